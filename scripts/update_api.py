@@ -355,6 +355,10 @@ def Z3_solver_propagate_fixed(ctx, s, fixed_eh, _elems = Elementaries(_lib.Z3_so
     _elems.f(ctx, s, fixed_eh)
     _elems.Check(ctx)
 
+def Z3_solver_propagate_fixed_batch(ctx, s, fixed_batch_eh, _elems = Elementaries(_lib.Z3_solver_propagate_fixed_batch)):
+    _elems.f(ctx, s, fixed_batch_eh)
+    _elems.Check(ctx)
+
 def Z3_solver_propagate_eq(ctx, s, eq_eh, _elems = Elementaries(_lib.Z3_solver_propagate_eq)):
     _elems.f(ctx, s, eq_eh)
     _elems.Check(ctx)
@@ -1387,6 +1391,7 @@ z3_ml_overrides = frozenset([
 z3_ml_callbacks = frozenset([
     'Z3_solver_propagate_init',
     'Z3_solver_propagate_fixed',
+    'Z3_solver_propagate_fixed_batch',
     'Z3_solver_propagate_final',
     'Z3_solver_propagate_eq',
     'Z3_solver_propagate_diseq',
@@ -1939,6 +1944,7 @@ Z3_pop_eh   = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_
 Z3_fresh_eh = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p)
 
 Z3_fixed_eh = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p)
+Z3_fixed_batch_eh = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_uint, ctypes.POINTER(ctypes.c_void_p), ctypes.POINTER(ctypes.c_void_p))
 Z3_final_eh = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p)
 Z3_eq_eh    = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p)
 
@@ -1949,6 +1955,7 @@ _lib.Z3_solver_register_on_clause.restype = None
 _lib.Z3_solver_propagate_init.restype = None
 _lib.Z3_solver_propagate_final.restype = None
 _lib.Z3_solver_propagate_fixed.restype = None
+_lib.Z3_solver_propagate_fixed_batch.restype = None
 _lib.Z3_solver_propagate_eq.restype = None
 _lib.Z3_solver_propagate_diseq.restype = None
 _lib.Z3_solver_propagate_decide.restype = None
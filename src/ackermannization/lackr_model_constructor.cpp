@@ -46,6 +46,8 @@ public:
     //
     // Returns true iff model was successfully constructed.
     // Conflicts are saved as a side effect.
+    // All conflicts of the abstract model are collected in one pass,
+    // so the caller can refine the abstraction with all of them at once.
     //
     bool check() {
         bool retv = true;
@@ -55,7 +57,7 @@ public:
             expr * const term  = _term ? _term : m.mk_const(c);
             if (!check_term(term)) retv = false;
         }
-        return retv;
+        return retv && m_conflicts.empty();
     }
     
     
@@ -122,6 +124,7 @@ private:
     ptr_vector<expr> m_stack;
     ackr_helper      m_ackr_helper;
     expr_mark        m_visited;
+    expr_mark        m_tainted;      // the value of the term depends on a conflicting term
     
     static inline val_info mk_val_info(expr* value, app* source_term) {
         val_info rv;
@@ -187,7 +190,7 @@ private:
         return m_app2val.find(a, val);
     }
     
-    bool evaluate(app * a, expr_ref& result) {
+    bool evaluate(app * a, expr_ref& result, bool& tainted) {
         SASSERT(!is_val(a));
         const unsigned num = a->get_num_args();
         if (num == 0) { // handle constants
@@ -211,13 +214,12 @@ private:
                   << " : " << mk_ismt2_pp(val, m, 2) << '\n'; );
             SASSERT(b);
             values[i] = val;
+            tainted |= m_tainted.is_marked(args[i]);
         }
         // handle functions
         if (m_ackr_helper.is_uninterp_fn(a)) { // handle uninterpreted
             app_ref key(m.mk_app(a->get_decl(), values.data()), m);
-            if (!make_value_uninterpreted_function(a, key.get(), result)) {
-                return false;
-            }
+            make_value_uninterpreted_function(a, key.get(), result, tainted);
         }
         else if (m_ackr_helper.is_select(a)) {
             // fail on select terms
@@ -238,8 +240,11 @@ private:
         TRACE("model_constructor", tout << "mk_value(\n" << mk_ismt2_pp(a, m, 2) << ")\n";);
         SASSERT(!m_app2val.contains(a));
         expr_ref result(m);
-        if (!evaluate(a, result))
+        bool tainted = false;
+        if (!evaluate(a, result, tainted))
             return false;
+        if (tainted)
+            m_tainted.mark(a, true);
         TRACE("model_constructor",
               tout << "map term(\n" << mk_ismt2_pp(a, m, 2) << "\n->"
               << mk_ismt2_pp(result.get(), m, 2)<< ")\n"; );
@@ -265,9 +270,16 @@ private:
         result = val;
     }
     
-    bool make_value_uninterpreted_function(app* a,
+    //
+    // A term that is congruent to an earlier term with a different value is a conflict.
+    // It takes the value of the earlier term, so the check continues past conflicts.
+    // Conflicts are only recorded when the arguments of the term have their values
+    // from the abstract model; those conflicts are violated by the abstract model.
+    //
+    void make_value_uninterpreted_function(app* a,
                                            app* key,
-                                           expr_ref& result) {
+                                           expr_ref& result,
+                                           bool& tainted) {
         // get ackermann constant
         app * const ac = m_info->get_abstr(a);
         func_decl * const a_fd = a->get_decl();
@@ -289,10 +301,11 @@ private:
                 TRACE("model_constructor",
                       tout << "already mapped by(\n" << mk_ismt2_pp(vi.source_term, m, 2) << "\n->"
                       << mk_ismt2_pp(vi.value, m, 2) << ")\n"; );
-                m_conflicts.push_back(std::make_pair(a, vi.source_term));
+                if (!tainted)
+                    m_conflicts.push_back(std::make_pair(a, vi.source_term));
+                tainted = true;
             }
             result = vi.value;
-            return ok;
         } 
         else {                        // new value
             result = value;
@@ -302,10 +315,7 @@ private:
             m_pinned.push_back(vi.source_term);
             m_pinned.push_back(vi.value);
             m_pinned.push_back(key);
-            return true;
         }
-        UNREACHABLE();
-        return true;
     }
     
     void make_value_interpreted_function(app* a,
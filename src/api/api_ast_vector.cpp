@@ -21,6 +21,8 @@ Revision History:
 #include "api/api_ast_vector.h"
 #include "ast/ast_translation.h"
 #include "ast/ast_smt2_pp.h"
+#include "ast/ast_binary.h"
+#include <fstream>
 
 extern "C" {
 
@@ -135,4 +137,42 @@ extern "C" {
         Z3_CATCH_RETURN(nullptr);
     }
 
+    void Z3_API Z3_ast_vector_serialize(Z3_context c, Z3_ast_vector v, Z3_string file_name) {
+        Z3_TRY;
+        LOG_Z3_ast_vector_serialize(c, v, file_name);
+        RESET_ERROR_CODE();
+        std::ofstream out(file_name, std::ios::binary);
+        if (!out) {
+            SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
+            return;
+        }
+        ast_ref_vector const& asts = to_ast_vector_ref(v);
+        ast_to_binary(mk_c(c)->m(), asts.size(), asts.data(), out);
+        if (!out)
+            SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
+        Z3_CATCH;
+    }
+
+    Z3_ast_vector Z3_API Z3_ast_vector_deserialize(Z3_context c, Z3_string file_name) {
+        Z3_TRY;
+        LOG_Z3_ast_vector_deserialize(c, file_name);
+        RESET_ERROR_CODE();
+        std::ifstream in(file_name, std::ios::binary);
+        if (!in) {
+            SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
+            RETURN_Z3(nullptr);
+        }
+        Z3_ast_vector_ref * v = alloc(Z3_ast_vector_ref, *mk_c(c), mk_c(c)->m());
+        mk_c(c)->save_object(v);
+        try {
+            ast_from_binary(mk_c(c)->m(), in, v->m_ast_vector);
+        }
+        catch (z3_exception& ex) {
+            v->m_ast_vector.reset();
+            SET_ERROR_CODE(Z3_PARSER_ERROR, ex.msg());
+        }
+        RETURN_Z3(of_ast_vector(v));
+        Z3_CATCH_RETURN(nullptr);
+    }
+
 };
@@ -151,8 +151,14 @@ namespace api {
 	    m_char_fid   = m().mk_family_id("char");
         m_special_relations_fid   = m().mk_family_id("specrels");
         m_dt_plugin = static_cast<datatype_decl_plugin*>(m().get_plugin(m_dt_fid));
-    
-        install_tactics(*this);
+    }
+
+    tactic_manager& context::tactics() {
+        if (!m_tactics_installed) {
+            m_tactics_installed = true;
+            install_tactics(*this);
+        }
+        return *this;
     }
 
 
@@ -405,6 +411,7 @@ extern "C" {
         LOG_Z3_del_context(c);
         RESET_ERROR_CODE();
         dealloc(mk_c(c));
+        memory::trim();
         Z3_CATCH;
     }
 
@@ -87,6 +87,7 @@ namespace api {
         scoped_ptr<cmd_context>    m_cmd;
         add_plugins                m_plugins;
         mutex                      m_mux;
+        bool                       m_tactics_installed = false;
 
         arith_util                 m_arith_util;
         bv_util                    m_bv_util;
@@ -194,6 +195,9 @@ namespace api {
         void dec_ref(ast* a);
         void flush_objects();
 
+        // The tactic, probe and simplifier tables are only built when first used.
+        tactic_manager& tactics();
+
         Z3_ast_print_mode get_print_mode() const { return m_print_mode; }
         void set_print_mode(Z3_ast_print_mode m) { m_print_mode = m; }
 
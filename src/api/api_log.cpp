@@ -73,12 +73,12 @@ std::ostream & operator<<(std::ostream & out, ll_escaped const & d) {
 }
 }
 
-void R()              { *g_z3_log << 'R' << std::endl; }
-void P(void * obj)    { *g_z3_log << "P " << obj <<std::endl; }
-void I(int64_t i)     { *g_z3_log << "I " << i << std::endl; }
-void U(uint64_t u)    { *g_z3_log << "U " << u << std::endl; }
-void D(double d)      { *g_z3_log << "D " << d << std::endl; }
-void S(Z3_string str) { *g_z3_log << "S \"" << ll_escaped{str} << '"' << std::endl; }
+void R()              { *g_z3_log << 'R' << '\n'; }
+void P(void * obj)    { *g_z3_log << "P " << obj << '\n'; }
+void I(int64_t i)     { *g_z3_log << "I " << i << '\n'; }
+void U(uint64_t u)    { *g_z3_log << "U " << u << '\n'; }
+void D(double d)      { *g_z3_log << "D " << d << '\n'; }
+void S(Z3_string str) { *g_z3_log << "S \"" << ll_escaped{str} << "\"\n"; }
 void Sy(Z3_symbol sym) {
     symbol s = symbol::c_api_ext2symbol(sym);
     if (s.is_null()) {
@@ -90,12 +90,13 @@ void Sy(Z3_symbol sym) {
     else {
         *g_z3_log << "$ |" << ll_escaped{s.str().c_str()} << '|';
     }
-    *g_z3_log << std::endl;
+    *g_z3_log << '\n';
 }
-void Ap(unsigned sz)  { *g_z3_log << "p " << sz << std::endl; }
-void Au(unsigned sz)  { *g_z3_log << "u " << sz << std::endl; }
-void Ai(unsigned sz)  { *g_z3_log << "i " << sz << std::endl; }
-void Asy(unsigned sz) { *g_z3_log << "s " << sz << std::endl; }
+void Ap(unsigned sz)  { *g_z3_log << "p " << sz << '\n'; }
+void Au(unsigned sz)  { *g_z3_log << "u " << sz << '\n'; }
+void Ai(unsigned sz)  { *g_z3_log << "i " << sz << '\n'; }
+void Asy(unsigned sz) { *g_z3_log << "s " << sz << '\n'; }
+// the log is flushed once per API call, after the command is written.
 void C(unsigned id)   { *g_z3_log << "C " << id << std::endl; }
 static void _Z3_append_log(char const * msg) { *g_z3_log << "M \"" << ll_escaped{msg} << '"' << std::endl; }
 
@@ -157,7 +157,7 @@ extern "C" {
         RESET_ERROR_CODE();
         CHECK_NON_NULL(m, false);
         CHECK_IS_EXPR(t, false);
-        model * _m = to_model_ref(m);
+        model * _m = to_model_eval_ref(m);
         params_ref p;
         ast_manager& mgr = mk_c(c)->m();
         if (!_m->has_solver()) {
@@ -172,6 +172,62 @@ extern "C" {
         Z3_CATCH_RETURN(false);
     }
 
+    bool Z3_API Z3_model_eval_words(Z3_context c, Z3_model m, unsigned num_terms, Z3_ast const terms[], bool model_completion, unsigned num_words, unsigned words[]) {
+        Z3_TRY;
+        LOG_Z3_model_eval_words(c, m, num_terms, terms, model_completion, num_words, words);
+        RESET_ERROR_CODE();
+        CHECK_NON_NULL(m, false);
+        if (num_terms == 0)
+            return true;
+        if (num_words % num_terms != 0) {
+            SET_ERROR_CODE(Z3_INVALID_ARG, "number of words is not a multiple of the number of terms");
+            return false;
+        }
+        for (unsigned i = 0; i < num_terms; ++i) {
+            CHECK_IS_EXPR(terms[i], false);
+        }
+        model * _m = to_model_eval_ref(m);
+        ast_manager& mgr = mk_c(c)->m();
+        if (!_m->has_solver()) {
+            params_ref p;
+            _m->set_solver(alloc(api::seq_expr_solver, mgr, p));
+        }
+        unsigned stride = num_words / num_terms;
+        model::scoped_model_completion _scm(*_m, model_completion);
+        expr_ref val(mgr);
+        rational r, q;
+        rational base = rational::power_of_two(32);
+        unsigned bv_size;
+        for (unsigned i = 0; i < num_terms; ++i) {
+            val = (*_m)(to_expr(terms[i]));
+            if (mgr.is_true(val))
+                r = rational::one();
+            else if (mgr.is_false(val))
+                r = rational::zero();
+            else if (!mk_c(c)->bvutil().is_numeral(val, r, bv_size) && 
+                     !(mk_c(c)->autil().is_numeral(val, r) && r.is_int() && !r.is_neg()))
+                return false;
+            unsigned* out = words + i * stride;
+            if (r.is_uint64()) {
+                uint64_t v = r.get_uint64();
+                for (unsigned j = 0; j < stride; ++j, v >>= 32)
+                    out[j] = static_cast<unsigned>(v);
+                if (v != 0)
+                    return false;
+                continue;
+            }
+            for (unsigned j = 0; j < stride; ++j) {
+                q = div(r, base);
+                out[j] = (r - q * base).get_unsigned();
+                r = q;
+            }
+            if (!r.is_zero())
+                return false;
+        }
+        return true;
+        Z3_CATCH_RETURN(false);
+    }
+
     unsigned Z3_API Z3_model_get_num_sorts(Z3_context c, Z3_model m) {
         Z3_TRY;
         LOG_Z3_model_get_num_sorts(c, m);
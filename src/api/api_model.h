@@ -22,12 +22,22 @@ Revision History:
 
 struct Z3_model_ref : public api::object {
     model_ref  m_model;
+    bool       m_compress = false; // m_model is compressed when it is first inspected
     Z3_model_ref(api::context& c): api::object(c) {}
 };
 
 inline Z3_model_ref * to_model(Z3_model s) { return reinterpret_cast<Z3_model_ref *>(s); }
 inline Z3_model of_model(Z3_model_ref * s) { return reinterpret_cast<Z3_model>(s); }
-inline model * to_model_ref(Z3_model s) { return to_model(s)->m_model.get(); }
+inline model * to_model_ref(Z3_model s) { 
+    Z3_model_ref * r = to_model(s);
+    if (r->m_compress) {
+        r->m_compress = false;
+        r->m_model->compress();
+    }
+    return r->m_model.get(); 
+}
+// evaluation does not depend on whether the model is compressed.
+inline model * to_model_eval_ref(Z3_model s) { return to_model(s)->m_model.get(); }
 
 struct Z3_func_interp_ref : public api::object {
     model_ref     m_model; // must have it to prevent reference to m_func_interp to be killed.
@@ -213,8 +213,8 @@ extern "C" {
         Z3_model_ref * m_ref = alloc(Z3_model_ref, *mk_c(c)); 
         if (_m) {
             model_params mp(to_optimize_ptr(o)->get_params());
-            if (mp.compact()) _m->compress();
             m_ref->m_model = _m;
+            m_ref->m_compress = mp.compact();
         }
         else {
             m_ref->m_model = alloc(model, mk_c(c)->m());
@@ -21,8 +21,11 @@ Revision History:
 #include "util/cancel_eh.h"
 #include "util/file_path.h"
 #include "util/scoped_timer.h"
+#include "util/worker_pool.h"
 #include "util/file_path.h"
 #include "ast/ast_pp.h"
+#include "ast/ast_binary.h"
+#include "ast/ast_util.h"
 #include "api/z3.h"
 #include "api/api_log_macros.h"
 #include "api/api_context.h"
@@ -126,6 +129,38 @@ extern "C" {
         m_eh = eh;
     }
 
+    void solver_progress::start() {
+        m_count = 0;
+        m_next = 0;
+        m_watch.reset();
+        m_watch.start();
+    }
+
+    void solver_progress::publish() {
+        statistics st;
+        m_owner.m_solver->collect_statistics(st);
+        get_memory_statistics(st);
+        lock_guard lock(m_mux);
+        m_snapshot.reset();
+        m_snapshot.copy(st);
+    }
+
+    void solver_progress::fast_progress_sample() {
+        // look at the clock only every 256 samples and publish at most every 100ms.
+        if ((++m_count & 0xFF) != 0) 
+            return;
+        double now = m_watch.get_seconds();
+        if (now < m_next)
+            return;
+        m_next = now + 0.1;
+        publish();
+    }
+
+    void solver_async_check::wait() {
+        std::unique_lock<std::mutex> lock(m_mux);
+        m_cv.wait(lock, [&]() { return !m_running; });
+    }
+
     void Z3_solver_ref::set_cancel() {
         lock_guard lock(m_mux);
         if (m_eh) (*m_eh)(API_INTERRUPT_EH_CALLER);
@@ -332,7 +367,7 @@ extern "C" {
         ast_manager& m = to_solver_ref(s)->get_manager();
         std::stringstream err;
         sat::solver solver(to_solver_ref(s)->get_params(), m.limit());
-        if (!parse_dimacs(is, err, solver)) {
+        if (!parse_dimacs(is, err, solver, 1)) {
             SET_ERROR_CODE(Z3_PARSER_ERROR, std::move(err).str());
             return;
         }
@@ -368,15 +403,39 @@ extern "C" {
         Z3_CATCH;        
     }
 
+    static void solver_from_binary_stream(Z3_context c, Z3_solver s, std::istream& is) {
+        ast_manager& m = mk_c(c)->m();
+        ast_ref_vector fmls(m);
+        try {
+            ast_from_binary(m, is, fmls);
+        }
+        catch (z3_exception& ex) {
+            SET_ERROR_CODE(Z3_PARSER_ERROR, ex.msg());
+            return;
+        }
+        for (ast* f : fmls) {
+            if (!is_expr(f) || !m.is_bool(to_expr(f))) {
+                SET_ERROR_CODE(Z3_PARSER_ERROR, "checkpoint contains a non-Boolean term");
+                return;
+            }
+        }
+        for (ast* f : fmls)
+            to_solver_ref(s)->assert_expr(to_expr(f));
+    }
+
     void Z3_API Z3_solver_from_file(Z3_context c, Z3_solver s, Z3_string file_name) {
         Z3_TRY;
         LOG_Z3_solver_from_file(c, s, file_name);
         char const* ext = get_extension(file_name);
-        std::ifstream is(file_name);
+        bool binary = ext && std::string("z3ab") == ext;
+        std::ifstream is(file_name, binary ? std::ios::in | std::ios::binary : std::ios::in);
         init_solver(c, s);
         if (!is) {
             SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
         }
+        else if (binary) {
+            solver_from_binary_stream(c, s, is);
+        }
         else if (ext && (std::string("dimacs") == ext || std::string("cnf") == ext)) {
             solver_from_dimacs_stream(c, s, is);
         }
@@ -509,6 +568,8 @@ extern "C" {
         RESET_ERROR_CODE();
         to_solver(s)->m_solver = nullptr;
         if (to_solver(s)->m_pp) to_solver(s)->m_pp->reset();
+        mk_c(c)->m().compact_memory();
+        memory::trim();
         Z3_CATCH;
     }
     
@@ -531,6 +592,23 @@ extern "C" {
         Z3_CATCH;
     }
 
+    void Z3_API Z3_solver_assert_vector(Z3_context c, Z3_solver s, Z3_ast_vector v) {
+        Z3_TRY;
+        LOG_Z3_solver_assert_vector(c, s, v);
+        RESET_ERROR_CODE();
+        init_solver(c, s);
+        ast_ref_vector const& fmls = to_ast_vector_ref(v);
+        for (ast* a : fmls) {
+            if (!is_expr(a) || !mk_c(c)->m().is_bool(to_expr(a))) {
+                SET_ERROR_CODE(Z3_INVALID_ARG, "Boolean expression expected");
+                return;
+            }
+        }
+        for (ast* a : fmls)
+            to_solver(s)->assert_expr(to_expr(a));
+        Z3_CATCH;
+    }
+
     void Z3_API Z3_solver_assert_and_track(Z3_context c, Z3_solver s, Z3_ast a, Z3_ast p) {
         Z3_TRY;
         LOG_Z3_solver_assert_and_track(c, s, a, p);
@@ -627,7 +705,7 @@ extern "C" {
         Z3_CATCH_RETURN(nullptr);
     }
 
-    static Z3_lbool _solver_check(Z3_context c, Z3_solver s, unsigned num_assumptions, Z3_ast const assumptions[]) {
+    static Z3_lbool _solver_check(Z3_context c, Z3_solver s, unsigned num_assumptions, Z3_ast const assumptions[], bool async = false) {
         for (unsigned i = 0; i < num_assumptions; i++) {
             if (!is_expr(to_ast(assumptions[i]))) {
                 SET_ERROR_CODE(Z3_INVALID_ARG, "assumption is not an expression");
@@ -635,16 +713,22 @@ extern "C" {
             }
         }
         expr * const * _assumptions = to_exprs(num_assumptions, assumptions);
+        // free terms whose deletion was deferred by the delete_budget option
+        mk_c(c)->m().delete_pending_nodes();
         solver_params sp(to_solver(s)->m_params);
         unsigned timeout     = mk_c(c)->get_timeout();
         timeout              = to_solver(s)->m_params.get_uint("timeout", timeout);
         timeout              = sp.timeout() != UINT_MAX ? sp.timeout() : timeout;
         unsigned rlimit      = to_solver(s)->m_params.get_uint("rlimit", mk_c(c)->get_rlimit());
-        bool     use_ctrl_c  = to_solver(s)->m_params.get_bool("ctrl_c", true);
+        // signal handlers are process wide, checks on worker threads do not install them.
+        bool     use_ctrl_c  = !async && to_solver(s)->m_params.get_bool("ctrl_c", true);
         cancel_eh<reslimit> eh(mk_c(c)->m().limit());
         to_solver(s)->set_eh(&eh);
         api::context::set_interruptable si(*(mk_c(c)), eh);
         lbool result = l_undef;
+        solver_progress& progress = to_solver(s)->m_progress;
+        progress.start();
+        to_solver_ref(s)->set_progress_callback(&progress);
         {
             scoped_ctrl_c ctrlc(eh, false, use_ctrl_c);
             scoped_timer timer(timeout, &eh);
@@ -656,6 +740,7 @@ extern "C" {
             catch (z3_exception & ex) {
                 to_solver_ref(s)->set_reason_unknown(eh);
                 to_solver(s)->set_eh(nullptr);
+                to_solver_ref(s)->set_progress_callback(nullptr);
                 if (mk_c(c)->m().inc()) {
                     mk_c(c)->handle_exception(ex);
                 }
@@ -664,10 +749,13 @@ extern "C" {
             catch (...) {
                 to_solver_ref(s)->set_reason_unknown(eh);
                 to_solver(s)->set_eh(nullptr);
+                to_solver_ref(s)->set_progress_callback(nullptr);
                 return Z3_L_UNDEF;
             }
         }
         to_solver(s)->set_eh(nullptr);
+        to_solver_ref(s)->set_progress_callback(nullptr);
+        progress.publish();
         if (result == l_undef) {
             to_solver_ref(s)->set_reason_unknown(eh);
         }
@@ -692,6 +780,110 @@ extern "C" {
         Z3_CATCH_RETURN(Z3_L_UNDEF);
     }
     
+    void Z3_API Z3_solver_check_async(Z3_context c, Z3_solver s, unsigned num_assumptions, Z3_ast const assumptions[]) {
+        Z3_TRY;
+        LOG_Z3_solver_check_async(c, s, num_assumptions, assumptions);
+        RESET_ERROR_CODE();
+        init_solver(c, s);
+        solver_async_check& a = to_solver(s)->m_async;
+        {
+            std::lock_guard<std::mutex> lock(a.m_mux);
+            if (a.m_running) {
+                SET_ERROR_CODE(Z3_INVALID_USAGE, "a check is already running on the solver");
+                return;
+            }
+        }
+        for (unsigned i = 0; i < num_assumptions; i++) {
+            if (!is_expr(to_ast(assumptions[i]))) {
+                SET_ERROR_CODE(Z3_INVALID_ARG, "assumption is not an expression");
+                return;
+            }
+        }
+        a.m_assumptions.reset();
+        a.m_assumptions.append(num_assumptions, to_exprs(num_assumptions, assumptions));
+        a.m_result = Z3_L_UNDEF;
+        a.m_running = true;
+        worker_pool::submit([c, s]() {
+            solver_async_check& a = to_solver(s)->m_async;
+            Z3_lbool r = Z3_L_UNDEF;
+            try {
+                r = _solver_check(c, s, a.m_assumptions.size(), reinterpret_cast<Z3_ast const*>(a.m_assumptions.data()), true);
+            }
+            catch (...) {
+                r = Z3_L_UNDEF;
+            }
+            std::lock_guard<std::mutex> lock(a.m_mux);
+            a.m_result = r;
+            a.m_running = false;
+            a.m_cv.notify_all();
+        });
+        Z3_CATCH;
+    }
+
+    bool Z3_API Z3_solver_check_async_done(Z3_context c, Z3_solver s) {
+        // safe to call while the check runs: this does not log or touch the error code.
+        solver_async_check& a = to_solver(s)->m_async;
+        std::lock_guard<std::mutex> lock(a.m_mux);
+        return !a.m_running;
+    }
+
+    Z3_lbool Z3_API Z3_solver_check_async_wait(Z3_context c, Z3_solver s) {
+        Z3_TRY;
+        LOG_Z3_solver_check_async_wait(c, s);
+        solver_async_check& a = to_solver(s)->m_async;
+        a.wait();
+        return a.m_result;
+        Z3_CATCH_RETURN(Z3_L_UNDEF);
+    }
+
+    Z3_lbool Z3_API Z3_solver_enumerate_mus(Z3_context c, Z3_solver s, Z3_ast_vector soft, Z3_ast_vector result) {
+        Z3_TRY;
+        LOG_Z3_solver_enumerate_mus(c, s, soft, result);
+        RESET_ERROR_CODE();
+        init_solver(c, s);
+        ast_manager& m = mk_c(c)->m();
+        expr_ref_vector _soft(m);
+        for (ast* a : to_ast_vector_ref(soft)) {
+            if (!is_expr(a) || !m.is_bool(to_expr(a)) || !is_literal(m, to_expr(a))) {
+                SET_ERROR_CODE(Z3_INVALID_ARG, "soft constraints must be Boolean literals");
+                return Z3_L_UNDEF;
+            }
+            _soft.push_back(to_expr(a));
+        }
+        scoped_ptr<mus_enumerator>& e = to_solver(s)->m_mus_enum;
+        if (!e || e->soft() != _soft) {
+            solver* map = mk_smt_solver(m, params_ref(), symbol("QF_UF"));
+            e = alloc(mus_enumerator, *to_solver_ref(s), map, _soft);
+        }
+        expr_ref_vector _result(m);
+        lbool r = l_undef;
+        unsigned timeout     = to_solver(s)->m_params.get_uint("timeout", mk_c(c)->get_timeout());
+        unsigned rlimit      = to_solver(s)->m_params.get_uint("rlimit", mk_c(c)->get_rlimit());
+        bool     use_ctrl_c  = to_solver(s)->m_params.get_bool("ctrl_c", true);
+        cancel_eh<reslimit> eh(m.limit());
+        to_solver(s)->set_eh(&eh);
+        api::context::set_interruptable si(*(mk_c(c)), eh);
+        {
+            scoped_ctrl_c ctrlc(eh, false, use_ctrl_c);
+            scoped_timer timer(timeout, &eh);
+            scoped_rlimit _rlimit(m.limit(), rlimit);
+            try {
+                r = e->next(_result);
+            }
+            catch (z3_exception & ex) {
+                to_solver(s)->set_eh(nullptr);
+                mk_c(c)->handle_exception(ex);
+                return Z3_L_UNDEF;
+            }
+        }
+        to_solver(s)->set_eh(nullptr);
+        to_ast_vector_ref(result).reset();
+        for (expr* t : _result)
+            to_ast_vector_ref(result).push_back(t);
+        return of_lbool(r);
+        Z3_CATCH_RETURN(Z3_L_UNDEF);
+    }
+
     Z3_model Z3_API Z3_solver_get_model(Z3_context c, Z3_solver s) {
         Z3_TRY;
         LOG_Z3_solver_get_model(c, s);
@@ -703,12 +895,10 @@ extern "C" {
             SET_ERROR_CODE(Z3_INVALID_USAGE, "there is no current model");
             RETURN_Z3(nullptr);
         }
-        if (_m) {
-            model_params mp(to_solver_ref(s)->get_params());
-            if (mp.compact()) _m->compress();
-        }
+        model_params mp(to_solver_ref(s)->get_params());
         Z3_model_ref * m_ref = alloc(Z3_model_ref, *mk_c(c)); 
         m_ref->m_model = _m;
+        m_ref->m_compress = mp.compact();
         mk_c(c)->save_object(m_ref);
         RETURN_Z3(of_model(m_ref));
         Z3_CATCH_RETURN(nullptr);
@@ -792,6 +982,20 @@ extern "C" {
         Z3_CATCH_RETURN(nullptr);
     }
 
+    Z3_stats Z3_API Z3_solver_get_statistics_snapshot(Z3_context c, Z3_solver s) {
+        // called concurrently with a running check, so it neither logs nor resets the error code.
+        Z3_TRY;
+        Z3_stats_ref * st = alloc(Z3_stats_ref, *mk_c(c));
+        {
+            solver_progress& progress = to_solver(s)->m_progress;
+            lock_guard lock(progress.m_mux);
+            st->m_stats.copy(progress.m_snapshot);
+        }
+        mk_c(c)->save_object(st);
+        return of_stats(st);
+        Z3_CATCH_RETURN(nullptr);
+    }
+
     Z3_string Z3_API Z3_solver_to_string(Z3_context c, Z3_solver s) {
         Z3_TRY;
         LOG_Z3_solver_to_string(c, s);
@@ -814,6 +1018,28 @@ extern "C" {
         Z3_CATCH_RETURN("");
     }
 
+    void Z3_API Z3_solver_to_file(Z3_context c, Z3_solver s, Z3_string file_name) {
+        Z3_TRY;
+        LOG_Z3_solver_to_file(c, s, file_name);
+        RESET_ERROR_CODE();
+        init_solver(c, s);
+        std::ofstream out(file_name, std::ios::out | std::ios::binary);
+        if (!out) {
+            SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
+            return;
+        }
+        solver& sv = *to_solver_ref(s);
+        expr_ref_vector fmls(mk_c(c)->m());
+        sv.get_assertions(fmls);
+        // learned units are only implied by the assertions outside of user scopes.
+        if (sv.get_scope_level() == 0)
+            fmls.append(sv.get_units());
+        ast_to_binary(mk_c(c)->m(), fmls.size(), reinterpret_cast<ast* const*>(fmls.data()), out);
+        if (!out)
+            SET_ERROR_CODE(Z3_FILE_ACCESS_ERROR, nullptr);
+        Z3_CATCH;
+    }
+
 
     Z3_lbool Z3_API Z3_get_implied_equalities(Z3_context c, 
                                               Z3_solver s,
@@ -1043,6 +1269,17 @@ extern "C" {
         Z3_CATCH;        
     }
 
+    void Z3_API Z3_solver_propagate_fixed_batch(
+        Z3_context  c, 
+        Z3_solver   s,
+        Z3_fixed_batch_eh fixed_batch_eh) {
+        Z3_TRY;
+        RESET_ERROR_CODE();
+        user_propagator::fixed_batch_eh_t _fixed = (void(*)(void*,user_propagator::callback*,unsigned,expr* const*,expr* const*))fixed_batch_eh;
+        to_solver_ref(s)->user_propagate_register_fixed_batch(_fixed);
+        Z3_CATCH;        
+    }
+
     void Z3_API Z3_solver_propagate_final(
         Z3_context  c, 
         Z3_solver   s,
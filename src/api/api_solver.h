@@ -18,8 +18,13 @@ Revision History:
 #pragma once
 
 #include "util/mutex.h"
+#include "util/stopwatch.h"
 #include "api/api_util.h"
 #include "solver/solver.h"
+#include "solver/progress_callback.h"
+#include "solver/mus_enum.h"
+#include <condition_variable>
+#include <mutex>
 
 struct solver2smt2_pp {
     ast_pp_util     m_pp_util;
@@ -38,6 +43,34 @@ struct solver2smt2_pp {
 
 };
 
+struct Z3_solver_ref;
+
+// statistics published periodically by the thread running check-sat,
+// to be read from other threads.
+struct solver_progress : public progress_callback {
+    Z3_solver_ref& m_owner;
+    mutex          m_mux;
+    statistics     m_snapshot;
+    stopwatch      m_watch;
+    double         m_next = 0;
+    unsigned       m_count = 0;
+    solver_progress(Z3_solver_ref& s): m_owner(s) {}
+    void start();
+    void publish();
+    void fast_progress_sample() override;
+};
+
+// a check-sat submitted by Z3_solver_check_async.
+struct solver_async_check {
+    std::mutex              m_mux;
+    std::condition_variable m_cv;
+    bool                    m_running = false;
+    Z3_lbool                m_result = Z3_L_UNDEF;
+    expr_ref_vector         m_assumptions;
+    solver_async_check(ast_manager& m): m_assumptions(m) {}
+    void wait();
+};
+
 struct Z3_solver_ref : public api::object {
     scoped_ptr<solver_factory> m_solver_factory;
     ref<solver>                m_solver;
@@ -48,12 +81,17 @@ struct Z3_solver_ref : public api::object {
     scoped_ptr<cmd_context>    m_cmd_context;
     mutex                      m_mux;
     event_handler*             m_eh;
+    solver_progress            m_progress;
+    solver_async_check         m_async;
+    scoped_ptr<mus_enumerator> m_mus_enum;
 
     Z3_solver_ref(api::context& c, solver_factory * f): 
-        api::object(c), m_solver_factory(f), m_solver(nullptr), m_logic(symbol::null), m_eh(nullptr) {}
+        api::object(c), m_solver_factory(f), m_solver(nullptr), m_logic(symbol::null), m_eh(nullptr), m_progress(*this), m_async(c.m()) {}
 
     Z3_solver_ref(api::context& c, solver * s): 
-        api::object(c), m_solver_factory(nullptr), m_solver(s), m_logic(symbol::null), m_eh(nullptr) {}
+        api::object(c), m_solver_factory(nullptr), m_solver(s), m_logic(symbol::null), m_eh(nullptr), m_progress(*this), m_async(c.m()) {}
+
+    ~Z3_solver_ref() override { m_async.wait(); }
 
     void assert_expr(expr* e);
     void assert_expr(expr* e, expr* t);
@@ -19,6 +19,7 @@ Revision History:
 #include "api/api_log_macros.h"
 #include "api/api_context.h"
 #include "api/api_stats.h"
+#include "util/small_object_allocator.h"
 
 extern "C" {
 
@@ -133,4 +134,15 @@ extern "C" {
         return memory::get_allocation_size();
     }
 
+    Z3_string Z3_API Z3_get_memory_breakdown(Z3_context c) {
+        Z3_TRY;
+        LOG_Z3_get_memory_breakdown(c);
+        RESET_ERROR_CODE();
+        std::ostringstream buffer;
+        buffer << "(:total " << memory::get_allocation_size();
+        small_object_allocator::display_usage(buffer) << ")";
+        return mk_c(c)->mk_external_string(std::move(buffer).str());
+        Z3_CATCH_RETURN("");
+    }
+
 };
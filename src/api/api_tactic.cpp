@@ -59,7 +59,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_mk_tactic(c, name);
         RESET_ERROR_CODE();
-        tactic_cmd * t = mk_c(c)->find_tactic_cmd(symbol(name));
+        tactic_cmd * t = mk_c(c)->tactics().find_tactic_cmd(symbol(name));
         if (t == nullptr) {
             std::stringstream err;
             err << "unknown tactic " << name;
@@ -91,7 +91,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_mk_probe(c, name);
         RESET_ERROR_CODE();
-        probe_info * p = mk_c(c)->find_probe(symbol(name));
+        probe_info * p = mk_c(c)->tactics().find_probe(symbol(name));
         if (p == nullptr) {
             SET_ERROR_CODE(Z3_INVALID_ARG, nullptr);
             RETURN_Z3(nullptr);
@@ -327,7 +327,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_num_tactics(c);
         RESET_ERROR_CODE();
-        return mk_c(c)->num_tactics();
+        return mk_c(c)->tactics().num_tactics();
         Z3_CATCH_RETURN(0);
     }
 
@@ -335,11 +335,11 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_tactic_name(c, idx);
         RESET_ERROR_CODE();
-        if (idx >= mk_c(c)->num_tactics()) {
+        if (idx >= mk_c(c)->tactics().num_tactics()) {
             SET_ERROR_CODE(Z3_IOB, nullptr);
             return "";
         }        
-        return mk_c(c)->mk_external_string(mk_c(c)->get_tactic(idx)->get_name().str().c_str());
+        return mk_c(c)->mk_external_string(mk_c(c)->tactics().get_tactic(idx)->get_name().str().c_str());
         Z3_CATCH_RETURN("");
     }
 
@@ -347,7 +347,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_num_probes(c);
         RESET_ERROR_CODE();
-        return mk_c(c)->num_probes();
+        return mk_c(c)->tactics().num_probes();
         Z3_CATCH_RETURN(0);
     }
 
@@ -355,11 +355,11 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_probe_name(c, idx);
         RESET_ERROR_CODE();
-        if (idx >= mk_c(c)->num_probes()) {
+        if (idx >= mk_c(c)->tactics().num_probes()) {
             SET_ERROR_CODE(Z3_IOB, nullptr);
             return "";
         }
-        return mk_c(c)->mk_external_string(mk_c(c)->get_probe(idx)->get_name().str().c_str());
+        return mk_c(c)->mk_external_string(mk_c(c)->tactics().get_probe(idx)->get_name().str().c_str());
         Z3_CATCH_RETURN("");
     }
 
@@ -391,7 +391,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_tactic_get_descr(c, name);
         RESET_ERROR_CODE();
-        tactic_cmd * t = mk_c(c)->find_tactic_cmd(symbol(name));
+        tactic_cmd * t = mk_c(c)->tactics().find_tactic_cmd(symbol(name));
         if (t == nullptr) {
             SET_ERROR_CODE(Z3_INVALID_ARG, nullptr);
             return "";
@@ -404,7 +404,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_probe_get_descr(c, name);
         RESET_ERROR_CODE();
-        probe_info * p = mk_c(c)->find_probe(symbol(name));
+        probe_info * p = mk_c(c)->tactics().find_probe(symbol(name));
         if (p == nullptr) {
             SET_ERROR_CODE(Z3_INVALID_ARG, nullptr);
             return "";
@@ -534,7 +534,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_mk_simplifier(c, name);
         RESET_ERROR_CODE();
-        simplifier_cmd * t = mk_c(c)->find_simplifier_cmd(symbol(name));
+        simplifier_cmd * t = mk_c(c)->tactics().find_simplifier_cmd(symbol(name));
         if (t == nullptr) {
             std::stringstream err;
             err << "unknown simplifier " << name;
@@ -566,7 +566,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_num_simplifiers(c);
         RESET_ERROR_CODE();
-        return mk_c(c)->num_simplifiers();
+        return mk_c(c)->tactics().num_simplifiers();
         Z3_CATCH_RETURN(0);
     }
 
@@ -574,11 +574,11 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_get_simplifier_name(c, idx);
         RESET_ERROR_CODE();
-        if (idx >= mk_c(c)->num_simplifiers()) {
+        if (idx >= mk_c(c)->tactics().num_simplifiers()) {
             SET_ERROR_CODE(Z3_IOB, nullptr);
             return "";
         }        
-        return mk_c(c)->mk_external_string(mk_c(c)->get_simplifier(idx)->get_name().str().c_str());
+        return mk_c(c)->mk_external_string(mk_c(c)->tactics().get_simplifier(idx)->get_name().str().c_str());
         Z3_CATCH_RETURN("");
     }
 
@@ -658,7 +658,7 @@ extern "C" {
         Z3_TRY;
         LOG_Z3_simplifier_get_descr(c, name);
         RESET_ERROR_CODE();
-        simplifier_cmd * t = mk_c(c)->find_simplifier_cmd(symbol(name));
+        simplifier_cmd * t = mk_c(c)->tactics().find_simplifier_cmd(symbol(name));
         if (t == nullptr) {
             SET_ERROR_CODE(Z3_INVALID_ARG, nullptr);
             return "";
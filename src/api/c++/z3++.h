@@ -2785,8 +2785,8 @@ namespace z3 {
         }        
         void add(expr_vector const& v) { 
             check_context(*this, v); 
-            for (unsigned i = 0; i < v.size(); ++i) 
-                add(v[i]); 
+            Z3_solver_assert_vector(ctx(), m_solver, v);
+            check_error();
         }
         void from_file(char const* file) { Z3_solver_from_file(ctx(), m_solver, file); ctx().check_parser_error(); }
         void from_string(char const* s) { Z3_solver_from_string(ctx(), m_solver, s); ctx().check_parser_error(); }
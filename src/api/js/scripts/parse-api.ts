@@ -52,6 +52,7 @@ const types = {
   Z3_pop_eh: 'Z3_pop_eh',
   Z3_fresh_eh: 'Z3_fresh_eh',
   Z3_fixed_eh: 'Z3_fixed_eh',
+  Z3_fixed_batch_eh: 'Z3_fixed_batch_eh',
   Z3_eq_eh: 'Z3_eq_eh',
   Z3_final_eh: 'Z3_final_eh',
   Z3_created_eh: 'Z3_created_eh',
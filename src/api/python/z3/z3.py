@@ -1217,7 +1217,25 @@ def _coerce_expr_merge(s, a):
         return s
 
 
+def _same_sort_exprs(args):
+    """Return `True` if `args` are expressions of the same context and sort.
+    Sorts are hash-consed, so it suffices to compare the sort pointers."""
+    a = args[0]
+    if not isinstance(a, ExprRef):
+        return False
+    ctx = a.ctx
+    ref = ctx.ref()
+    s = Z3_get_sort(ref, a.as_ast()).value
+    for i in range(1, len(args)):
+        b = args[i]
+        if not isinstance(b, ExprRef) or b.ctx is not ctx or Z3_get_sort(ref, b.as_ast()).value != s:
+            return False
+    return True
+
+
 def _coerce_exprs(a, b, ctx=None):
+    if isinstance(a, ExprRef) and isinstance(b, ExprRef) and _same_sort_exprs((a, b)):
+        return (a, b)
     if not is_expr(a) and not is_expr(b):
         a = _py2expr(a, ctx)
         b = _py2expr(b, ctx)
@@ -1246,6 +1264,8 @@ def _reduce(func, sequence, initial):
 
 
 def _coerce_expr_list(alist, ctx=None):
+    if len(alist) > 0 and _same_sort_exprs(alist):
+        return list(alist)
     has_expr = False
     for a in alist:
         if is_expr(a):
@@ -7071,7 +7091,9 @@ class Solver(Z3PPObject):
         args = _get_args(args)
         s = BoolSort(self.ctx)
         for arg in args:
-            if isinstance(arg, Goal) or isinstance(arg, AstVector):
+            if isinstance(arg, AstVector):
+                Z3_solver_assert_vector(self.ctx.ref(), self.solver, arg.vector)
+            elif isinstance(arg, Goal):
                 for f in arg:
                     Z3_solver_assert(self.ctx.ref(), self.solver, f.as_ast())
             else:
@@ -7265,6 +7287,25 @@ class Solver(Z3PPObject):
         consequences = [consequences[i] for i in range(sz)]
         return CheckSatResult(r), consequences
 
+    def enumerate_mus(self, soft):
+        """Enumerate the minimal unsatisfiable subsets and minimal correction sets of soft.
+        Yield pairs (unsat, mus) and (sat, mcs).
+        >>> s = Solver()
+        >>> a, b = Bools('a b')
+        >>> s.add(Or(Not(a), Not(b)))
+        >>> sorted([(str(r), len(l)) for r, l in s.enumerate_mus([a, b])])
+        [('sat', 1), ('sat', 1), ('unsat', 2)]
+        """
+        _soft = AstVector(None, self.ctx)
+        for a in soft:
+            _soft.push(a)
+        while True:
+            result = AstVector(None, self.ctx)
+            r = Z3_solver_enumerate_mus(self.ctx.ref(), self.solver, _soft.vector, result.vector)
+            if r == Z3_L_UNDEF:
+                return
+            yield CheckSatResult(r), [result[i] for i in range(len(result))]
+
     def from_file(self, filename):
         """Parse assertions from a file"""
         Z3_solver_from_file(self.ctx.ref(), self.solver, filename)
@@ -11577,6 +11618,15 @@ def user_prop_fixed(ctx, cb, id, value):
     prop.fixed(id, value)
     prop.cb = old_cb
 
+def user_prop_fixed_batch(ctx, cb, n, ids, values):
+    prop = _prop_closures.get(ctx)
+    old_cb = prop.cb
+    prop.cb = cb
+    ids = [_to_expr_ref(to_Ast(ids[i]), prop.ctx()) for i in range(n)]
+    values = [_to_expr_ref(to_Ast(values[i]), prop.ctx()) for i in range(n)]
+    prop.fixed_batch(ids, values)
+    prop.cb = old_cb
+
 def user_prop_created(ctx, cb, id):
     prop = _prop_closures.get(ctx)
     old_cb = prop.cb
@@ -11624,6 +11674,7 @@ _user_prop_push = Z3_push_eh(user_prop_push)
 _user_prop_pop = Z3_pop_eh(user_prop_pop)
 _user_prop_fresh = Z3_fresh_eh(user_prop_fresh)
 _user_prop_fixed = Z3_fixed_eh(user_prop_fixed)
+_user_prop_fixed_batch = Z3_fixed_batch_eh(user_prop_fixed_batch)
 _user_prop_created = Z3_created_eh(user_prop_created)
 _user_prop_final = Z3_final_eh(user_prop_final)
 _user_prop_eq = Z3_eq_eh(user_prop_eq)
@@ -11672,6 +11723,7 @@ class UserPropagateBase:
         self.cb = None
         self.id = _prop_closures.insert(self)
         self.fixed = None
+        self.fixed_batch = None
         self.final = None
         self.eq = None
         self.diseq = None
@@ -11706,6 +11758,17 @@ class UserPropagateBase:
             Z3_solver_propagate_fixed(self.ctx_ref(), self.solver.solver, _user_prop_fixed)
         self.fixed = fixed
 
+    def add_fixed_batch(self, fixed_batch):
+        """Register fixed_batch(ids, values), which receives the terms fixed
+        in a propagation round together with their values in one call.
+        It replaces a callback registered with add_fixed.
+        """
+        assert not self.fixed_batch
+        assert not self._ctx
+        if self.solver:
+            Z3_solver_propagate_fixed_batch(self.ctx_ref(), self.solver.solver, _user_prop_fixed_batch)
+        self.fixed_batch = fixed_batch
+
     def add_created(self, created):
         assert not self.created
         assert not self._ctx
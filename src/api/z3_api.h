@@ -1431,6 +1431,7 @@ Z3_DECLARE_CLOSURE(Z3_push_eh,    void, (void* ctx, Z3_solver_callback cb));
 Z3_DECLARE_CLOSURE(Z3_pop_eh,     void, (void* ctx, Z3_solver_callback cb, unsigned num_scopes));
 Z3_DECLARE_CLOSURE(Z3_fresh_eh,   void*, (void* ctx, Z3_context new_context));
 Z3_DECLARE_CLOSURE(Z3_fixed_eh,   void, (void* ctx, Z3_solver_callback cb, Z3_ast t, Z3_ast value));
+Z3_DECLARE_CLOSURE(Z3_fixed_batch_eh, void, (void* ctx, Z3_solver_callback cb, unsigned n, Z3_ast const* ts, Z3_ast const* values));
 Z3_DECLARE_CLOSURE(Z3_eq_eh,      void, (void* ctx, Z3_solver_callback cb, Z3_ast s, Z3_ast t));
 Z3_DECLARE_CLOSURE(Z3_final_eh,   void, (void* ctx, Z3_solver_callback cb));
 Z3_DECLARE_CLOSURE(Z3_created_eh, void, (void* ctx, Z3_solver_callback cb, Z3_ast t));
@@ -1539,6 +1540,7 @@ extern "C" {
 
             - proof  (Boolean)           Enable proof generation
             - debug_ref_count (Boolean)  Enable debug support for Z3_ast reference counting
+            - delete_budget (unsigned)   Maximal number of AST nodes freed when a term is released; the rest is freed incrementally (0: no bound)
             - trace  (Boolean)           Tracing support for VCC
             - trace_file_name (String)   Trace out file for VCC traces
             - timeout (unsigned)         default timeout (in milliseconds) used for solvers
@@ -5456,6 +5458,27 @@ extern "C" {
     */
     bool Z3_API Z3_model_eval(Z3_context c, Z3_model m, Z3_ast t, bool model_completion, Z3_ast * v);
 
+    /**
+       \brief Evaluate the terms \c terms in the model \c m and store their values
+       as fixed width unsigned integers in \c words.
+
+       Each term is assigned \c num_words / \c num_terms consecutive 32-bit words of
+       \c words, least significant word first. The terms must be bit-vectors,
+       non-negative integers or Booleans (\c true is stored as 1). All terms are
+       evaluated with the same model evaluator, so shared sub-terms are evaluated once.
+
+       Return \c false if some term does not evaluate to a numeral, or its value does
+       not fit in the words assigned to it. The contents of \c words are unspecified
+       in this case.
+
+       \pre num_words is a multiple of num_terms
+
+       \sa Z3_model_eval
+
+       def_API('Z3_model_eval_words', BOOL, (_in(CONTEXT), _in(MODEL), _in(UINT), _in_array(2, AST), _in(BOOL), _in(UINT), _out_array(5, UINT)))
+    */
+    bool Z3_API Z3_model_eval_words(Z3_context c, Z3_model m, unsigned num_terms, Z3_ast const terms[], bool model_completion, unsigned num_words, unsigned words[]);
+
     /**
        \brief Return the interpretation (i.e., assignment) of constant \c a in the model \c m.
        Return \c NULL, if the model does not assign an interpretation for \c a.
@@ -6948,6 +6971,19 @@ extern "C" {
     */
     void Z3_API Z3_solver_assert(Z3_context c, Z3_solver s, Z3_ast a);
 
+    /**
+       \brief Assert all constraints in the vector \c v into the solver.
+
+       This is equivalent to calling #Z3_solver_assert for every element of \c v,
+       but crosses the API boundary only once. None of the constraints are
+       asserted if some element of \c v is not a Boolean expression.
+
+       \sa Z3_solver_assert
+
+       def_API('Z3_solver_assert_vector', VOID, (_in(CONTEXT), _in(SOLVER), _in(AST_VECTOR)))
+    */
+    void Z3_API Z3_solver_assert_vector(Z3_context c, Z3_solver s, Z3_ast_vector v);
+
     /**
        \brief Assert a constraint \c a into the solver, and track it (in the unsat) core using
        the Boolean constant \c p.
@@ -6970,8 +7006,13 @@ extern "C" {
     /**
        \brief load solver assertions from a file.
 
+       Files with extension \c dimacs or \c cnf are read as DIMACS, files with
+       extension \c z3ab are read as checkpoints written by #Z3_solver_to_file,
+       all other files are parsed as SMT-LIB2.
+
        \sa Z3_solver_from_string
        \sa Z3_solver_to_string
+       \sa Z3_solver_to_file
 
        def_API('Z3_solver_from_file', VOID, (_in(CONTEXT), _in(SOLVER), _in(STRING)))
     */
@@ -7095,6 +7136,19 @@ extern "C" {
 
     void Z3_API Z3_solver_propagate_fixed(Z3_context c, Z3_solver s, Z3_fixed_eh fixed_eh);
 
+    /**
+       \brief register a callback for expressions bound to fixed values.
+       Unlike the callback registered with #Z3_solver_propagate_fixed, the assignments
+       are buffered and passed in one call at the end of each propagation round.
+       \c ts[i] is bound to \c values[i] for \c i < \c n.
+       The callback can use \c cb to propagate consequences of any of the assignments.
+       A callback registered with this function replaces the one registered with #Z3_solver_propagate_fixed.
+
+       def_API('Z3_solver_propagate_fixed_batch', VOID, (_in(CONTEXT), _in(SOLVER), _fnptr(Z3_fixed_batch_eh)))
+     */
+
+    void Z3_API Z3_solver_propagate_fixed_batch(Z3_context c, Z3_solver s, Z3_fixed_batch_eh fixed_batch_eh);
+
     /**
        \brief register a callback on final check.
        This provides freedom to the propagator to delay actions or implement a branch-and bound solver.
@@ -7242,6 +7296,60 @@ extern "C" {
     Z3_lbool Z3_API Z3_solver_check_assumptions(Z3_context c, Z3_solver s,
                                                 unsigned num_assumptions, Z3_ast const assumptions[]);
 
+    /**
+       \brief Start checking the assertions of the given solver under the optional
+       assumptions on a thread of a pool managed by Z3, and return immediately.
+
+       While the check runs, the context \c c may only be used with
+       #Z3_solver_check_async_done, #Z3_solver_check_async_wait,
+       #Z3_solver_interrupt, #Z3_solver_get_statistics_snapshot and #Z3_interrupt.
+       Other contexts can be used freely. A running check is canceled with
+       #Z3_solver_interrupt. Releasing the last reference to the solver waits
+       for the check to finish.
+
+       \sa Z3_solver_check_async_done
+       \sa Z3_solver_check_async_wait
+
+       def_API('Z3_solver_check_async', VOID, (_in(CONTEXT), _in(SOLVER), _in(UINT), _in_array(2, AST)))
+    */
+    void Z3_API Z3_solver_check_async(Z3_context c, Z3_solver s,
+                                      unsigned num_assumptions, Z3_ast const assumptions[]);
+
+    /**
+       \brief Return true if no check started by #Z3_solver_check_async is running on the solver.
+
+       def_API('Z3_solver_check_async_done', BOOL, (_in(CONTEXT), _in(SOLVER)))
+    */
+    bool Z3_API Z3_solver_check_async_done(Z3_context c, Z3_solver s);
+
+    /**
+       \brief Wait for the check started by #Z3_solver_check_async and return its result.
+       Afterwards, models, cores and reasons for unknown results are retrieved as after
+       #Z3_solver_check_assumptions.
+
+       def_API('Z3_solver_check_async_wait', LBOOL, (_in(CONTEXT), _in(SOLVER)))
+    */
+    Z3_lbool Z3_API Z3_solver_check_async_wait(Z3_context c, Z3_solver s);
+
+    /**
+       \brief Enumerate minimal unsatisfiable subsets (MUS) and minimal correction
+       sets (MCS) of the literals in \c soft relative to the assertions of \c s.
+
+       Each call stores the next subset in \c result. It returns \c Z3_L_FALSE
+       if \c result is an MUS and \c Z3_L_TRUE if \c result is an MCS, that is,
+       a minimal set of literals whose removal makes the remaining literals
+       satisfiable together with the assertions. It returns \c Z3_L_UNDEF when
+       all subsets have been produced or the search was interrupted.
+       Successive calls with the same \c soft vector continue the enumeration;
+       a different vector starts a new one.
+
+       \sa Z3_solver_check_assumptions
+       \sa Z3_solver_get_unsat_core
+
+       def_API('Z3_solver_enumerate_mus', LBOOL, (_in(CONTEXT), _in(SOLVER), _in(AST_VECTOR), _in(AST_VECTOR)))
+    */
+    Z3_lbool Z3_API Z3_solver_enumerate_mus(Z3_context c, Z3_solver s, Z3_ast_vector soft, Z3_ast_vector result);
+
     /**
        \brief Retrieve congruence class representatives for terms.
 
@@ -7350,6 +7458,22 @@ extern "C" {
     */
     Z3_stats Z3_API Z3_solver_get_statistics(Z3_context c, Z3_solver s);
 
+    /**
+       \brief Return the statistics most recently published by a running or completed check of the solver.
+
+       While #Z3_solver_check or #Z3_solver_check_assumptions runs, solvers that report
+       progress publish their statistics and memory usage about every 100 milliseconds.
+       Unlike #Z3_solver_get_statistics, this function may be called from another thread
+       while the solver is running, provided the running check does not invoke callbacks
+       that access the context at the same time. The snapshot is empty until the first
+       statistics are published.
+
+       \remark User must use #Z3_stats_inc_ref and #Z3_stats_dec_ref to manage Z3_stats objects.
+
+       def_API('Z3_solver_get_statistics_snapshot', STATS, (_in(CONTEXT), _in(SOLVER)))
+    */
+    Z3_stats Z3_API Z3_solver_get_statistics_snapshot(Z3_context c, Z3_solver s);
+
     /**
        \brief Convert a solver into a string.
 
@@ -7368,6 +7492,22 @@ extern "C" {
     */
     Z3_string Z3_API Z3_solver_to_dimacs_string(Z3_context c, Z3_solver s, bool include_names);
 
+    /**
+       \brief Save the assertions of a solver to a file in the binary AST format.
+
+       When the solver is not inside a user scope, the unit literals it has learned
+       are saved as well. Loading the file with #Z3_solver_from_file restores the
+       assertions without parsing. The file name should use the extension \c z3ab.
+
+       Assertions over datatypes, recursive functions or floating point numerals
+       cannot be saved in this format.
+
+       \sa Z3_solver_from_file
+
+       def_API('Z3_solver_to_file', VOID, (_in(CONTEXT), _in(SOLVER), _in(STRING)))
+    */
+    void Z3_API Z3_solver_to_file(Z3_context c, Z3_solver s, Z3_string file_name);
+
     /**@}*/
 
     /** @name Statistics */
@@ -7453,6 +7593,17 @@ extern "C" {
     */
     uint64_t Z3_API Z3_get_estimated_alloc_size(void);
 
+    /**
+    \brief Return a breakdown of the memory in use as an S-expression.
+
+    The result has the form \ccode{(:total n :id1 n1 ... :idk nk)} where \c n is the
+    total number of bytes allocated and \c ni is the number of bytes held by the
+    small object allocators tagged \c idi.
+
+    def_API('Z3_get_memory_breakdown', STRING, (_in(CONTEXT),))
+    */
+    Z3_string Z3_API Z3_get_memory_breakdown(Z3_context c);
+
     /**@}*/
 
 #ifdef __cplusplus
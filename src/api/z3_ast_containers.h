@@ -104,6 +104,27 @@ extern "C" {
     */
     Z3_string Z3_API Z3_ast_vector_to_string(Z3_context c, Z3_ast_vector v);
 
+    /**
+       \brief Write the AST vector \c v to the file \c file_name in a compact binary format.
+
+       Shared sub-terms are written once. Datatypes, recursive functions and
+       floating point numerals are not supported.
+
+       \sa Z3_ast_vector_deserialize
+
+       def_API('Z3_ast_vector_serialize', VOID, (_in(CONTEXT), _in(AST_VECTOR), _in(STRING)))
+    */
+    void Z3_API Z3_ast_vector_serialize(Z3_context c, Z3_ast_vector v, Z3_string file_name);
+
+    /**
+       \brief Read an AST vector written by #Z3_ast_vector_serialize from the file \c file_name.
+
+       \sa Z3_ast_vector_serialize
+
+       def_API('Z3_ast_vector_deserialize', AST_VECTOR, (_in(CONTEXT), _in(STRING)))
+    */
+    Z3_ast_vector Z3_API Z3_ast_vector_deserialize(Z3_context c, Z3_string file_name);
+
     /**@}*/
 
     /** @name AST maps */
@@ -29,6 +29,7 @@ Revision History:
 #include "ast/array_decl_plugin.h"
 #include "ast/arith_decl_plugin.h"
 #include "ast/ast_translation.h"
+#include "ast/expr_op_cache.h"
 #include "util/z3_version.h"
 #include <iostream>
 
@@ -1367,6 +1368,11 @@ static void mark_array_ref(ast_mark& mark, unsigned sz, parameter const * a) {
 ast_manager::~ast_manager() {
     SASSERT(is_format_manager() || !m_family_manager.has_family(symbol("format")));
 
+    dealloc(m_rewrite_cache);
+    m_rewrite_cache = nullptr;
+    m_delete_budget = 0;
+    delete_nodes(UINT_MAX);
+
     dec_ref(m_bool_sort);
     dec_ref(m_proof_sort);
     dec_ref(m_true);
@@ -1448,7 +1454,16 @@ ast_manager::~ast_manager() {
     }
 }
 
+expr_op_cache& ast_manager::get_rewrite_cache() {
+    if (!m_rewrite_cache) {
+        m_rewrite_cache = alloc(expr_op_cache, *this, "rewrite cache hits", "rewrite cache misses", "rewrite cache evictions");
+        m_rewrite_cache->set_max_size(0);
+    }
+    return *m_rewrite_cache;
+}
+
 void ast_manager::compact_memory() {
+    delete_nodes(UINT_MAX);
     m_alloc.consolidate();
     unsigned capacity = m_ast_table.capacity();
     if (capacity > 4*m_ast_table.size()) {
@@ -1802,8 +1817,29 @@ void ast_manager::delete_node(ast * n) {
 
     SASSERT(m_ast_table.contains(n));
     m_ast_table.push_erase(n);
+    delete_nodes(m_delete_budget == 0 ? UINT_MAX : m_delete_budget);
+}
 
-    while ((n = m_ast_table.pop_erase())) {
+/**
+   \brief Free up to max_nodes unreachable nodes.
+
+   Unreachable nodes are erased from the ast table as soon as their
+   reference count drops to zero, so they cannot be shared again and
+   can be freed at any later point. The table queues erased nodes in
+   its own cells, which must be released before the next insertion, so
+   nodes that are not freed within the budget are parked in
+   m_pending_deletes.
+*/
+void ast_manager::delete_nodes(unsigned max_nodes) {
+    ast* n;
+    for (; max_nodes > 0; --max_nodes) {
+        n = m_ast_table.pop_erase();
+        if (!n) {
+            if (m_pending_deletes.empty())
+                break;
+            n = m_pending_deletes.back();
+            m_pending_deletes.pop_back();
+        }
 
         CTRACE("del_quantifier", is_quantifier(n), tout << "deleting quantifier " << n->m_id << " " << n << "\n";);
         TRACE("mk_var_bug", tout << "del_ast: " << " " << n->m_ref_count << "\n";);
@@ -1870,6 +1906,8 @@ void ast_manager::delete_node(ast * n) {
         }       
         deallocate_node(n, ::get_node_size(n));
     }
+    while ((n = m_ast_table.pop_erase()))
+        m_pending_deletes.push_back(n);
 }
 
 
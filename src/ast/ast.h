@@ -64,6 +64,7 @@ Revision History:
 
 class ast;
 class ast_manager;
+class expr_op_cache;
 
 /**
    \brief Generic exception for AST related errors.
@@ -1510,6 +1511,9 @@ protected:
     unsigned                  m_fresh_id;
     bool                      m_debug_ref_count;
     u_map<unsigned>           m_debug_free_indices;
+    unsigned                  m_delete_budget = 0;     // 0: free unreachable nodes eagerly
+    ptr_vector<ast>           m_pending_deletes;       // unreachable nodes whose deletion was deferred
+    expr_op_cache*            m_rewrite_cache = nullptr;
     std::fstream*             m_trace_stream = nullptr;
     bool                      m_trace_stream_owner = false;
     bool                      m_has_type_vars = false;
@@ -1642,6 +1646,22 @@ public:
 
     void debug_ref_count() { m_debug_ref_count = true; }
 
+    /**
+       \brief Bound the number of nodes freed when a node becomes unreachable.
+       The remaining unreachable nodes are freed by later deletions or by
+       delete_pending_nodes. A budget of 0 frees them eagerly.
+    */
+    void set_delete_budget(unsigned n) { m_delete_budget = n; }
+    bool has_pending_deletes() const { return !m_pending_deletes.empty(); }
+    void delete_pending_nodes(unsigned max_nodes = UINT_MAX) { delete_nodes(max_nodes); }
+
+    /**
+       \brief Cache of top-level rewrite results shared by the rewriters of
+       this manager. It is created on first use and is empty unless a
+       rewriter gives it a positive size.
+    */
+    expr_op_cache& get_rewrite_cache();
+
     void inc_ref(ast* n) {
         if (n) 
             n->inc_ref();
@@ -1686,6 +1706,7 @@ protected:
     }
 
     void delete_node(ast * n);
+    void delete_nodes(unsigned max_nodes);
 
     void * allocate_node(unsigned size) {
         return m_alloc.allocate(size);
@@ -2484,6 +2505,12 @@ typedef app_ref_buffer                proof_ref_buffer;
 
 typedef obj_mark<expr> expr_mark;
 
+/**
+   \brief Mark with a constant time reset, for traversals that reset their
+   mark after every use.
+*/
+typedef obj_mark<expr, stamp_vector> expr_stamp_mark;
+
 class expr_sparse_mark {
     obj_hashtable<expr> m_marked;
 public:
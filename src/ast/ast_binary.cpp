@@ -0,0 +1,573 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary.cpp
+
+Abstract:
+
+    Compact binary serialization of ASTs.
+
+Notes:
+
+    The stream starts with the magic "Z3AB" and a format version. It is
+    followed by one record per node and an end record that lists the roots.
+    Numbers are LEB128 encoded, signed numbers are zig-zag encoded.
+
+    record    := SORT family kind name params
+               | DECL family kind params name arity sort* sort flags
+               | APP decl num_args expr*
+               | VAR idx sort
+               | QUANT kind num_decls (name sort)* body weight qid skid
+                       num_patterns expr* num_no_patterns expr*
+               | END num_roots node*
+    family    := symbol, the null symbol for uninterpreted sorts and declarations
+    symbol    := 0 | 1 num | 2 string
+
+--*/
+
+#include "ast/ast_binary.h"
+#include "util/zstring.h"
+#include <cstring>
+
+namespace {
+
+    const char     MAGIC[4] = { 'Z', '3', 'A', 'B' };
+    const unsigned VERSION = 1;
+
+    enum record_kind {
+        R_END,
+        R_SORT,
+        R_DECL,
+        R_APP,
+        R_VAR,
+        R_QUANT
+    };
+
+    enum symbol_kind {
+        S_NULL,
+        S_NUM,
+        S_STR
+    };
+
+    enum decl_flags {
+        F_ASSOC = 1,
+        F_COMM = 2,
+        F_INJ = 4,
+        F_SKOLEM = 8
+    };
+
+    class writer {
+        ast_manager&     m;
+        std::ostream&    m_out;
+        unsigned_vector  m_index;          // expression id |-> position in the stream
+        unsigned_vector  m_decl_index;     // small id of sorts and declarations |-> position in the stream
+        unsigned         m_num_nodes = 0;
+        ptr_vector<ast>  m_todo;
+        family_id        m_dt_fid, m_rec_fid;
+
+        void write_uint(uint64_t n) {
+            while (n >= 0x80) {
+                m_out.put(static_cast<char>((n & 0x7f) | 0x80));
+                n >>= 7;
+            }
+            m_out.put(static_cast<char>(n));
+        }
+
+        void write_int(int64_t n) {
+            write_uint((static_cast<uint64_t>(n) << 1) ^ static_cast<uint64_t>(n >> 63));
+        }
+
+        void write_string(std::string const& s) {
+            write_uint(s.size());
+            m_out.write(s.data(), s.size());
+        }
+
+        void write_symbol(symbol const& s) {
+            if (s.is_null())
+                write_uint(S_NULL);
+            else if (s.is_numerical()) {
+                write_uint(S_NUM);
+                write_uint(s.get_num());
+            }
+            else {
+                write_uint(S_STR);
+                write_string(s.str());
+            }
+        }
+
+        void write_family(family_id fid) {
+            if (fid == null_family_id || fid == user_sort_family_id)
+                write_symbol(symbol::null);
+            else
+                write_symbol(m.get_family_name(fid));
+        }
+
+        // sorts and declarations draw their ids from a separate range starting at c_first_decl_id.
+        unsigned get_index(ast* a) const {
+            if (is_expr(a))
+                return m_index.get(a->get_id(), UINT_MAX);
+            return m_decl_index.get(to_decl(a)->get_small_id(), UINT_MAX);
+        }
+
+        void set_index(ast* a, unsigned idx) {
+            if (is_expr(a))
+                m_index.setx(a->get_id(), idx, UINT_MAX);
+            else
+                m_decl_index.setx(to_decl(a)->get_small_id(), idx, UINT_MAX);
+        }
+
+        void write_node(ast* a) {
+            SASSERT(get_index(a) != UINT_MAX);
+            write_uint(get_index(a));
+        }
+
+        void write_params(unsigned n, parameter const* ps) {
+            write_uint(n);
+            for (unsigned i = 0; i < n; ++i) {
+                parameter const& p = ps[i];
+                write_uint(p.get_kind());
+                switch (p.get_kind()) {
+                case parameter::PARAM_INT:
+                    write_int(p.get_int());
+                    break;
+                case parameter::PARAM_AST:
+                    write_node(p.get_ast());
+                    break;
+                case parameter::PARAM_SYMBOL:
+                    write_symbol(p.get_symbol());
+                    break;
+                case parameter::PARAM_ZSTRING:
+                    write_string(p.get_zstring().encode());
+                    break;
+                case parameter::PARAM_RATIONAL:
+                    write_string(p.get_rational().to_string());
+                    break;
+                case parameter::PARAM_DOUBLE: {
+                    double d = p.get_double();
+                    char buffer[sizeof(double)];
+                    memcpy(buffer, &d, sizeof(double));
+                    m_out.write(buffer, sizeof(double));
+                    break;
+                }
+                default:
+                    throw default_exception("binary serialization does not support plugin specific parameters");
+                }
+            }
+        }
+
+        void check_family(family_id fid) {
+            if (fid != null_family_id && (fid == m_dt_fid || fid == m_rec_fid))
+                throw default_exception("binary serialization does not support " + m.get_family_name(fid).str());
+        }
+
+        bool is_visited(ast* a) const {
+            return get_index(a) != UINT_MAX;
+        }
+
+        void push(ast* a) {
+            if (!is_visited(a))
+                m_todo.push_back(a);
+        }
+
+        void push_params(unsigned n, parameter const* ps) {
+            for (unsigned i = 0; i < n; ++i)
+                if (ps[i].is_ast())
+                    push(ps[i].get_ast());
+        }
+
+        void push_children(ast* a) {
+            switch (a->get_kind()) {
+            case AST_SORT: {
+                sort* s = to_sort(a);
+                push_params(s->get_num_parameters(), s->get_parameters());
+                break;
+            }
+            case AST_FUNC_DECL: {
+                func_decl* f = to_func_decl(a);
+                push_params(f->get_num_parameters(), f->get_parameters());
+                for (sort* s : *f)
+                    push(s);
+                push(f->get_range());
+                break;
+            }
+            case AST_APP:
+                push(to_app(a)->get_decl());
+                for (expr* arg : *to_app(a))
+                    push(arg);
+                break;
+            case AST_VAR:
+                push(to_var(a)->get_sort());
+                break;
+            case AST_QUANTIFIER: {
+                quantifier* q = to_quantifier(a);
+                for (unsigned i = 0; i < q->get_num_decls(); ++i)
+                    push(q->get_decl_sort(i));
+                for (unsigned i = 0; i < q->get_num_children(); ++i)
+                    push(q->get_child(i));
+                break;
+            }
+            default:
+                UNREACHABLE();
+            }
+        }
+
+        void write_record(ast* a) {
+            switch (a->get_kind()) {
+            case AST_SORT: {
+                sort* s = to_sort(a);
+                check_family(s->get_family_id());
+                write_uint(R_SORT);
+                write_family(s->get_family_id());
+                write_uint(s->get_info() ? s->get_decl_kind() : 0);
+                write_symbol(s->get_name());
+                write_params(s->get_num_parameters(), s->get_parameters());
+                break;
+            }
+            case AST_FUNC_DECL: {
+                func_decl* f = to_func_decl(a);
+                check_family(f->get_family_id());
+                write_uint(R_DECL);
+                write_family(f->get_family_id());
+                write_uint(f->get_info() ? f->get_decl_kind() : 0);
+                write_params(f->get_num_parameters(), f->get_parameters());
+                write_symbol(f->get_name());
+                write_uint(f->get_arity());
+                for (sort* s : *f)
+                    write_node(s);
+                write_node(f->get_range());
+                unsigned flags = 0;
+                if (f->get_family_id() == null_family_id) {
+                    if (f->is_associative()) flags |= F_ASSOC;
+                    if (f->is_commutative()) flags |= F_COMM;
+                    if (f->is_injective()) flags |= F_INJ;
+                    if (f->is_skolem()) flags |= F_SKOLEM;
+                }
+                write_uint(flags);
+                break;
+            }
+            case AST_APP:
+                write_uint(R_APP);
+                write_node(to_app(a)->get_decl());
+                write_uint(to_app(a)->get_num_args());
+                for (expr* arg : *to_app(a))
+                    write_node(arg);
+                break;
+            case AST_VAR:
+                write_uint(R_VAR);
+                write_uint(to_var(a)->get_idx());
+                write_node(to_var(a)->get_sort());
+                break;
+            case AST_QUANTIFIER: {
+                quantifier* q = to_quantifier(a);
+                write_uint(R_QUANT);
+                write_uint(q->get_kind());
+                write_uint(q->get_num_decls());
+                for (unsigned i = 0; i < q->get_num_decls(); ++i) {
+                    write_symbol(q->get_decl_name(i));
+                    write_node(q->get_decl_sort(i));
+                }
+                write_node(q->get_expr());
+                write_int(q->get_weight());
+                write_symbol(q->get_qid());
+                write_symbol(q->get_skid());
+                write_uint(q->get_num_patterns());
+                for (unsigned i = 0; i < q->get_num_patterns(); ++i)
+                    write_node(q->get_pattern(i));
+                write_uint(q->get_num_no_patterns());
+                for (unsigned i = 0; i < q->get_num_no_patterns(); ++i)
+                    write_node(q->get_no_pattern(i));
+                break;
+            }
+            default:
+                UNREACHABLE();
+            }
+            set_index(a, m_num_nodes++);
+        }
+
+        void visit(ast* root) {
+            push(root);
+            while (!m_todo.empty()) {
+                ast* a = m_todo.back();
+                if (is_visited(a)) {
+                    m_todo.pop_back();
+                    continue;
+                }
+                unsigned sz = m_todo.size();
+                push_children(a);
+                if (sz == m_todo.size()) {
+                    m_todo.pop_back();
+                    write_record(a);
+                }
+            }
+        }
+
+    public:
+        writer(ast_manager& m, std::ostream& out):
+            m(m), m_out(out),
+            m_dt_fid(m.get_family_id("datatype")),
+            m_rec_fid(m.get_family_id("recfun")) {}
+
+        void operator()(unsigned n, ast* const* asts) {
+            m_out.write(MAGIC, sizeof(MAGIC));
+            write_uint(VERSION);
+            for (unsigned i = 0; i < n; ++i)
+                visit(asts[i]);
+            write_uint(R_END);
+            write_uint(n);
+            for (unsigned i = 0; i < n; ++i)
+                write_node(asts[i]);
+        }
+    };
+
+    class reader {
+        ast_manager&    m;
+        std::istream&   m_in;
+        ast_ref_vector  m_nodes;
+        vector<parameter> m_params;
+        ptr_vector<sort>  m_sorts;
+        ptr_vector<expr>  m_args, m_patterns, m_no_patterns;
+        svector<symbol>   m_names;
+
+        [[noreturn]] void fail(char const* msg) {
+            throw default_exception(std::string("invalid binary AST stream: ") + msg);
+        }
+
+        uint64_t read_uint() {
+            uint64_t n = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                int c = m_in.get();
+                if (c == std::char_traits<char>::eof())
+                    fail("unexpected end of input");
+                n |= static_cast<uint64_t>(c & 0x7f) << shift;
+                if ((c & 0x80) == 0)
+                    return n;
+            }
+            fail("number is too large");
+        }
+
+        unsigned read_unsigned() {
+            uint64_t n = read_uint();
+            if (n > UINT_MAX)
+                fail("number is too large");
+            return static_cast<unsigned>(n);
+        }
+
+        int64_t read_int() {
+            uint64_t n = read_uint();
+            return static_cast<int64_t>(n >> 1) ^ -static_cast<int64_t>(n & 1);
+        }
+
+        std::string read_string() {
+            unsigned sz = read_unsigned();
+            std::string s(sz, '\0');
+            if (sz > 0 && !m_in.read(&s[0], sz))
+                fail("unexpected end of input");
+            return s;
+        }
+
+        symbol read_symbol() {
+            switch (read_uint()) {
+            case S_NULL:
+                return symbol::null;
+            case S_NUM:
+                return symbol(read_unsigned());
+            case S_STR:
+                return symbol(read_string());
+            default:
+                fail("invalid symbol");
+            }
+        }
+
+        family_id read_family() {
+            symbol s = read_symbol();
+            if (s.is_null())
+                return null_family_id;
+            family_id fid = m.get_family_id(s);
+            if (fid == null_family_id || !m.has_plugin(fid))
+                fail("unknown theory");
+            return fid;
+        }
+
+        ast* read_node() {
+            unsigned idx = read_unsigned();
+            if (idx >= m_nodes.size())
+                fail("reference to an undefined node");
+            return m_nodes.get(idx);
+        }
+
+        sort* read_sort() {
+            ast* a = read_node();
+            if (!is_sort(a))
+                fail("sort expected");
+            return to_sort(a);
+        }
+
+        expr* read_expr() {
+            ast* a = read_node();
+            if (!is_expr(a))
+                fail("expression expected");
+            return to_expr(a);
+        }
+
+        void read_params() {
+            m_params.reset();
+            unsigned n = read_unsigned();
+            for (unsigned i = 0; i < n; ++i) {
+                switch (read_uint()) {
+                case parameter::PARAM_INT:
+                    m_params.push_back(parameter(static_cast<int>(read_int())));
+                    break;
+                case parameter::PARAM_AST:
+                    m_params.push_back(parameter(read_node()));
+                    break;
+                case parameter::PARAM_SYMBOL:
+                    m_params.push_back(parameter(read_symbol()));
+                    break;
+                case parameter::PARAM_ZSTRING:
+                    m_params.push_back(parameter(zstring(read_string().c_str())));
+                    break;
+                case parameter::PARAM_RATIONAL:
+                    m_params.push_back(parameter(rational(read_string().c_str())));
+                    break;
+                case parameter::PARAM_DOUBLE: {
+                    char buffer[sizeof(double)];
+                    if (!m_in.read(buffer, sizeof(double)))
+                        fail("unexpected end of input");
+                    double d;
+                    memcpy(&d, buffer, sizeof(double));
+                    m_params.push_back(parameter(d));
+                    break;
+                }
+                default:
+                    fail("invalid parameter");
+                }
+            }
+        }
+
+        ast* read_sort_record() {
+            family_id fid = read_family();
+            decl_kind k = read_unsigned();
+            symbol name = read_symbol();
+            read_params();
+            if (fid == null_family_id)
+                return m.mk_uninterpreted_sort(name, m_params.size(), m_params.data());
+            if (fid == poly_family_id)
+                return m.mk_type_var(name);
+            return m.mk_sort(fid, k, m_params.size(), m_params.data());
+        }
+
+        ast* read_decl_record() {
+            family_id fid = read_family();
+            decl_kind k = read_unsigned();
+            read_params();
+            symbol name = read_symbol();
+            unsigned arity = read_unsigned();
+            m_sorts.reset();
+            for (unsigned i = 0; i < arity; ++i)
+                m_sorts.push_back(read_sort());
+            sort* range = read_sort();
+            unsigned flags = read_unsigned();
+            if (fid != null_family_id)
+                return m.mk_func_decl(fid, k, m_params.size(), m_params.data(), arity, m_sorts.data(), range);
+            if (flags == 0)
+                return m.mk_func_decl(name, arity, m_sorts.data(), range);
+            func_decl_info info(null_family_id, null_decl_kind);
+            info.set_associative((flags & F_ASSOC) != 0);
+            info.set_commutative((flags & F_COMM) != 0);
+            info.set_injective((flags & F_INJ) != 0);
+            info.set_skolem((flags & F_SKOLEM) != 0);
+            return m.mk_func_decl(name, arity, m_sorts.data(), range, info);
+        }
+
+        ast* read_app_record() {
+            ast* f = read_node();
+            if (!is_func_decl(f))
+                fail("function declaration expected");
+            unsigned n = read_unsigned();
+            m_args.reset();
+            for (unsigned i = 0; i < n; ++i)
+                m_args.push_back(read_expr());
+            return m.mk_app(to_func_decl(f), n, m_args.data());
+        }
+
+        ast* read_var_record() {
+            unsigned idx = read_unsigned();
+            return m.mk_var(idx, read_sort());
+        }
+
+        ast* read_quantifier_record() {
+            unsigned k = read_unsigned();
+            if (k != forall_k && k != exists_k && k != lambda_k)
+                fail("invalid quantifier kind");
+            unsigned n = read_unsigned();
+            if (n == 0)
+                fail("quantifier without bound variables");
+            m_names.reset();
+            m_sorts.reset();
+            for (unsigned i = 0; i < n; ++i) {
+                m_names.push_back(read_symbol());
+                m_sorts.push_back(read_sort());
+            }
+            expr* body = read_expr();
+            int weight = static_cast<int>(read_int());
+            symbol qid = read_symbol();
+            symbol skid = read_symbol();
+            m_patterns.reset();
+            unsigned num_patterns = read_unsigned();
+            for (unsigned i = 0; i < num_patterns; ++i)
+                m_patterns.push_back(read_expr());
+            m_no_patterns.reset();
+            unsigned num_no_patterns = read_unsigned();
+            for (unsigned i = 0; i < num_no_patterns; ++i)
+                m_no_patterns.push_back(read_expr());
+            if (k == lambda_k)
+                return m.mk_lambda(n, m_sorts.data(), m_names.data(), body);
+            return m.mk_quantifier(static_cast<quantifier_kind>(k), n, m_sorts.data(), m_names.data(), body, weight, qid, skid,
+                                   num_patterns, m_patterns.data(), num_no_patterns, m_no_patterns.data());
+        }
+
+    public:
+        reader(ast_manager& m, std::istream& in): m(m), m_in(in), m_nodes(m) {}
+
+        void operator()(ast_ref_vector& result) {
+            char magic[sizeof(MAGIC)];
+            if (!m_in.read(magic, sizeof(MAGIC)) || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+                fail("missing header");
+            if (read_uint() != VERSION)
+                fail("unsupported version");
+            while (true) {
+                ast* a = nullptr;
+                switch (read_uint()) {
+                case R_END: {
+                    unsigned n = read_unsigned();
+                    for (unsigned i = 0; i < n; ++i)
+                        result.push_back(read_node());
+                    return;
+                }
+                case R_SORT:  a = read_sort_record(); break;
+                case R_DECL:  a = read_decl_record(); break;
+                case R_APP:   a = read_app_record(); break;
+                case R_VAR:   a = read_var_record(); break;
+                case R_QUANT: a = read_quantifier_record(); break;
+                default:
+                    fail("invalid record");
+                }
+                if (!a)
+                    fail("could not recreate a declaration");
+                m_nodes.push_back(a);
+            }
+        }
+    };
+}
+
+void ast_to_binary(ast_manager& m, unsigned num_asts, ast* const* asts, std::ostream& out) {
+    writer w(m, out);
+    w(num_asts, asts);
+}
+
+void ast_from_binary(ast_manager& m, std::istream& in, ast_ref_vector& result) {
+    reader r(m, in);
+    r(result);
+}
@@ -0,0 +1,33 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    ast_binary.h
+
+Abstract:
+
+    Compact binary serialization of ASTs.
+
+    The format stores the DAG of the serialized ASTs. Every sort, function
+    declaration and expression is written once, after the nodes it refers to,
+    and is referenced by its position in the stream. Theory declarations are
+    recreated through their families, so the format does not depend on
+    family or declaration ids of the writing process.
+
+    Datatypes, recursive functions and parameters that are private to a
+    decl plugin (such as floating point numerals) are not supported.
+
+--*/
+#pragma once
+
+#include "ast/ast.h"
+#include <iostream>
+
+void ast_to_binary(ast_manager& m, unsigned num_asts, ast* const* asts, std::ostream& out);
+
+/**
+   \brief Read ASTs written by ast_to_binary and append them to result.
+   Throws default_exception when the input is not a valid binary AST stream.
+*/
+void ast_from_binary(ast_manager& m, std::istream& in, ast_ref_vector& result);
@@ -21,6 +21,16 @@ Revision History:
 #include "ast/ast_smt2_pp.h"
 #include "ast/ast_smt_pp.h"
 #include "ast/recfun_decl_plugin.h"
+#include "ast/for_each_expr.h"
+#include "ast/pp_params.hpp"
+
+/**
+ * The neat printer builds a format tree for the entire assertion before printing.
+ * Large assertions are printed by the low level printer instead.
+ */
+static bool use_neat(expr* f, bool neat, unsigned max_size) {
+    return neat && (max_size == UINT_MAX || get_num_exprs(f) <= max_size);
+}
 
 void ast_pp_util::collect(expr* e) {
     coll.visit(e);
@@ -91,7 +101,7 @@ void ast_pp_util::remove_decl(func_decl* f) {
 }
 
 std::ostream& ast_pp_util::display_expr(std::ostream& out, expr* f, bool neat) {
-    if (neat) {
+    if (use_neat(f, neat, pp_params().neat_max_size())) {
         ast_smt2_pp(out, f, m_env);
     }
     else {
@@ -118,20 +128,15 @@ void ast_pp_util::display_assert_and_track(std::ostream& out, expr* f, expr* t,
 }
 
 void ast_pp_util::display_asserts(std::ostream& out, expr_ref_vector const& fmls, bool neat) {
-    if (neat) {
-        for (expr* f : fmls) {
-            out << "(assert ";
+    unsigned max_size = pp_params().neat_max_size();
+    ast_smt_pp ll_smt2_pp(m);
+    for (expr* f : fmls) {
+        out << "(assert ";
+        if (use_neat(f, neat, max_size))
             ast_smt2_pp(out, f, m_env);
-            out << ")\n";
-        }
-    }
-    else {
-        ast_smt_pp ll_smt2_pp(m);
-        for (expr* f : fmls) {
-            out << "(assert ";
+        else
             ll_smt2_pp.display_expr_smt2(out, f);
-            out << ")\n";
-        }
+        out << ")\n";
     }
 }
 
@@ -227,7 +227,10 @@ ast * ast_translation::process(ast const * _n) {
             ast * n = fr.m_n;
             ast * r;         
             TRACE("ast_translation", tout << mk_ll_pp(n, m_from_manager, false) << "\n";);
-            if (fr.m_idx == 0 && n->get_ref_count() > 1) {
+            // visit already looked n up before pushing its frame; only the
+            // extra frames pushed for polymorphic declarations can be
+            // translated in the meantime.
+            if (fr.m_idx == 0 && n->get_ref_count() > 1 && m_from_manager.has_type_vars()) {
                 if (m_cache.find(n, r)) {
                     SASSERT(m_result_stack.size() == fr.m_rpos);
                     m_result_stack.push_back(r);
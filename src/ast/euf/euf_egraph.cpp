@@ -742,6 +742,12 @@ namespace euf {
 
     enode* egraph::find_lca(enode* a, enode* b) {
         SASSERT(a->get_root() == b->get_root());
+        // congruent terms frequently share arguments or have arguments
+        // that are adjacent in the proof forest.
+        if (a == b || a->m_target == b)
+            return b;
+        if (b->m_target == a)
+            return a;
         a->mark2_targets<true>();
         while (!b->is_marked2()) 
             b = b->m_target;
@@ -0,0 +1,124 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    expr_op_cache.cpp
+
+Abstract:
+
+    Bounded cache for the results of operations on expressions.
+
+--*/
+#include "ast/expr_op_cache.h"
+
+void expr_op_cache::unlink(unsigned i) {
+    entry& e = m_entries[i];
+    if (e.m_prev != UINT_MAX)
+        m_entries[e.m_prev].m_next = e.m_next;
+    else
+        m_head = e.m_next;
+    if (e.m_next != UINT_MAX)
+        m_entries[e.m_next].m_prev = e.m_prev;
+    else
+        m_tail = e.m_prev;
+}
+
+void expr_op_cache::push_front(unsigned i) {
+    entry& e = m_entries[i];
+    e.m_prev = UINT_MAX;
+    e.m_next = m_head;
+    if (m_head != UINT_MAX)
+        m_entries[m_head].m_prev = i;
+    m_head = i;
+    if (m_tail == UINT_MAX)
+        m_tail = i;
+}
+
+void expr_op_cache::inc_ref(op_key const& k, expr* r) {
+    m.inc_ref(k.a);
+    m.inc_ref(k.b);
+    m.inc_ref(k.c);
+    m.inc_ref(r);
+}
+
+void expr_op_cache::dec_ref(op_key const& k, expr* r) {
+    m.dec_ref(k.a);
+    m.dec_ref(k.b);
+    m.dec_ref(k.c);
+    m.dec_ref(r);
+}
+
+void expr_op_cache::evict() {
+    SASSERT(m_tail != UINT_MAX);
+    unsigned i = m_tail;
+    unlink(i);
+    entry const& e = m_entries[i];
+    m_table.remove(e.m_key);
+    dec_ref(e.m_key, e.m_result);
+    m_free.push_back(i);
+    ++m_evictions;
+}
+
+expr* expr_op_cache::find(decl_kind op, expr* a, expr* b, expr* c) {
+    unsigned i;
+    if (!m_table.find(op_key{ op, a, b, c }, i)) {
+        ++m_misses;
+        return nullptr;
+    }
+    ++m_hits;
+    if (i != m_head) {
+        unlink(i);
+        push_front(i);
+    }
+    return m_entries[i].m_result;
+}
+
+void expr_op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, expr* r) {
+    op_key k{ op, a, b, c };
+    unsigned i;
+    if (m_table.find(k, i)) {
+        inc_ref(k, r);
+        dec_ref(k, m_entries[i].m_result);
+        m_entries[i].m_result = r;
+        return;
+    }
+    if (m_max_size == 0)
+        return;
+    if (m_table.size() >= m_max_size)
+        evict();
+    inc_ref(k, r);
+    if (m_free.empty()) {
+        i = m_entries.size();
+        m_entries.push_back(entry());
+    }
+    else {
+        i = m_free.back();
+        m_free.pop_back();
+    }
+    m_entries[i].m_key = k;
+    m_entries[i].m_result = r;
+    push_front(i);
+    m_table.insert(k, i);
+}
+
+void expr_op_cache::reset() {
+    for (unsigned i = m_head; i != UINT_MAX; i = m_entries[i].m_next)
+        dec_ref(m_entries[i].m_key, m_entries[i].m_result);
+    m_table.reset();
+    m_entries.reset();
+    m_free.reset();
+    m_head = m_tail = UINT_MAX;
+}
+
+void expr_op_cache::set_max_size(unsigned n) {
+    m_max_size = n;
+    while (m_table.size() > m_max_size)
+        evict();
+}
+
+void expr_op_cache::collect_statistics(statistics& st) const {
+    st.update(m_hits_key, m_hits);
+    st.update(m_misses_key, m_misses);
+    st.update(m_evictions_key, m_evictions);
+}
@@ -0,0 +1,84 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    expr_op_cache.h
+
+Abstract:
+
+    Bounded cache for the results of operations on expressions, such as
+    regex derivatives or top-level rewrites.
+
+    Entries are keyed by the operation and its (hash-consed) arguments.
+    The caches are owned by an ast_manager or one of its plugins, so they
+    are shared by all rewriters and solvers that use the same manager and
+    survive across calls to check-sat. When a cache is full, the least
+    recently used entry is evicted.
+
+--*/
+#pragma once
+
+#include "ast/ast.h"
+#include "util/map.h"
+#include "util/statistics.h"
+
+class expr_op_cache {
+    struct op_key {
+        decl_kind k;
+        expr* a, *b, *c;
+    };
+
+    struct key_hash {
+        unsigned operator()(op_key const& e) const {
+            return combine_hash(mk_mix(e.k, e.a ? e.a->get_id() : 0, e.b ? e.b->get_id() : 0), e.c ? e.c->get_id() : 0);
+        }
+    };
+
+    struct key_eq {
+        bool operator()(op_key const& a, op_key const& b) const {
+            return a.k == b.k && a.a == b.a && a.b == b.b && a.c == b.c;
+        }
+    };
+
+    struct entry {
+        op_key   m_key;
+        expr*    m_result;
+        unsigned m_prev;
+        unsigned m_next;
+    };
+
+    ast_manager&                             m;
+    map<op_key, unsigned, key_hash, key_eq>  m_table;
+    svector<entry>                           m_entries;
+    unsigned_vector                          m_free;
+    unsigned                                 m_head = UINT_MAX;   // most recently used
+    unsigned                                 m_tail = UINT_MAX;   // least recently used
+    unsigned                                 m_max_size = 10000;
+    unsigned                                 m_hits = 0;
+    unsigned                                 m_misses = 0;
+    unsigned                                 m_evictions = 0;
+    char const *                             m_hits_key;
+    char const *                             m_misses_key;
+    char const *                             m_evictions_key;
+
+    void unlink(unsigned i);
+    void push_front(unsigned i);
+    void evict();
+    void inc_ref(op_key const& k, expr* r);
+    void dec_ref(op_key const& k, expr* r);
+
+public:
+    // the statistics keys must be string literals
+    expr_op_cache(ast_manager& m, char const* hits_key, char const* misses_key, char const* evictions_key):
+        m(m), m_hits_key(hits_key), m_misses_key(misses_key), m_evictions_key(evictions_key) {}
+    ~expr_op_cache() { reset(); }
+
+    expr* find(decl_kind op, expr* a, expr* b, expr* c);
+    void insert(decl_kind op, expr* a, expr* b, expr* c, expr* r);
+    void reset();
+
+    void set_max_size(unsigned n);
+    unsigned size() const { return m_table.size(); }
+    void collect_statistics(statistics& st) const;
+};
@@ -4376,6 +4376,43 @@ void fpa2bv_converter_wrapped::mk_const(func_decl* f, expr_ref& result) {
     }
 }
 
+bool fpa2bv_converter_wrapped::mk_delayed(func_decl* f, unsigned num, expr* const* args, expr_ref& result) {
+    if (!m_delay || f->get_family_id() != m_util.get_family_id())
+        return false;
+    switch (f->get_decl_kind()) {
+    case OP_FPA_MUL:
+    case OP_FPA_DIV:
+    case OP_FPA_REM:
+    case OP_FPA_FMA:
+    case OP_FPA_SQRT:
+        break;
+    default:
+        return false;
+    }
+    app_ref e(m.mk_app(f, num, args), m);
+    if (!m_delayed.contains(e)) {
+        m_delayed.insert(e);
+        m_delayed_trail.push_back(e);
+    }
+    result = unwrap(wrap(e), f->get_range());
+    return true;
+}
+
+void fpa2bv_converter_wrapped::mk_circuit(app* e, expr_ref& result) {
+    SASSERT(is_delayed(e));
+    func_decl* f = e->get_decl();
+    unsigned num = e->get_num_args();
+    expr* const* args = e->get_args();
+    switch (f->get_decl_kind()) {
+    case OP_FPA_MUL: mk_mul(f, num, args, result); break;
+    case OP_FPA_DIV: mk_div(f, num, args, result); break;
+    case OP_FPA_REM: mk_rem(f, num, args, result); break;
+    case OP_FPA_FMA: mk_fma(f, num, args, result); break;
+    case OP_FPA_SQRT: mk_sqrt(f, num, args, result); break;
+    default: UNREACHABLE();
+    }
+}
+
 app_ref fpa2bv_converter_wrapped::wrap(expr* e) {
     SASSERT(m_util.is_float(e) || m_util.is_rm(e));
     SASSERT(!m_util.is_bvwrap(e));
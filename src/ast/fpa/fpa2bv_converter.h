@@ -89,6 +89,11 @@ public:
     virtual void mk_const(func_decl * f, expr_ref & result);
     virtual void mk_rm_const(func_decl * f, expr_ref & result);
     virtual void mk_uf(func_decl * f, unsigned num, expr * const * args, expr_ref & result);
+    /**
+       \brief Hook for leaving an operation unconverted. Returns true if result
+       is an abstraction of f(args) instead of its circuit.
+    */
+    virtual bool mk_delayed(func_decl * f, unsigned num, expr * const * args, expr_ref & result) { return false; }
     void mk_var(unsigned base_inx, sort * srt, expr_ref & result);
 
     void mk_pinf(func_decl * f, expr_ref & result);
@@ -235,13 +240,29 @@ private:
 
 class fpa2bv_converter_wrapped : public fpa2bv_converter {
     th_rewriter& m_rw;
+    bool                m_delay = false;
+    obj_hashtable<expr> m_delayed;
+    expr_ref_vector     m_delayed_trail;
  public:
 
     fpa2bv_converter_wrapped(ast_manager & m, th_rewriter& rw) :
         fpa2bv_converter(m),
-        m_rw(rw) {}
+        m_rw(rw),
+        m_delayed_trail(m) {}
     void mk_const(func_decl * f, expr_ref & result) override;
     void mk_rm_const(func_decl * f, expr_ref & result) override;
+
+    /**
+       \brief When delaying is enabled, multiplication, division, remainder,
+       fused multiply-add and square root are converted to the bits of
+       wrap(f(args)) instead of their circuits. The circuit of a delayed
+       term is created by mk_circuit.
+    */
+    bool mk_delayed(func_decl * f, unsigned num, expr * const * args, expr_ref & result) override;
+    void set_delay(bool f) { m_delay = f; }
+    bool is_delayed(expr * e) const { return m_delayed.contains(e); }
+    void mk_circuit(app * e, expr_ref & result);
+
     app_ref wrap(expr * e);
     app_ref unwrap(expr * e, sort * s);
 
@@ -29,6 +29,9 @@ class contains_vars::imp {
     unsigned                 m_window;
 
     void visit(expr * n, unsigned delta, bool & visited) {
+        // ground applications contain neither variables nor quantifiers
+        if (is_ground(n))
+            return;
         expr_delta_pair e(n, delta);
         if (!m_cache.contains(e)) {
             m_todo.push_back(e);
@@ -71,6 +74,8 @@ public:
         m_window     = end - begin;
         m_todo.reset();
         m_cache.reset();
+        if (is_ground(n))
+            return false;
         m_todo.push_back(expr_delta_pair(n, begin));
         while (!m_todo.empty()) {
             expr_delta_pair e = m_todo.back();
@@ -20,6 +20,7 @@ Revision History:
 
 #include "ast/ast.h"
 #include "util/obj_hashtable.h"
+#include "util/swiss_hashtable.h"
 
 /**
    \brief Functor for computing the number of occurrences of each sub-expression in a expression F.
@@ -28,7 +29,7 @@ class num_occurs {
 protected:
     bool m_ignore_ref_count1;
     bool m_ignore_quantifiers;
-    obj_map<expr, unsigned>        m_num_occurs;
+    obj_map<expr, unsigned, swiss_hashtable> m_num_occurs;
 
     void process(expr * t, expr_fast_mark1 & visited);
 public:
@@ -95,7 +95,8 @@ bool occurs(sort* s1, sort* s2) {
     return false;
 }
 
-void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_mark& occ) {
+template<typename Mark>
+static void mark_occurs_core(ptr_vector<expr>& to_check, expr* v, Mark& occ) {
     expr_fast_mark2 visited;
     occ.mark(v, true);
     visited.mark(v, true);
@@ -138,3 +139,11 @@ void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_mark& occ) {
         }
     }
 }
+
+void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_mark& occ) {
+    mark_occurs_core(to_check, v, occ);
+}
+
+void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_stamp_mark& occ) {
+    mark_occurs_core(to_check, v, occ);
+}
@@ -40,5 +40,6 @@ bool occurs(sort* s1, sort* s2);
 * \brief Mark sub-expressions of to_check by whether v occurs in these.
 */
 void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_mark& occurs);
+void mark_occurs(ptr_vector<expr>& to_check, expr* v, expr_stamp_mark& occurs);
 
 
@@ -27,6 +27,10 @@ Revision History:
 #include "ast/well_sorted.h"
 #include "ast/for_each_expr.h"
 #include "ast/rewriter/rewriter_def.h"
+#include "ast/ast_binary.h"
+#include "util/mutex.h"
+#include <sstream>
+#include <unordered_map>
 
 void smaller_pattern::save(expr * p1, expr * p2) {
     expr_pair e(p1, p2);
@@ -615,7 +619,105 @@ void pattern_inference_cfg::mk_patterns(unsigned num_bindings,
 }
 
 
+static mutex                                         g_pattern_cache_mux;
+static std::unordered_map<std::string, std::string>  g_pattern_cache;
+static const unsigned                                g_max_pattern_cache_size = 1 << 16;
+
+/**
+   \brief the key of a quantifier is the serialization of the quantifier, its rewritten
+   body and no-patterns, followed by the parameters that influence inference.
+   It is empty if the quantifier is not eligible for caching.
+*/
+std::string pattern_inference_cfg::mk_cache_key(quantifier* q, expr* new_body, expr* const* new_no_patterns) {
+    if (!m_params.m_pi_cache || m.proofs_enabled() || !m_preferred.empty())
+        return std::string();
+    ptr_vector<ast> asts;
+    asts.push_back(q);
+    asts.push_back(new_body);
+    for (unsigned i = 0; i < q->get_num_no_patterns(); ++i)
+        asts.push_back(new_no_patterns[i]);
+    std::ostringstream out;
+    try {
+        ast_to_binary(m, asts.size(), asts.data(), out);
+    }
+    catch (default_exception&) {
+        return std::string();
+    }
+    m_params.display(out);
+    for (family_id fid : m_forbidden)
+        out << m.get_family_name(fid) << "\n";
+    return std::move(out).str();
+}
+
+/**
+   \brief retrieve a cached result. An empty result records that inference 
+   did not change the quantifier.
+*/
+bool pattern_inference_cfg::find_cached(std::string const& key, expr_ref& result) {
+    std::string value;
+    {
+        lock_guard lock(g_pattern_cache_mux);
+        auto it = g_pattern_cache.find(key);
+        if (it == g_pattern_cache.end())
+            return false;
+        value = it->second;
+    }
+    result = nullptr;
+    if (value.empty())
+        return true;
+    ast_ref_vector asts(m);
+    std::istringstream in(value);
+    try {
+        ast_from_binary(m, in, asts);
+    }
+    catch (default_exception&) {
+        return false;
+    }
+    if (asts.size() != 1 || !is_quantifier(asts.get(0)))
+        return false;
+    result = to_quantifier(asts.get(0));
+    return true;
+}
+
+void pattern_inference_cfg::cache_result(std::string const& key, expr* result) {
+    std::ostringstream out;
+    if (result) {
+        ast* a = result;
+        try {
+            ast_to_binary(m, 1, &a, out);
+        }
+        catch (default_exception&) {
+            return;
+        }
+    }
+    lock_guard lock(g_pattern_cache_mux);
+    if (g_pattern_cache.size() >= g_max_pattern_cache_size)
+        g_pattern_cache.clear();
+    g_pattern_cache[key] = std::move(out).str();
+}
+
 bool pattern_inference_cfg::reduce_quantifier(
+    quantifier * q, 
+    expr * new_body, 
+    expr * const * new_patterns,
+    expr * const * new_no_patterns,
+    expr_ref & result,
+    proof_ref & result_pr) {
+    if (q->get_num_patterns() > 0 || !is_forall(q) || !m_params.m_pi_enabled || m_params.m_pi_use_database)
+        return reduce_quantifier_core(q, new_body, new_patterns, new_no_patterns, result, result_pr);
+    std::string key = mk_cache_key(q, new_body, new_no_patterns);
+    if (key.empty())
+        return reduce_quantifier_core(q, new_body, new_patterns, new_no_patterns, result, result_pr);
+    if (find_cached(key, result)) {
+        TRACE("pattern_inference", tout << "cached:\n" << mk_pp(q, m) << "\n";);
+        return result.get() != nullptr;
+    }
+    bool r = reduce_quantifier_core(q, new_body, new_patterns, new_no_patterns, result, result_pr);
+    cache_result(key, r ? result.get() : nullptr);
+    return r;
+}
+
+bool pattern_inference_cfg::reduce_quantifier_core(
     quantifier * q, 
     expr * new_body, 
     expr * const *, // new_patterns 
@@ -29,6 +29,7 @@ Revision History:
 #include "util/obj_pair_hashtable.h"
 #include "util/map.h"
 #include "ast/pattern/expr_pattern_match.h"
+#include <string>
 
 /**
    \brief A pattern p_1 is smaller than a pattern p_2 iff 
@@ -239,6 +240,20 @@ public:
                            expr_ref & result,
                            proof_ref & result_pr);
 
+private:
+    bool reduce_quantifier_core(quantifier * old_q, 
+                                expr * new_body, 
+                                expr * const * new_patterns, 
+                                expr * const * new_no_patterns,
+                                expr_ref & result,
+                                proof_ref & result_pr);
+
+    std::string mk_cache_key(quantifier * q, expr * new_body, expr * const * new_no_patterns);
+    bool find_cached(std::string const & key, expr_ref & result);
+    void cache_result(std::string const & key, expr * result);
+
+public:
+
     void register_preferred(unsigned num, func_decl * const * fs) { for (unsigned i = 0; i < num; i++) register_preferred(fs[i]); }
     
     bool is_forbidden(func_decl const * decl) const {
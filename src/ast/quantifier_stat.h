@@ -40,6 +40,7 @@ namespace q {
         unsigned m_num_instances_simplify_true;
         unsigned m_num_instances_curr_search;
         unsigned m_num_instances_curr_branch; //!< only updated if QI_TRACK_INSTANCES is true
+        unsigned m_num_conflicts;  //!< number of instances that were in conflict when they were created
         unsigned m_max_generation; //!< max. generation of an instance
         float    m_max_cost;
 
@@ -99,6 +100,14 @@ namespace q {
             m_num_instances_curr_search++;
         }
 
+        unsigned get_num_conflicts() const {
+            return m_num_conflicts;
+        }
+
+        void inc_num_conflicts() {
+            m_num_conflicts++;
+        }
+
         void inc_num_instances_curr_branch() {
             m_num_instances_curr_branch++;
         }
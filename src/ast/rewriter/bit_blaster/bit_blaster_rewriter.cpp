@@ -97,11 +97,19 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
     unsigned_vector                          m_keyval_lim;
     func_decl_ref_vector                     m_newbits;
     unsigned_vector                          m_newbits_lim;
+    // blasted circuits of expensive operators, keyed by the operator applied to
+    // the blasted arguments. Unlike the rewriter cache, the entries survive
+    // cleanup and are only removed when the scope that created them is popped.
+    obj_map<app, expr*>                      m_blasted;
+    app_ref_vector                           m_blasted_keys;
+    expr_ref_vector                          m_blasted_values;
+    unsigned_vector                          m_blasted_lim;
 
     bool                                     m_blast_mul;
     bool                                     m_blast_add;
     bool                                     m_blast_quant;
     bool                                     m_blast_full;
+    bool                                     m_blast_cache;
     unsigned long long                       m_max_memory;
     unsigned                                 m_max_steps;
 
@@ -124,7 +132,9 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
         m_bindings(m),
         m_keys(m),
         m_values(m),
-        m_newbits(m) {
+        m_newbits(m),
+        m_blasted_keys(m),
+        m_blasted_values(m) {
         updt_params(p);
     }
 
@@ -135,6 +145,7 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
         m_blast_mul      = p.get_bool("blast_mul", true);
         m_blast_full     = p.get_bool("blast_full", false);
         m_blast_quant    = p.get_bool("blast_quant", false);
+        m_blast_cache    = p.get_bool("blast_cache", true);
         m_blaster.set_max_memory(m_max_memory);
     }
 
@@ -163,6 +174,7 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
     void push() {
         m_keyval_lim.push_back(m_keys.size());
         m_newbits_lim.push_back(m_newbits.size());
+        m_blasted_lim.push_back(m_blasted_keys.size());
     }
 
     unsigned get_num_scopes() const {
@@ -185,6 +197,13 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
             lim = m_newbits_lim[new_sz];
             m_newbits.shrink(lim);
             m_newbits_lim.shrink(new_sz);
+
+            lim = m_blasted_lim[new_sz];
+            for (unsigned i = m_blasted_keys.size(); i-- > lim; )
+                m_blasted.remove(m_blasted_keys.get(i));
+            m_blasted_keys.shrink(lim);
+            m_blasted_values.shrink(lim);
+            m_blasted_lim.shrink(new_sz);
         }
     }
 
@@ -377,7 +396,45 @@ MK_PARAMETRIC_UNARY_REDUCE(reduce_sign_extend, mk_sign_extend);
         result_pr = nullptr;
     }
 
+    bool is_cached(func_decl * f) const {
+        if (!m_blast_cache || f->get_family_id() != m_blaster.butil().get_family_id())
+            return false;
+        switch (f->get_decl_kind()) {
+        case OP_BMUL:
+        case OP_BSDIV_I:
+        case OP_BUDIV_I:
+        case OP_BSREM_I:
+        case OP_BUREM_I:
+        case OP_BSMOD_I:
+        case OP_BSHL:
+        case OP_BLSHR:
+        case OP_BASHR:
+            return true;
+        default:
+            return false;
+        }
+    }
+
     br_status reduce_app(func_decl * f, unsigned num, expr * const * args, expr_ref & result, proof_ref & result_pr) {
+        if (!is_cached(f))
+            return reduce_app_core(f, num, args, result, result_pr);
+        app_ref key(m().mk_app(f, num, args), m());
+        expr * r = nullptr;
+        if (m_blasted.find(key, r)) {
+            result = r;
+            result_pr = nullptr;
+            return BR_DONE;
+        }
+        br_status st = reduce_app_core(f, num, args, result, result_pr);
+        if (st == BR_DONE) {
+            m_blasted.insert(key, result);
+            m_blasted_keys.push_back(key);
+            m_blasted_values.push_back(result);
+        }
+        return st;
+    }
+
+    br_status reduce_app_core(func_decl * f, unsigned num, expr * const * args, expr_ref & result, proof_ref & result_pr) {
         result_pr = nullptr;
         TRACE("bit_blaster", tout << f->get_name() << " ";
               for (unsigned i = 0; i < num; ++i) tout << mk_pp(args[i], m()) << " ";
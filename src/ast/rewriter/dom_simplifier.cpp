@@ -96,8 +96,11 @@ bool expr_dominators::compute_dominators() {
               });
 
         SASSERT(m_post2expr.empty() || m_post2expr.back() == e);
-        for (unsigned i = 0; i + 1 < m_post2expr.size(); ++i) {
-            expr * child = m_post2expr[i];
+        // visit nodes in reverse post-order, so that parents are processed before their children.
+        // The formula is a DAG, so the first pass computes the dominators 
+        // and the second pass confirms that they are stable.
+        for (unsigned i = m_post2expr.size(); i-- > 1; ) {
+            expr * child = m_post2expr[i - 1];
             ptr_vector<expr> const& p = m_parents[child];
             expr * new_idom = nullptr, *idom2 = nullptr;
 
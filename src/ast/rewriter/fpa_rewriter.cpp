@@ -19,17 +19,59 @@ Notes:
 #include "ast/rewriter/fpa_rewriter.h"
 #include "params/fpa_rewriter_params.hpp"
 #include "ast/ast_smt2_pp.h"
+#include <cfenv>
 
 fpa_rewriter::fpa_rewriter(ast_manager & m, params_ref const & p) :
     m_util(m),
     m_fm(m_util.fm()),
-    m_hi_fp_unspecified(false) {
+    m_hi_fp_unspecified(false),
+    m_hw_fp_arith(true) {
     updt_params(p);
 }
 
 void fpa_rewriter::updt_params(params_ref const & _p) {
     fpa_rewriter_params p(_p);
     m_hi_fp_unspecified = p.hi_fp_unspecified();
+    m_hw_fp_arith = p.hw_fp_arith();
+}
+
+/**
+   \brief Float64 operations are evaluated with the host FPU on platforms whose
+   double arithmetic is IEEE 754 binary64 without extended intermediate precision.
+   The hardware does not support round-nearest-ties-away, which stays with mpf.
+*/
+bool fpa_rewriter::use_hwf(mpf_rounding_mode rm, mpf const & x) const {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+    return m_hw_fp_arith && rm != MPF_ROUND_NEAREST_TAWAY && x.get_ebits() == 11 && x.get_sbits() == 53;
+#else
+    return false;
+#endif
+}
+
+/**
+   \brief evaluate k on Float64 arguments with hwf_manager.
+   The conversions between mpf and double are exact; the rounding mode
+   of the host is restored afterwards.
+*/
+void fpa_rewriter::hwf_op(decl_kind k, mpf_rounding_mode rm, unsigned num_args, mpf const * const * args, mpf & r) {
+    SASSERT(num_args <= 3);
+    hwf a[3], o;
+    for (unsigned i = 0; i < num_args; ++i)
+        m_hwf.set(a[i], m_fm.to_double(*args[i]));
+    int old_rm = std::fegetround();
+    switch (k) {
+    case OP_FPA_ADD:  m_hwf.add(rm, a[0], a[1], o); break;
+    case OP_FPA_MUL:  m_hwf.mul(rm, a[0], a[1], o); break;
+    case OP_FPA_DIV:  m_hwf.div(rm, a[0], a[1], o); break;
+    case OP_FPA_FMA:  m_hwf.fma(rm, a[0], a[1], a[2], o); break;
+    case OP_FPA_SQRT: m_hwf.sqrt(rm, a[0], o); break;
+    default: UNREACHABLE(); break;
+    }
+    std::fesetround(old_rm);
+    if (m_hwf.is_nan(o))
+        m_fm.mk_nan(11, 53, r);
+    else
+        m_fm.set(r, 11, 53, m_hwf.to_double(o));
 }
 
 void fpa_rewriter::get_param_descrs(param_descrs & r) {
@@ -262,7 +304,12 @@ br_status fpa_rewriter::mk_add(expr * arg1, expr * arg2, expr * arg3, expr_ref &
         scoped_mpf v2(m_fm), v3(m_fm);
         if (m_util.is_numeral(arg2, v2) && m_util.is_numeral(arg3, v3)) {
             scoped_mpf t(m_fm);
-            m_fm.add(rm, v2, v3, t);
+            if (use_hwf(rm, v2)) {
+                mpf const * vs[2] = { &v2.get(), &v3.get() };
+                hwf_op(OP_FPA_ADD, rm, 2, vs, t);
+            }
+            else
+                m_fm.add(rm, v2, v3, t);
             result = m_util.mk_value(t);
             return BR_DONE;
         }
@@ -284,7 +331,12 @@ br_status fpa_rewriter::mk_mul(expr * arg1, expr * arg2, expr * arg3, expr_ref &
         scoped_mpf v2(m_fm), v3(m_fm);
         if (m_util.is_numeral(arg2, v2) && m_util.is_numeral(arg3, v3)) {
             scoped_mpf t(m_fm);
-            m_fm.mul(rm, v2, v3, t);
+            if (use_hwf(rm, v2)) {
+                mpf const * vs[2] = { &v2.get(), &v3.get() };
+                hwf_op(OP_FPA_MUL, rm, 2, vs, t);
+            }
+            else
+                m_fm.mul(rm, v2, v3, t);
             result = m_util.mk_value(t);
             return BR_DONE;
         }
@@ -300,7 +352,12 @@ br_status fpa_rewriter::mk_div(expr * arg1, expr * arg2, expr * arg3, expr_ref &
         scoped_mpf v2(m_fm), v3(m_fm);
         if (m_util.is_numeral(arg2, v2) && m_util.is_numeral(arg3, v3)) {
             scoped_mpf t(m_fm);
-            m_fm.div(rm, v2, v3, t);
+            if (use_hwf(rm, v2)) {
+                mpf const * vs[2] = { &v2.get(), &v3.get() };
+                hwf_op(OP_FPA_DIV, rm, 2, vs, t);
+            }
+            else
+                m_fm.div(rm, v2, v3, t);
             result = m_util.mk_value(t);
             return BR_DONE;
         }
@@ -424,7 +481,12 @@ br_status fpa_rewriter::mk_fma(expr * arg1, expr * arg2, expr * arg3, expr * arg
         scoped_mpf v2(m_fm), v3(m_fm), v4(m_fm);
         if (m_util.is_numeral(arg2, v2) && m_util.is_numeral(arg3, v3) && m_util.is_numeral(arg4, v4)) {
             scoped_mpf t(m_fm);
-            m_fm.fma(rm, v2, v3, v4, t);
+            if (use_hwf(rm, v2)) {
+                mpf const * vs[3] = { &v2.get(), &v3.get(), &v4.get() };
+                hwf_op(OP_FPA_FMA, rm, 3, vs, t);
+            }
+            else
+                m_fm.fma(rm, v2, v3, v4, t);
             result = m_util.mk_value(t);
             return BR_DONE;
         }
@@ -440,7 +502,12 @@ br_status fpa_rewriter::mk_sqrt(expr * arg1, expr * arg2, expr_ref & result) {
         scoped_mpf v2(m_fm);
         if (m_util.is_numeral(arg2, v2)) {
             scoped_mpf t(m_fm);
-            m_fm.sqrt(rm, v2, t);
+            if (use_hwf(rm, v2)) {
+                mpf const * vs[1] = { &v2.get() };
+                hwf_op(OP_FPA_SQRT, rm, 1, vs, t);
+            }
+            else
+                m_fm.sqrt(rm, v2, t);
             result = m_util.mk_value(t);
             return BR_DONE;
         }
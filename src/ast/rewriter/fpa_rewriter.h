@@ -24,11 +24,17 @@ Notes:
 #include "ast/expr_map.h"
 #include "util/params.h"
 #include "util/mpf.h"
+#include "util/hwf.h"
 
 class fpa_rewriter {
     fpa_util      m_util;
     mpf_manager & m_fm;
+    hwf_manager   m_hwf;
     bool          m_hi_fp_unspecified;
+    bool          m_hw_fp_arith;
+
+    bool use_hwf(mpf_rounding_mode rm, mpf const & x) const;
+    void hwf_op(decl_kind k, mpf_rounding_mode rm, unsigned num_args, mpf const * const * args, mpf & r);
 
     app * mk_eq_nan(expr * arg);
     app * mk_neq_nan(expr * arg);
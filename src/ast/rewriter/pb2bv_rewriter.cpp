@@ -555,6 +555,7 @@ struct pb2bv_rewriter::imp {
             if (!k.is_unsigned()) {
                 return result;
             }
+            pin(m_args.size(), m_args.data());
             switch (is_le) {
             case l_true: 
                 result = m_sort.le(k.get_unsigned(), coeffs.size(), coeffs.data(), m_args.data());
@@ -761,7 +762,15 @@ struct pb2bv_rewriter::imp {
             m_keep_cardinality_constraints(false),
             m_pb_solver(symbol("solver")),
             m_min_arity(9)
-        {}
+        {
+            m_sort.cfg().m_cache = true;
+        }
+
+        // networks shared by m_sort refer to their inputs.
+        void pin(unsigned sz, expr* const* args) {
+            for (unsigned i = 0; i < sz; ++i)
+                trail(args[i]);
+        }
 
         void set_pb_solver(symbol const& s) { m_pb_solver = s; }
 
@@ -883,6 +892,7 @@ struct pb2bv_rewriter::imp {
 
         bool mk_pb(bool full, func_decl * f, unsigned sz, expr * const* args, expr_ref & result) {
             SASSERT(f->get_family_id() == pb.get_family_id());
+            pin(sz, args);
             if (is_or(f)) {
                 result = m.mk_or(sz, args);
             }
@@ -1055,6 +1065,7 @@ struct pb2bv_rewriter::imp {
         if (enc == symbol("ordered")) return sorting_network_encoding::ordered_at_most;
         if (enc == symbol("unate")) return sorting_network_encoding::unate_at_most;
         if (enc == symbol("circuit")) return sorting_network_encoding::circuit_at_most;
+        if (enc == symbol("adaptive")) return sorting_network_encoding::adaptive_at_most;
         return sorting_network_encoding::grouped_at_most;
     }
     
@@ -1080,7 +1091,7 @@ struct pb2bv_rewriter::imp {
     void collect_param_descrs(param_descrs& r) const {
         r.insert("keep_cardinality_constraints", CPK_BOOL, "retain cardinality constraints (don't bit-blast them) and use built-in cardinality solver", "false");
         r.insert("pb.solver", CPK_SYMBOL, "encoding used for Pseudo-Boolean constraints: totalizer, sorting, binary_merge, bv, solver. PB constraints are retained if set to 'solver'", "solver");
-        r.insert("cardinality.encoding", CPK_SYMBOL, "encoding used for cardinality constraints: grouped, bimander, ordered, unate, circuit", "none");
+        r.insert("cardinality.encoding", CPK_SYMBOL, "encoding used for cardinality constraints: grouped, bimander, ordered, unate, circuit, adaptive", "none");
     }
 
     unsigned get_num_steps() const { return m_rw.get_num_steps(); }
@@ -1102,6 +1113,7 @@ struct pb2bv_rewriter::imp {
             m_fresh_lim.resize(new_sz);
         }
         m_rw.reset();
+        m_rw.m_cfg.m_r.m_sort.reset_cache();
     }
 
     void flush_side_constraints(expr_ref_vector& side_constraints) { 
@@ -1114,6 +1126,7 @@ struct pb2bv_rewriter::imp {
         st.update("pb-compile-card", m_compile_card);
         st.update("pb-aux-variables", m_fresh.size());
         st.update("pb-aux-clauses", m_rw.m_cfg.m_r.m_sort.m_stats.m_num_compiled_clauses);
+        st.update("pb-shared-networks", m_rw.m_cfg.m_r.m_sort.m_stats.m_num_cache_hits);
     }
 
 };
@@ -616,10 +616,12 @@ br_status poly_rewriter<Config>::mk_nflat_add_core(unsigned num_args, expr * con
         }
         if (m_sort_sums) {
             TRACE("rewriter_bug", tout << "new_args.size(): " << new_args.size() << "\n";);
-            if (c.is_zero())
-                std::sort(new_args.data(), new_args.data() + new_args.size(), mon_lt(*this));
-            else
-                std::sort(new_args.data() + 1, new_args.data() + new_args.size(), mon_lt(*this));
+            // sums are usually in normal form already during fixpoints, avoid re-sorting them.
+            expr** begin = new_args.data() + (c.is_zero() ? 0 : 1);
+            expr** end = new_args.data() + new_args.size();
+            mon_lt mlt(*this);
+            if (!std::is_sorted(begin, end, mlt))
+                std::sort(begin, end, mlt);
         }
         result = mk_add_app(new_args.size(), new_args.data());
         TRACE("rewriter", tout << result << "\n";);
@@ -856,7 +858,8 @@ br_status poly_rewriter<Config>::cancel_monomials(expr * lhs, expr * rhs, bool m
     if (move) {
         if (m_sort_sums) { 
             // + 1 to skip coefficient
-            std::sort(new_lhs_monomials.begin() + 1, new_lhs_monomials.end(), lt);
+            if (!std::is_sorted(new_lhs_monomials.begin() + 1, new_lhs_monomials.end(), lt))
+                std::sort(new_lhs_monomials.begin() + 1, new_lhs_monomials.end(), lt);
         }
         c_at_rhs = true;
     }
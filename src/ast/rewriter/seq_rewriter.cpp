@@ -234,9 +234,18 @@ public:
 
 };
 
-re2automaton::re2automaton(ast_manager& m): m(m), u(m), m_ba(nullptr), m_sa(nullptr) {}
+re2automaton::re2automaton(ast_manager& m): m(m), u(m), m_ba(nullptr), m_sa(nullptr), m_cache_pinned(m) {}
+
+void re2automaton::reset_cache() {
+    for (auto const& kv : m_cache)
+        dealloc(kv.m_value);
+    m_cache.reset();
+    m_cache_pinned.reset();
+}
 
 void re2automaton::set_solver(expr_solver* solver) {
+    // complements and intersections are only built with a solver
+    reset_cache();
     m_solver = solver;
     m_ba = alloc(sym_expr_boolean_algebra, m, *solver);
     m_sa = alloc(symbolic_automata_t, sm, *m_ba.get());
@@ -271,6 +280,18 @@ bool re2automaton::is_unit_char(expr* e, expr_ref& ch) {
 }
 
 eautomaton* re2automaton::re2aut(expr* e) {
+    eautomaton* a = nullptr;
+    if (m_cache.find(e, a))
+        return a ? eautomaton::clone(*a) : nullptr;
+    a = mk_re2aut(e);
+    if (m_cache.size() >= m_max_cache_size)
+        reset_cache();
+    m_cache.insert(e, a ? eautomaton::clone(*a) : nullptr);
+    m_cache_pinned.push_back(e);
+    return a;
+}
+
+eautomaton* re2automaton::mk_re2aut(expr* e) {
     SASSERT(u.is_re(e));
     expr *e0, *e1, *e2;
     scoped_ptr<eautomaton> a, b;
@@ -401,6 +422,7 @@ eautomaton* re2automaton::seq2aut(expr* e) {
 void seq_rewriter::updt_params(params_ref const & p) {
     seq_rewriter_params sp(p);
     m_coalesce_chars = sp.coalesce_chars();
+    m_op_cache.set_max_size(sp.regex_cache_size());
 }
 
 void seq_rewriter::get_param_descrs(param_descrs & r) {
@@ -6088,32 +6110,3 @@ bool seq_rewriter::reduce_subsequence(expr_ref_vector& ls, expr_ref_vector& rs,
     return true;
 } 
 
-seq_rewriter::op_cache::op_cache(ast_manager& m):
-    m_trail(m)
-{}
-
-expr* seq_rewriter::op_cache::find(decl_kind op, expr* a, expr* b, expr* c) {
-    op_entry e(op, a, b, c, nullptr);
-    m_table.find(e, e);
-
-    return e.r;
-}
-
-void seq_rewriter::op_cache::insert(decl_kind op, expr* a, expr* b, expr* c, expr* r) {
-    cleanup();
-    if (a) m_trail.push_back(a);
-    if (b) m_trail.push_back(b);
-    if (c) m_trail.push_back(c);
-    if (r) m_trail.push_back(r);
-    m_table.insert(op_entry(op, a, b, c, r));
-}
-
-void seq_rewriter::op_cache::cleanup() {
-    if (m_table.size() >= m_max_cache_size) {
-        m_trail.reset();
-        m_table.reset();
-        STRACE("seq_regex", tout << "Op cache reset!" << std::endl;);
-        STRACE("seq_regex_brief", tout << "(OP CACHE RESET) ";);
-        STRACE("seq_verbose", tout << "Derivative op cache reset" << std::endl;);
-    }
-}
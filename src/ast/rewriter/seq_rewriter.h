@@ -97,12 +97,20 @@ class re2automaton {
     scoped_ptr<expr_solver>         m_solver;
     scoped_ptr<boolean_algebra_t>   m_ba;
     scoped_ptr<symbolic_automata_t> m_sa;
+    // automata of regular expressions built so far, keyed by the
+    // (hash-consed) expression. Callers receive copies.
+    obj_map<expr, eautomaton*>      m_cache;
+    expr_ref_vector                 m_cache_pinned;
+    static const unsigned           m_max_cache_size = 1000;
 
     bool is_unit_char(expr* e, expr_ref& ch);
     eautomaton* re2aut(expr* e);
+    eautomaton* mk_re2aut(expr* e);
     eautomaton* seq2aut(expr* e);
+    void reset_cache();
 public:
     re2automaton(ast_manager& m);
+    ~re2automaton() { reset_cache(); }
     eautomaton* operator()(expr* e);
     void set_solver(expr_solver* solver);
     bool has_solver() const { return m_solver; }
@@ -114,44 +122,11 @@ public:
 */
 class seq_rewriter {
 
-    class op_cache {
-        struct op_entry {
-            decl_kind k;
-            expr* a, *b, *c, *r;
-            op_entry(decl_kind k, expr* a, expr* b, expr* c, expr* r): k(k), a(a), b(b), c(c), r(r) {}
-            op_entry():k(0), a(nullptr), b(nullptr), c(nullptr), r(nullptr) {}
-        };
-
-        struct hash_entry {
-            unsigned operator()(op_entry const& e) const { 
-                return combine_hash(mk_mix(e.k, e.a ? e.a->get_id() : 0, e.b ? e.b->get_id() : 0), e.c ? e.c->get_id() : 0);
-            }
-        };
-
-        struct eq_entry {
-            bool operator()(op_entry const& a, op_entry const& b) const {
-                return a.k == b.k && a.a == b.a && a.b == b.b && a.c == b.c;
-            }
-        };
-
-        typedef hashtable<op_entry, hash_entry, eq_entry> op_table;
-
-        unsigned        m_max_cache_size { 10000 };
-        expr_ref_vector m_trail;
-        op_table        m_table;
-        void cleanup();
-
-    public:
-        op_cache(ast_manager& m);
-        expr* find(decl_kind op, expr* a, expr* b, expr* c);
-        void insert(decl_kind op, expr* a, expr* b, expr* c, expr* r);
-    };
-
     seq_util       m_util;
     arith_util     m_autil;
     bool_rewriter  m_br;
     re2automaton   m_re2aut;
-    op_cache       m_op_cache;
+    expr_op_cache& m_op_cache;
     expr_ref_vector m_es, m_lhs, m_rhs;
     bool           m_coalesce_chars;    
 
@@ -355,7 +330,7 @@ class seq_rewriter {
 
 public:
     seq_rewriter(ast_manager & m, params_ref const & p = params_ref()):
-        m_util(m), m_autil(m), m_br(m, p), m_re2aut(m), m_op_cache(m), m_es(m), 
+        m_util(m), m_autil(m), m_br(m, p), m_re2aut(m), m_op_cache(m_util.op_cache()), m_es(m), 
         m_lhs(m), m_rhs(m), m_coalesce_chars(true) {
     }
     ast_manager & m() const { return m_util.get_manager(); }
@@ -371,6 +346,8 @@ public:
 
     bool coalesce_chars() const { return m_coalesce_chars; }
 
+    void collect_statistics(statistics& st) const { m_op_cache.collect_statistics(st); }
+
     br_status mk_app_core(func_decl * f, unsigned num_args, expr * const * args, expr_ref & result);
     br_status mk_eq_core(expr * lhs, expr * rhs, expr_ref & result);
     br_status mk_le_core(expr* lhs, expr* rhs, expr_ref& result);
@@ -16,6 +16,7 @@ Author:
 Notes:
 
 --*/
+#include <sstream>
 #include "params/rewriter_params.hpp"
 #include "params/poly_rewriter_params.hpp"
 #include "ast/rewriter/th_rewriter.h"
@@ -41,6 +42,7 @@ Notes:
 #include "ast/well_sorted.h"
 #include "ast/for_each_expr.h"
 #include "ast/array_peq.h"
+#include "ast/expr_op_cache.h"
 
 namespace {
 struct th_rewriter_cfg : public default_rewriter_cfg {
@@ -78,6 +80,7 @@ struct th_rewriter_cfg : public default_rewriter_cfg {
     bool                m_rewrite_patterns = true;
     bool                m_enable_der = true;
     bool                m_nested_der = false;
+    unsigned            m_memo_size = 0;
 
 
     ast_manager & m() const { return m_b_rw.m(); }
@@ -96,6 +99,7 @@ struct th_rewriter_cfg : public default_rewriter_cfg {
         m_rewrite_patterns = p.rewrite_patterns();
         m_enable_der     = p.enable_der();
         m_nested_der     = _p.get_bool("nested_der", false);
+        m_memo_size      = p.memo_size();
     }
 
     void updt_params(params_ref const & p) {
@@ -911,9 +915,44 @@ struct th_rewriter_cfg : public default_rewriter_cfg {
 
 struct th_rewriter::imp : public rewriter_tpl<th_rewriter_cfg> {
     th_rewriter_cfg m_cfg;
+    unsigned        m_memo_key = 0;      // fingerprint of the parameters, part of the key of memoized results
+    bool            m_has_solver = false;
     imp(ast_manager & m, params_ref const & p):
         rewriter_tpl<th_rewriter_cfg>(m, m.proofs_enabled(), m_cfg),
         m_cfg(m, p) {
+        updt_memo(p);
+    }
+
+    void updt_memo(params_ref const & p) {
+        if (m_cfg.m_memo_size == 0)
+            return;
+        std::ostringstream strm;
+        p.display(strm);
+        gparams::get_module("rewriter").display(strm);
+        strm << m_cfg.m_b_rw.flat_and_or() << m_cfg.m_b_rw.order_eq();
+        std::string s = strm.str();
+        m_memo_key = string_hash(s.c_str(), static_cast<unsigned>(s.length()), 17);
+        m().get_rewrite_cache().set_max_size(m_cfg.m_memo_size);
+    }
+
+    // top-level results are shared when they only depend on the term and the parameters
+    bool use_memo() const {
+        return m_cfg.m_memo_size > 0 && !m_cfg.m_subst && !m_has_solver && !m().proofs_enabled();
+    }
+
+    bool find_memo(expr * t, expr_ref & result) {
+        if (!use_memo())
+            return false;
+        expr * r = m().get_rewrite_cache().find(static_cast<decl_kind>(m_memo_key), t, nullptr, nullptr);
+        if (!r)
+            return false;
+        result = r;
+        return true;
+    }
+
+    void insert_memo(expr * t, expr * r) {
+        if (use_memo() && m().inc())
+            m().get_rewrite_cache().insert(static_cast<decl_kind>(m_memo_key), t, nullptr, nullptr, r);
     }
     expr_ref mk_app(func_decl* f, unsigned sz, expr* const* args) {
         return m_cfg.mk_app(f, sz, args);
@@ -925,6 +964,7 @@ struct th_rewriter::imp : public rewriter_tpl<th_rewriter_cfg> {
 
     void set_solver(expr_solver* solver) {
         m_cfg.m_seq_rw.set_solver(solver);
+        m_has_solver = solver != nullptr;
     }
 };
 
@@ -940,6 +980,7 @@ ast_manager & th_rewriter::m() const {
 void th_rewriter::updt_params(params_ref const & p) {
     m_params.append(p);
     m_imp->cfg().updt_params(m_params);
+    m_imp->updt_memo(m_params);
 }
 
 void th_rewriter::get_param_descrs(param_descrs & r) {
@@ -952,10 +993,12 @@ void th_rewriter::get_param_descrs(param_descrs & r) {
 
 void th_rewriter::set_flat_and_or(bool f) {
     m_imp->cfg().m_b_rw.set_flat_and_or(f);
+    m_imp->updt_memo(m_params);
 }
 
 void th_rewriter::set_order_eq(bool f) {
     m_imp->cfg().m_b_rw.set_order_eq(f);
+    m_imp->updt_memo(m_params);
 }
 
 th_rewriter::~th_rewriter() {
@@ -970,6 +1013,11 @@ unsigned th_rewriter::get_num_steps() const {
     return m_imp->get_num_steps();
 }
 
+void th_rewriter::collect_statistics(statistics & st) const {
+    if (m_imp->cfg().m_memo_size > 0)
+        m().get_rewrite_cache().collect_statistics(st);
+}
+
 void th_rewriter::cleanup() {
     ast_manager & m = m_imp->m();
     m_imp->~imp();
@@ -984,7 +1032,10 @@ void th_rewriter::reset() {
 void th_rewriter::operator()(expr_ref & term) {
     expr_ref result(term.get_manager());    
     try {
-        m_imp->operator()(term, result);
+        if (!m_imp->find_memo(term, result)) {
+            m_imp->operator()(term, result);
+            m_imp->insert_memo(term, result);
+        }
         term = std::move(result);
     }
     catch (...) {
@@ -996,7 +1047,10 @@ void th_rewriter::operator()(expr_ref & term) {
 
 void th_rewriter::operator()(expr * t, expr_ref & result) {
     try {
+        if (m_imp->find_memo(t, result))
+            return;
         m_imp->operator()(t, result);
+        m_imp->insert_memo(t, result);
     }
     catch (...) {
         result = t;
@@ -1008,7 +1062,12 @@ void th_rewriter::operator()(expr * t, expr_ref & result) {
 
 void th_rewriter::operator()(expr * t, expr_ref & result, proof_ref & result_pr) {
     try {
+        if (m_imp->find_memo(t, result)) {
+            result_pr = nullptr;
+            return;
+        }
         m_imp->operator()(t, result, result_pr);
+        m_imp->insert_memo(t, result);
     }
     catch (...) {
         result = t;
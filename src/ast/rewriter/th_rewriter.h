@@ -21,6 +21,7 @@ Notes:
 #include "ast/ast.h"
 #include "ast/rewriter/rewriter_types.h"
 #include "util/params.h"
+#include "util/statistics.h"
 
 class expr_substitution;
 
@@ -44,6 +45,7 @@ public:
 
     unsigned get_cache_size() const;
     unsigned get_num_steps() const;
+    void collect_statistics(statistics & st) const;
    
     void operator()(expr_ref& term);
     void operator()(expr * t, expr_ref & result);
@@ -35,11 +35,19 @@ seq_decl_plugin::seq_decl_plugin(): m_init(false),
 void seq_decl_plugin::finalize() {
     for (psig* s : m_sigs) 
         dealloc(s);
+    dealloc(m_op_cache);
+    m_op_cache = nullptr;
     m_manager->dec_ref(m_string);
     m_manager->dec_ref(m_char);
     m_manager->dec_ref(m_reglan);
 }
 
+expr_op_cache& seq_decl_plugin::get_op_cache() {
+    if (!m_op_cache)
+        m_op_cache = alloc(expr_op_cache, *m_manager, "seq regex cache hits", "seq regex cache misses", "seq regex cache evictions");
+    return *m_op_cache;
+}
+
 bool seq_decl_plugin::is_sort_param(sort* s, unsigned& idx) {
     return
         s->get_name().is_numerical() &&
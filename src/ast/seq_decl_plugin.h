@@ -24,6 +24,7 @@ Revision History:
 
 #include "ast/ast.h"
 #include "ast/char_decl_plugin.h"
+#include "ast/expr_op_cache.h"
 #include "util/lbool.h"
 #include "util/zstring.h"
 
@@ -139,6 +140,7 @@ class seq_decl_plugin : public decl_plugin {
     bool             m_has_re;
     bool             m_has_seq;
     char_decl_plugin* m_char_plugin { nullptr };
+    expr_op_cache*   m_op_cache { nullptr };
 
 
     void add_map_sig();
@@ -214,6 +216,11 @@ public:
 
     char_decl_plugin& get_char_plugin() const { return *m_char_plugin; }
 
+    /**
+       \brief Cache of regex operations shared by the users of this plugin.
+    */
+    expr_op_cache& get_op_cache();
+
 };
 
 class seq_util {
@@ -229,6 +236,8 @@ public:
 
     ast_manager& get_manager() const { return m; }
 
+    expr_op_cache& op_cache() const { return seq.get_op_cache(); }
+
     sort* mk_char_sort() const { return seq.char_sort(); }
     sort* mk_string_sort() const { return seq.string_sort(); }
 
@@ -30,6 +30,7 @@ void bit_blaster_simplifier::collect_param_descrs(param_descrs & r) {
     r.insert("blast_add", CPK_BOOL, "(default: true) bit-blast adders.");
     r.insert("blast_quant", CPK_BOOL, "(default: false) bit-blast quantified variables.");
     r.insert("blast_full", CPK_BOOL, "(default: false) bit-blast any term with bit-vector sort, this option will make E-matching ineffective in any pattern containing bit-vector terms.");
+    r.insert("blast_cache", CPK_BOOL, "(default: true) keep the circuits of multipliers, dividers and shifters across calls and inner scopes.");
 }
 
 void bit_blaster_simplifier::reduce() {                            
@@ -96,26 +96,37 @@ namespace bv {
         if (hi - lo + 1 == sz)
             return;
         SASSERT(0 < lo || hi + 1 < sz);
-        auto& b = m_boundaries.insert_if_not_there(x, uint_set());
+        if (!m_boundaries.contains(x)) {
+            m_boundaries.insert(x, uint_set());
+            m_pinned.push_back(x);
+            if (num_scopes() > 0) {
+                m_trail.push(push_back_vector(m_pinned));
+                m_trail.push(insert_obj_map(m_boundaries, x));
+            }
+        }
 
+        // the set is looked up on undo because entries move when m_boundaries grows.
         struct remove_set : public trail {
-            uint_set& b;
+            obj_map<expr, uint_set>& m;
+            expr* x;
             unsigned i;
-            remove_set(uint_set& b, unsigned i) :b(b), i(i) {}
+            remove_set(obj_map<expr, uint_set>& m, expr* x, unsigned i) :m(m), x(x), i(i) {}
             void undo() override {
-                b.remove(i);
+                m.find(x).remove(i);
             }
         };
-        if (lo > 0 && !b.contains(lo)) {
-            b.insert(lo); 
-            if (num_scopes() > 0)
-                m_trail.push(remove_set(b, lo));
-        }
-        if (hi + 1 < sz && !b.contains(hi + 1)) {
-            b.insert(hi + 1); 
+        auto add_cut = [&](unsigned i) {
+            uint_set& b = m_boundaries.find(x);
+            if (b.contains(i))
+                return;
+            b.insert(i);
             if (num_scopes() > 0)
-                m_trail.push(remove_set(b, hi+ 1));
-        }
+                m_trail.push(remove_set(m_boundaries, x, i));
+        };
+        if (lo > 0)
+            add_cut(lo);
+        if (hi + 1 < sz)
+            add_cut(hi + 1);
     }
 
     expr* slice::mk_extract(unsigned hi, unsigned lo, expr* x) {
@@ -172,12 +183,12 @@ namespace bv {
                     else
                         cache.setx(e->get_id(), e);
                     SASSERT(e->get_sort() == cache.get(e->get_id())->get_sort());
-                    uint_set b;
-                    if (m_boundaries.find(e, b)) {
+                    auto* b = m_boundaries.find_core(e);
+                    if (b) {
                         expr* r = cache.get(e->get_id());
                         expr_ref_vector xs(m);
                         unsigned lo = 0;
-                        for (unsigned hi : b) {
+                        for (unsigned hi : b->get_data().m_value) {
                             xs.push_back(mk_extract(hi - 1, lo, r));
                             lo = hi;
                         }
@@ -33,7 +33,8 @@ namespace bv {
     class slice : public dependent_expr_simplifier {
         bv_util                 m_bv;
         th_rewriter             m_rewriter;
-        obj_map<expr, uint_set> m_boundaries;
+        obj_map<expr, uint_set> m_boundaries;    // cut points of sliced terms, maintained across calls
+        expr_ref_vector         m_pinned;        // keys of m_boundaries
         ptr_vector<expr>        m_xs, m_ys;
         
         expr* mk_extract(unsigned hi, unsigned lo, expr* x);
@@ -46,7 +47,7 @@ namespace bv {
         
     public:
 
-        slice(ast_manager& m, dependent_expr_state& fmls) : dependent_expr_simplifier(m, fmls), m_bv(m), m_rewriter(m) {}
+        slice(ast_manager& m, dependent_expr_state& fmls) : dependent_expr_simplifier(m, fmls), m_bv(m), m_rewriter(m), m_pinned(m) {}
         char const* name() const override { return "bv-slice"; }
         void push() override { dependent_expr_simplifier::push(); }
         void pop(unsigned n) override { dependent_expr_simplifier::pop(n); }
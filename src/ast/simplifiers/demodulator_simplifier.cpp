@@ -22,8 +22,54 @@ void demodulator_index::reset() {
         dealloc(v);
     for (auto& [k, v] : m_bwd_index)
         dealloc(v);
+    for (auto& [k, v] : m_lhs2ids)
+        dealloc(v);
     m_fwd_index.reset();
     m_bwd_index.reset();
+    m_lhs2ids.reset();
+    m_lhs_tree.reset();
+}
+
+void demodulator_index::insert_fwd(app* lhs, unsigned i) {
+    add(lhs->get_decl(), i, m_fwd_index);
+    uint_set* s;
+    if (!m_lhs2ids.find(lhs, s)) {
+        s = alloc(uint_set);
+        m_lhs2ids.insert(lhs, s);
+        m_lhs_tree.insert(lhs);
+    }
+    s->insert(i);
+}
+
+void demodulator_index::remove_fwd(app* lhs, unsigned i) {
+    del(lhs->get_decl(), i, m_fwd_index);
+    uint_set* s;
+    if (!m_lhs2ids.find(lhs, s) || !s->contains(i))
+        return;
+    s->remove(i);
+    if (s->empty()) {
+        m_lhs_tree.erase(lhs);
+        m_lhs2ids.remove(lhs);
+        dealloc(s);
+    }
+}
+
+void demodulator_index::find_fwd(app* t, uint_set& result) {
+    struct collect : public st_visitor {
+        demodulator_index& idx;
+        uint_set& result;
+        collect(demodulator_index& idx, uint_set& r): st_visitor(idx.m_subst), idx(idx), result(r) {}
+        bool operator()(expr* e) override {
+            uint_set* s = nullptr;
+            if (is_app(e) && idx.m_lhs2ids.find(to_app(e), s))
+                for (unsigned i : *s)
+                    result.insert(i);
+            return true;
+        }
+    };
+    m_subst.reset();
+    collect v(*this, result);
+    m_lhs_tree.gen(t, v);
 }
 
 void demodulator_index::add(func_decl* f, unsigned i, obj_map<func_decl, uint_set*>& map) {
@@ -118,6 +164,14 @@ bool demodulator_simplifier::rewrite1(func_decl* f, expr_ref_vector const& args,
 
     TRACE("demodulator", tout << "trying to rewrite: " << f->get_name() << " args:" << args << "\n"; m_index.display(tout));
 
+    // with many demodulators for f, only try those that can generalize f(args).
+    if (set->num_elems() > 8) {
+        m_candidates.reset();
+        app_ref t(m.mk_app(f, args.size(), args.data()), m);
+        m_index.find_fwd(t, m_candidates);
+        set = &m_candidates;
+    }
+
     for (unsigned i : *set) {
 
         auto const& [lhs, rhs] = m_rewrites[i];
@@ -151,7 +205,6 @@ void demodulator_simplifier::reschedule_processed(func_decl* f) {
             tmp.insert(i);
     for (auto i : tmp) {
         m_processed.remove(i);
-        m_index.remove_fwd(f, i);
         m_index.remove_bwd(fml(i), i);
         m_todo.push_back(i);
     }
@@ -169,7 +222,7 @@ void demodulator_simplifier::reschedule_demodulators(func_decl* f, expr* lhs) {
         if (!m_match_subst.can_rewrite(fml(i), lhs))
             continue;
         SASSERT(f == p.first->get_decl());
-        m_index.remove_fwd(f, i);
+        m_index.remove_fwd(p.first, i);
         m_index.remove_bwd(fml(i), i);
         m_todo.push_back(i);
     }
@@ -184,6 +237,7 @@ void demodulator_simplifier::reset() {
     for (unsigned i : indices())
         max_vid = std::max(max_vid, m_util.max_var_id(fml(i)));
     m_match_subst.reserve(max_vid);
+    m_index.reserve_vars(max_vid + 1);
 }
 
 void demodulator_simplifier::reduce() {
@@ -202,7 +256,7 @@ void demodulator_simplifier::reduce() {
             TRACE("demodulator", tout << i << " " << mk_pp(fml(i), m) << ": " << large << " ==> " << small << "\n");
             reschedule_processed(f);
             reschedule_demodulators(f, large);
-            m_index.insert_fwd(f, i);
+            m_index.insert_fwd(large, i);
             m_rewrites.insert(i, app_expr_pair(large, small));
             m_pinned.push_back(large);
             m_pinned.push_back(small);
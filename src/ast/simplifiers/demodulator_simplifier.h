@@ -14,23 +14,35 @@ Author:
 #pragma once
 
 #include "ast/substitution/demodulator_rewriter.h"
+#include "ast/substitution/substitution_tree.h"
 #include "ast/simplifiers/dependent_expr_state.h"
 #include "util/uint_set.h"
 
 class demodulator_index {
     ast_manager& m;
     obj_map<func_decl, uint_set*> m_fwd_index, m_bwd_index; 
+    // left-hand sides of demodulators, indexed for generalization queries
+    // when a function symbol has many demodulators.
+    substitution_tree             m_lhs_tree;
+    obj_map<app, uint_set*>       m_lhs2ids;
+    substitution                  m_subst;
     void add(func_decl* f, unsigned i, obj_map<func_decl, uint_set*>& map);
     void del(func_decl* f, unsigned i, obj_map<func_decl, uint_set*>& map);
  public:
-    demodulator_index(ast_manager& m): m(m) {}
+    demodulator_index(ast_manager& m): m(m), m_lhs_tree(m), m_subst(m) {}
     ~demodulator_index();
     void reset();
-    void insert_fwd(func_decl* f, unsigned i) { add(f, i, m_fwd_index); }
-    void remove_fwd(func_decl* f, unsigned i) { del(f, i, m_fwd_index); }
+    void reserve_vars(unsigned num_vars) { m_subst.reserve(3, num_vars); }
+    void insert_fwd(app* lhs, unsigned i);
+    void remove_fwd(app* lhs, unsigned i);
     void insert_bwd(expr* e, unsigned i);
     void remove_bwd(expr* e, unsigned i);
     bool find_fwd(func_decl* f, uint_set*& s) { return m_fwd_index.find(f, s); }
+    /**
+       \brief retrieve demodulators whose left-hand side may generalize t.
+       The result over-approximates the demodulators that match t.
+    */
+    void find_fwd(app* t, uint_set& result);
     bool find_bwd(func_decl* f, uint_set*& s) { return m_bwd_index.find(f, s); }
     bool empty() const { return m_fwd_index.empty(); }
     std::ostream& display(std::ostream& out) const;
@@ -43,7 +55,7 @@ class demodulator_simplifier : public dependent_expr_simplifier {
     demodulator_match_subst   m_match_subst;
     demodulator_rewriter_util m_rewriter;
     u_map<app_expr_pair>      m_rewrites;
-    uint_set                  m_processed, m_dependencies;
+    uint_set                  m_processed, m_dependencies, m_candidates;
     unsigned_vector           m_todo;
     expr_ref_vector           m_pinned;
 
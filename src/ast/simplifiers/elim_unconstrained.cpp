@@ -139,11 +139,24 @@ void elim_unconstrained::eliminate() {
     }
 }
 
-expr* elim_unconstrained::get_parent(unsigned n) const {
-    for (expr* p : get_node(n).m_parents)
-        if (get_node(p).m_refcount > 0 && get_node(p).m_term == get_node(p).m_orig)
-            return p;
-    return nullptr;
+/**
+ * Parents with reference count 0 were garbage collected and are not revived,
+ * so they are removed from the parent list as it is scanned.
+ */
+expr* elim_unconstrained::get_parent(unsigned n) {
+    auto& parents = get_node(n).m_parents;
+    expr* r = nullptr;
+    unsigned j = 0;
+    for (expr* p : parents) {
+        node const& np = get_node(p);
+        if (np.m_refcount == 0)
+            continue;
+        parents[j++] = p;
+        if (!r && np.m_term == np.m_orig)
+            r = p;
+    }
+    parents.shrink(j);
+    return r;
 }
 
 void elim_unconstrained::invalidate_parents(expr* e) {
@@ -172,6 +185,7 @@ void elim_unconstrained::init_nodes() {
 
     m_enable_proofs = false;
     m_trail.reset();
+    m_frozen.reset();
     m_fmls.freeze_suffix();
 
     expr_ref_vector terms(m);
@@ -235,18 +249,28 @@ void elim_unconstrained::init_terms(expr_ref_vector const& terms) {
     }
 }
 
+/**
+ * Freeze the variables below r. Sub-terms are visited at most once per round:
+ * freezing is not undone in a round, so the variables of a visited sub-term stay frozen.
+ */
 void elim_unconstrained::freeze_rec(expr* r) {
-    expr_ref_vector children(m);
+    SASSERT(m_todo.empty());
     if (is_quantifier(r))
-        children.push_back(to_quantifier(r)->get_expr());
+        m_todo.push_back(to_quantifier(r)->get_expr());
     else if (is_app(r))
-        children.append(to_app(r)->get_num_args(), to_app(r)->get_args());
-    else
-        return;
-    if (children.empty())
-        return;
-    for (expr* t : subterms::all(children))
+        m_todo.append(to_app(r)->get_num_args(), to_app(r)->get_args());
+    while (!m_todo.empty()) {
+        expr* t = m_todo.back();
+        m_todo.pop_back();
+        if (m_frozen.is_marked(t))
+            continue;
+        m_frozen.mark(t, true);
         freeze(t);
+        if (is_quantifier(t))
+            m_todo.push_back(to_quantifier(t)->get_expr());
+        else if (is_app(t))
+            m_todo.append(to_app(t)->get_num_args(), to_app(t)->get_args());
+    }
 }
 
 void elim_unconstrained::freeze(expr* t) {
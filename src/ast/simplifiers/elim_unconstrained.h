@@ -53,6 +53,8 @@ class elim_unconstrained : public dependent_expr_simplifier {
     unsigned_vector          m_root;
     bool                     m_created_compound = false;
     bool                     m_enable_proofs = false;
+    expr_mark                m_frozen;        // sub-terms whose variables were frozen in the current round
+    ptr_vector<expr>         m_todo;
 
     bool is_var_lt(int v1, int v2) const;
     bool is_node(unsigned n) const { return m_nodes.size() > n; }
@@ -68,7 +70,7 @@ class elim_unconstrained : public dependent_expr_simplifier {
     void freeze(expr* t);
     void freeze_rec(expr* r);
     void gc(expr* t);
-    expr* get_parent(unsigned n) const;
+    expr* get_parent(unsigned n);
     void init_terms(expr_ref_vector const& terms);
     void init_nodes();
     void eliminate();
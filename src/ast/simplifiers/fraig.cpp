@@ -0,0 +1,329 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    fraig.cpp
+
+Abstract:
+
+    Functionally reduce the Boolean structure of assertions.
+
+Notes:
+
+    The Boolean structure of the new assertions is collected as an and-inverter like
+    graph with and, or, not, xor, implies, iff and Boolean if-then-else as gates.
+    Other Boolean terms are leaves. The constant true is node 0, so tautologies and
+    contradictions are merged with the constants.
+
+    Candidates are grouped by sorting the nodes on their signatures normalized to
+    have the first simulation bit unset. Candidates whose joint support exceeds
+    MAX_SUPPORT leaves are not checked.
+
+--*/
+
+#include "ast/ast_pp.h"
+#include "ast/ast_util.h"
+#include "ast/simplifiers/fraig.h"
+
+fraig_simplifier::fraig_simplifier(ast_manager& m, params_ref const& p, dependent_expr_state& fmls):
+    dependent_expr_simplifier(m, fmls),
+    m_rewriter(m) {
+    updt_params(p);
+}
+
+bool fraig_simplifier::is_gate(expr* e) const {
+    if (!is_app(e) || to_app(e)->get_family_id() != basic_family_id)
+        return false;
+    switch (to_app(e)->get_decl_kind()) {
+    case OP_AND:
+    case OP_OR:
+    case OP_NOT:
+    case OP_XOR:
+    case OP_IMPLIES:
+    case OP_ITE:
+        return true;
+    case OP_EQ:
+        return m.is_iff(e);
+    default:
+        return false;
+    }
+}
+
+uint64_t fraig_simplifier::random_word() {
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 5; ++i)
+        r = (r << 15) | static_cast<uint64_t>(m_rand());
+    return r;
+}
+
+template<typename GetWord>
+uint64_t fraig_simplifier::eval(app* a, GetWord const& get_word) {
+    uint64_t r;
+    switch (a->get_decl_kind()) {
+    case OP_NOT:
+        return ~get_word(a->get_arg(0));
+    case OP_AND:
+        r = ~0ull;
+        for (expr* arg : *a)
+            r &= get_word(arg);
+        return r;
+    case OP_OR:
+        r = 0;
+        for (expr* arg : *a)
+            r |= get_word(arg);
+        return r;
+    case OP_XOR:
+        r = 0;
+        for (expr* arg : *a)
+            r ^= get_word(arg);
+        return r;
+    case OP_IMPLIES:
+        return ~get_word(a->get_arg(0)) | get_word(a->get_arg(1));
+    case OP_EQ:
+        return ~(get_word(a->get_arg(0)) ^ get_word(a->get_arg(1)));
+    case OP_ITE: {
+        uint64_t c = get_word(a->get_arg(0));
+        return (c & get_word(a->get_arg(1))) | (~c & get_word(a->get_arg(2)));
+    }
+    default:
+        UNREACHABLE();
+        return 0;
+    }
+}
+
+void fraig_simplifier::set_support(node& n, unsigned idx) {
+    n.m_support_size = 0;
+    if (n.m_leaf) {
+        if (!m.is_true(n.m_expr) && !m.is_false(n.m_expr))
+            n.m_support[n.m_support_size++] = idx;
+        return;
+    }
+    for (expr* arg : *to_app(n.m_expr)) {
+        node const& c = m_nodes[get_node(arg)];
+        if (c.m_support_size == UINT_MAX) {
+            n.m_support_size = UINT_MAX;
+            return;
+        }
+        // merge the sorted supports
+        unsigned merged[2 * MAX_SUPPORT];
+        unsigned i = 0, j = 0, k = 0;
+        while (i < n.m_support_size || j < c.m_support_size) {
+            if (j == c.m_support_size || (i < n.m_support_size && n.m_support[i] < c.m_support[j]))
+                merged[k++] = n.m_support[i++];
+            else if (i == n.m_support_size || c.m_support[j] < n.m_support[i])
+                merged[k++] = c.m_support[j++];
+            else
+                merged[k++] = n.m_support[i++], ++j;
+        }
+        if (k > MAX_SUPPORT) {
+            n.m_support_size = UINT_MAX;
+            return;
+        }
+        for (i = 0; i < k; ++i)
+            n.m_support[i] = merged[i];
+        n.m_support_size = k;
+    }
+}
+
+void fraig_simplifier::mk_node(expr* e) {
+    unsigned idx = m_nodes.size();
+    node n;
+    n.m_expr = e;
+    n.m_leaf = !is_gate(e);
+    for (unsigned w = 0; w < NUM_WORDS; ++w) {
+        if (m.is_true(e))
+            n.m_sig[w] = ~0ull;
+        else if (m.is_false(e))
+            n.m_sig[w] = 0;
+        else if (n.m_leaf)
+            n.m_sig[w] = random_word();
+        else
+            n.m_sig[w] = eval(to_app(e), [&](expr* arg) { return m_nodes[get_node(arg)].m_sig[w]; });
+    }
+    set_support(n, idx);
+    m_expr2node.setx(e->get_id(), idx, UINT_MAX);
+    m_nodes.push_back(n);
+}
+
+void fraig_simplifier::add_formula(expr* f) {
+    SASSERT(m_todo.empty());
+    m_todo.push_back(f);
+    while (!m_todo.empty()) {
+        expr* e = m_todo.back();
+        if (get_node(e) != UINT_MAX) {
+            m_todo.pop_back();
+            continue;
+        }
+        unsigned sz = m_todo.size();
+        if (is_gate(e))
+            for (expr* arg : *to_app(e))
+                if (get_node(arg) == UINT_MAX)
+                    m_todo.push_back(arg);
+        if (sz == m_todo.size()) {
+            m_todo.pop_back();
+            mk_node(e);
+        }
+    }
+}
+
+/**
+ * Compute the truth table of a node over the given support.
+ * Leaf support[k] is assigned the k'th projection pattern.
+ */
+uint64_t fraig_simplifier::truth_table(unsigned root, unsigned sz, unsigned const* support) {
+    static const uint64_t proj[MAX_SUPPORT] = {
+        0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+        0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull
+    };
+    m_tt.reserve(m_nodes.size());
+    m_tt_done.reserve(m_nodes.size(), false);
+    auto set_tt = [&](unsigned n, uint64_t v) {
+        m_tt[n] = v;
+        m_tt_done[n] = true;
+        m_tt_trail.push_back(n);
+    };
+    for (unsigned k = 0; k < sz; ++k)
+        set_tt(support[k], proj[k]);
+    m_tt_todo.push_back(root);
+    while (!m_tt_todo.empty()) {
+        unsigned n = m_tt_todo.back();
+        if (m_tt_done[n]) {
+            m_tt_todo.pop_back();
+            continue;
+        }
+        node const& nd = m_nodes[n];
+        if (nd.m_leaf) {
+            // leaves in the cone other than the constants are in the support
+            SASSERT(m.is_true(nd.m_expr) || m.is_false(nd.m_expr));
+            set_tt(n, m.is_true(nd.m_expr) ? ~0ull : 0);
+            m_tt_todo.pop_back();
+            continue;
+        }
+        unsigned todo_sz = m_tt_todo.size();
+        for (expr* arg : *to_app(nd.m_expr))
+            if (!m_tt_done[get_node(arg)])
+                m_tt_todo.push_back(get_node(arg));
+        if (todo_sz == m_tt_todo.size()) {
+            set_tt(n, eval(to_app(nd.m_expr), [&](expr* arg) { return m_tt[get_node(arg)]; }));
+            m_tt_todo.pop_back();
+        }
+    }
+    uint64_t r = m_tt[root];
+    for (unsigned n : m_tt_trail)
+        m_tt_done[n] = false;
+    m_tt_trail.reset();
+    return r;
+}
+
+/**
+ * Return 1 if nodes a and b are equivalent, -1 if a is equivalent to the negation of b
+ * and 0 if they are not equivalent or the check is too expensive.
+ */
+int fraig_simplifier::is_equiv(unsigned a, unsigned b) {
+    node const& na = m_nodes[a];
+    node const& nb = m_nodes[b];
+    if (na.m_support_size == UINT_MAX || nb.m_support_size == UINT_MAX)
+        return 0;
+    unsigned support[MAX_SUPPORT];
+    unsigned sz = 0;
+    for (unsigned i = 0; i < na.m_support_size; ++i)
+        support[sz++] = na.m_support[i];
+    for (unsigned j = 0; j < nb.m_support_size; ++j) {
+        unsigned s = nb.m_support[j];
+        if (std::find(support, support + sz, s) != support + sz)
+            continue;
+        if (sz == MAX_SUPPORT)
+            return 0;
+        support[sz++] = s;
+    }
+    uint64_t ta = truth_table(a, sz, support);
+    uint64_t tb = truth_table(b, sz, support);
+    if (ta == tb)
+        return 1;
+    if (ta == ~tb)
+        return -1;
+    return 0;
+}
+
+void fraig_simplifier::reduce() {
+    m_nodes.reset();
+    m_expr2node.reset();
+    mk_node(m.mk_true());
+    for (unsigned idx : indices()) {
+        if (m_nodes.size() > m_max_nodes || !m.inc())
+            break;
+        add_formula(m_fmls[idx].fml());
+    }
+
+    auto is_neg = [&](unsigned i) { return (m_nodes[i].m_sig[0] & 1) != 0; };
+    auto word = [&](unsigned i, unsigned w) { return is_neg(i) ? ~m_nodes[i].m_sig[w] : m_nodes[i].m_sig[w]; };
+    auto same_class = [&](unsigned i, unsigned j) {
+        for (unsigned w = 0; w < NUM_WORDS; ++w)
+            if (word(i, w) != word(j, w))
+                return false;
+        return true;
+    };
+    unsigned_vector order;
+    for (unsigned i = 0; i < m_nodes.size(); ++i)
+        order.push_back(i);
+    std::sort(order.begin(), order.end(), [&](unsigned i, unsigned j) {
+        for (unsigned w = 0; w < NUM_WORDS; ++w)
+            if (word(i, w) != word(j, w))
+                return word(i, w) < word(j, w);
+        return i < j;
+    });
+
+    // merge each node into the first node of its class.
+    // The first node was created before the others, so it does not contain them.
+    expr_substitution subst(m, false, false);
+    expr_ref_vector pinned(m);
+    for (unsigned i = 0, j = 0; i < order.size(); i = j) {
+        unsigned rep = order[i];
+        for (j = i + 1; j < order.size() && same_class(rep, order[j]); ++j) {
+            unsigned n = order[j];
+            ++m_stats.m_num_candidates;
+            int r = is_equiv(rep, n);
+            if (r == 0)
+                continue;
+            expr* e = m_nodes[rep].m_expr;
+            expr_ref def(r == 1 ? e : mk_not(m, e), m);
+            TRACE("fraig", tout << mk_bounded_pp(m_nodes[n].m_expr, m) << " -> " << def << "\n");
+            pinned.push_back(def);
+            subst.insert(m_nodes[n].m_expr, def);
+            ++m_stats.m_num_merges;
+        }
+    }
+
+    if (!subst.empty()) {
+        expr_ref r(m);
+        proof_ref pr(m);
+        m_rewriter.set_substitution(&subst);
+        for (unsigned idx : indices()) {
+            auto const& d = m_fmls[idx];
+            m_rewriter(d.fml(), r, pr);
+            if (r != d.fml())
+                m_fmls.update(idx, dependent_expr(m, r, nullptr, d.dep()));
+        }
+        m_rewriter.set_substitution(nullptr);
+        m_rewriter.reset();
+    }
+    m_nodes.reset();
+    m_expr2node.reset();
+}
+
+void fraig_simplifier::collect_statistics(statistics& st) const {
+    st.update("fraig-candidates", m_stats.m_num_candidates);
+    st.update("fraig-merges", m_stats.m_num_merges);
+}
+
+void fraig_simplifier::updt_params(params_ref const& p) {
+    m_max_nodes = p.get_uint("max_nodes", 1000000);
+    m_rand.set_seed(p.get_uint("random_seed", 0));
+    m_rewriter.updt_params(p);
+}
+
+void fraig_simplifier::collect_param_descrs(param_descrs& r) {
+    r.insert("max_nodes", CPK_UINT, "maximum number of Boolean sub-terms to simulate.", "1000000");
+    r.insert("random_seed", CPK_UINT, "random seed for the simulation patterns.", "0");
+}
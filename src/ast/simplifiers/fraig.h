@@ -0,0 +1,85 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    fraig.h
+
+Abstract:
+
+    Functionally reduce the Boolean structure of assertions.
+
+    Boolean sub-terms are simulated in parallel on random patterns, 64 patterns
+    per machine word. Sub-terms with the same signature, up to complement, are
+    candidates for being equivalent. A candidate pair is checked exactly by
+    computing the truth tables of both cones over their joint support when the
+    support is small. Proven equivalent sub-terms are merged into the sub-term
+    that was created first.
+
+    Merges replace sub-terms by equivalent sub-terms so they do not require
+    model reconstruction.
+
+--*/
+
+#pragma once
+
+#include "ast/simplifiers/dependent_expr_state.h"
+#include "ast/rewriter/th_rewriter.h"
+#include "ast/expr_substitution.h"
+
+
+class fraig_simplifier : public dependent_expr_simplifier {
+
+    static const unsigned NUM_WORDS = 4;       // number of 64-bit simulation words per node
+    static const unsigned MAX_SUPPORT = 6;     // truth tables of this many leaves fit in a word
+
+    struct stats {
+        unsigned m_num_candidates = 0;
+        unsigned m_num_merges = 0;
+        void reset() { memset(this, 0, sizeof(*this)); }
+    };
+
+    struct node {
+        expr*    m_expr;
+        bool     m_leaf;
+        uint64_t m_sig[NUM_WORDS];
+        unsigned m_support_size;               // UINT_MAX if the support exceeds MAX_SUPPORT
+        unsigned m_support[MAX_SUPPORT];       // sorted leaf node indices
+    };
+
+    stats            m_stats;
+    th_rewriter      m_rewriter;
+    random_gen       m_rand;
+    unsigned         m_max_nodes = 1000000;
+    svector<node>    m_nodes;
+    unsigned_vector  m_expr2node;              // expression id |-> node index
+    ptr_vector<expr> m_todo;
+    svector<uint64_t> m_tt;                    // node index |-> truth table
+    bool_vector      m_tt_done;                // node index |-> truth table is computed
+    unsigned_vector  m_tt_trail, m_tt_todo;
+
+    bool is_gate(expr* e) const;
+    unsigned get_node(expr* e) const { return e->get_id() < m_expr2node.size() ? m_expr2node[e->get_id()] : UINT_MAX; }
+    uint64_t random_word();
+    void add_formula(expr* f);
+    void mk_node(expr* e);
+    void set_support(node& n, unsigned idx);
+    uint64_t truth_table(unsigned idx, unsigned sz, unsigned const* support);
+    int is_equiv(unsigned a, unsigned b);
+
+    template<typename GetWord>
+    uint64_t eval(app* a, GetWord const& get_word);
+
+public:
+    fraig_simplifier(ast_manager& m, params_ref const& p, dependent_expr_state& fmls);
+    char const* name() const override { return "fraig"; }
+    void reduce() override;
+    void collect_statistics(statistics& st) const override;
+    void reset_statistics() override { m_stats.reset(); }
+    void updt_params(params_ref const& p) override;
+    void collect_param_descrs(param_descrs& r) override;
+};
+
+/*
+  ADD_SIMPLIFIER("fraig", "merge equivalent Boolean sub-terms found by random simulation.", "alloc(fraig_simplifier, m, p, s)")
+*/
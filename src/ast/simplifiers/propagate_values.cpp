@@ -53,35 +53,83 @@ void propagate_values::add_sub(dependent_expr const& de) {
     expr* x, * y;
     auto const& [f, p, dep] = de();
     if (m.is_not(f, x) && m_shared.is_shared(x))
-        m_subst.insert(x, m.mk_false(), dep);
+        add_sub(UINT_MAX, x, m.mk_false(), dep);
     if (m_shared.is_shared(f))
-        m_subst.insert(f, m.mk_true(), dep);
+        add_sub(UINT_MAX, f, m.mk_true(), dep);
     if (m.is_eq(f, x, y)) {
         if (m.is_value(x) && m_shared.is_shared(y))
-            m_subst.insert(y, x, dep);
+            add_sub(UINT_MAX, y, x, dep);
         else if (m.is_value(y) && m_shared.is_shared(x))
-            m_subst.insert(x, y, dep);
+            add_sub(UINT_MAX, x, y, dep);
     }
 };
 
+/**
+ * Insert x -> v unless x already has a value. 
+ * Index i is the frozen formula the fact comes from, or UINT_MAX for facts from the suffix.
+ * Only the first fact for a key is kept so that keys can be retracted in the order they were added.
+ */
+void propagate_values::add_sub(unsigned i, expr* x, expr* v, expr_dependency* d) {
+    if (m_subst.contains(x))
+        return;
+    m_subst.insert(x, v, d);
+    if (i == UINT_MAX)
+        m_suffix_keys.push_back(x);
+    else
+        m_prefix_keys.push_back({ i, x });
+}
+
+/**
+ * The formulas below qhead are frozen and are not rewritten. Their facts stay in m_subst
+ * across calls, so each call only scans the formulas that were frozen since the previous call.
+ * Facts of formulas that were popped are retracted. The facts are not filtered by sharing:
+ * the frozen formulas are not part of the occurrence count.
+ */
+void propagate_values::init_prefix() {
+    while (!m_prefix_keys.empty() && m_prefix_keys.back().first >= qhead()) {
+        m_subst.erase(m_prefix_keys.back().second);
+        m_prefix_keys.pop_back();
+    }
+    m_num_prefix = std::min(m_num_prefix, qhead());
+    expr* x, * y;
+    for (; m_num_prefix < qhead(); ++m_num_prefix) {
+        unsigned i = m_num_prefix;
+        auto const& [f, p, dep] = m_fmls[i]();
+        if (m.is_not(f, x))
+            add_sub(i, x, m.mk_false(), dep);
+        add_sub(i, f, m.mk_true(), dep);
+        if (m.is_eq(f, x, y)) {
+            if (m.is_value(x))
+                add_sub(i, y, x, dep);
+            else if (m.is_value(y))
+                add_sub(i, x, y, dep);
+        }
+    }
+}
+
+void propagate_values::reset_suffix() {
+    for (expr* x : m_suffix_keys)
+        m_subst.erase(x);
+    m_suffix_keys.reset();
+}
+
 void propagate_values::reduce() {
     m_shared.reset();
-    m_subst.reset();
+    reset_suffix();
+    init_prefix();
 
     auto add_shared = [&]() {
         shared_occs_mark visited;
         m_shared.reset();
-        for (unsigned i = 0; i < qtail(); ++i)
+        for (unsigned i : indices())
             m_shared(m_fmls[i].fml(), visited);
     };   
    
     auto init_sub = [&]() {
         add_shared();
-        m_subst.reset();
+        reset_suffix();
         m_rewriter.reset();
         m_rewriter.set_substitution(&m_subst);
-        for (unsigned i = 0; i < qhead(); ++i)
-            add_sub(m_fmls[i]);
     };
     
     unsigned rw = m_stats.m_num_rewrites + 1;
@@ -99,7 +147,7 @@ void propagate_values::reduce() {
     
     m_rewriter.set_substitution(nullptr);        
     m_rewriter.reset();
-    m_subst.reset();
+    reset_suffix();
     m_shared.reset();
 }
 
@@ -37,9 +37,15 @@ class propagate_values : public dependent_expr_simplifier {
     unsigned               m_max_rounds = 4;
     shared_occs            m_shared;
     expr_substitution      m_subst;
+    unsigned               m_num_prefix = 0;     // number of frozen formulas whose facts are in m_subst
+    svector<std::pair<unsigned, expr*>> m_prefix_keys; // (formula index, key) inserted for the frozen prefix
+    ptr_vector<expr>       m_suffix_keys;        // keys inserted for formulas in the current suffix
 
     void process_fml(unsigned i);
     void add_sub(dependent_expr const& de);
+    void add_sub(unsigned i, expr* x, expr* v, expr_dependency* d);
+    void init_prefix();
+    void reset_suffix();
 
 public:
     propagate_values(ast_manager& m, params_ref const& p, dependent_expr_state& fmls);
@@ -32,7 +32,7 @@ namespace euf {
         dependent_expr_state&     m_fmls;
         solve_eqs&                m_solve_eqs;
         expr_mark                 m_and_pos, m_and_neg, m_or_pos, m_or_neg;
-        expr_mark                 m_contains_v;
+        expr_stamp_mark           m_contains_v;
         ptr_vector<expr>          m_todo;
 
         typedef svector<std::pair<bool, expr*>> signed_expressions;
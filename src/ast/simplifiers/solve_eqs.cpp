@@ -78,6 +78,45 @@ namespace euf {
                 m_next[var2id(eq.var)].push_back(eq);
     }
 
+    /**
+    * Classify the sub-terms of t by whether they contain a variable of the dependency graph.
+    * The occurs-check in extract_subst skips variable free sub-terms, so large shared 
+    * sub-terms of solved terms are traversed once per round instead of once per equation.
+    */
+    void solve_eqs::mark_var_free(expr* t) {
+        auto is_done = [&](expr* e) { return m_var_free.is_marked(e) || m_has_var.is_marked(e); };
+        if (is_done(t))
+            return;
+        SASSERT(m_todo.empty());
+        m_todo.push_back(t);
+        while (!m_todo.empty()) {
+            expr* e = m_todo.back();
+            if (is_done(e)) {
+                m_todo.pop_back();
+                continue;
+            }
+            bool has_var = is_var(e);
+            unsigned sz = m_todo.size();
+            auto visit = [&](expr* arg) {
+                if (m_has_var.is_marked(arg))
+                    has_var = true;
+                else if (!is_done(arg))
+                    m_todo.push_back(arg);
+            };
+            if (has_var)
+                ;
+            else if (is_app(e)) 
+                for (expr* arg : *to_app(e))
+                    visit(arg);
+            else if (is_quantifier(e))
+                visit(to_quantifier(e)->get_expr());
+            if (has_var)
+                m_has_var.mark(e, true);
+            else if (sz == m_todo.size())
+                m_var_free.mark(e, true);
+        }
+    }
+
     /**
     * Build a substitution while assigning levels to terms.
     * The substitution is well-formed when variables are replaced with terms whose
@@ -88,6 +127,8 @@ namespace euf {
         m_id2level.resize(m_id2var.size(), UINT_MAX);
         m_subst_ids.reset();
         m_subst = alloc(expr_substitution, m, true, false);        
+        m_var_free.reset();
+        m_has_var.reset();
 
         auto is_explored = [&](unsigned id) {
             return m_id2level[id] != UINT_MAX;
@@ -125,13 +166,14 @@ namespace euf {
                     // determine if substitution is safe.
                     // all time-stamps must be at or above current level
                     // unexplored variables that are part of substitution are appended to work list.
+                    mark_var_free(t);
                     SASSERT(m_todo.empty());
                     m_todo.push_back(t);
                     expr_fast_mark1 visited;
                     while (!m_todo.empty()) {
                         expr* e = m_todo.back();
                         m_todo.pop_back();
-                        if (visited.is_marked(e))
+                        if (visited.is_marked(e) || m_var_free.is_marked(e))
                             continue;
                         visited.mark(e, true);
                         if (is_app(e)) {
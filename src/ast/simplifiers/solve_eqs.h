@@ -56,6 +56,8 @@ namespace euf {
         expr_mark                     m_unsafe_vars;   // expressions that cannot be replaced
         ptr_vector<expr>              m_todo;
         expr_mark                     m_visited;
+        expr_mark                     m_var_free;      // sub-terms without variables of the dependency graph
+        expr_mark                     m_has_var;       // sub-terms with variables of the dependency graph
         obj_map<expr, unsigned>       m_num_occs;
 
 
@@ -65,6 +67,7 @@ namespace euf {
         void get_eqs(dep_eq_vector& eqs);
         void filter_unsafe_vars();        
         void extract_subst();
+        void mark_var_free(expr* t);
         void extract_dep_graph(dep_eq_vector& eqs);
         void normalize();
         void apply_subst(vector<dependent_expr>& old_fmls);
@@ -115,6 +115,11 @@ namespace bv {
 
         unsigned get_num_moves() { return m_stats.m_moves + m_engine.get_stats().m_moves; }
 
+        /**
+        * Number of terms to repair in the best model passed to the set_model callback.
+        */
+        unsigned get_min_repair_size() const { return m_min_repair_size; }
+
         std::ostream& display(std::ostream& out);
 
         /**
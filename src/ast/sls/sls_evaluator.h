@@ -529,7 +529,10 @@ public:
         }    
     }
 
-    void run_serious_update(unsigned cur_depth) {
+    // With prune_unchanged, parents of a term whose value and score did not change
+    // are not re-evaluated, as in run_update. This requires the values and scores to be consistent
+    // before the update, so it is not used when all values are recomputed.
+    void run_serious_update(unsigned cur_depth, bool prune_unchanged = false) {
         // precondition: m_traversal_stack contains the entry point(s)
         expr_fast_mark1 visited;
         mpz new_value;
@@ -544,9 +547,11 @@ public:
                 expr * cur = cur_depth_exprs[i];
 
                 (*this)(to_app(cur), new_value);
+                bool changed = !m_mpz_manager.eq(new_value, m_tracker.get_value(cur));
                 m_tracker.set_value(cur, new_value);
 
                 new_score = m_tracker.score(cur);
+                changed |= new_score != m_tracker.get_score(cur);
                 if (m_tracker.is_top_expr(cur))
                 {
                     m_tracker.adapt_top_sum(cur, new_score, m_tracker.get_score(cur));
@@ -559,10 +564,12 @@ public:
                 m_tracker.set_score(cur, new_score);
                 m_tracker.set_score_prune(cur, new_score);
 
-                if (m_tracker.has_uplinks(cur)) {
-                    ptr_vector<expr> & ups = m_tracker.get_uplinks(cur);
+                if (ptr_vector<expr> * ups_p = m_tracker.find_uplinks(cur)) {
+                    ptr_vector<expr> & ups = *ups_p;
                     for (unsigned j = 0; j < ups.size(); j++) {
                         expr * next = ups[j];
+                        if (prune_unchanged && !changed && !m_manager.is_not(next))
+                            continue;
                         unsigned next_d = m_tracker.get_distance(next);
                         SASSERT(next_d < cur_depth);
                         if (!visited.is_marked(next)) {
@@ -595,15 +602,21 @@ public:
                 expr * cur = cur_depth_exprs[i];
 
                 (*this)(to_app(cur), new_value);
+                bool changed = !m_mpz_manager.eq(new_value, m_tracker.get_value(cur));
                 m_tracker.set_value(cur, new_value);
                 new_score = m_tracker.score(cur);
+                changed |= new_score != m_tracker.get_score(cur);
                 if (m_tracker.is_top_expr(cur))
                     m_tracker.adapt_top_sum(cur, new_score, m_tracker.get_score(cur));
                 m_tracker.set_score(cur, new_score);
-                if (m_tracker.has_uplinks(cur)) {
-                    ptr_vector<expr> & ups = m_tracker.get_uplinks(cur);
+                if (ptr_vector<expr> * ups_p = m_tracker.find_uplinks(cur)) {
+                    ptr_vector<expr> & ups = *ups_p;
                     for (unsigned j = 0; j < ups.size(); j++) {
                         expr * next = ups[j];
+                        // scores only depend on the values and scores of the arguments,
+                        // except for negations which score their argument negated.
+                        if (!changed && !m_manager.is_not(next))
+                            continue;
                         unsigned next_d = m_tracker.get_distance(next);
                         SASSERT(next_d < cur_depth);
                         if (!visited.is_marked(next)) {
@@ -656,7 +669,7 @@ public:
             m_traversal_stack.resize(cur_depth+1);
         m_traversal_stack[cur_depth].push_back(ep);
 
-        run_serious_update(cur_depth);
+        run_serious_update(cur_depth, true);
     }
 
     unsigned run_update_bool_prune(unsigned cur_depth) {
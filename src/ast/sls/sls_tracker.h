@@ -264,6 +264,11 @@ public:
         return m_uplinks.find(n);
     }
 
+    inline ptr_vector<expr> * find_uplinks(expr * n) {
+        auto * e = m_uplinks.find_core(n);
+        return e ? &e->get_data().m_value : nullptr;
+    }
+
     inline void ucb_forget(ptr_vector<expr> & as) {
         if (m_ucb_forget < 1.0)
         {
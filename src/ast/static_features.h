@@ -26,6 +26,7 @@ Revision History:
 #include "ast/seq_decl_plugin.h"
 #include "ast/special_relations_decl_plugin.h"
 #include "util/map.h"
+#include "util/swiss_hashtable.h"
 
 struct static_features {
     struct to_process {
@@ -106,9 +107,10 @@ struct static_features {
     unsigned_vector          m_expr2depth; // expr-id -> depth
     unsigned                 m_max_stack_depth;      // maximal depth of stack we are willing to walk.
 
-    u_map<unsigned>          m_expr2or_and_depth; 
-    u_map<unsigned>          m_expr2ite_depth;
-    u_map<unsigned>          m_expr2formula_depth;
+    typedef map<unsigned, unsigned, u_hash, u_eq, swiss_hashtable> depth_map;
+    depth_map                m_expr2or_and_depth; 
+    depth_map                m_expr2ite_depth;
+    depth_map                m_expr2formula_depth;
 
     unsigned                 m_num_theories; 
     bool_vector              m_theories;       // mapping family_id -> bool
@@ -660,6 +660,7 @@ class get_info_cmd : public cmd {
     symbol   m_all_statistics;
     symbol   m_assertion_stack_levels;
     symbol   m_rlimit;
+    symbol   m_memory_breakdown;
 public:
     get_info_cmd():
         cmd("get-info"),
@@ -671,7 +672,8 @@ public:
         m_reason_unknown(":reason-unknown"),
         m_all_statistics(":all-statistics"),
         m_assertion_stack_levels(":assertion-stack-levels"),
-        m_rlimit(":rlimit") {
+        m_rlimit(":rlimit"),
+        m_memory_breakdown(":memory-breakdown") {
     }
     char const * get_usage() const override { return "<keyword>"; }
     char const * get_descr(cmd_context & ctx) const override { return "get information."; }
@@ -709,6 +711,10 @@ public:
         else if (opt == m_all_statistics) {
             ctx.display_statistics();
         }
+        else if (opt == m_memory_breakdown) {
+            ctx.regular_stream() << "(:memory-breakdown (:total " << memory::get_allocation_size();
+            small_object_allocator::display_usage(ctx.regular_stream()) << "))" << std::endl;
+        }
         else if (opt == m_assertion_stack_levels) {
             ctx.regular_stream() << "(:assertion-stack-levels " << ctx.num_scopes() << ")" << std::endl;
         }
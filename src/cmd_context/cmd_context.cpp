@@ -363,6 +363,7 @@ ast_manager * ast_context_params::mk_ast_manager() {
         r->enable_int_real_coercions(false);
     if (m_debug_ref_count)
         r->debug_ref_count();
+    r->set_delete_budget(m_delete_budget);
     return r;
 }
 
@@ -1217,9 +1218,10 @@ bool cmd_context::try_mk_builtin_app(symbol const & s, unsigned num_args, expr *
 bool cmd_context::try_mk_declared_app(symbol const & s, unsigned num_args, expr * const * args, 
                                       unsigned num_indices, parameter const * indices, sort * range,
                                       expr_ref & result)  {
-    if (!m_func_decls.contains(s))
+    auto* e = m_func_decls.find_core(s);
+    if (!e)
         return false;
-    func_decls& fs = m_func_decls.find(s);
+    func_decls& fs = e->get_data().m_value;
 
     if (num_args == 0 && !range) {
         if (fs.more_than_one())
@@ -1245,6 +1247,8 @@ bool cmd_context::try_mk_declared_app(symbol const & s, unsigned num_args, expr
 bool cmd_context::try_mk_macro_app(symbol const & s, unsigned num_args, expr * const * args, 
                          unsigned num_indices, parameter const * indices, sort * range,
                          expr_ref & result) {
+    if (m_macros.empty())
+        return false;
     expr_ref _t(m());
     expr_ref_vector coerced_args(m());
     if (macros_find(s, num_args, args, coerced_args, _t)) {
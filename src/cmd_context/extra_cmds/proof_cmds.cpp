@@ -166,6 +166,7 @@ public:
     
     void updt_params(params_ref const& p) {
         trim.updt_params(p);
+        trim.set_concurrent(solver_params(p).proof_trim_concurrent());
     }
 
     expr_ref mk_dep(unsigned id, unsigned_vector const& deps) {
@@ -89,6 +89,7 @@ void help_tactic(cmd_context & ctx) {
     buf << "- (par-or <tactic>+) executes the given tactics in parallel until one of them succeeds (i.e., the first that doesn't fail).\n";
     buf << "- (par-then <tactic1> <tactic2>) executes tactic1 and then tactic2 to every subgoal produced by tactic1. All subgoals are processed in parallel.\n";
     buf << "- (try-for <tactic> <num>) executes the given tactic for at most <num> milliseconds, it fails if the execution takes more than <num> milliseconds.\n";
+    buf << "- (try-for-rlimit <tactic> <num>) executes the given tactic for at most <num> resource units, it fails if the execution uses more than <num> units. The budget is deterministic, unlike the timeout of try-for.\n";
     buf << "- (if <probe> <tactic> <tactic>) if <probe> evaluates to true, then execute the first tactic. Otherwise execute the second.\n";
     buf << "- (when <probe> <tactic>) shorthand for (if <probe> <tactic> skip).\n";
     buf << "- (fail-if <probe>) fail if <probe> evaluates to true.\n";
@@ -467,6 +468,18 @@ static tactic * mk_try_for(cmd_context & ctx, sexpr * n) {
     return try_for(t, timeout);
 }
 
+static tactic * mk_try_for_rlimit(cmd_context & ctx, sexpr * n) {
+    SASSERT(n->is_composite());
+    unsigned num_children = n->get_num_children();
+    if (num_children != 3)
+        throw cmd_exception("invalid try-for-rlimit combinator, two arguments expected", n->get_line(), n->get_pos());
+    if (!n->get_child(2)->is_numeral() || !n->get_child(2)->get_numeral().is_unsigned())
+        throw cmd_exception("invalid try-for-rlimit combinator, second argument must be an unsigned integer", n->get_line(), n->get_pos());
+    tactic * t = sexpr2tactic(ctx, n->get_child(1));
+    unsigned rlimit = n->get_child(2)->get_numeral().get_unsigned();
+    return try_for_rlimit(t, rlimit);
+}
+
 static tactic * mk_repeat(cmd_context & ctx, sexpr * n) {
     SASSERT(n->is_composite());
     unsigned num_children = n->get_num_children();
@@ -686,6 +699,8 @@ tactic * sexpr2tactic(cmd_context & ctx, sexpr * n) {
             return mk_par_then(ctx, n);
         else if (cmd_name == "try-for")
             return mk_try_for(ctx, n);
+        else if (cmd_name == "try-for-rlimit")
+            return mk_try_for_rlimit(ctx, n);
         else if (cmd_name == "repeat")
             return mk_repeat(ctx, n);
         else if (cmd_name == "if" || cmd_name == "ite" || cmd_name == "cond")
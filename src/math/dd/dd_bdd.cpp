@@ -49,6 +49,11 @@ namespace dd {
         alloc_free_nodes(1024 + num_vars);
         m_disable_gc = false;
         m_is_new_node = false;
+        m_op_depth = 0;
+        m_max_op_cache_size = 1 << 20;
+        m_cache_hits_at_flush = 0;
+        m_cache_misses_at_flush = 0;
+        m_reorder_threshold = 0;
         
         // add variables
         for (unsigned i = 0; i < num_vars; ++i) {
@@ -83,6 +88,7 @@ namespace dd {
     bdd_manager::BDD bdd_manager::apply(BDD arg1, BDD arg2, bdd_op op) {
         bool first = true;
         SASSERT(well_formed());
+        scoped_op _so(*this);
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -113,6 +119,7 @@ namespace dd {
             SASSERT(e2->m_result != null_bdd);
             push_entry(e1);
             e1 = nullptr;
+            m_stats.m_cache_hits++;
             return true;            
         }
         else {
@@ -120,10 +127,66 @@ namespace dd {
             e1->m_bdd2 = b;
             e1->m_op = c;
             SASSERT(e1->m_result == null_bdd);
+            m_stats.m_cache_misses++;
+            if (m_op_cache.size() > m_max_op_cache_size)
+                flush_op_cache();
             return false;        
         }
     }
 
+    /**
+     * Remove finished entries from the operation cache. 
+     * Entries without result belong to operations in progress and are retained.
+     */
+    void bdd_manager::flush_op_cache() {
+        unsigned hits = m_stats.m_cache_hits - m_cache_hits_at_flush;
+        unsigned misses = m_stats.m_cache_misses - m_cache_misses_at_flush;
+        if (hits >= misses && m_max_op_cache_size < (1u << 30))
+            m_max_op_cache_size *= 2;
+        m_cache_hits_at_flush = m_stats.m_cache_hits;
+        m_cache_misses_at_flush = m_stats.m_cache_misses;
+        m_stats.m_cache_flushes++;
+        release_finished_entries();
+    }
+
+    void bdd_manager::release_finished_entries() {
+        ptr_vector<op_entry> to_delete, to_keep;
+        for (auto* e : m_op_cache) {            
+            if (e->m_result != null_bdd) {
+                to_delete.push_back(e);
+            }
+            else {
+                to_keep.push_back(e);
+            }
+        }
+        m_op_cache.reset();
+        for (op_entry* e : to_delete) {
+            m_alloc.deallocate(sizeof(*e), e);
+        }
+        for (op_entry* e : to_keep) {
+            m_op_cache.insert(e);
+        }
+    }
+
+    void bdd_manager::check_limits() {
+        if (m_reorder_threshold == 0 || m_disable_gc || num_live_nodes() < m_reorder_threshold)
+            return;
+        IF_VERBOSE(13, verbose_stream() << "(bdd :reorder " << num_live_nodes() << ")\n";);
+        m_stats.m_num_reorder++;
+        try_reorder();
+        while (num_live_nodes() > m_reorder_threshold / 2 && m_reorder_threshold < (1u << 30))
+            m_reorder_threshold *= 2;
+    }
+
+    void bdd_manager::collect_statistics(statistics& st) const {
+        st.update("bdd nodes", num_live_nodes());
+        st.update("bdd cache hits", m_stats.m_cache_hits);
+        st.update("bdd cache misses", m_stats.m_cache_misses);
+        st.update("bdd cache flushes", m_stats.m_cache_flushes);
+        st.update("bdd gc", m_stats.m_num_gc);
+        st.update("bdd reorder", m_stats.m_num_reorder);
+    }
+
     bdd_manager::BDD bdd_manager::apply_rec(BDD a, BDD b, bdd_op op) {
         switch (op) {
         case bdd_and_op:
@@ -546,6 +609,7 @@ namespace dd {
 
     bdd bdd_manager::mk_not(bdd b) {
         bool first = true;
+        scoped_op _so(*this);
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -581,6 +645,7 @@ namespace dd {
 
     bdd bdd_manager::mk_cofactor(bdd const& a, bdd const& b) {
 	bool first = true;
+        scoped_op _so(*this);
         scoped_push _sp(*this);
         SASSERT(!b.is_const() && b.lo().is_const() && b.hi().is_const());
         while (true) {
@@ -632,6 +697,7 @@ namespace dd {
 
     bdd bdd_manager::mk_ite(bdd const& c, bdd const& t, bdd const& e) {         
         bool first = true;
+        scoped_op _so(*this);
         scoped_push _sp(*this);
         while (true) {
             try {
@@ -702,6 +768,7 @@ namespace dd {
     }
 
     bdd_manager::BDD bdd_manager::mk_quant(unsigned n, unsigned const* vars, BDD b, bdd_op op) {
+        scoped_op _so(*this);
         BDD result = b;
         // TODO: should this method catch mem_out like the other non-rec mk_ methods?
         for (unsigned i = 0; i < n; ++i) {
@@ -806,6 +873,7 @@ namespace dd {
     }
 
     void bdd_manager::gc() {
+        m_stats.m_num_gc++;
         m_free_nodes.reset();
         IF_VERBOSE(13, verbose_stream() << "(bdd :gc " << m_nodes.size() << ")\n";);
         bool_vector reachable(m_nodes.size(), false);
@@ -844,22 +912,7 @@ namespace dd {
         std::sort(m_free_nodes.begin(), m_free_nodes.end());
         m_free_nodes.reverse();
 
-        ptr_vector<op_entry> to_delete, to_keep;
-        for (auto* e : m_op_cache) {            
-            if (e->m_result != null_bdd) {
-                to_delete.push_back(e);
-            }
-            else {
-                to_keep.push_back(e);
-            }
-        }
-        m_op_cache.reset();
-        for (op_entry* e : to_delete) {
-            m_alloc.deallocate(sizeof(*e), e);
-        }
-        for (op_entry* e : to_keep) {
-            m_op_cache.insert(e);
-        }
+        release_finished_entries();
 
         m_node_table.reset();
         // re-populate node cache
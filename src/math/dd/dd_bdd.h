@@ -22,6 +22,7 @@ Revision History:
 #include "util/map.h"
 #include "util/small_object_allocator.h"
 #include "util/rational.h"
+#include "util/statistics.h"
 
 namespace dd {
 
@@ -107,12 +108,22 @@ namespace dd {
 
         struct eq_entry {
             bool operator()(op_entry * a, op_entry * b) const { 
-                return a->m_bdd1 == b->m_bdd2 && a->m_bdd2 == b->m_bdd2 && a->m_op == b->m_op;
+                return a->m_bdd1 == b->m_bdd1 && a->m_bdd2 == b->m_bdd2 && a->m_op == b->m_op;
             }
         };
 
         typedef ptr_hashtable<op_entry, hash_entry, eq_entry> op_table;
 
+        struct stats {
+            unsigned m_cache_hits;
+            unsigned m_cache_misses;
+            unsigned m_cache_flushes;
+            unsigned m_num_gc;
+            unsigned m_num_reorder;
+            stats() { reset(); }
+            void reset() { m_cache_hits = m_cache_misses = m_cache_flushes = m_num_gc = m_num_reorder = 0; }
+        };
+
         svector<bdd_node>          m_nodes;
         op_table                   m_op_cache;
         node_table                 m_node_table;
@@ -135,6 +146,12 @@ namespace dd {
         unsigned_vector            m_reorder_rc;
         cost_metric                m_cost_metric;
         BDD                        m_cost_bdd;
+        unsigned                   m_op_depth;           // nesting of top-level operations
+        unsigned                   m_max_op_cache_size;  // flush finished entries above this size
+        unsigned                   m_cache_hits_at_flush;
+        unsigned                   m_cache_misses_at_flush;
+        unsigned                   m_reorder_threshold;  // live nodes that trigger sifting, 0 to disable
+        stats                      m_stats;
 
         BDD make_node(unsigned level, BDD l, BDD r);
         bool is_new_node() const { return m_is_new_node; }
@@ -200,6 +217,25 @@ namespace dd {
         void reserve_var(unsigned v);
         bool well_formed();
 
+        void flush_op_cache();
+        void release_finished_entries();
+        void check_limits();
+        unsigned num_live_nodes() const { return m_nodes.size() - m_free_nodes.size(); }
+
+        /**
+           \brief reordering and garbage collection may only run between
+           top-level operations, when no cache entries are pending.
+        */
+        struct scoped_op {
+            bdd_manager& m;
+            scoped_op(bdd_manager& m): m(m) {
+                if (m.m_op_depth == 0)
+                    m.check_limits();
+                ++m.m_op_depth;
+            }
+            ~scoped_op() { --m.m_op_depth; }
+        };
+
         struct scoped_push {
             bdd_manager& m;
             unsigned     m_size;
@@ -218,6 +254,22 @@ namespace dd {
 
         void set_max_num_nodes(unsigned n) { m_max_num_bdd_nodes = n; }
 
+        /**
+           \brief bound the operation cache. Finished entries are flushed
+           when the bound is reached. The bound doubles when at least half
+           of the lookups since the previous flush were hits.
+        */
+        void set_max_op_cache_size(unsigned n) { m_max_op_cache_size = n; }
+
+        /**
+           \brief sift variables when an operation starts with at least n live nodes.
+           The threshold doubles after each reordering that leaves more than n/2 nodes.
+           0 disables dynamic reordering.
+        */
+        void set_reorder_threshold(unsigned n) { m_reorder_threshold = n; }
+
+        void collect_statistics(statistics& st) const;
+
         bdd mk_var(unsigned i);
         bdd mk_nvar(unsigned i);
 
@@ -1375,8 +1375,9 @@ namespace dd {
             e = m_node_table.insert_if_not_there2(n);
             e->get_data().m_refcount = 0;      
         }
-        if (do_gc) {
-            if (m_nodes.size() > m_max_num_nodes) 
+        // grow the node pool only when collection recovered less than a third of it.
+        if (do_gc && m_free_nodes.size()*3 < m_nodes.size()) {
+            if (m_nodes.size() > m_max_num_nodes || memory::above_high_watermark()) 
                 throw mem_out();            
             alloc_free_nodes(m_nodes.size()/2);
         }
@@ -1623,8 +1624,10 @@ namespace dd {
         for (unsigned i = m_nodes.size(); i-- > pdd_no_op; ) {
             if (!reachable[i]) {
                 if (is_val(i)) {
-                    if (m_freeze_value == val(i)) 
+                    if (m_freeze_value == val(i)) {
+                        reachable[i] = true;
                         continue;
+                    }
                     m_free_values.push_back(m_mpq_table.find(val(i)).m_value_index);
                     m_mpq_table.remove(val(i));  
                 }
@@ -1633,6 +1636,7 @@ namespace dd {
                 m_free_nodes.push_back(i);       
             }
         }
+        compact(reachable);
         // sort free nodes so that adjacent nodes are picked in order of use
         std::sort(m_free_nodes.begin(), m_free_nodes.end());
         m_free_nodes.reverse();
@@ -1664,6 +1668,32 @@ namespace dd {
         SASSERT(well_formed());
     }
 
+    /**
+     * Release free nodes at the end of the node pool, keeping half of the live nodes
+     * as headroom. Live nodes are not renumbered as pdd objects refer to them by index.
+     */
+    void pdd_manager::compact(bool_vector const& reachable) {
+        unsigned sz = m_nodes.size();
+        unsigned min_sz = std::max(static_cast<unsigned>(pdd_no_op) + 1, (num_nodes() * 3) / 2);
+        while (sz > min_sz && !reachable[sz - 1])
+            --sz;
+        if (sz == m_nodes.size())
+            return;
+        IF_VERBOSE(13, verbose_stream() << "(pdd :compact " << m_nodes.size() << " -> " << sz << ")\n";);
+        unsigned j = 0;
+        for (unsigned n : m_free_nodes)
+            if (n < sz)
+                m_free_nodes[j++] = n;
+        m_free_nodes.shrink(j);
+        if (2 * sz < m_nodes.capacity()) {
+            svector<node> nodes(sz, m_nodes.data());
+            m_nodes.swap(nodes);
+        }
+        else 
+            m_nodes.shrink(sz);
+        init_dmark();
+    }
+
     void pdd_manager::init_mark() {
         m_mark.resize(m_nodes.size());
         ++m_mark_level;
@@ -244,6 +244,7 @@ namespace dd {
         bool check_result(op_entry*& e1, op_entry const* e2, PDD a, PDD b, PDD c);
         
         void alloc_free_nodes(unsigned n);
+        void compact(bool_vector const& reachable);
         void init_mark();
         void set_mark(unsigned i) { m_mark[i] = m_mark_level; }
         bool is_marked(unsigned i) { return m_mark[i] == m_mark_level; }
@@ -47,6 +47,15 @@
           w - r = 0. In which case, w inherits the labels from r.
           Otherwise, label the node by the intersection of vanishing polynomials from lo(p) and hi(p).
 
+        F4-style reduction (Faugere 1999) over GF2:
+        - collect the S-polynomials of pairs of equations in a Macaulay matrix together
+          with the equations. Columns are monomials in descending order, such that
+          Gauss-Jordan elimination reduces leading monomials first.
+        - rows of the reduced matrix whose leading monomial is not a leading monomial of
+          one of the equations are new elements of the basis.
+        - unlike full F4 there is no symbolic preprocessing: the remaining reductions
+          and the completion of the basis are left to the Buchberger loop.
+
        Eliminating multiplier variables, but not adders [Kaufmann et al FMCAD 2019 for GF2];
        - Only apply GB saturation with respect to variables that are part of multipliers.
        - Perhaps this amounts to figuring out whether a variable is used in an xor or more
@@ -54,6 +63,7 @@
   --*/
 
 #include "math/grobner/pdd_simplifier.h"
+#include "util/map.h"
 #include "math/simplex/bit_matrix.h"
 
 namespace dd {
@@ -69,6 +79,7 @@ namespace dd {
                     simplify_linear_step(false) || 
                     /*simplify_elim_dual_step() ||*/
                     simplify_exlin() ||
+                    simplify_f4() ||
                     false)) {
                 DEBUG_CODE(s.invariant(););
                 TRACE("dd.solver", s.display(tout););
@@ -398,6 +409,94 @@ namespace dd {
         return !simp_eqs.empty() && simplify_linear_step(false);
     }
 
+    /**
+       \brief F4-style reduction of the dependency-free equations and their S-polynomials.
+       Runs at most once per simplification. So far just for GF(2) semantics.
+     */
+    bool simplifier::simplify_f4() {
+        if (s.m.get_semantics() != pdd_manager::mod2_e ||
+            !s.m_config.m_enable_f4 || m_f4_done) {
+            return false;
+        }
+        m_f4_done = true;
+        vector<pdd> rows;
+        for (auto* e : s.m_to_simplify) if (!e->dep()) rows.push_back(e->poly());
+        for (auto* e : s.m_processed) if (!e->dep()) rows.push_back(e->poly());
+        unsigned num_eqs = rows.size();
+        unsigned max_rows = std::max(2 * num_eqs, 1000u);
+        for (unsigned i = 0; i < num_eqs && rows.size() < max_rows; ++i) {
+            for (unsigned j = i + 1; j < num_eqs && rows.size() < max_rows; ++j) {
+                pdd r(s.m);
+                if (s.m.try_spoly(rows[i], rows[j], r) && !r.is_zero())
+                    rows.push_back(r);
+            }
+        }
+        if (rows.size() == num_eqs)
+            return false;
+
+        // index monomials by their (hash-consed) pdd
+        vector<pdd> mons;
+        u_map<unsigned> mon2idx;
+        auto mon_index = [&](pdd_monomial const& mo) {
+            pdd t = s.m.one();
+            for (unsigned v : mo.vars)
+                t *= s.m.mk_var(v);
+            unsigned idx;
+            if (!mon2idx.find(t.index(), idx)) {
+                idx = mons.size();
+                mon2idx.insert(t.index(), idx);
+                mons.push_back(t);
+            }
+            return idx;
+        };
+        vector<unsigned_vector> row_mons;
+        for (pdd const& p : rows) {
+            row_mons.push_back(unsigned_vector());
+            for (auto const& mo : p)
+                row_mons.back().push_back(mon_index(mo));
+        }
+        
+        // columns are monomials in descending order
+        unsigned_vector col2mon, mon2col(mons.size());
+        for (unsigned i = 0; i < mons.size(); ++i)
+            col2mon.push_back(i);
+        std::sort(col2mon.begin(), col2mon.end(), [&](unsigned a, unsigned b) { return s.m.lm_lt(mons[b], mons[a]); });
+        for (unsigned c = 0; c < col2mon.size(); ++c)
+            mon2col[col2mon[c]] = c;
+
+        bit_matrix bm;
+        bm.reset(mons.size());
+        uint_set leading;
+        for (unsigned i = 0; i < rows.size(); ++i) {
+            auto row = bm.add_row();
+            unsigned lead = UINT_MAX;
+            for (unsigned mi : row_mons[i]) {
+                row.set(mon2col[mi]);
+                lead = std::min(lead, mon2col[mi]);
+            }
+            if (i < num_eqs && lead != UINT_MAX)
+                leading.insert(lead);
+        }
+        IF_VERBOSE(10, verbose_stream() << "pdd-f4 " << rows.size() << " x " << mons.size() << "\n";);
+
+        bm.solve();
+
+        bool added = false;
+        for (auto const& r : bm) {
+            auto it = r.begin();
+            if (it == r.end() || leading.contains(*it))
+                continue;
+            pdd p = s.m.zero();
+            for (unsigned c : r)
+                p += mons[col2mon[c]];
+            TRACE("dd.solver", tout << "f4: " << p << "\n";);
+            s.m_stats.m_f4_rows++;
+            s.add(p);
+            added = true;
+        }
+        return added;
+    }
+
     void simplifier::init_orbits(vector<pdd> const& eqs, vector<uint_set>& orbits) {
         for (pdd const& p : eqs) {
             auto const& fv = p.free_vars();
@@ -24,6 +24,7 @@ class simplifier {
     typedef ptr_vector<equation> equation_vector;
 
     solver& s;
+    bool    m_f4_done = false;
 public:
 
     simplifier(solver& s): s(s) {}
@@ -46,6 +47,7 @@ private:
     bool simplify_elim_dual_step();
     bool simplify_leaf_step();
     bool simplify_exlin();
+    bool simplify_f4();
     void init_orbits(vector<pdd> const& eqs, vector<uint_set>& orbits);
     void exlin_augment(vector<uint_set> const& orbits, vector<pdd>& eqs);
     void simplify_exlin(vector<uint_set> const& orbits, vector<pdd> const& eqs, vector<pdd>& simp_eqs);
@@ -477,6 +477,7 @@ namespace dd {
         st.update("dd.solver.steps", m_stats.m_compute_steps);
         st.update("dd.solver.simplified", m_stats.simplified());
         st.update("dd.solver.superposed", m_stats.m_superposed);
+        st.update("dd.solver.f4-rows", m_stats.m_f4_rows);
         st.update("dd.solver.processed", m_processed.size());
         st.update("dd.solver.solved", m_solved.size());
         st.update("dd.solver.to_simplify", m_to_simplify.size());
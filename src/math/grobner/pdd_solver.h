@@ -38,6 +38,7 @@ public:
         double   m_max_expr_size;
         unsigned m_max_expr_degree;
         unsigned m_superposed;
+        unsigned m_f4_rows;
         unsigned m_compute_steps;
         void reset() { memset(this, 0, sizeof(*this)); }
         stats() { reset(); }
@@ -56,6 +57,7 @@ public:
         unsigned m_max_simplified = UINT_MAX;
         unsigned m_random_seed = 0;
         bool     m_enable_exlin = false;
+        bool     m_enable_f4 = false;
         unsigned m_eqs_growth = 10;
         unsigned m_expr_size_growth = 10;
         unsigned m_expr_degree_growth = 5;
@@ -182,6 +182,7 @@ class heap_trie {
     stats    m_stats;
     node*    m_spare_leaf;
     node*    m_spare_trie;
+    bool     m_verbose_find_le = false;
 
 public:
 
@@ -272,6 +273,7 @@ public:
     bool find_le(Key const* keys, check_value& check) {
         ++m_stats.m_num_find_le;
         ++m_stats.m_num_find_le_nodes;
+        m_verbose_find_le = get_verbosity_level() >= 2;
         return find_le(m_root, 0, keys, check);
     }
 
@@ -557,11 +559,12 @@ private:
         if (index == num_keys()) {
             SASSERT(n->ref_count() > 0);
             bool r = check(to_leaf(n)->get_value());
-            IF_VERBOSE(2, 
-                       for (unsigned j = 0; j < index; ++j) {
-                           verbose_stream() << " ";
-                       }
-                       verbose_stream() << to_leaf(n)->get_value() << (r?" hit\n":" miss\n"););
+            if (m_verbose_find_le) {
+                for (unsigned j = 0; j < index; ++j) {
+                    verbose_stream() << " ";
+                }
+                verbose_stream() << to_leaf(n)->get_value() << (r?" hit\n":" miss\n");
+            }
             return r;
         }
         else {
@@ -570,12 +573,14 @@ private:
             for (unsigned i = 0; i < nodes.size(); ++i) {
                 ++m_stats.m_num_find_le_nodes;
                 node* m = nodes[i].second;
-                IF_VERBOSE(2,
-                           for (unsigned j = 0; j < index; ++j) {
-                               verbose_stream() << " ";
-                           }
-                           verbose_stream() << nodes[i].first << " <=? " << key << " rc:" << m->ref_count() << "\n";);
-                if (m->ref_count() > 0 && m_le.le(nodes[i].first, key) && find_le(m, index+1, keys, check)) {
+                if (m_verbose_find_le) {
+                    for (unsigned j = 0; j < index; ++j) {
+                        verbose_stream() << " ";
+                    }
+                    verbose_stream() << nodes[i].first << " <=? " << key << " rc:" << m->ref_count() << "\n";
+                }
+                // compare the key stored in the node array before touching the child
+                if (m_le.le(nodes[i].first, key) && m->ref_count() > 0 && find_le(m, index+1, keys, check)) {
                     if (i > 0) {
                         std::swap(nodes[i], nodes[0]);
                     }
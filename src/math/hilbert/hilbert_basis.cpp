@@ -493,14 +493,26 @@ class hilbert_basis::passive2 {
             return (**p)(v1, v2);
         }
     };
+    // signs of the unrestricted entries of a vector, packed so that the
+    // resolvability test in next_resolvable scans a dense array instead
+    // of fetching each sos vector from the store.
+    struct support {
+        uint64_t m_pos = 0;
+        uint64_t m_neg = 0;
+        bool     m_unit = false;     // first (homogenizing) entry is 1
+    };
     hilbert_basis&      hb;
     svector<offset_t>   m_pos_sos;
     svector<offset_t>   m_neg_sos;
     vector<numeral>     m_pos_sos_sum;
     vector<numeral>     m_neg_sos_sum;
+    svector<support>    m_pos_sos_support;
+    svector<support>    m_neg_sos_support;
+    bool                m_packed = false;
     vector<numeral>     m_sum_abs;
     unsigned_vector     m_psos;
     svector<offset_t>   m_pas;
+    svector<support>    m_pas_support;
     vector<numeral>     m_weight;
     unsigned_vector     m_free_list;
     passive2*           m_this;
@@ -516,6 +528,26 @@ class hilbert_basis::passive2 {
         return w;
     }
 
+    support mk_support(offset_t idx) const {
+        support r;
+        if (!m_packed)
+            return r;
+        values const& v = hb.vec(idx);
+        r.m_unit = v[0].is_one();
+        for (unsigned i = 0; i < hb.m_ints.size(); ++i) {
+            numeral const& n = v[hb.m_ints[i]];
+            if (n.is_pos())
+                r.m_pos |= (1ull << i);
+            else if (n.is_neg())
+                r.m_neg |= (1ull << i);
+        }
+        return r;
+    }
+
+    static bool can_resolve(support const& s, support const& p) {
+        return !(s.m_unit && p.m_unit) && !(s.m_pos & p.m_neg) && !(s.m_neg & p.m_pos);
+    }
+
 public:
     passive2(hilbert_basis& hb): 
         hb(hb),
@@ -526,15 +558,18 @@ public:
     }
 
     void init(svector<offset_t> const& I) {
+        m_packed = hb.m_ints.size() <= 64;
         for (unsigned i = 0; i < I.size(); ++i) {
             numeral const& w = hb.vec(I[i]).weight();
             if (w.is_pos()) {
                 m_pos_sos.push_back(I[i]);
                 m_pos_sos_sum.push_back(sum_abs(I[i]));
+                m_pos_sos_support.push_back(mk_support(I[i]));
             }
             else {
                 m_neg_sos.push_back(I[i]);
                 m_neg_sos_sum.push_back(sum_abs(I[i]));
+                m_neg_sos_support.push_back(mk_support(I[i]));
             }
         }
     }
@@ -544,11 +579,14 @@ public:
         m_free_list.reset();
         m_psos.reset();
         m_pas.reset();
+        m_pas_support.reset();
         m_sum_abs.reset();
         m_pos_sos.reset();
         m_neg_sos.reset();
         m_pos_sos_sum.reset();
         m_neg_sos_sum.reset();
+        m_pos_sos_support.reset();
+        m_neg_sos_support.reset();
         m_weight.reset();
     }
 
@@ -558,6 +596,7 @@ public:
         if (m_free_list.empty()) {
             v = m_pas.size();
             m_pas.push_back(idx);
+            m_pas_support.push_back(mk_support(idx));
             m_psos.push_back(offset);
             m_weight.push_back(numeral(0));
             m_heap.set_bounds(v+1);
@@ -567,6 +606,7 @@ public:
             v = m_free_list.back();
             m_free_list.pop_back();
             m_pas[v] = idx;
+            m_pas_support[v] = mk_support(idx);
             m_psos[v] = offset;
             m_weight[v] = numeral(0);
             m_sum_abs[v] = sum_abs(idx);
@@ -629,10 +669,13 @@ private:
     void next_resolvable(bool is_positive, unsigned v) {
         offset_t pas = m_pas[v];
         svector<offset_t> const& soss = is_positive?m_neg_sos:m_pos_sos;
+        svector<support> const& sups = is_positive?m_neg_sos_support:m_pos_sos_support;
+        support const& sup = m_pas_support[v];
         while (m_psos[v] < soss.size()) {
             unsigned psos = m_psos[v];
             offset_t sos = soss[psos];
-            if (hb.can_resolve(sos, pas, false)) {
+            SASSERT(!m_packed || can_resolve(sups[psos], sup) == hb.can_resolve(sos, pas, false));
+            if (m_packed ? can_resolve(sups[psos], sup) : hb.can_resolve(sos, pas, false)) {
                 m_weight[v] = m_sum_abs[v] + (is_positive?m_neg_sos_sum[psos]:m_pos_sos_sum[psos]);
                 m_heap.insert(v);
                 return;
@@ -33,6 +33,7 @@ class cross_nested {
     bool                                              m_done;
     ptr_vector<nex>                                   m_b_split_vec;
     int                                               m_reported;
+    int                                               m_max_reported = 100;
     bool                                              m_random_bit;
     std::function<nex_scalar*()>                      m_mk_scalar;
     nex_creator&                                      m_nex_creator;
@@ -57,6 +58,9 @@ public:
     {}
 
     
+    // bound the number of cross-nested forms that are checked
+    void set_max_reported(unsigned n) { m_max_reported = n; }
+
     void run(nex *e) {
         TRACE("nla_cn", tout << *e << "\n";);
         SASSERT(m_nex_creator.is_simplified(*e));
@@ -253,7 +257,7 @@ public:
         if (vars.empty()) {
             if (front.empty()) {
                 TRACE("nla_cn", tout << "got the cn form: =" << *m_e << "\n";);
-                m_done = m_call_on_result(m_e) || ++m_reported > 100;
+                m_done = m_call_on_result(m_e) || ++m_reported > m_max_reported;
  #ifdef Z3DEBUG
                 TRACE("nla_cn", tout << "m_e_clone " << *m_e_clone << "\n";);
                 SASSERT(nex_creator::equal(m_e, m_e_clone));
@@ -284,7 +288,7 @@ public:
 #ifdef Z3DEBUG
             TRACE("nla_cn", tout << "got the cn form: =" << *m_e <<  ", clone = " << *m_e_clone << "\n";);
 #endif
-            m_done = m_call_on_result(m_e) || ++m_reported > 100;
+            m_done = m_call_on_result(m_e) || ++m_reported > m_max_reported;
 #ifdef Z3DEBUG
             SASSERT(nex_creator::equal(m_e, m_e_clone));
 #endif
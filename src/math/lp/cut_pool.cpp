@@ -0,0 +1,169 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    cut_pool.cpp
+
+Abstract:
+
+    Pool of cuts t >= k found by int_solver, kept across calls to check.
+
+--*/
+#include <algorithm>
+#include <cmath>
+#include "util/hash.h"
+#include "math/lp/cut_pool.h"
+#include "math/lp/lar_solver.h"
+
+namespace lp {
+
+    void cut_pool::normalize(cut& c) const {
+        std::sort(c.m_coeffs.begin(), c.m_coeffs.end(), [](auto const& a, auto const& b) { return a.second < b.second; });
+        mpq d(1);
+        for (auto const& p : c.m_coeffs)
+            d = lcm(d, denominator(p.first));
+        mpq g(0);
+        for (auto const& p : c.m_coeffs)
+            g = gcd(g, abs(numerator(p.first) * (d / denominator(p.first))));
+        mpq s = d / g;
+        bool all_int = true;
+        c.m_norm = 0;
+        for (auto& p : c.m_coeffs) {
+            p.first *= s;
+            double v = p.first.get_double();
+            c.m_norm += v * v;
+            all_int &= lra.column_is_int(p.second);
+            c.m_max_column = std::max(c.m_max_column, p.second);
+        }
+        c.m_norm = std::sqrt(c.m_norm);
+        c.m_k *= s;
+        if (all_int)
+            c.m_k = ceil(c.m_k);
+    }
+
+    unsigned cut_pool::hash(cut const& c) {
+        unsigned h = c.m_k.hash();
+        for (auto const& p : c.m_coeffs)
+            h = combine_hash(h, combine_hash(p.first.hash(), hash_u(p.second)));
+        return h;
+    }
+
+    double cut_pool::parallelism(cut const& a, cut const& b) {
+        // both coefficient vectors are sorted by column
+        double dot = 0;
+        unsigned i = 0, j = 0;
+        while (i < a.m_coeffs.size() && j < b.m_coeffs.size()) {
+            lpvar u = a.m_coeffs[i].second, v = b.m_coeffs[j].second;
+            if (u < v)
+                ++i;
+            else if (v < u)
+                ++j;
+            else
+                dot += a.m_coeffs[i++].first.get_double() * b.m_coeffs[j++].first.get_double();
+        }
+        return std::abs(dot) / (a.m_norm * b.m_norm);
+    }
+
+    bool cut_pool::is_active(cut const& c) const {
+        for (constraint_index ci : c.m_deps)
+            if (!lra.constraints().is_active(ci))
+                return false;
+        return true;
+    }
+
+    u_dependency* cut_pool::mk_dep(cut const& c) const {
+        u_dependency* dep = nullptr;
+        for (constraint_index ci : c.m_deps)
+            dep = lra.dep_manager().mk_join(dep, lra.constraints()[ci].dep());
+        return dep;
+    }
+
+    void cut_pool::remove(unsigned i) {
+        if (i + 1 != m_cuts.size())
+            m_cuts[i] = std::move(m_cuts.back());
+        m_cuts.pop_back();
+    }
+
+    void cut_pool::evict() {
+        unsigned oldest = 0;
+        for (unsigned i = 1; i < m_cuts.size(); ++i)
+            if (m_cuts[i].m_age > m_cuts[oldest].m_age)
+                oldest = i;
+        remove(oldest);
+    }
+
+    void cut_pool::add(lar_term const& t, mpq const& k, u_dependency* dep) {
+        if (m_max_size == 0 || t.size() == 0)
+            return;
+        cut c;
+        c.m_coeffs = t.coeffs_as_vector();
+        c.m_k = k;
+        normalize(c);
+        lra.dep_manager().linearize(dep, c.m_deps);
+        std::sort(c.m_deps.begin(), c.m_deps.end());
+        c.m_deps.shrink(static_cast<unsigned>(std::unique(c.m_deps.begin(), c.m_deps.end()) - c.m_deps.begin()));
+        for (constraint_index ci : c.m_deps)
+            c.m_max_constraint = std::max(c.m_max_constraint, ci);
+        c.m_hash = hash(c);
+        for (cut& d : m_cuts) {
+            if (d.m_hash == c.m_hash && d.m_k == c.m_k && d.m_coeffs == c.m_coeffs) {
+                // the same cut, possibly with another justification
+                if (d.m_deps.size() > c.m_deps.size()) {
+                    d.m_deps.swap(c.m_deps);
+                    d.m_max_constraint = c.m_max_constraint;
+                }
+                d.m_age = 0;
+                return;
+            }
+        }
+        if (m_cuts.size() >= m_max_size)
+            evict();
+        m_cuts.push_back(std::move(c));
+    }
+
+    unsigned cut_pool::separate(unsigned max_cuts, std::function<void(lar_term const&, mpq const&, u_dependency*)> const& add_cut) {
+        for (unsigned i = m_cuts.size(); i-- > 0; )
+            if (++m_cuts[i].m_age > m_max_age)
+                remove(i);
+        unsigned_vector candidates;
+        for (unsigned i = 0; i < m_cuts.size(); ++i) {
+            cut& c = m_cuts[i];
+            if (!is_active(c))
+                continue;
+            impq v;
+            for (auto const& p : c.m_coeffs)
+                v += lra.get_column_value(p.second) * p.first;
+            if (!(v < c.m_k))
+                continue;
+            c.m_efficacy = (c.m_k - v.x).get_double() / c.m_norm;
+            candidates.push_back(i);
+        }
+        std::sort(candidates.begin(), candidates.end(), [&](unsigned a, unsigned b) {
+            return m_cuts[a].m_efficacy > m_cuts[b].m_efficacy;
+        });
+        unsigned_vector selected;
+        for (unsigned i : candidates) {
+            if (selected.size() >= max_cuts)
+                break;
+            cut const& c = m_cuts[i];
+            if (any_of(selected, [&](unsigned s) { return parallelism(c, m_cuts[s]) > m_max_parallelism; }))
+                continue;
+            selected.push_back(i);
+        }
+        for (unsigned i : selected) {
+            cut& c = m_cuts[i];
+            c.m_age = 0;
+            add_cut(lar_term(c.m_coeffs), c.m_k, mk_dep(c));
+        }
+        return selected.size();
+    }
+
+    void cut_pool::pop(unsigned num_columns, unsigned num_constraints) {
+        for (unsigned i = m_cuts.size(); i-- > 0; ) {
+            cut const& c = m_cuts[i];
+            if (c.m_max_column >= num_columns || (!c.m_deps.empty() && c.m_max_constraint >= num_constraints))
+                remove(i);
+        }
+    }
+}
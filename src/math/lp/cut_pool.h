@@ -0,0 +1,88 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    cut_pool.h
+
+Abstract:
+
+    Pool of cuts t >= k found by int_solver, kept across calls to check.
+
+    A cut is stored in normal form: the columns of t are sorted, the
+    coefficients are integers with gcd 1, and k is rounded up when all
+    the columns of t are integral. The dependencies of a cut are kept as
+    constraint indices, because u_dependency objects do not survive a pop.
+
+    A cut stays in the pool as long as its columns and constraints exist.
+    It can be reused when all its constraints are active and the current
+    solution violates it. Cuts are separated by efficacy, the violation
+    divided by the norm of t, and a cut is skipped when it is almost
+    parallel to a cut selected before it. A cut that is not selected for
+    m_max_age rounds is removed.
+
+--*/
+#pragma once
+
+#include <functional>
+#include "util/vector.h"
+#include "math/lp/lar_term.h"
+#include "math/lp/lar_constraints.h"
+
+namespace lp {
+class lar_solver;
+
+class cut_pool {
+    struct cut {
+        vector<std::pair<mpq, lpvar>> m_coeffs;
+        mpq                           m_k;
+        svector<constraint_index>     m_deps;
+        unsigned                      m_hash = 0;
+        unsigned                      m_age = 0;
+        unsigned                      m_max_column = 0;
+        unsigned                      m_max_constraint = 0;
+        double                        m_norm = 0;
+        double                        m_efficacy = 0;
+    };
+
+    lar_solver&      lra;
+    vector<cut>      m_cuts;
+    unsigned         m_max_size = 0;
+    unsigned         m_max_age = 64;
+    double           m_max_parallelism = 0.9;
+
+    void normalize(cut& c) const;
+    static unsigned hash(cut const& c);
+    static double parallelism(cut const& a, cut const& b);
+    bool is_active(cut const& c) const;
+    u_dependency* mk_dep(cut const& c) const;
+    void remove(unsigned i);
+    void evict();
+
+public:
+    cut_pool(lar_solver& lra): lra(lra) {}
+
+    void set_max_size(unsigned n) { m_max_size = n; }
+
+    unsigned size() const { return m_cuts.size(); }
+
+    /**
+       \brief Store the cut t >= k justified by dep, unless it is already in the pool.
+    */
+    void add(lar_term const& t, mpq const& k, u_dependency* dep);
+
+    /**
+       \brief Pass up to max_cuts pooled cuts that are violated by the current solution to add_cut.
+       Return the number of cuts passed.
+    */
+    unsigned separate(unsigned max_cuts, std::function<void(lar_term const&, mpq const&, u_dependency*)> const& add_cut);
+
+    /**
+       \brief Remove the cuts that use columns or constraints removed by a pop.
+    */
+    void pop(unsigned num_columns, unsigned num_constraints);
+
+    void reset() { m_cuts.reset(); }
+};
+
+}
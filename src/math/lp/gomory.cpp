@@ -482,7 +482,6 @@ public:
     lia_move gomory::get_gomory_cuts(unsigned num_cuts) {
         struct cut_result {lar_term t; mpq k; u_dependency *dep;};
         vector<cut_result> big_cuts;
-        unsigned_vector columns_for_cuts = gomory_select_int_infeasible_vars(num_cuts);
         bool has_small_cut = false;
 
         // define inline helper functions
@@ -502,7 +501,21 @@ public:
             return true;
         };
 
+        // reuse the pooled cuts violated by the current solution before creating new ones
+        if (lia.m_cut_pool.size() > 0) {
+            unsigned n = lia.m_cut_pool.separate(num_cuts, add_cut);
+            if (n > 0) {
+                lia.settings().stats().m_pooled_cuts += n;
+                if (!_check_feasible())
+                    return lia_move::conflict;
+                if (!lia.has_inf_int())
+                    return lia_move::sat;
+                return lia_move::continue_with_check;
+            }
+        }
+
 // start creating cuts        
+        unsigned_vector columns_for_cuts = gomory_select_int_infeasible_vars(num_cuts);
         for (unsigned j : columns_for_cuts) {
             SASSERT(is_gomory_cut_target(j));
             unsigned row_index = lia.row_of_basic_column(j);
@@ -515,6 +528,7 @@ public:
                 continue;
             }
             SASSERT(test_row_polarity(lia, row, j) == cc.m_polarity);
+            lia.m_cut_pool.add(cc.m_t, cc.m_k, cc.m_dep);
             if (cc.m_polarity == row_polarity::MAX) 
                 lra.update_column_type_and_bound(j, lp::lconstraint_kind::LE, floor(lra.get_column_value(j).x), add_deps(cc.m_dep, row, j));
             else if (cc.m_polarity == row_polarity::MIN)
@@ -67,6 +67,29 @@ bool horner::row_is_interesting(const T& row) const {
     return false;
 }
 
+/**
+   \brief Hash of the coefficients, variables and bounds that determine the
+   cross-nested forms of the row and their intervals.
+*/
+template <typename T>
+unsigned horner::row_signature(const T& row) const {
+    unsigned h = row.size();
+    auto add_var = [&](lpvar j) {
+        h = combine_hash(h, hash_u(j));
+        h = combine_hash(h, c().has_lower_bound(j) ? c().lra.column_lower_bound(j).hash() : 0);
+        h = combine_hash(h, c().has_upper_bound(j) ? c().lra.column_upper_bound(j).hash() : 0);
+    };
+    for (const auto& p : row) {
+        h = combine_hash(h, p.coeff().hash());
+        lpvar j = p.var();
+        add_var(j);
+        if (c().is_monic_var(j))
+            for (lpvar k : c().emons()[j].vars())
+                add_var(k);
+    }
+    return h;
+}
+
 bool horner::lemmas_on_expr(cross_nested& cn, nex_sum* e) {
     TRACE("nla_horner", tout << "e = " << *e << "\n";);
     cn.run(e);
@@ -91,6 +114,7 @@ bool horner::lemmas_on_row(const T& row) {
         [this, dep](const nex* n) { return c().m_intervals.check_nex(n, dep); },
         [this](unsigned j)   { return c().var_is_fixed(j); },
         [this]() { return c().random(); }, m_nex_creator);
+    cn.set_max_reported(c().params().arith_nl_horner_forms());
     bool ret = lemmas_on_expr(cn, to_sum(e));
     c().m_intervals.get_dep_intervals().reset(); // clean the memory allocated by the interval bound dependencies
     return ret;
@@ -122,10 +146,20 @@ bool horner::horner_lemmas() {
     bool conflict = false;
     for (unsigned i = 0; i < sz && !conflict; i++) {
         m_row_index = rows[(i + r) % sz];
-        if (lemmas_on_row(matrix.m_rows[m_row_index])) {
+        auto const& row = matrix.m_rows[m_row_index];
+        // a row that did not change since it last produced no conflict is skipped
+        unsigned sig = row_signature(row), old_sig;
+        if (m_no_conflict.find(m_row_index, old_sig) && old_sig == sig) {
+            c().lp_settings().stats().m_horner_cached_rows++;
+            continue;
+        }
+        if (lemmas_on_row(row)) {
             c().lp_settings().stats().m_horner_conflicts++;
+            m_no_conflict.remove(m_row_index);
             conflict = true;
         }
+        else
+            m_no_conflict.insert(m_row_index, sig);
     }
     return conflict;
 }
@@ -24,6 +24,7 @@
 #include "math/lp/nex.h"
 #include "math/lp/cross_nested.h"
 #include "util/uint_set.h"
+#include "util/map.h"
 
 namespace nla {
 class core;
@@ -32,6 +33,10 @@ class core;
 class horner : common {
     nex_creator::sum_factory  m_row_sum;
     unsigned         m_row_index;                      
+    u_map<unsigned>  m_no_conflict; // row index -> signature of the row when it last produced no conflict
+
+    template <typename T>
+    unsigned row_signature(const T& row) const;
 public:
     typedef intervals::interval interv;
     horner(core *core);
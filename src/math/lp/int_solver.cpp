@@ -152,7 +152,8 @@ namespace lp {
         m_patcher(*this),
         m_number_of_calls(0),
         m_hnf_cutter(*this),
-        m_hnf_cut_period(settings().hnf_cut_period()) {
+        m_hnf_cut_period(settings().hnf_cut_period()),
+        m_cut_pool(lar_slv) {
         lra.set_int_solver(this);
     }
 
@@ -181,6 +182,7 @@ namespace lp {
         m_ex->clear();
         m_upper = false;
         m_cut_vars.reset();
+        m_cut_pool.set_max_size(settings().cut_pool_size());
         
         lia_move r = lia_move::undef;
 
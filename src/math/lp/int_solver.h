@@ -27,6 +27,7 @@ Revision History:
 #include "math/lp/int_gcd_test.h"
 #include "math/lp/lia_move.h"
 #include "math/lp/explanation.h"
+#include "math/lp/cut_pool.h"
 
 namespace lp {
 class lar_solver;
@@ -68,6 +69,7 @@ class int_solver {
     hnf_cutter          m_hnf_cutter;
     unsigned            m_hnf_cut_period;
     unsigned_vector     m_cut_vars;        // variables that should not be selected for cuts
+    cut_pool            m_cut_pool;        // cuts kept across calls to check
     
     vector<equality>       m_equalities;
 public:
@@ -129,6 +131,7 @@ public:
     bool is_term(unsigned j) const;
     unsigned column_count() const;
     lia_move hnf_cut();
+    cut_pool& get_cut_pool() { return m_cut_pool; }
 
     int select_int_infeasible_var();
     
@@ -186,6 +186,8 @@ public:
 
     bool valid_index(constraint_index ci) const { return ci < m_constraints.size(); }
 
+    unsigned size() const { return m_constraints.size(); }
+
     class active_constraints {
         friend class constraint_set;
         constraint_set const& cs;
@@ -245,6 +245,8 @@ namespace lp {
         lp_assert(m_mpq_lar_core_solver.m_r_solver.reduced_costs_are_correct_tableau());
         m_usage_in_terms.pop(k);
         m_dependencies.pop_scope(k);
+        if (m_int_solver)
+            m_int_solver->get_cut_pool().pop(A_r().column_count(), m_constraints.size());
         // init the nbasis sorting
 		require_nbasis_sort();
         set_status(lp_status::UNKNOWN);
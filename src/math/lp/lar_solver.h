@@ -43,6 +43,9 @@
 #include "util/stacked_value.h"
 #include "util/vector.h"
 #include "util/trail.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 namespace lp {
 
@@ -177,12 +180,12 @@ class lar_solver : public column_namer {
     bool sizes_are_correct() const;
     bool implied_bound_is_correctly_explained(implied_bound const& be, const vector<std::pair<mpq, unsigned>>& explanation) const;
 
-    template <typename T>
-    unsigned calculate_implied_bounds_for_row(unsigned row_index, lp_bound_propagator<T>& bp) {
+    template <typename B>
+    unsigned calculate_implied_bounds_for_row(unsigned row_index, B& bp) {
         if (A_r().m_rows[row_index].size() > settings().max_row_length_for_bound_propagation || row_has_a_big_num(row_index))
             return 0;
 
-        return bound_analyzer_on_row<row_strip<mpq>, lp_bound_propagator<T>>::analyze_row(
+        return bound_analyzer_on_row<row_strip<mpq>, B>::analyze_row(
             A_r().m_rows[row_index],
             null_ci,
             zero_of_type<numeric_pair<mpq>>(),
@@ -373,13 +376,64 @@ public:
                     m_row_bounds_to_replay.push_back(i);
             }
         }
-        for (unsigned i : m_touched_rows) {
-            calculate_implied_bounds_for_row(i, bp);
+        unsigned num_threads = num_bprop_threads();
+        if (num_threads > 1) {
+            calculate_implied_bounds_in_parallel(bp, num_threads);
             if (settings().get_cancel_flag())
                 return;
         }
+        else {
+            for (unsigned i : m_touched_rows) {
+                calculate_implied_bounds_for_row(i, bp);
+                if (settings().get_cancel_flag())
+                    return;
+            }
+        }
         m_touched_rows.reset();
     }
+
+    // use a thread for at least this many touched rows
+    static const unsigned min_rows_per_bprop_thread = 512;
+
+    unsigned num_bprop_threads() const {
+#ifdef SINGLE_THREAD
+        return 1;
+#else
+        unsigned n = settings().bprop_threads();
+        if (n == 0)
+            n = std::thread::hardware_concurrency();
+        return std::max(1u, std::min(n, m_touched_rows.size() / min_rows_per_bprop_thread));
+#endif
+    }
+
+    /**
+       \brief Analyze the touched rows in contiguous chunks, one per thread.
+       The bounds of each chunk are buffered and then replayed into bp chunk by chunk,
+       so bp sees them in the same order as in the sequential loop.
+    */
+    template <typename T>
+    void calculate_implied_bounds_in_parallel(lp_bound_propagator<T>& bp, unsigned num_threads) {
+#ifndef SINGLE_THREAD
+        unsigned_vector rows;
+        for (unsigned i : m_touched_rows)
+            rows.push_back(i);
+        unsigned chunk = (rows.size() + num_threads - 1) / num_threads;
+        std_vector<lp_bound_buffer<T>> buffers(num_threads, lp_bound_buffer<T>(bp));
+        auto work = [&](unsigned id) {
+            unsigned end = std::min(rows.size(), (id + 1) * chunk);
+            for (unsigned k = id * chunk; k < end && !settings().get_cancel_flag(); ++k)
+                calculate_implied_bounds_for_row(rows[k], buffers[id]);
+        };
+        std_vector<std::thread> threads;
+        for (unsigned id = 1; id < num_threads; ++id)
+            threads.push_back(std::thread([&, id]() { work(id); }));
+        work(0);
+        for (auto& th : threads)
+            th.join();
+        for (auto& b : buffers)
+            b.replay();
+#endif
+    }
     void collect_more_rows_for_lp_propagation();
     template <typename T>
     void check_missed_propagations(lp_bound_propagator<T>& bp) {
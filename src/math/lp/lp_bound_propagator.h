@@ -455,4 +455,41 @@ public:
         return true;
     }
 };
+
+/**
+   \brief Collects the bounds that bound_analyzer_on_row finds on a worker thread.
+   It only reads the solver state through the propagator, and the bounds are
+   replayed into the propagator on the main thread, in the order they were found.
+*/
+template <typename T>
+class lp_bound_buffer {
+    struct entry {
+        mpq      m_bound;
+        unsigned m_j;
+        bool     m_is_low;
+        bool     m_strict;
+        std::function<u_dependency* ()> m_explain;
+    };
+    lp_bound_propagator<T>& m_bp;
+    std_vector<entry>       m_entries;
+public:
+    lp_bound_buffer(lp_bound_propagator<T>& bp) : m_bp(bp) {}
+
+    lar_solver& lp() { return m_bp.lp(); }
+    bool upper_bound_is_available(unsigned j) const { return m_bp.upper_bound_is_available(j); }
+    bool lower_bound_is_available(unsigned j) const { return m_bp.lower_bound_is_available(j); }
+    column_type get_column_type(unsigned j) const { return m_bp.get_column_type(j); }
+    const impq& get_lower_bound(unsigned j) const { return m_bp.get_lower_bound(j); }
+    const impq& get_upper_bound(unsigned j) const { return m_bp.get_upper_bound(j); }
+
+    void add_bound(mpq const& v, unsigned j, bool is_low, bool strict, std::function<u_dependency* ()> explain_bound) {
+        m_entries.push_back({v, j, is_low, strict, std::move(explain_bound)});
+    }
+
+    void replay() {
+        for (auto& e : m_entries)
+            m_bp.add_bound(e.m_bound, e.m_j, e.m_is_low, e.m_strict, std::move(e.m_explain));
+        m_entries.clear();
+    }
+};
 }  // namespace lp
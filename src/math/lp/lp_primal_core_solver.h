@@ -50,6 +50,7 @@ namespace lp {
         unsigned m_bland_mode_threshold;
         unsigned m_left_basis_repeated;
         vector<unsigned> m_leaving_candidates;
+        vector<double> m_dual_weights; // devex reference weights, indexed by columns
 
         std::list<unsigned> m_non_basis_list;
         void sort_non_basis();
@@ -333,7 +334,9 @@ namespace lp {
     }
 
     void advance_on_entering_and_leaving_tableau_rows(int entering, int leaving,
-                                                      const X &theta) {
+                                                      const X &theta, const T &a_ent) {
+        if (!m_bland_mode_tableau && this->m_settings.dual_pricing() == dual_pricing_enum::devex)
+            update_dual_weights(entering, leaving, a_ent);
         update_basis_and_x_tableau_rows(entering, leaving, theta);
         this->track_column_feasibility(entering);
     }
@@ -345,6 +348,51 @@ namespace lp {
         return this->inf_heap().min_value();
     }
 
+    double dual_weight(unsigned j) const {
+        return j < m_dual_weights.size() ? m_dual_weights[j] : 1.0;
+    }
+
+    // The column of the entering variable is read before the pivot. The weights persist
+    // between the calls, together with the basis, so that they warm-start the next repair.
+    void update_dual_weights(unsigned entering, unsigned leaving, const T &a_ent) {
+        if (m_dual_weights.size() < this->m_n())
+            m_dual_weights.resize(this->m_n(), 1.0);
+        double w_r = m_dual_weights[leaving];
+        double a_r = numeric_traits<T>::get_double(a_ent);
+        for (const auto &c : this->m_A.m_columns[entering]) {
+            unsigned bj = this->m_basis[c.var()];
+            if (bj == leaving)
+                continue;
+            double ratio = numeric_traits<T>::get_double(this->m_A.get_val(c)) / a_r;
+            m_dual_weights[bj] = std::max(m_dual_weights[bj], ratio * ratio * w_r);
+        }
+        m_dual_weights[entering] = std::max(w_r / (a_r * a_r), 1.0);
+    }
+
+    // pick the infeasible basic column maximizing violation^2 / weight
+    int find_leaving_by_pricing() {
+        bool devex = this->m_settings.dual_pricing() == dual_pricing_enum::devex;
+        int best = -1;
+        double best_score = -1;
+        for (unsigned j : this->inf_heap()) {
+            double v = numeric_traits<X>::get_double(this->m_x[j] - get_val_for_leaving(j));
+            double score = v * v;
+            if (devex)
+                score /= dual_weight(j);
+            if (score > best_score || (score == best_score && j < static_cast<unsigned>(best))) {
+                best = j;
+                best_score = score;
+            }
+        }
+        return best;
+    }
+
+    int choose_leaving_tableau_rows() {
+        if (m_bland_mode_tableau || this->m_settings.dual_pricing() == dual_pricing_enum::smallest_index)
+            return find_smallest_inf_column();
+        return find_leaving_by_pricing();
+    }
+
     const X &get_val_for_leaving(unsigned j) const {
         lp_assert(!this->column_is_feasible(j));
         switch (this->m_column_types[j]) {
@@ -367,7 +415,7 @@ namespace lp {
     }
 
     void one_iteration_tableau_rows() {
-        int leaving = find_smallest_inf_column();
+        int leaving = choose_leaving_tableau_rows();
         if (leaving == -1) {
             this->set_status(lp_status::OPTIMAL);
             return;
@@ -398,8 +446,8 @@ namespace lp {
         TRACE("lar_solver_feas", tout << "leaving = " << leaving
                                  << " removed from inf_heap()\n";);
         // this will remove the leaving from the heap
-        this->inf_heap().erase_min();
-        advance_on_entering_and_leaving_tableau_rows(entering, leaving, theta);
+        this->inf_heap().erase(leaving);
+        advance_on_entering_and_leaving_tableau_rows(entering, leaving, theta, a_ent);
         if (this->current_x_is_feasible())
             this->set_status(lp_status::OPTIMAL);
     }
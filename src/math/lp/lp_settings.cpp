@@ -27,9 +27,12 @@ void lp::lp_settings::updt_params(params_ref const& _p) {
     smt_params_helper p(_p);
     m_enable_hnf = p.arith_enable_hnf();
     m_propagate_eqs = p.arith_propagate_eqs();
+    m_bprop_threads = p.arith_bprop_threads();
+    m_cut_pool_size = p.arith_cut_pool_size();
     print_statistics = p.arith_print_stats();
     m_print_external_var_name = p.arith_print_ext_var_names();
     report_frequency = p.arith_rep_freq();
     m_simplex_strategy = static_cast<lp::simplex_strategy_enum>(p.arith_simplex_strategy());
+    m_dual_pricing = static_cast<lp::dual_pricing_enum>(std::min(p.arith_simplex_pricing(), 2u));
     m_nlsat_delay = p.arith_nl_delay();
 }
@@ -57,6 +57,13 @@ enum class simplex_strategy_enum {
     tableau_costs
 };
 
+// how the tableau_rows strategy picks the infeasible basic column that leaves the basis
+enum class dual_pricing_enum {
+    smallest_index, // the infeasible column with the smallest index
+    dantzig,        // the column with the largest bound violation
+    devex           // the largest bound violation relative to its devex reference weight
+};
+
 std::string column_type_to_string(column_type t);
 
 enum class lp_status {
@@ -115,14 +122,17 @@ struct statistics {
     unsigned m_hnf_cuts;
     unsigned m_nla_calls;
     unsigned m_gomory_cuts;
+    unsigned m_pooled_cuts;
     unsigned m_nla_add_bounds;
     unsigned m_nla_propagate_bounds;
     unsigned m_nla_propagate_eq;
     unsigned m_nla_lemmas;
     unsigned m_nra_calls;
     unsigned m_nla_bounds_improvements;
+    unsigned m_nla_icp_conflicts;
     unsigned m_horner_calls;
     unsigned m_horner_conflicts;
+    unsigned m_horner_cached_rows;
     unsigned m_cross_nested_forms;
     unsigned m_grobner_calls;
     unsigned m_grobner_conflicts;
@@ -144,8 +154,10 @@ struct statistics {
         st.update("arith-hnf-calls", m_hnf_cutter_calls);
         st.update("arith-hnf-cuts", m_hnf_cuts);
         st.update("arith-gomory-cuts", m_gomory_cuts);
+        st.update("arith-pooled-cuts", m_pooled_cuts);
         st.update("arith-horner-calls", m_horner_calls);
         st.update("arith-horner-conflicts", m_horner_conflicts);
+        st.update("arith-horner-cached-rows", m_horner_cached_rows);
         st.update("arith-horner-cross-nested-forms", m_cross_nested_forms);
         st.update("arith-grobner-calls", m_grobner_calls);
         st.update("arith-grobner-conflicts", m_grobner_conflicts);
@@ -157,6 +169,7 @@ struct statistics {
         st.update("arith-nla-lemmas", m_nla_lemmas);
         st.update("arith-nra-calls", m_nra_calls);   
         st.update("arith-bounds-improvements", m_nla_bounds_improvements);
+        st.update("arith-nla-icp-conflicts", m_nla_icp_conflicts);
 
     }
 };
@@ -204,6 +217,7 @@ public:
     bool                   m_bound_propagation = true;
     bool                   presolve_with_double_solver_for_lar = true;
     simplex_strategy_enum  m_simplex_strategy;
+    dual_pricing_enum      m_dual_pricing = dual_pricing_enum::smallest_index;
     
     int              report_frequency = 1000;
     bool             print_statistics = false;
@@ -225,7 +239,11 @@ private:
     bool             m_enable_hnf = true;
     bool             m_print_external_var_name = false;
     bool             m_propagate_eqs = false;
+    unsigned         m_bprop_threads = 1;
+    unsigned         m_cut_pool_size = 0;
 public:
+    unsigned bprop_threads() const { return m_bprop_threads; }
+    unsigned cut_pool_size() const { return m_cut_pool_size; }
     bool print_external_var_name() const { return m_print_external_var_name; }
     bool propagate_eqs() const { return m_propagate_eqs;}
     unsigned hnf_cut_period() const { return m_hnf_cut_period; }
@@ -265,6 +283,8 @@ public:
     simplex_strategy_enum simplex_strategy() const { return m_simplex_strategy; }
     simplex_strategy_enum & simplex_strategy()  { return m_simplex_strategy; }
     bool use_tableau_rows() const { return m_simplex_strategy == simplex_strategy_enum::tableau_rows; }
+    dual_pricing_enum dual_pricing() const { return m_dual_pricing; }
+    dual_pricing_enum & dual_pricing() { return m_dual_pricing; }
     
 #ifdef Z3DEBUG
 static unsigned ddd; // used for debugging    
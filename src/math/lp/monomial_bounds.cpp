@@ -26,6 +26,143 @@ namespace nla {
         }
     }
 
+    /**
+     * Interval constraint propagation over all monomials.
+     * Bounds are propagated up from the factors to the monomial and down from
+     * the monomial to its factors, using intervals that are local to this pass,
+     * until no bound changes or m_icp_max_rounds rounds have been made.
+     * Return true if an interval became empty, in which case a conflict
+     * lemma is added.
+     */
+    bool monomial_bounds::icp() {
+        m_icp.reset();
+        m_icp_index.reset();
+        bool changed = true;
+        for (unsigned round = 0; changed && round < m_icp_max_rounds; ++round) {
+            changed = false;
+            for (monic const& m : c().emons()) {
+                if (!c().reslim().inc())
+                    return false;
+                if (!icp_propagate(m, changed)) {
+                    ++c().lra.settings().stats().m_nla_icp_conflicts;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    scoped_dep_interval& monomial_bounds::icp_interval(lpvar v) {
+        unsigned idx;
+        if (m_icp_index.find(v, idx))
+            return *m_icp[idx];
+        m_icp_index.insert(v, m_icp.size());
+        m_icp.push_back(alloc(scoped_dep_interval, dep));
+        var2interval(v, *m_icp.back());
+        return *m_icp.back();
+    }
+
+    /**
+     * Intersect the interval of v with range.
+     * Return false if the intersection is empty.
+     */
+    bool monomial_bounds::icp_tighten(lpvar v, dep_interval const& range, bool& changed) {
+        scoped_dep_interval& vi = icp_interval(v);
+        scoped_dep_interval r(dep);
+        dep.set<dep_intervals::with_deps>(r, range);
+        if (!dep.lower_is_inf(r) && is_too_big(dep.lower(r)))
+            dep.set_lower_is_inf(r, true);
+        if (!dep.upper_is_inf(r) && is_too_big(dep.upper(r)))
+            dep.set_upper_is_inf(r, true);
+        if (c().var_is_int(v)) {
+            if (!dep.lower_is_inf(r)) {
+                rational lo(dep.lower(r));
+                dep.set_lower(r, dep.lower_is_open(r) && lo.is_int() ? lo + 1 : ceil(lo));
+                dep.set_lower_is_open(r, false);
+            }
+            if (!dep.upper_is_inf(r)) {
+                rational hi(dep.upper(r));
+                dep.set_upper(r, dep.upper_is_open(r) && hi.is_int() ? hi - 1 : floor(hi));
+                dep.set_upper_is_open(r, false);
+            }
+        }
+        auto improves_lower = [&]() {
+            if (dep.lower_is_inf(r))
+                return false;
+            if (dep.lower_is_inf(vi))
+                return true;
+            rational a(dep.lower(r)), b(dep.lower(vi));
+            return a > b || (a == b && dep.lower_is_open(r) && !dep.lower_is_open(vi));
+        };
+        auto improves_upper = [&]() {
+            if (dep.upper_is_inf(r))
+                return false;
+            if (dep.upper_is_inf(vi))
+                return true;
+            rational a(dep.upper(r)), b(dep.upper(vi));
+            return a < b || (a == b && dep.upper_is_open(r) && !dep.upper_is_open(vi));
+        };
+        if (improves_lower()) {
+            dep.copy_lower_bound<dep_intervals::with_deps>(r, vi);
+            changed = true;
+        }
+        if (improves_upper()) {
+            dep.copy_upper_bound<dep_intervals::with_deps>(r, vi);
+            changed = true;
+        }
+        if (!dep.is_empty(vi))
+            return true;
+        lp::explanation ex;
+        dep.get_lower_dep(vi, ex);
+        dep.get_upper_dep(vi, ex);
+        new_lemma lemma(c(), "icp - empty interval");
+        lemma &= ex;
+        TRACE("nla_solver", dep.display(tout << "v" << v << " ", vi) << "\n" << lemma << "\n";);
+        return false;
+    }
+
+    /**
+     * Propagate the product of the factor intervals to m.var(), and
+     * m.var() divided by the product of the other factors to each factor
+     * that occurs with power 1.
+     */
+    bool monomial_bounds::icp_propagate(monic const& m, bool& changed) {
+        scoped_dep_interval product(dep), vi(dep);
+        dep.set_value(product, rational::one());
+        unsigned power = 1;
+        for (unsigned i = 0; i < m.size(); ) {
+            lpvar v = m.vars()[i];
+            ++i;
+            for (power = 1; i < m.size() && m.vars()[i] == v; ++i, ++power);
+            dep.set<dep_intervals::with_deps>(vi, icp_interval(v));
+            dep.power<dep_intervals::with_deps>(vi, power, vi);
+            dep.mul<dep_intervals::with_deps>(product, vi, product);
+        }
+        if (!icp_tighten(m.var(), product, changed))
+            return false;
+        for (unsigned i = 0; i < m.size(); ) {
+            lpvar v = m.vars()[i];
+            unsigned start = i;
+            for (++i; i < m.size() && m.vars()[i] == v; ++i);
+            if (i - start > 1)
+                continue;
+            scoped_dep_interval others(dep), range(dep);
+            dep.set_value(others, rational::one());
+            for (unsigned k = 0; k < m.size(); ++k) {
+                if (k == start)
+                    continue;
+                dep.set<dep_intervals::with_deps>(vi, icp_interval(m.vars()[k]));
+                dep.mul<dep_intervals::with_deps>(others, vi, others);
+            }
+            if (!dep.separated_from_zero(others))
+                continue;
+            dep.div<dep_intervals::with_deps>(icp_interval(m.var()), others, range);
+            if (!icp_tighten(v, range, changed))
+                return false;
+        }
+        return true;
+    }
+
     bool monomial_bounds::is_too_big(mpq const& q) const {
         return rational(q).bitsize() > 256;
     }
@@ -11,12 +11,19 @@
 #include "math/lp/nla_common.h"
 #include "math/lp/nla_intervals.h"
 #include "util/uint_set.h"
+#include "util/scoped_ptr_vector.h"
+#include "util/map.h"
 
 namespace nla {
     class core;
     class monomial_bounds : common {
         dep_intervals& dep;
 
+        // interval constraint propagation
+        scoped_ptr_vector<scoped_dep_interval> m_icp;
+        u_map<unsigned>                        m_icp_index;
+        unsigned                               m_icp_max_rounds = 16;
+
         bool should_propagate_lower(dep_interval const& range, lpvar v, unsigned p);
         bool should_propagate_upper(dep_interval const& range, lpvar v, unsigned p);
         void propagate_bound(lpvar v, lp::lconstraint_kind cmp, rational const& q, u_dependency* d);
@@ -38,6 +45,10 @@ namespace nla {
         bool is_zero(lpvar v) const;
         bool add_lemma();
 
+        scoped_dep_interval& icp_interval(lpvar v);
+        bool icp_tighten(lpvar v, dep_interval const& range, bool& changed);
+        bool icp_propagate(monic const& m, bool& changed);
+
         // monomial propagation
         void unit_propagate(monic & m);
         bool is_linear(monic const& m, lpvar& w, lpvar & fixed_to_zero);
@@ -46,6 +57,7 @@ namespace nla {
     public:
         monomial_bounds(core* core);
         void propagate();
+        bool icp();
         void unit_propagate();
     }; 
 }
@@ -1502,6 +1502,9 @@ lbool core::check() {
 
     auto no_effect = [&]() { return ret == l_undef && !done() && m_lemmas.empty() && m_literals.empty() && !m_check_feasible; };
     
+    if (no_effect() && params().arith_nl_icp())
+        m_monomial_bounds.icp();
+
     if (no_effect())
         m_monomial_bounds.propagate();
     
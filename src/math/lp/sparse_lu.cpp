@@ -0,0 +1,16 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sparse_lu.cpp
+
+Abstract:
+
+    Sparse LU factorization of a simplex basis.
+
+--*/
+#include "math/lp/sparse_lu_def.h"
+namespace lp {
+template class sparse_lu<mpq>;
+}
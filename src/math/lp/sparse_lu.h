@@ -0,0 +1,108 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sparse_lu.h
+
+Abstract:
+
+    Sparse LU factorization of a simplex basis.
+
+    The basis is given by its columns. The factorization performs
+    Gaussian elimination with Markowitz pivot selection on the active
+    submatrix and records, for every step k, the pivot row r_k, the
+    pivot position c_k, the column of L multipliers and the row of U.
+    The passes over L and the eta file skip the steps whose entry of the
+    right side is zero, which keeps solves cheap on sparse right sides.
+
+    Basis changes are recorded as eta columns in product form, and a
+    new factorization is due after m_max_etas replacements.
+
+--*/
+#pragma once
+
+#include <utility>
+#include "util/vector.h"
+#include "math/lp/lp_utils.h"
+#include "math/lp/indexed_vector.h"
+
+namespace lp {
+
+template <typename T>
+class sparse_lu {
+public:
+    typedef vector<std::pair<unsigned, T>> sparse_column;
+
+private:
+    struct step {
+        unsigned      m_row;   // the pivot row r_k
+        unsigned      m_pos;   // the basis position c_k
+        T             m_pivot;
+        sparse_column m_l;     // (row, multiplier) for the rows eliminated in this step
+        sparse_column m_u;     // (position, value) of the pivot row without the pivot
+    };
+
+    struct count_lt {
+        vector<unsigned> const & m_count;
+        count_lt(vector<unsigned> const & c): m_count(c) {}
+        bool operator()(int p1, int p2) const { return m_count[p1] < m_count[p2]; }
+    };
+
+    struct eta {
+        unsigned      m_pos;
+        T             m_pivot;
+        sparse_column m_col;   // (position, alpha) without the pivot
+    };
+
+    unsigned        m_dim = 0;
+    vector<step>    m_steps;
+    vector<eta>     m_etas;
+    unsigned        m_max_etas;
+    double          m_threshold;
+
+    // active submatrix, used only while factoring
+    vector<sparse_column>    m_rows;        // (position, value)
+    vector<vector<unsigned>> m_col_rows;   // rows that may have a non-zero in a position
+    vector<T>                m_work;        // the pivot row, indexed by positions
+    static T const* find(sparse_column const& row, unsigned pos);
+    static void assign(indexed_vector<T> & w, unsigned i, T const& v);
+
+public:
+    sparse_lu(unsigned max_etas = 100, double threshold = 0.01):
+        m_max_etas(max_etas),
+        m_threshold(threshold) {}
+
+    /**
+       \brief Factor the basis whose position p holds the column columns[p].
+       The entries of a column are (row, value) pairs. Return false if the basis is singular.
+    */
+    bool factor(vector<sparse_column> const& columns);
+
+    /**
+       \brief Solve B x = a. On entry w holds a indexed by rows, on exit it holds x indexed by positions.
+    */
+    void solve_Bx(indexed_vector<T> & w) const;
+
+    /**
+       \brief Solve y^T B = d^T. On entry w holds d indexed by positions, on exit it holds y indexed by rows.
+    */
+    void solve_yB(indexed_vector<T> & w) const;
+
+    /**
+       \brief Replace the column at position pos by the column whose solution of B x = a is alpha.
+       Return false if the new basis is singular, that is, alpha[pos] is zero.
+    */
+    bool replace_column(unsigned pos, indexed_vector<T> const& alpha);
+
+    bool needs_refactorization() const { return m_etas.size() >= m_max_etas; }
+
+    unsigned dimension() const { return m_dim; }
+
+    unsigned num_etas() const { return m_etas.size(); }
+
+    // the number of off diagonal non-zeros in L and U
+    unsigned fill() const;
+};
+
+}
@@ -0,0 +1,274 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sparse_lu_def.h
+
+Abstract:
+
+    Sparse LU factorization of a simplex basis.
+
+--*/
+#pragma once
+
+#include <cmath>
+#include "util/heap.h"
+#include "math/lp/sparse_lu.h"
+
+namespace lp {
+
+template <typename T>
+T const* sparse_lu<T>::find(sparse_column const& row, unsigned pos) {
+    for (auto const& e : row)
+        if (e.first == pos)
+            return &e.second;
+    return nullptr;
+}
+
+template <typename T>
+void sparse_lu<T>::assign(indexed_vector<T> & w, unsigned i, T const& v) {
+    T d = v - w[i];
+    if (!numeric_traits<T>::is_zero(d))
+        w.add_value_at_index(i, d);
+}
+
+template <typename T>
+bool sparse_lu<T>::factor(vector<sparse_column> const& columns) {
+    m_dim = columns.size();
+    m_steps.reset();
+    m_etas.reset();
+    m_rows.reset();
+    m_col_rows.reset();
+    m_rows.resize(m_dim);
+    m_col_rows.resize(m_dim);
+    vector<unsigned> count(m_dim, 0u);
+    for (unsigned p = 0; p < m_dim; ++p) {
+        for (auto const& e : columns[p]) {
+            SASSERT(e.first < m_dim);
+            if (numeric_traits<T>::is_zero(e.second))
+                continue;
+            m_rows[e.first].push_back({p, e.second});
+            m_col_rows[p].push_back(e.first);
+            ++count[p];
+        }
+    }
+    heap<count_lt> positions(m_dim, count_lt(count));
+    for (unsigned p = 0; p < m_dim; ++p)
+        positions.insert(p);
+    vector<bool> row_done(m_dim, false);
+    vector<unsigned> row_stamp(m_dim, 0u);
+    vector<unsigned> pos_stamp(m_dim, 0u);
+    unsigned stamp = 0;
+    m_work.resize(m_dim);
+
+    auto update_count = [&](unsigned p, bool inc) {
+        if (inc) {
+            ++count[p];
+            if (positions.contains(p))
+                positions.increased(p);
+        }
+        else {
+            --count[p];
+            if (positions.contains(p))
+                positions.decreased(p);
+        }
+    };
+
+    while (!positions.empty()) {
+        unsigned c = positions.erase_min();
+        // choose, among the rows whose entry in c is large enough, the shortest one
+        double max_abs = 0;
+        ++stamp;
+        for (unsigned i : m_col_rows[c]) {
+            if (row_done[i] || row_stamp[i] == stamp)
+                continue;
+            row_stamp[i] = stamp;
+            T const* v = find(m_rows[i], c);
+            if (v)
+                max_abs = std::max(max_abs, std::abs(numeric_traits<T>::get_double(*v)));
+        }
+        if (count[c] == 0 || max_abs == 0) {
+            m_rows.reset();
+            m_col_rows.reset();
+            return false;
+        }
+        unsigned r = UINT_MAX;
+        T const* pv = nullptr;
+        ++stamp;
+        for (unsigned i : m_col_rows[c]) {
+            if (row_done[i] || row_stamp[i] == stamp)
+                continue;
+            row_stamp[i] = stamp;
+            T const* v = find(m_rows[i], c);
+            if (!v || std::abs(numeric_traits<T>::get_double(*v)) < m_threshold * max_abs)
+                continue;
+            if (r == UINT_MAX || m_rows[i].size() < m_rows[r].size()) {
+                r = i;
+                pv = v;
+            }
+        }
+        SASSERT(r != UINT_MAX);
+
+        m_steps.push_back(step());
+        step & s = m_steps.back();
+        s.m_row = r;
+        s.m_pos = c;
+        s.m_pivot = *pv;
+        row_done[r] = true;
+        unsigned pivot_stamp = ++stamp;
+        for (auto const& e : m_rows[r]) {
+            if (e.first == c)
+                continue;
+            s.m_u.push_back(e);
+            m_work[e.first] = e.second;
+            pos_stamp[e.first] = pivot_stamp;
+            update_count(e.first, false);
+        }
+
+        // eliminate the entries of c in the other active rows
+        unsigned rows_stamp = ++stamp;
+        for (unsigned idx = 0; idx < m_col_rows[c].size(); ++idx) {
+            unsigned i = m_col_rows[c][idx];
+            if (row_done[i] || row_stamp[i] == rows_stamp)
+                continue;
+            row_stamp[i] = rows_stamp;
+            T const* a = find(m_rows[i], c);
+            if (!a)
+                continue;
+            T l = *a / s.m_pivot;
+            s.m_l.push_back({i, l});
+            unsigned seen = ++stamp;
+            sparse_column new_row;
+            for (auto const& e : m_rows[i]) {
+                if (e.first == c)
+                    continue;
+                if (pos_stamp[e.first] != pivot_stamp) {
+                    new_row.push_back(e);
+                    continue;
+                }
+                pos_stamp[e.first] = seen;
+                T v = e.second - l * m_work[e.first];
+                if (numeric_traits<T>::is_zero(v))
+                    update_count(e.first, false);
+                else
+                    new_row.push_back({e.first, v});
+            }
+            for (auto const& e : s.m_u) {
+                if (pos_stamp[e.first] == seen) {
+                    pos_stamp[e.first] = pivot_stamp;
+                    continue;
+                }
+                new_row.push_back({e.first, -l * e.second});
+                m_col_rows[e.first].push_back(i);
+                update_count(e.first, true);
+            }
+            m_rows[i].swap(new_row);
+        }
+        m_rows[r].reset();
+        m_col_rows[c].reset();
+    }
+    m_rows.reset();
+    m_col_rows.reset();
+    return true;
+}
+
+template <typename T>
+void sparse_lu<T>::solve_Bx(indexed_vector<T> & w) const {
+    // apply L^{-1}
+    for (step const& s : m_steps) {
+        T const& t = w[s.m_row];
+        if (numeric_traits<T>::is_zero(t))
+            continue;
+        T tv = t;
+        for (auto const& e : s.m_l)
+            w.add_value_at_index(e.first, -e.second * tv);
+    }
+    // back substitution with U, visiting the steps in reverse order
+    indexed_vector<T> x(m_dim);
+    for (unsigned k = m_steps.size(); k-- > 0; ) {
+        step const& s = m_steps[k];
+        T t = w[s.m_row];
+        for (auto const& e : s.m_u) {
+            T const& xe = x[e.first];
+            if (!numeric_traits<T>::is_zero(xe))
+                t -= e.second * xe;
+        }
+        if (!numeric_traits<T>::is_zero(t))
+            x.set_value(t / s.m_pivot, s.m_pos);
+    }
+    // apply the eta file
+    for (eta const& e : m_etas) {
+        T const& t = x[e.m_pos];
+        if (numeric_traits<T>::is_zero(t))
+            continue;
+        T xp = t / e.m_pivot;
+        assign(x, e.m_pos, xp);
+        for (auto const& a : e.m_col)
+            x.add_value_at_index(a.first, -a.second * xp);
+    }
+    w = x;
+}
+
+template <typename T>
+void sparse_lu<T>::solve_yB(indexed_vector<T> & w) const {
+    // apply the eta file in reverse order
+    for (unsigned k = m_etas.size(); k-- > 0; ) {
+        eta const& e = m_etas[k];
+        T t = w[e.m_pos];
+        for (auto const& a : e.m_col) {
+            T const& d = w[a.first];
+            if (!numeric_traits<T>::is_zero(d))
+                t -= a.second * d;
+        }
+        assign(w, e.m_pos, t / e.m_pivot);
+    }
+    // solve z^T U = d^T, z is indexed by rows
+    indexed_vector<T> z(m_dim);
+    for (step const& s : m_steps) {
+        T const& t = w[s.m_pos];
+        if (numeric_traits<T>::is_zero(t))
+            continue;
+        T zr = t / s.m_pivot;
+        z.set_value(zr, s.m_row);
+        for (auto const& e : s.m_u)
+            w.add_value_at_index(e.first, -zr * e.second);
+    }
+    // y^T = z^T L^{-1}
+    for (unsigned k = m_steps.size(); k-- > 0; ) {
+        step const& s = m_steps[k];
+        T t = z[s.m_row];
+        for (auto const& e : s.m_l) {
+            T const& v = z[e.first];
+            if (!numeric_traits<T>::is_zero(v))
+                t -= e.second * v;
+        }
+        assign(z, s.m_row, t);
+    }
+    w = z;
+}
+
+template <typename T>
+bool sparse_lu<T>::replace_column(unsigned pos, indexed_vector<T> const& alpha) {
+    SASSERT(pos < m_dim);
+    if (numeric_traits<T>::is_zero(alpha[pos]))
+        return false;
+    m_etas.push_back(eta());
+    eta & e = m_etas.back();
+    e.m_pos = pos;
+    e.m_pivot = alpha[pos];
+    for (unsigned i : alpha.m_index)
+        if (i != pos)
+            e.m_col.push_back({i, alpha[i]});
+    return true;
+}
+
+template <typename T>
+unsigned sparse_lu<T>::fill() const {
+    unsigned r = 0;
+    for (step const& s : m_steps)
+        r += s.m_l.size() + s.m_u.size();
+    return r;
+}
+
+}
@@ -2088,17 +2088,18 @@ namespace algebraic_numbers {
             TRACE("anum_eval_sign", tout << "evaluating sign of: " << p << "\n";);
             while (true) {
                 bool restart = false;
-                // Optimistic: maybe x2v contains only rational values
-                try {
+                polynomial::var_vector & xs = m_eval_sign_vars;
+                // Optimistic: maybe x2v contains only rational values.
+                // Check the variables upfront instead of failing in the middle of the evaluation.
+                xs.reset();
+                ext_pm.vars(p, xs);
+                if (all_of(xs, [&](polynomial::var x) { return x2v(x).is_basic(); })) {
                     opt_var2basic x2v_basic(*this, x2v);
                     scoped_mpq r(qm());
                     ext_pm.eval(p, x2v_basic, r);
                     TRACE("anum_eval_sign", tout << "all variables are assigned to rationals, value of p: " << r << "\n";);
                     return ::to_sign(qm().sign(r));
                 }
-                catch (const opt_var2basic::failed &) {
-                    // continue
-                }
 
                 // Eliminate rational values from p
                 polynomial_ref p_prime(ext_pm);
@@ -2118,7 +2119,6 @@ namespace algebraic_numbers {
                 }
 
                 // Try to find sign using intervals
-                polynomial::var_vector & xs = m_eval_sign_vars;
                 xs.reset();
                 ext_pm.vars(p_prime, xs);
                 SASSERT(!xs.empty());
@@ -5318,6 +5318,81 @@ namespace polynomial {
             sign = !sign;
         }
 
+        /**
+           \brief Return the image of p in Zp. Unlike normalize, the coefficients are not divided by their gcd.
+        */
+        polynomial * mk_Zp_image(polynomial const * p) {
+            SASSERT(m().modular());
+            m_cheap_som_buffer.reset();
+            scoped_numeral a(m_manager);
+            unsigned sz = p->size();
+            for (unsigned i = 0; i < sz; i++) {
+                m_manager.set(a, p->a(i));
+                m_cheap_som_buffer.add_reset(a, p->m(i));
+            }
+            return m_cheap_som_buffer.mk();
+        }
+
+        /**
+           \brief Modular resultant. Store in result the resultant of p and q with respect to x,
+           computed as the resultant modulo word size primes and combined by the Chinese Remainder
+           Theorem. Return false if there are not enough primes.
+
+           The resultant is the determinant of the Sylvester matrix of p and q. The coefficients of
+           the determinant are bounded by the permanent of the matrix of the norms of its entries,
+           which is at most |p|^deg(q) * |q|^deg(p), where |.| is the sum of the absolute values of
+           the coefficients. Primes that lower the degree of p or q in x are skipped; for the
+           remaining ones, the image of the resultant is the resultant of the images.
+        */
+        bool mod_resultant(polynomial const * p, polynomial const * q, var x, polynomial_ref & result) {
+            SASSERT(!m().modular());
+            unsigned deg_p = degree(p, x);
+            unsigned deg_q = degree(q, x);
+            scoped_numeral norm(m()), bound(m()), tmp(m());
+            abs_norm(p, norm);
+            m().power(norm, deg_q, bound);
+            abs_norm(q, norm);
+            m().power(norm, deg_p, tmp);
+            m().mul(bound, tmp, bound);
+            // the image must determine all coefficients in the range [-bound, bound]
+            m().add(bound, bound, bound);
+            TRACE("mresultant", tout << "p: " << polynomial_ref(const_cast<polynomial*>(p), pm()) << "\nq: " << polynomial_ref(const_cast<polynomial*>(q), pm()) << "\nbound: " << bound << "\n";);
+
+            polynomial_ref p_Zp(m_wrapper);
+            polynomial_ref q_Zp(m_wrapper);
+            polynomial_ref R(m_wrapper);
+            polynomial_ref C_star(m_wrapper);
+            scoped_numeral modulus(m());
+            scoped_numeral prime(m());
+            for (unsigned i = 0; i < NUM_BIG_PRIMES; i++) {
+                checkpoint();
+                m().set(prime, g_big_primes[i]);
+                {
+                    scoped_set_zp setZp(m_wrapper, prime);
+                    p_Zp = mk_Zp_image(p);
+                    q_Zp = mk_Zp_image(q);
+                    if (degree(p_Zp, x) != deg_p || degree(q_Zp, x) != deg_q) {
+                        TRACE("mresultant", tout << "bad prime " << prime << "\n";);
+                        continue;
+                    }
+                    resultant(p_Zp, q_Zp, x, R);
+                }
+                if (C_star.get() == nullptr) {
+                    C_star = R;
+                    m().set(modulus, prime);
+                }
+                else {
+                    CRA_combine_images(R, prime, C_star, modulus, C_star);
+                }
+                if (m().gt(modulus, bound)) {
+                    TRACE("mresultant", tout << "result: " << C_star << "\n";);
+                    result = C_star;
+                    return true;
+                }
+            }
+            return false;
+        }
+
         /**
            \brief Compute the resultant of p and q with respect to r.
 
@@ -5420,6 +5495,9 @@ namespace polynomial {
                 return;
             }
 
+            if (!m().modular() && mod_resultant(A, B, x, result))
+                return;
+
             // decompose A and B into
             //   A = iA*cA*ppA
             //   B = iB*cB*ppB
@@ -87,6 +87,8 @@ namespace polynomial {
     
     struct cache::imp { 
         manager &                m;
+        cache::stats &           m_stats;
+        unsigned &               m_max_entries;
         polynomial_table         m_poly_table;
         psc_chain_cache          m_psc_chain_cache;
         factor_cache             m_factor_cache;
@@ -94,7 +96,7 @@ namespace polynomial {
         svector<char>            m_in_cache;
         small_object_allocator & m_allocator;
 
-        imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()) {
+        imp(manager & _m, cache::stats & st, unsigned & max_entries):m(_m), m_stats(st), m_max_entries(max_entries), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()) {
         }
         
         ~imp() {
@@ -151,7 +153,7 @@ namespace polynomial {
         void psc_chain(polynomial * p, polynomial * q, var x, polynomial_ref_vector & S) {
             p = mk_unique(p);
             q = mk_unique(q);
-            unsigned h = hash_u_u(pid(p), pid(q));
+            unsigned h = combine_hash(hash_u_u(pid(p), pid(q)), x);
             psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
             psc_chain_entry * old_entry = m_psc_chain_cache.insert_if_not_there(entry); 
             if (entry != old_entry) {
@@ -161,8 +163,10 @@ namespace polynomial {
                 for (unsigned i = 0; i < old_entry->m_result_sz; i++) {
                     S.push_back(old_entry->m_result[i]);
                 }
+                m_stats.m_psc_hits++;
             }
             else {
+                m_stats.m_psc_misses++;
                 m.psc_chain(p, q, x, S);
                 unsigned sz = S.size();
                 entry->m_result_sz = sz;
@@ -172,6 +176,10 @@ namespace polynomial {
                     S.set(i, h);
                     entry->m_result[i] = h;
                 }
+                if (m_psc_chain_cache.size() > m_max_entries) {
+                    m_stats.m_flushes++;
+                    reset_psc_chain_cache();
+                }
             }
         }
 
@@ -188,8 +196,10 @@ namespace polynomial {
                 for (unsigned i = 0; i < old_entry->m_result_sz; i++) {
                     distinct_factors.push_back(old_entry->m_result[i]);
                 }
+                m_stats.m_factor_hits++;
             }
             else {
+                m_stats.m_factor_misses++;
                 factors fs(m);
                 m.factor(p, fs);
                 unsigned sz = fs.distinct_factors();
@@ -200,12 +210,16 @@ namespace polynomial {
                     distinct_factors.push_back(h);
                     entry->m_result[i] = h;
                 }
+                if (m_factor_cache.size() > m_max_entries) {
+                    m_stats.m_flushes++;
+                    reset_factor_cache();
+                }
             }
         }
     };
 
     cache::cache(manager & m) {
-        m_imp = alloc(imp, m);
+        m_imp = alloc(imp, m, m_stats, m_max_entries);
     }
 
     cache::~cache() {
@@ -231,6 +245,14 @@ namespace polynomial {
     void cache::reset() {
         manager & _m = m();
         dealloc(m_imp);
-        m_imp = alloc(imp, _m);
+        m_imp = alloc(imp, _m, m_stats, m_max_entries);
+    }
+
+    void cache::collect_statistics(statistics & st) const {
+        st.update("nlsat psc cache hits", m_stats.m_psc_hits);
+        st.update("nlsat psc cache misses", m_stats.m_psc_misses);
+        st.update("nlsat factor cache hits", m_stats.m_factor_hits);
+        st.update("nlsat factor cache misses", m_stats.m_factor_misses);
+        st.update("nlsat cache flushes", m_stats.m_flushes);
     }
 };
@@ -19,15 +19,28 @@ Notes:
 #pragma once
 
 #include "math/polynomial/polynomial.h"
+#include "util/statistics.h"
 
 namespace polynomial {
 
     /**
        \brief Functor for creating unique polynomials and caching results of operations
+
+       The caches for psc chains and factors are keyed by the ids of the unique
+       polynomials. A cache is flushed when it exceeds the maximal number of entries.
     */
     class cache {
         struct imp;
-        imp * m_imp;
+        struct stats {
+            unsigned m_psc_hits = 0;
+            unsigned m_psc_misses = 0;
+            unsigned m_factor_hits = 0;
+            unsigned m_factor_misses = 0;
+            unsigned m_flushes = 0;
+        };
+        imp *    m_imp;
+        stats    m_stats;
+        unsigned m_max_entries = UINT_MAX;
     public:
         cache(manager & m);
         ~cache();
@@ -37,6 +50,9 @@ namespace polynomial {
         void psc_chain(polynomial const * p, polynomial const * q, var x, polynomial_ref_vector & S);
         void factor(polynomial const * p, polynomial_ref_vector & distinct_factors);
         void reset();
+        void set_max_entries(unsigned n) { m_max_entries = n; }
+        void collect_statistics(statistics & st) const;
+        void reset_statistics() { m_stats = stats(); }
     };
 };
 
@@ -21,6 +21,8 @@ Author:
 Notes:
 
 --*/
+#include <cmath>
+#include <limits>
 #include "math/polynomial/upolynomial.h"
 #include "math/polynomial/upolynomial_factorization.h"
 #include "math/polynomial/polynomial_primes.h"
@@ -1728,6 +1730,51 @@ namespace upolynomial {
         }
     }
 
+    /**
+       \brief Floating point filter for the sign of p(b).
+       Evaluate p(b) with Horner's rule in double precision, together with S = sum |a_i|*|b|^i.
+       Every term a_i*b^i is computed with a relative error of at most gamma_K, so the error
+       of the result is at most gamma_K * S. The bound does not depend on the rounding mode.
+       Return false if the sign cannot be certified, e.g., the numbers are out of range.
+    */
+    bool manager::eval_sign_at_double(unsigned sz, numeral const * p, mpbq const & b, sign & r) {
+        // relative error of get_double, 1 for machine integers and at most the number of digits otherwise.
+        auto conversion_error = [&](numeral const & a) { return m().m().is_int64(a) ? 1u : 40u; };
+        if (m().modular() || b.k() > 512)
+            return false;
+        double c = m().m().get_double(b.numerator());
+        double x = std::ldexp(c, -static_cast<int>(b.k()));
+        if (!std::isfinite(x) || std::fabs(x) > 1e30 || (x != 0 && std::fabs(x) < 1e-30))
+            return false;
+        unsigned n = sz - 1;
+        unsigned max_conv = 0;
+        for (unsigned i = 0; i < sz; i++)
+            max_conv = std::max(max_conv, conversion_error(p[i]));
+        double ax = std::fabs(x);
+        double v = m().m().get_double(p[n]);
+        double s = std::fabs(v);
+        for (unsigned i = n; i-- > 0; ) {
+            double a = m().m().get_double(p[i]);
+            v = v * x + a;
+            s = s * ax + std::fabs(a);
+        }
+        if (!std::isfinite(v) || !std::isfinite(s) || s > 1e300 || s < 1e-250)
+            return false;
+        double K = 2.0 * n + 2 + max_conv + n * conversion_error(b.numerator());
+        double u = std::numeric_limits<double>::epsilon();
+        if (K * u > 0.25)
+            return false;
+        // gamma_K, doubled to absorb the rounding errors in the computation of s
+        double bound = 2 * (K * u / (1 - K * u)) * s;
+        if (v > bound)
+            r = sign_pos;
+        else if (v < -bound)
+            r = sign_neg;
+        else
+            return false;
+        return true;
+    }
+
     // Evaluate the sign of p(b)
     sign manager::eval_sign_at(unsigned sz, numeral const * p, mpbq const & b) {
         // Actually, given b = c/2^k, we compute the sign of (2^k)^n*p(b)
@@ -1739,6 +1786,9 @@ namespace upolynomial {
             return sign_zero;
         if (sz == 1)
             return sign_of(p[0]);
+        sign fp_sign;
+        if (eval_sign_at_double(sz, p, b, fp_sign))
+            return fp_sign;
         numeral const & c = b.numerator();
         unsigned k   = b.k();
         unsigned k_i = k;
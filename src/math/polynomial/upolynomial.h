@@ -554,6 +554,7 @@ namespace upolynomial {
         numeral_vector    m_push_tmp;
 
         sign sign_of(numeral const & c);
+        bool eval_sign_at_double(unsigned sz, numeral const * p, mpbq const & b, sign & r);
         struct drs_frame;
         void pop_top_frame(numeral_vector & p_stack, svector<drs_frame> & frame_stack);
         void push_child_frames(unsigned sz, numeral const * p, numeral_vector & p_stack, svector<drs_frame> & frame_stack);
@@ -17,6 +17,7 @@ Notes:
 #include "util/stopwatch.h"
 #include "util/trace.h"
 #include <cstring>
+#include <algorithm>
 
 
 bit_matrix::col_iterator bit_matrix::row::begin() const { 
@@ -28,13 +29,15 @@ bit_matrix::col_iterator bit_matrix::row::end() const {
 }
 
 void bit_matrix::col_iterator::next() {
+    unsigned n = r.m.m_num_columns;
     ++m_column;
-    while (m_column < r.m.m_num_columns && !r[m_column]) {
-        while ((m_column % 64) == 0 && m_column + 64 < r.m.m_num_columns && !r.r[m_column >> 6]) {
+    while (m_column < n && !r[m_column]) {
+        if ((m_column % 64) == 0 && !r.r[m_column >> 6]) 
             m_column += 64;
-        }
-        ++m_column;
+        else
+            ++m_column;
     }
+    m_column = std::min(m_column, n);
 }
 
 bool bit_matrix::row::operator[](unsigned i) const {
@@ -71,6 +74,20 @@ bit_matrix::row& bit_matrix::row::operator+=(row const& other) {
     return *this;
 }
 
+bool bit_matrix::row::is_zero() const {
+    for (unsigned i = 0; i < m.m_num_chunks; ++i) 
+        if (r[i])
+            return false;
+    return true;
+}
+
+unsigned bit_matrix::first_chunk(uint64_t const* r) const {
+    unsigned i = 0;
+    while (i < m_num_chunks && !r[i])
+        ++i;
+    return i;
+}
+
 struct bit_matrix::report {
     bit_matrix& b;
     stopwatch   m_watch;
@@ -82,19 +99,114 @@ struct bit_matrix::report {
 };
 
 void bit_matrix::solve() {
-    basic_solve();
+    report _report(*this);
+    if (m_rows.size() >= 256 && m_num_columns >= 64)
+        m4r_solve(8);
+    else
+        basic_solve();
 }
 
+/**
+   \brief Gauss-Jordan elimination.
+   The solved rows are moved to the front in the order of their pivot columns.
+   Rows that are linearly dependent on the solved rows become zero.
+*/
 void bit_matrix::basic_solve() {
-    report _report(*this);
-    for (row& r : *this) {
-        auto ci = r.begin();
-        if (ci != r.end()) {
-            unsigned c = *ci;
-            for (row& r2 : *this) {
-                if (r2 != r && r2[c]) r2 += r;
+    unsigned r = 0, n = m_rows.size();
+    for (unsigned c = 0; c < m_num_columns && r < n; ++c) {
+        unsigned i = r;
+        while (i < n && !get(m_rows[i], c))
+            ++i;
+        if (i == n)
+            continue;
+        std::swap(m_rows[i], m_rows[r]);
+        uint64_t const* p = m_rows[r];
+        unsigned start = c >> 6;
+        for (unsigned j = 0; j < n; ++j) 
+            if (j != r && get(m_rows[j], c))
+                add_row(m_rows[j], p, start);
+        ++r;
+    }
+}
+
+/**
+   \brief Search for a row in [r, n) with column c set after it has been reduced
+   by the pivot rows [r0, r) of the current block, whose pivot columns are pivots.
+   The pivot row is swapped to position r, and the other pivot rows of 
+   the block are reduced by it.
+*/
+bool bit_matrix::find_pivot(unsigned c, unsigned r, unsigned r0, unsigned_vector const& pivots) {
+    unsigned n = m_rows.size();
+    for (unsigned i = r; i < n; ++i) {
+        uint64_t* row = m_rows[i];
+        for (unsigned j = 0; j < pivots.size(); ++j) 
+            if (get(row, pivots[j]))
+                add_row(row, m_rows[r0 + j], pivots[j] >> 6);
+        if (!get(row, c))
+            continue;
+        std::swap(m_rows[i], m_rows[r]);
+        for (unsigned j = r0; j < r; ++j) 
+            if (get(m_rows[j], c))
+                add_row(m_rows[j], m_rows[r], c >> 6);
+        return true;
+    }
+    return false;
+}
+
+/**
+   \brief Gauss-Jordan elimination using the method of four Russians.
+   Up to k pivots are selected at a time. All 2^k sums of the pivot rows 
+   are tabulated in Gray code order, which is one row addition per entry.
+   Every other row is then reduced by adding the sum selected by its bits 
+   in the pivot columns.
+*/
+void bit_matrix::m4r_solve(unsigned k) {
+    SASSERT(0 < k && k < 16);
+    unsigned n = m_rows.size();
+    region tbl_region;
+    ptr_vector<uint64_t> table;
+    for (unsigned i = 0; i < (1u << k); ++i) 
+        table.push_back(new (tbl_region) uint64_t[m_num_chunks]);
+    unsigned_vector pivots;
+    unsigned r = 0;
+    for (unsigned c = 0; c < m_num_columns && r < n; ) {
+        unsigned r0 = r;
+        pivots.reset();
+        for (; c < m_num_columns && r < n && pivots.size() < k; ++c) {
+            if (find_pivot(c, r, r0, pivots)) {
+                pivots.push_back(c);
+                ++r;
             }
-        }        
+        }
+        if (pivots.empty())
+            break;
+        unsigned start = m_num_chunks;
+        for (unsigned j = r0; j < r; ++j) 
+            start = std::min(start, first_chunk(m_rows[j]));
+        unsigned sz = 1u << pivots.size();
+        memset(table[0], 0, sizeof(uint64_t)*m_num_chunks);
+        for (unsigned i = 1, prev = 0; i < sz; ++i) {
+            // the i'th Gray code differs from its predecessor in the lowest set bit of i.
+            unsigned code = i ^ (i >> 1);
+            unsigned b = 0;
+            while (!(i & (1u << b)))
+                ++b;
+            uint64_t* dst = table[code];
+            memcpy(dst, table[prev], sizeof(uint64_t)*m_num_chunks);
+            add_row(dst, m_rows[r0 + b], start);
+            prev = code;
+        }
+        for (unsigned i = 0; i < n; ++i) {
+            if (r0 <= i && i < r)
+                continue;
+            uint64_t* row = m_rows[i];
+            unsigned mask = 0;
+            for (unsigned j = 0; j < pivots.size(); ++j) 
+                if (get(row, pivots[j]))
+                    mask |= (1u << j);
+            if (mask)
+                add_row(row, table[mask], start);
+        }
     }
 }
 
@@ -16,7 +16,11 @@ Author:
 Notes:
 
     Exposes Gauss-Jordan simplification.
-    Uses extremely basic implementation, can be tuned by 4R method.
+    Rows are packed into 64-bit words. Row additions start at the
+    first non-zero word of the pivot row. Larger matrices are
+    solved using the method of four Russians: blocks of pivot rows
+    are combined into a table indexed by Gray codes, such that each
+    remaining row is reduced by a single row addition per block.
 
 --*/
 
@@ -52,6 +56,7 @@ public:
         void set(unsigned i) { SASSERT((i >> 6) < m.m_num_chunks); r[i >> 6] |= (1ull << (i & 63)); }
         void unset(unsigned i) { SASSERT((i >> 6) < m.m_num_chunks); r[i >> 6] &= ~(1ull << (i & 63)); }
         row& operator+=(row const& other);
+        bool is_zero() const;
 
         // using pointer equality:
         bool operator==(row const& other) const { return r == other.r; }
@@ -93,6 +98,9 @@ public:
     };
 
     void reset(unsigned num_columns);
+
+    unsigned num_rows() const { return m_rows.size(); }
+    unsigned num_columns() const { return m_num_columns; }
     
     row_iterator begin() { return row_iterator(*this, true); }
     row_iterator end() { return row_iterator(*this, false); }
@@ -103,6 +111,11 @@ public:
 
 private:
     void basic_solve();
+    void m4r_solve(unsigned k);
+    bool find_pivot(unsigned c, unsigned r, unsigned r0, unsigned_vector const& pivots);
+    unsigned first_chunk(uint64_t const* r) const;
+    void add_row(uint64_t* dst, uint64_t const* src, unsigned start) { for (unsigned i = start; i < m_num_chunks; ++i) dst[i] ^= src[i]; }
+    bool get(uint64_t const* r, unsigned c) const { return (r[c >> 6] & (1ull << (c & 63))) != 0; }
     unsigned_vector gray(unsigned n);
 };
 
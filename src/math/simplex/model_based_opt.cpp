@@ -435,23 +435,14 @@ namespace opt {
         bound_row_index = UINT_MAX;
         rational lub_val;
         rational const& x_val = m_var2value[x];
-        unsigned_vector const& row_ids = m_var2row_ids[x];
-        uint_set visited;
+        unsigned_vector const& row_ids = compact_row_ids(x);
         m_above.reset();
         m_below.reset();
         for (unsigned row_id : row_ids) {
             SASSERT(row_id != m_objective_id);
-            if (visited.contains(row_id)) 
-                continue;
-            visited.insert(row_id);
             row& r = m_rows[row_id];
-            if (!r.m_alive)
-                continue;
             rational a = get_coefficient(row_id, x);
-            if (a.is_zero()) {
-                // skip
-            }
-            else if (a.is_pos() == is_pos || r.m_type == t_eq) {
+            if (a.is_pos() == is_pos || r.m_type == t_eq) {
                 rational value = x_val - (r.m_value/a);
                 if (bound_row_index == UINT_MAX) {
                     lub_val = value;
@@ -482,6 +473,33 @@ namespace opt {
         m_retired_rows.push_back(row_id);
     }
 
+    //
+    // Occurrence lists only grow while rows are combined: a row is added to
+    // the list of a variable when the variable enters the row, but it is not
+    // removed when the variable cancels out or the row is retired.
+    // Prune the list of x in place, keeping the first occurrence of each
+    // live row that contains x, so that later passes over x only visit rows
+    // that matter and need no visited set.
+    //
+    unsigned_vector const& model_based_opt::compact_row_ids(unsigned x) {
+        unsigned_vector& row_ids = m_var2row_ids[x];
+        unsigned j = 0;
+        for (unsigned row_id : row_ids) {
+            if (m_row_mark.get(row_id, false))
+                continue;
+            if (!m_rows[row_id].m_alive)
+                continue;
+            if (get_coefficient(row_id, x).is_zero())
+                continue;
+            m_row_mark.setx(row_id, true, false);
+            row_ids[j++] = row_id;
+        }
+        row_ids.shrink(j);
+        for (unsigned row_id : row_ids)
+            m_row_mark[row_id] = false;
+        return row_ids;
+    }
+
     rational model_based_opt::eval(unsigned x) const {
         return m_var2value[x];
     }
@@ -1111,8 +1129,7 @@ namespace opt {
         bool     lub_strict = false, glb_strict = false;
         rational lub_val, glb_val;
         rational const& x_val = m_var2value[x];
-        unsigned_vector const& row_ids = m_var2row_ids[x];
-        uint_set visited;
+        unsigned_vector const& row_ids = compact_row_ids(x);
         lub_rows.reset();
         glb_rows.reset();
         divide_rows.reset();
@@ -1122,15 +1139,8 @@ namespace opt {
         unsigned eq_row = UINT_MAX;
         // select the lub and glb.
         for (unsigned row_id : row_ids) {
-            if (visited.contains(row_id)) 
-                continue;
-            visited.insert(row_id);
             row& r = m_rows[row_id];
-            if (!r.m_alive) 
-                continue;
             rational a = get_coefficient(row_id, x);
-            if (a.is_zero()) 
-                continue;
             if (r.m_type == t_eq) 
                 eq_row = row_id;
             else if (r.m_type == t_mod) 
@@ -1665,7 +1675,7 @@ namespace opt {
     model_based_opt::def model_based_opt::solve_for(unsigned row_id1, unsigned x, bool compute_def) {
         TRACE("opt", tout << "v" << x << " := " << eval(x) << "\n" << m_rows[row_id1] << "\n";
         display(tout));
-        rational a = get_coefficient(row_id1, x), b;
+        rational a = get_coefficient(row_id1, x);
         row& r1 = m_rows[row_id1];
         ineq_type ty = r1.m_type;
         SASSERT(!a.is_zero());
@@ -1690,18 +1700,9 @@ namespace opt {
             rational c = mod(-eval(coeffs), a);
             add_divides(coeffs, c, a);
         }
-        unsigned_vector const& row_ids = m_var2row_ids[x];
-        uint_set visited;
-        visited.insert(row_id1);
+        unsigned_vector const& row_ids = compact_row_ids(x);
         for (unsigned row_id2 : row_ids) {
-            if (visited.contains(row_id2))
-                continue;
-            visited.insert(row_id2);
-            row& r = m_rows[row_id2];
-            if (!r.m_alive)
-                continue;
-            b = get_coefficient(row_id2, x);
-            if (b.is_zero())
+            if (row_id2 == row_id1)
                 continue;
             row& dst = m_rows[row_id2];
             switch (dst.m_type) {
@@ -101,6 +101,7 @@ namespace opt {
         unsigned_vector         m_lub, m_glb, m_divides, m_mod, m_div;
         unsigned_vector         m_above, m_below;
         unsigned_vector         m_retired_rows;
+        bool_vector             m_row_mark;
         vector<model_based_opt::def> m_result;
 
         void eliminate(unsigned v, def const& d);
@@ -176,6 +177,9 @@ namespace opt {
 
         void retire_row(unsigned row_id);
 
+        // remove duplicate, retired and stale rows from the occurrences of x.
+        unsigned_vector const& compact_row_ids(unsigned x);
+
     public:
 
         model_based_opt();
@@ -59,6 +59,7 @@ namespace simplex {
 
         struct stats {
             unsigned m_num_pivots;
+            unsigned m_num_bound_flips;
             unsigned m_num_infeasible;
             unsigned m_num_checks;
             stats() { reset(); }
@@ -182,7 +183,7 @@ namespace simplex {
                                 scoped_eps_numeral& gain, scoped_numeral& new_a_ij, bool& inc);
 
 
-        void  select_pivot_primal(var_t v, var_t& x_i, var_t& x_j, scoped_numeral& a_ij, bool& inc_x_i, bool& inc_x_j);
+        void  select_pivot_primal(var_t v, var_t& x_i, var_t& x_j, scoped_numeral& a_ij, scoped_eps_numeral& gain, bool& inc_x_i, bool& inc_x_j);
 
 
         bool at_lower(var_t v) const;
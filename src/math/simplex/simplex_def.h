@@ -672,7 +672,7 @@ namespace simplex {
         // 
 
         SASSERT(is_feasible());
-        scoped_eps_numeral delta(em);
+        scoped_eps_numeral delta(em), gain(em);
         scoped_numeral a_ij(m);
         var_t x_i, x_j;
         bool inc_x_i, inc_x_j;
@@ -681,7 +681,7 @@ namespace simplex {
             if (!m_limit.inc()) {
                 return l_undef;
             }
-            select_pivot_primal(v, x_i, x_j, a_ij, inc_x_i, inc_x_j);
+            select_pivot_primal(v, x_i, x_j, a_ij, gain, inc_x_i, inc_x_j);
             if (x_j == null_var) {
                 // optimal
                 return l_true;
@@ -706,12 +706,26 @@ namespace simplex {
                 continue;
             }
 
-            // TBD: Change the value of x_j directly without pivoting:
-            // 
-            // if (!vj.is_fixed() && vj.bounded() && gain >= upper - lower) {
-            // 
-            // }
-            // 
+            // Bound flipping: x_j reaches its own bound before any base
+            // variable reaches its bound, so it can be moved to that bound
+            // without pivoting.
+            eps_numeral const* bound_j = nullptr;
+            if (inc_x_j && vj.m_upper_valid)
+                bound_j = &vj.m_upper;
+            else if (!inc_x_j && vj.m_lower_valid)
+                bound_j = &vj.m_lower;
+            if (bound_j) {
+                em.sub(*bound_j, vj.m_value, delta);
+                scoped_eps_numeral dist(em);
+                dist = delta;
+                em.abs(dist);
+                if (!(gain < dist)) {
+                    TRACE("simplex", tout << "flip v" << x_j << " by " << delta << "\n";);
+                    ++m_stats.m_num_bound_flips;
+                    update_value(x_j, delta);
+                    continue;
+                }
+            }
 
             pivot(x_i, x_j, a_ij);
             TRACE("simplex", display(tout << "after pivot\n"););
@@ -789,11 +803,12 @@ namespace simplex {
      */
     template<typename Ext>
     void simplex<Ext>::select_pivot_primal(var_t v, var_t& x_i, var_t& x_j, scoped_numeral& a_ij, 
-                                           bool& inc_x_i, bool& inc_x_j) {
+                                           scoped_eps_numeral& gain, bool& inc_x_i, bool& inc_x_j) {
         row r(m_vars[v].m_base2row);
         row_iterator it = M.row_begin(r), end = M.row_end(r);
     
-        scoped_eps_numeral gain(em), new_gain(em);
+        scoped_eps_numeral new_gain(em);
+        gain.reset();
         scoped_numeral new_a_ij(m);
         x_i = null_var;
         x_j = null_var;
@@ -890,8 +905,17 @@ namespace simplex {
             if (is_neg(curr_gain)) {
                 curr_gain.neg();
             }
-            if (x_i == null_var || (curr_gain < gain) || 
-                (is_zero(gain) && is_zero(curr_gain) && s < x_i)) {
+            // Ties are broken by the smallest index when there is no gain,
+            // to avoid cycling, and otherwise by the sparsest row, to
+            // limit fill-in when pivoting.
+            bool better = x_i == null_var || curr_gain < gain;
+            if (!better && em.eq(curr_gain, gain)) {
+                if (is_zero(gain))
+                    better = s < x_i;
+                else
+                    better = M.row_size(r) < M.row_size(row(m_vars[x_i].m_base2row));
+            }
+            if (better) {
                 x_i = s;
                 gain = curr_gain;
                 new_a_ij = a_ij;
@@ -1030,6 +1054,7 @@ namespace simplex {
     void simplex<Ext>::collect_statistics(::statistics & st) const {
         M.collect_statistics(st);
         st.update("simplex num pivots", m_stats.m_num_pivots);
+        st.update("simplex num bound flips", m_stats.m_num_bound_flips);
         st.update("simplex num infeasible", m_stats.m_num_infeasible);
         st.update("simplex num checks", m_stats.m_num_checks);
     }
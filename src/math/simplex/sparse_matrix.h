@@ -219,6 +219,8 @@ namespace simplex {
 
         unsigned column_size(var_t v) const { return m_columns[v].size(); }
 
+        unsigned row_size(row const& r) const { return m_rows[r.id()].size(); }
+
         unsigned num_vars() const { return m_columns.size(); }
         unsigned num_rows() const { return m_rows.size(); }
 
@@ -526,6 +526,8 @@ private:
     // Temporary
     numeral                   m_tmp1, m_tmp2, m_tmp3;
     interval                  m_i_tmp1, m_i_tmp2, m_i_tmp3;
+    svector<interval>         m_row_terms;   // a_i * x_i for the polynomial being propagated
+    svector<interval>         m_row_suffix;  // sum_{j >= i} a_j * x_j
 
 
     friend class node;
@@ -687,6 +689,10 @@ private:
     void propagate_polynomial(var x, node * n);
     // Propagate a new bound for y using the polynomial associated with x. x may be equal to y.
     void propagate_polynomial(var x, node * n, var y);
+    // Propagate new bounds for x and all variables of its polynomial, when they are all bounded.
+    void propagate_polynomial_row(var x, node * n);
+    // Assert the bounds r deduced for y using the polynomial associated with x.
+    void propagate_polynomial_bounds(var x, node * n, var y, interval & r);
 
     /**
        \brief Propagate new bounds at node n using clause c.
@@ -452,6 +452,10 @@ context_t<C>::~context_t() {
     del(m_i_tmp1);
     del(m_i_tmp2);
     del(m_i_tmp3);
+    for (interval & a : m_row_terms)
+        del(a);
+    for (interval & a : m_row_suffix)
+        del(a);
     del_nodes();
     del_unit_clauses();
     del_clauses();
@@ -1448,6 +1452,11 @@ void context_t<C>::propagate_polynomial(var x, node * n, var y) {
         TRACE("propagate_polynomial_bug", tout << "r after mul 1/a:  "; im().display(tout, r); tout << "\n";);
         // r contains the deduced bounds for y.
     }
+    propagate_polynomial_bounds(x, n, y, r);
+}
+
+template<typename C>
+void context_t<C>::propagate_polynomial_bounds(var x, node * n, var y, interval & r) {
     // r contains the deduced bounds for y.
     if (!r.m_l_inf) {
         normalize_bound(y, r.m_l_val, true, r.m_l_open);
@@ -1489,12 +1498,58 @@ void context_t<C>::propagate_polynomial(var x, node * n) {
         propagate_polynomial(x, n, unbounded_var);
     }
     else {
-        propagate_polynomial(x, n, x);
-        for (unsigned i = 0; i < sz; i++) {
-            if (inconsistent(n))
-                return;
-            propagate_polynomial(x, n, p->x(i));
-        }
+        propagate_polynomial_row(x, n);
+    }
+}
+
+/**
+   \brief Propagate x = sum a_i * x_i to x and to every x_i in one pass over the row.
+   The terms a_i * x_i and their suffix sums are computed once, so the bounds for x_i are
+   obtained from (x - (prefix_i + suffix_{i+1})) / a_i with O(n) interval operations instead of O(n^2).
+   The terms use the bounds at the beginning of the pass.
+*/
+template<typename C>
+void context_t<C>::propagate_polynomial_row(var x, node * n) {
+    polynomial * p = get_polynomial(x);
+    unsigned sz    = p->size();
+    while (m_row_terms.size() < sz + 1) {
+        m_row_terms.push_back(interval());
+        m_row_suffix.push_back(interval());
+    }
+    interval & v      = m_i_tmp2;
+    interval & r      = m_i_tmp1; r.set_mutable();
+    interval & prefix = m_i_tmp3; prefix.set_mutable();
+    for (unsigned i = 0; i < sz; i++) {
+        v.set_constant(n, p->x(i));
+        m_row_terms[i].set_mutable();
+        im().mul(p->a(i), v, m_row_terms[i]);
+    }
+    m_row_suffix[sz - 1].set_mutable();
+    im().set(m_row_suffix[sz - 1], m_row_terms[sz - 1]);
+    for (unsigned i = sz - 1; i-- > 0; ) {
+        m_row_suffix[i].set_mutable();
+        im().add(m_row_terms[i], m_row_suffix[i + 1], m_row_suffix[i]);
+    }
+    // bounds for x
+    im().set(r, m_row_suffix[0]);
+    propagate_polynomial_bounds(x, n, x, r);
+    for (unsigned i = 0; i < sz; i++) {
+        if (inconsistent(n))
+            return;
+        // r <- x - (prefix + suffix_{i+1})
+        v.set_constant(n, x);
+        im().set(r, v);
+        if (i > 0)
+            im().sub(r, prefix, r);
+        if (i + 1 < sz)
+            im().sub(r, m_row_suffix[i + 1], r);
+        im().div(r, p->a(i), r);
+        // prefix <- prefix + a_i * x_i
+        if (i == 0)
+            im().set(prefix, m_row_terms[0]);
+        else
+            im().add(prefix, m_row_terms[i], prefix);
+        propagate_polynomial_bounds(x, n, p->x(i), r);
     }
 }
 
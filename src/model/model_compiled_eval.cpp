@@ -0,0 +1,296 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    model_compiled_eval.cpp
+
+Abstract:
+
+    Evaluation of a fixed set of terms under many models.
+
+--*/
+
+#include "model/model_compiled_eval.h"
+
+static inline uint64_t word_mask(unsigned w) {
+    return w >= 64 ? ~static_cast<uint64_t>(0) : (static_cast<uint64_t>(1) << w) - 1;
+}
+
+static inline int64_t sign_extend(uint64_t v, unsigned w) {
+    if (w >= 64)
+        return static_cast<int64_t>(v);
+    uint64_t s = static_cast<uint64_t>(1) << (w - 1);
+    return static_cast<int64_t>((v ^ s) - s);
+}
+
+compiled_evaluator::compiled_evaluator(ast_manager& m):
+    m(m),
+    m_bv(m),
+    m_exprs(m) {
+}
+
+void compiled_evaluator::reset() {
+    m_exprs.reset();
+    m_code.reset();
+    m_args.reset();
+    m_values.reset();
+    m_slot.reset();
+}
+
+bool compiled_evaluator::is_word_sort(sort* s) const {
+    return m.is_bool(s) || (m_bv.is_bv_sort(s) && m_bv.get_bv_size(s) <= 64);
+}
+
+bool compiled_evaluator::compile_op(app* a, opcode& op) const {
+    if (!is_word_sort(a->get_sort()))
+        return false;
+    for (expr* arg : *a)
+        if (!is_word_sort(arg->get_sort()))
+            return false;
+    if (m.is_true(a) || m.is_false(a) || m_bv.is_numeral(a)) {
+        op = I_CONST;
+        return true;
+    }
+    if (a->get_family_id() == basic_family_id) {
+        switch (a->get_decl_kind()) {
+        case OP_NOT: op = I_NOT; return true;
+        case OP_AND: op = I_AND; return true;
+        case OP_OR: op = I_OR; return true;
+        case OP_XOR: op = I_XOR; return true;
+        case OP_IMPLIES: op = I_IMPLIES; return true;
+        case OP_ITE: op = I_ITE; return true;
+        case OP_EQ: op = I_EQ; return true;
+        case OP_DISTINCT: op = I_DISTINCT; return true;
+        default: return false;
+        }
+    }
+    if (a->get_family_id() == m_bv.get_fid()) {
+        switch (a->get_decl_kind()) {
+        case OP_BADD: op = I_ADD; return true;
+        case OP_BSUB: op = I_SUB; return true;
+        case OP_BMUL: op = I_MUL; return true;
+        case OP_BNEG: op = I_NEG; return true;
+        case OP_BAND: op = I_AND_BV; return true;
+        case OP_BOR: op = I_OR_BV; return true;
+        case OP_BXOR: op = I_XOR_BV; return true;
+        case OP_BNOT: op = I_NOT_BV; return true;
+        case OP_BSHL: op = I_SHL; return true;
+        case OP_BLSHR: op = I_LSHR; return true;
+        case OP_BASHR: op = I_ASHR; return true;
+        case OP_ULEQ: op = I_ULE; return true;
+        case OP_ULT: op = I_ULT; return true;
+        case OP_UGEQ: op = I_UGE; return true;
+        case OP_UGT: op = I_UGT; return true;
+        case OP_SLEQ: op = I_SLE; return true;
+        case OP_SLT: op = I_SLT; return true;
+        case OP_SGEQ: op = I_SGE; return true;
+        case OP_SGT: op = I_SGT; return true;
+        case OP_CONCAT: op = I_CONCAT; return true;
+        case OP_EXTRACT: op = I_EXTRACT; return true;
+        case OP_ZERO_EXT: op = I_ZERO_EXT; return true;
+        case OP_SIGN_EXT: op = I_SIGN_EXT; return true;
+        default: return false;
+        }
+    }
+    return false;
+}
+
+unsigned compiled_evaluator::add(expr* e) {
+    SASSERT(is_word_sort(e->get_sort()));
+    unsigned slot = 0;
+    if (m_slot.find(e, slot))
+        return slot;
+    ptr_vector<expr> todo;
+    todo.push_back(e);
+    while (!todo.empty()) {
+        expr* t = todo.back();
+        if (m_slot.contains(t)) {
+            todo.pop_back();
+            continue;
+        }
+        opcode op = I_LEAF;
+        if (is_app(t))
+            compile_op(to_app(t), op);
+        if (op != I_LEAF && op != I_CONST) {
+            unsigned sz = todo.size();
+            for (expr* arg : *to_app(t))
+                if (!m_slot.contains(arg))
+                    todo.push_back(arg);
+            if (sz < todo.size())
+                continue;
+        }
+        todo.pop_back();
+        instruction i;
+        i.m_op = op;
+        i.m_width = width(t);
+        i.m_args = m_args.size();
+        i.m_num_args = 0;
+        i.m_param = 0;
+        uint64_t val = 0;
+        if (op == I_CONST) {
+            VERIFY(to_word(t, val));
+        }
+        else if (op != I_LEAF) {
+            for (expr* arg : *to_app(t))
+                m_args.push_back(m_slot[arg]);
+            i.m_num_args = to_app(t)->get_num_args();
+            if (op == I_EXTRACT)
+                i.m_param = m_bv.get_extract_low(t);
+        }
+        m_slot.insert(t, m_code.size());
+        m_code.push_back(i);
+        m_exprs.push_back(t);
+        m_values.push_back(val);
+    }
+    return m_slot[e];
+}
+
+bool compiled_evaluator::to_word(expr* v, uint64_t& r) const {
+    rational n;
+    unsigned sz = 0;
+    if (m.is_true(v))
+        r = 1;
+    else if (m.is_false(v))
+        r = 0;
+    else if (m_bv.is_numeral(v, n, sz) && n.is_uint64())
+        r = n.get_uint64();
+    else
+        return false;
+    return true;
+}
+
+uint64_t compiled_evaluator::exec(instruction const& i) const {
+    unsigned n = i.m_num_args;
+    unsigned w = i.m_width;
+    uint64_t mask = word_mask(w);
+    uint64_t r = 0;
+    switch (i.m_op) {
+    case I_NOT:
+        return !arg(i, 0);
+    case I_AND:
+        for (unsigned j = 0; j < n; ++j)
+            if (!arg(i, j))
+                return 0;
+        return 1;
+    case I_OR:
+        for (unsigned j = 0; j < n; ++j)
+            if (arg(i, j))
+                return 1;
+        return 0;
+    case I_XOR:
+        for (unsigned j = 0; j < n; ++j)
+            r ^= arg(i, j);
+        return r;
+    case I_IMPLIES:
+        return !arg(i, 0) || arg(i, 1);
+    case I_ITE:
+        return arg(i, 0) ? arg(i, 1) : arg(i, 2);
+    case I_EQ:
+        return arg(i, 0) == arg(i, 1);
+    case I_DISTINCT:
+        for (unsigned j = 0; j < n; ++j)
+            for (unsigned k = j + 1; k < n; ++k)
+                if (arg(i, j) == arg(i, k))
+                    return 0;
+        return 1;
+    case I_ADD:
+        for (unsigned j = 0; j < n; ++j)
+            r += arg(i, j);
+        return r & mask;
+    case I_SUB:
+        r = arg(i, 0);
+        for (unsigned j = 1; j < n; ++j)
+            r -= arg(i, j);
+        return r & mask;
+    case I_MUL:
+        r = 1;
+        for (unsigned j = 0; j < n; ++j)
+            r *= arg(i, j);
+        return r & mask;
+    case I_NEG:
+        return (0 - arg(i, 0)) & mask;
+    case I_AND_BV:
+        r = mask;
+        for (unsigned j = 0; j < n; ++j)
+            r &= arg(i, j);
+        return r;
+    case I_OR_BV:
+        for (unsigned j = 0; j < n; ++j)
+            r |= arg(i, j);
+        return r;
+    case I_XOR_BV:
+        for (unsigned j = 0; j < n; ++j)
+            r ^= arg(i, j);
+        return r;
+    case I_NOT_BV:
+        return ~arg(i, 0) & mask;
+    case I_SHL:
+        return arg(i, 1) >= w ? 0 : (arg(i, 0) << arg(i, 1)) & mask;
+    case I_LSHR:
+        return arg(i, 1) >= w ? 0 : arg(i, 0) >> arg(i, 1);
+    case I_ASHR: {
+        int64_t s = sign_extend(arg(i, 0), w);
+        if (arg(i, 1) >= w)
+            return s < 0 ? mask : 0;
+        return static_cast<uint64_t>(s >> arg(i, 1)) & mask;
+    }
+    case I_ULE:
+        return arg(i, 0) <= arg(i, 1);
+    case I_ULT:
+        return arg(i, 0) < arg(i, 1);
+    case I_UGE:
+        return arg(i, 0) >= arg(i, 1);
+    case I_UGT:
+        return arg(i, 0) > arg(i, 1);
+    case I_SLE:
+        return sign_extend(arg(i, 0), arg_width(i, 0)) <= sign_extend(arg(i, 1), arg_width(i, 1));
+    case I_SLT:
+        return sign_extend(arg(i, 0), arg_width(i, 0)) < sign_extend(arg(i, 1), arg_width(i, 1));
+    case I_SGE:
+        return sign_extend(arg(i, 0), arg_width(i, 0)) >= sign_extend(arg(i, 1), arg_width(i, 1));
+    case I_SGT:
+        return sign_extend(arg(i, 0), arg_width(i, 0)) > sign_extend(arg(i, 1), arg_width(i, 1));
+    case I_CONCAT:
+        for (unsigned j = 0; j < n; ++j) {
+            unsigned aw = arg_width(i, j);
+            r = aw >= 64 ? arg(i, j) : (r << aw) | arg(i, j);
+        }
+        return r;
+    case I_EXTRACT:
+        return (arg(i, 0) >> i.m_param) & mask;
+    case I_ZERO_EXT:
+        return arg(i, 0);
+    case I_SIGN_EXT:
+        return static_cast<uint64_t>(sign_extend(arg(i, 0), arg_width(i, 0))) & mask;
+    default:
+        UNREACHABLE();
+        return 0;
+    }
+}
+
+bool compiled_evaluator::operator()(model& mdl) {
+    for (unsigned i = 0; i < m_code.size(); ++i) {
+        instruction const& ins = m_code[i];
+        switch (ins.m_op) {
+        case I_CONST:
+            break;
+        case I_LEAF: {
+            expr_ref v = mdl(m_exprs.get(i));
+            if (!to_word(v, m_values[i]))
+                return false;
+            break;
+        }
+        default:
+            m_values[i] = exec(ins);
+            break;
+        }
+    }
+    return true;
+}
+
+expr_ref compiled_evaluator::get_value(unsigned slot) const {
+    if (m_code[slot].m_width == 0)
+        return expr_ref(m.mk_bool_val(m_values[slot] != 0), m);
+    return expr_ref(m_bv.mk_numeral(m_values[slot], m_code[slot].m_width), m);
+}
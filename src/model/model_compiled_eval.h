@@ -0,0 +1,81 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    model_compiled_eval.h
+
+Abstract:
+
+    Evaluation of a fixed set of terms under many models.
+
+    The terms are compiled once into a topologically ordered sequence of
+    instructions over value slots. Boolean and bit-vector operations of
+    width at most 64 are executed directly on machine words. Every other
+    sub-term is a leaf of the instruction sequence and is evaluated by the
+    model evaluator.
+
+--*/
+#pragma once
+
+#include "ast/ast.h"
+#include "ast/bv_decl_plugin.h"
+#include "model/model.h"
+
+class compiled_evaluator {
+    enum opcode {
+        I_LEAF, I_CONST,
+        I_NOT, I_AND, I_OR, I_XOR, I_IMPLIES, I_ITE, I_EQ, I_DISTINCT,
+        I_ADD, I_SUB, I_MUL, I_NEG, I_AND_BV, I_OR_BV, I_XOR_BV, I_NOT_BV,
+        I_SHL, I_LSHR, I_ASHR,
+        I_ULE, I_ULT, I_UGE, I_UGT, I_SLE, I_SLT, I_SGE, I_SGT,
+        I_CONCAT, I_EXTRACT, I_ZERO_EXT, I_SIGN_EXT
+    };
+
+    struct instruction {
+        opcode   m_op;
+        unsigned m_width;      // 0 for Booleans
+        unsigned m_args;       // offset into m_args
+        unsigned m_num_args;
+        unsigned m_param;      // low bit of extract
+    };
+
+    ast_manager&          m;
+    bv_util               m_bv;
+    expr_ref_vector       m_exprs;    // term of each instruction
+    vector<instruction>   m_code;
+    unsigned_vector       m_args;
+    svector<uint64_t>     m_values;
+    obj_map<expr, unsigned> m_slot;
+
+    bool is_word_sort(sort* s) const;
+    bool compile_op(app* a, opcode& op) const;
+    unsigned width(expr* e) const { return m.is_bool(e) ? 0 : m_bv.get_bv_size(e); }
+    unsigned arg_width(instruction const& i, unsigned j) const { return m_code[m_args[i.m_args + j]].m_width; }
+    uint64_t arg(instruction const& i, unsigned j) const { return m_values[m_args[i.m_args + j]]; }
+    bool to_word(expr* v, uint64_t& r) const;
+    uint64_t exec(instruction const& i) const;
+
+public:
+    compiled_evaluator(ast_manager& m);
+
+    /**
+       \brief Compile the term e and return the slot that holds its value.
+       \pre e is a Boolean or a bit-vector of width at most 64.
+    */
+    unsigned add(expr* e);
+
+    /**
+       \brief Evaluate all compiled terms in the model mdl.
+       Return false if some leaf does not evaluate to a Boolean or bit-vector value.
+    */
+    bool operator()(model& mdl);
+
+    uint64_t get_word(unsigned slot) const { return m_values[slot]; }
+
+    expr_ref get_value(unsigned slot) const;
+
+    unsigned size() const { return m_code.size(); }
+
+    void reset();
+};
@@ -29,6 +29,7 @@ Revision History:
 #include "ast/scoped_proof.h"
 #include "ast/ast_pp_util.h"
 #include "ast/ast_util.h"
+#include "util/stopwatch.h"
 #include "muz/base/dl_context.h"
 #include "muz/base/fp_params.hpp"
 
@@ -716,7 +717,13 @@ namespace datalog {
     void context::transform_rules(rule_transformer& transf) {
         SASSERT(m_closed); //we must finish adding rules before we start transforming them
         TRACE("dl", display_rules(tout););
-        if (transf(m_rule_set)) {
+        stopwatch sw;
+        sw.start();
+        bool modified = transf(m_rule_set);
+        sw.stop();
+        m_transform_time += sw.get_seconds();
+        if (modified) {
+            ++m_num_transforms;
             //we have already ensured the negation is stratified and transformations
             //should not break the stratification
             m_rule_set.ensure_closed();
@@ -1021,6 +1028,8 @@ namespace datalog {
     }
 
     void context::reset_statistics() {
+        m_transform_time = 0;
+        m_num_transforms = 0;
         if (m_engine) {
             m_engine->reset_statistics();
         }
@@ -1030,6 +1039,8 @@ namespace datalog {
         if (m_engine) {
             m_engine->collect_statistics(st);
         }
+        st.update("time.datalog.transform", m_transform_time);
+        st.update("datalog transformations", m_num_transforms);
         get_memory_statistics(st);
         get_rlimit_statistics(m.limit(), st);
     }
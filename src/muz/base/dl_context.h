@@ -199,6 +199,8 @@ namespace datalog {
         bool               m_saturation_was_run;
         bool               m_enable_bind_variables;
         execution_result   m_last_status;
+        double             m_transform_time = 0;     // accumulated time of rule transformations
+        unsigned           m_num_transforms = 0;     // number of rule transformations that modified the rules
         expr_ref           m_last_answer;
         expr_ref           m_last_ground_answer;
         DL_ENGINE          m_engine_type;
@@ -82,7 +82,7 @@ namespace datalog {
             plugin & p = **it;
 
 
-            IF_VERBOSE(1, verbose_stream() << "(transform " << typeid(p).name() << "...";);
+            IF_VERBOSE(1, verbose_stream() << "(transform " << typeid(p).name() << " " << new_rules->get_num_rules() << " rules ...";);
             stopwatch sw;
             sw.start();
             scoped_ptr<rule_set> new_rules1 = p(*new_rules);
@@ -380,6 +380,7 @@ namespace datalog {
                 compile(b.m_rules, fmls, i);
                 assert_fmls(fmls);
                 lbool res = check(i);
+                b.report_level(i, res);
                 if (res == l_undef) {
                     return res;
                 }
@@ -1170,6 +1171,7 @@ namespace datalog {
                 b.checkpoint();
                 compile(i);
                 lbool res = check(i);
+                b.report_level(i, res);
                 if (res == l_undef) {
                     return res;
                 }
@@ -1448,6 +1450,9 @@ namespace datalog {
     lbool bmc::query(expr* query) {
         m_solver = nullptr;
         m_answer = nullptr;
+        m_depth = 0;
+        m_watch.reset();
+        m_watch.start();
         m_ctx.ensure_opened();
         m_rules.reset();
         datalog::rule_manager& rule_manager = m_ctx.get_rule_manager();
@@ -1534,12 +1539,20 @@ namespace datalog {
         tactic::checkpoint(m);
     }
 
+    // Each level is added incrementally to the same solver, so the time is cumulative over the levels.
+    void bmc::report_level(unsigned level, lbool res) {
+        m_depth = level + 1;
+        IF_VERBOSE(1, verbose_stream() << "(bmc :level " << level << " :result " << res 
+                   << " :time " << m_watch.get_current_seconds() << ")\n";);
+    }
+
     void bmc::display_certificate(std::ostream& out) const {
         out << mk_pp(m_answer, m) << "\n";
     }
 
     void bmc::collect_statistics(statistics& st) const {
         if (m_solver) m_solver->collect_statistics(st);
+        st.update("bmc depth", m_depth);
     }
 
     void bmc::reset_statistics() {
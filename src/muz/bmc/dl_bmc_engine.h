@@ -21,6 +21,7 @@ Revision History:
 
 #include "util/params.h"
 #include "util/statistics.h"
+#include "util/stopwatch.h"
 #include "ast/bv_decl_plugin.h"
 #include "solver/solver.h"
 
@@ -35,8 +36,11 @@ namespace datalog {
         func_decl_ref    m_query_pred;
         expr_ref         m_answer;
         rule_ref_vector  m_rule_trace;
+        unsigned         m_depth = 0;       // number of unrolled levels that were checked
+        stopwatch        m_watch;
 
         void checkpoint();
+        void report_level(unsigned level, lbool res);
 
         class nonlinear_dt;
         class nonlinear;
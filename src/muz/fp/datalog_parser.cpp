@@ -45,7 +45,8 @@ static char const* dtoken_strings[] = { "(", ")", "<string>", "<id>", "<num>", "
 class line_reader {
 
     static const char s_delimiter = '\n';
-    static const unsigned s_expansion_step = 1024;
+    // the buffer grows by this many bytes, and is refilled by reads of at least this size.
+    static const unsigned s_expansion_step = 1 << 16;
 
     FILE * m_file;
     svector<char> m_data;
@@ -279,6 +279,11 @@ namespace datalog {
         virtual void update(const sparse_table & t) {}
 
         virtual query_result get_matching_offsets(const key_value & key) const = 0;
+
+        /**
+           \brief Return an indexer for the table \c t, whose content is a copy of the indexed table.
+        */
+        virtual key_indexer * clone(const sparse_table & t) const = 0;
     };
 
 
@@ -312,6 +317,17 @@ namespace datalog {
             m_keys(key_len*sizeof(table_element)), 
             m_first_nonindexed(0) {}
 
+        general_key_indexer(const general_key_indexer & o)
+            : key_indexer(o.m_key_cols.size(), o.m_key_cols.data()),
+            m_map(o.m_map),
+            m_keys(o.m_keys),
+            m_first_nonindexed(o.m_first_nonindexed) {}
+
+        key_indexer * clone(const sparse_table & t) const override {
+            //offsets of facts are preserved when the content of a table is copied
+            return alloc(general_key_indexer, *this);
+        }
+
         void update(const sparse_table & t) override {
             if (m_first_nonindexed == t.m_data.after_last_offset()) {
                 return;
@@ -406,6 +422,10 @@ namespace datalog {
             m_key_fact.resize(t.get_signature().size());
         }
 
+        key_indexer * clone(const sparse_table & t) const override {
+            return alloc(full_signature_key_indexer, m_key_cols.size(), m_key_cols.data(), t);
+        }
+
         query_result get_matching_offsets(const key_value & key) const override {
             unsigned key_len = m_key_cols.size();
             for (unsigned i=0; i<key_len; i++) {
@@ -494,6 +514,14 @@ namespace datalog {
         m_key_indexes.reset();
     }
 
+    void sparse_table::copy_indexes(const sparse_table & t) {
+        SASSERT(m_key_indexes.empty());
+        for (auto const& kv : t.m_key_indexes) {
+            if (kv.m_value)
+                m_key_indexes.insert(kv.m_key, kv.m_value->clone(*this));
+        }
+    }
+
     void sparse_table::write_into_reserve(const table_element* f) {
         TRACE("dl_table_relation", tout << "\n";);
         m_data.ensure_reserve();
@@ -799,6 +827,7 @@ namespace datalog {
     sparse_table * sparse_table_plugin::mk_clone(const sparse_table & t) {
         sparse_table * res = get(mk_empty(t.get_signature()));
         res->m_data = t.m_data;
+        res->copy_indexes(t);
         return res;
     }
 
@@ -419,6 +419,14 @@ namespace datalog {
 
         void reset_indexes();
 
+        /**
+           \brief Copy the indexers of \c t, whose content was just copied into this table.
+
+           Clones of tables keep their indexes, so repeated joins with cloned relations do not
+           rebuild them.
+        */
+        void copy_indexes(const sparse_table & t);
+
         static void copy_columns(const column_layout & src_layout, const column_layout & dest_layout, 
             unsigned start_index, unsigned after_last, const char * src, char * dest, 
             unsigned & dest_idx, unsigned & pre_projection_idx, const unsigned * & next_removed);
@@ -17,6 +17,25 @@ Revision History:
 
     Extracted from dl_context
 
+Notes:
+
+    The compiled instruction program runs on a single thread.
+    Running strata or joins concurrently would require:
+    - a relation_manager and table plugins per worker: plugins recycle
+      tables and indices through shared pools,
+    - workers that do not create ast nodes (relation signatures, filters
+      and interpreted tails with free variables create ast nodes),
+    - result tables partitioned by the join key: sparse tables deduplicate
+      rows through a single hash table, which would otherwise serialize
+      the joins.
+
+    Each query recomputes the fixpoint: query resets the saturation marks
+    because the rules are transformed per query (magic sets, inlining and
+    slicing rename and drop predicates), so relations computed for one query
+    are not the fixpoint of the rules of the next. Keeping derived relations
+    across fact insertions would require saturation marks on the original
+    rules and transformations that preserve the original predicates.
+
 --*/
 
 
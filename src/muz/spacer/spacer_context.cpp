@@ -2100,7 +2100,10 @@ bool pred_transformer::frames::propagate_to_next_level (unsigned level)
     unsigned tgt_level = next_level (level);
     m_pt.ensure_level (tgt_level);
 
-    for (unsigned i = 0, sz = m_lemmas.size(); i < sz && m_lemmas [i]->level() <= level;) {
+    // lemmas are sorted by level, skip the ones below level
+    lemma** first = std::partition_point(m_lemmas.data(), m_lemmas.data() + m_lemmas.size(),
+                                         [&](lemma* l) { return l->level() < level; });
+    for (unsigned i = static_cast<unsigned>(first - m_lemmas.data()), sz = m_lemmas.size(); i < sz && m_lemmas [i]->level() <= level;) {
         if (m_lemmas [i]->level () < level) {++i; continue;}
 
         unsigned solver_level;
@@ -1004,6 +1004,11 @@ class derivation {
     pred_transformer &pt() const { return m_parent.pt(); }
 };
 
+// Proof obligations are blocked one at a time. Blocking pobs concurrently
+// would need per-worker copies of the prop solvers over translated terms:
+// pobs, lemmas and the prop solvers of all predicate transformers share the
+// ast_manager of the context, and blocking a pob adds lemmas to the frames of
+// the transformer and to its solver.
 class pob_queue {
 
     typedef std::priority_queue<pob *, std::vector<pob *>, pob_gt_proc>
@@ -193,6 +193,7 @@ namespace spacer {
         st.update ("time.iuc_solver.get_iuc.learn_core", m_learn_core_sw.get_seconds());
         
         st.update("iuc_solver.num_proxies", m_proxies.size());
+        st.update("iuc_solver.farkas_cache_hits", m_farkas_cache.num_hits());
     }
     
     void iuc_solver::reset_statistics () {
@@ -384,7 +385,8 @@ namespace spacer {
                 plugin =
                     alloc(unsat_core_plugin_farkas_lemma,
                           learner, m_split_literals,
-                          (m_iuc_arith == 1) /* use constants from A */);
+                          (m_iuc_arith == 1) /* use constants from A */,
+                          &m_farkas_cache);
                 learner.register_plugin(plugin);
                 break;
             case 2:
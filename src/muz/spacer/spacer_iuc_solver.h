@@ -21,6 +21,7 @@ Notes:
 #include"solver/solver.h"
 #include"ast/expr_substitution.h"
 #include"util/stopwatch.h"
+#include"muz/spacer/spacer_unsat_core_plugin.h"
 namespace spacer {
 class iuc_solver : public solver {
 private:
@@ -62,6 +63,7 @@ private:
     unsigned m_iuc_arith;
     bool m_print_farkas_stats;
     bool m_old_hyp_reducer;
+    farkas_core_cache m_farkas_cache;
     bool is_proxy(expr *e, app_ref &def);
     void undo_proxies_in_core(expr_ref_vector &v);
     app* mk_proxy(expr *v);
@@ -84,7 +86,8 @@ public:
         m_iuc(iuc),
         m_iuc_arith(iuc_arith),
         m_print_farkas_stats(print_farkas_stats),
-        m_old_hyp_reducer(old_hyp_reducer)
+        m_old_hyp_reducer(old_hyp_reducer),
+        m_farkas_cache(m)
     {}
 
     /* iuc solver specific */
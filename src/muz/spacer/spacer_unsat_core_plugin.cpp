@@ -217,6 +217,11 @@ namespace spacer {
 
     expr_ref unsat_core_plugin_farkas_lemma::compute_linear_combination(const coeff_lits_t& coeff_lits)
     {
+        if (m_cache) {
+            expr* core = m_cache->find(coeff_lits, m_use_constant_from_a, m_split_literals);
+            if (core)
+                return expr_ref(core, m);
+        }
 
         smt::farkas_util util(m);
         if (m_use_constant_from_a) {
@@ -225,12 +230,61 @@ namespace spacer {
         for (auto& p : coeff_lits) {
             util.add(p.first, p.second);
         }
+        expr_ref res(m);
         if (m_use_constant_from_a) {
-            return util.get();
+            res = util.get();
         }
         else {
-            return expr_ref(mk_not(m, util.get()), m);
+            res = mk_not(m, util.get());
+        }
+        if (m_cache) {
+            m_cache->insert(coeff_lits, m_use_constant_from_a, m_split_literals, res);
+        }
+        return res;
+    }
+
+    unsigned farkas_core_cache::hash(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals) {
+        unsigned h = lits.size() + 2 * use_constant_from_a + split_literals;
+        for (auto const& [coeff, lit] : lits)
+            h = mk_mix(h, coeff.hash(), lit->get_id());
+        return h;
+    }
+
+    expr* farkas_core_cache::find(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals) {
+        auto* h2e = m_hash2entries.find_core(hash(lits, use_constant_from_a, split_literals));
+        if (!h2e)
+            return nullptr;
+        for (unsigned idx : h2e->get_data().m_value) {
+            entry const& e = m_entries[idx];
+            if (e.m_use_constant_from_a != use_constant_from_a || e.m_split_literals != split_literals)
+                continue;
+            if (e.m_lits.size() != lits.size())
+                continue;
+            bool eq = true;
+            for (unsigned i = 0; eq && i < lits.size(); ++i)
+                eq = e.m_lits[i].second == lits[i].second && e.m_lits[i].first == lits[i].first;
+            if (eq) {
+                ++m_num_hits;
+                return e.m_core;
+            }
         }
+        return nullptr;
+    }
+
+    void farkas_core_cache::insert(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals, expr* core) {
+        if (m_entries.size() >= m_max_size)
+            reset();
+        for (auto const& p : lits)
+            m_pinned.push_back(p.second);
+        m_pinned.push_back(core);
+        m_hash2entries.insert_if_not_there(hash(lits, use_constant_from_a, split_literals), unsigned_vector()).push_back(m_entries.size());
+        m_entries.push_back({ lits, use_constant_from_a, split_literals, core });
+    }
+
+    void farkas_core_cache::reset() {
+        m_entries.reset();
+        m_hash2entries.reset();
+        m_pinned.reset();
     }
 
     void unsat_core_plugin_farkas_lemma_optimized::compute_partial_core(proof* step)
@@ -19,11 +19,41 @@ Revision History:
 
 #include "ast/ast.h"
 #include "util/min_cut.h"
+#include "util/map.h"
 
 namespace spacer {
 
     class unsat_core_learner;
 
+    /*
+     * Cache of Farkas cores, keyed by the coefficients and literals of the Farkas lemma.
+     * Proofs of consecutive queries share many Farkas lemmas, so the cache outlives
+     * the core learner. It is cleared when it exceeds its maximal size.
+     */
+    class farkas_core_cache {
+        typedef vector<std::pair<rational, app*>> coeff_lits_t;
+        struct entry {
+            coeff_lits_t m_lits;
+            bool         m_use_constant_from_a;
+            bool         m_split_literals;
+            expr*        m_core;
+        };
+        ast_manager&     m;
+        expr_ref_vector  m_pinned;
+        vector<entry>    m_entries;
+        u_map<unsigned_vector> m_hash2entries;
+        unsigned         m_max_size;
+        unsigned         m_num_hits = 0;
+
+        static unsigned hash(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals);
+    public:
+        farkas_core_cache(ast_manager& m, unsigned max_size = 10000): m(m), m_pinned(m), m_max_size(max_size) {}
+        expr* find(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals);
+        void insert(coeff_lits_t const& lits, bool use_constant_from_a, bool split_literals, expr* core);
+        void reset();
+        unsigned num_hits() const { return m_num_hits; }
+    };
+
 
     class unsat_core_plugin {
     protected:
@@ -50,14 +80,17 @@ namespace spacer {
     public:
         unsat_core_plugin_farkas_lemma(unsat_core_learner& learner,
                                        bool split_literals,
-                                       bool use_constant_from_a=true) :
+                                       bool use_constant_from_a=true,
+                                       farkas_core_cache* cache=nullptr) :
             unsat_core_plugin(learner),
             m_split_literals(split_literals),
-            m_use_constant_from_a(use_constant_from_a) {};
+            m_use_constant_from_a(use_constant_from_a),
+            m_cache(cache) {};
         void compute_partial_core(proof* step) override;
     private:
         bool m_split_literals;
         bool m_use_constant_from_a;
+        farkas_core_cache* m_cache;
         /*
          * compute linear combination of literals 'literals' having coefficients 'coefficients' and save result in res
          */
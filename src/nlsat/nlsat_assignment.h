@@ -30,14 +30,19 @@ namespace nlsat {
     class assignment : public polynomial::var2anum {
         scoped_anum_vector m_values;
         bool_vector      m_assigned;
+        unsigned         m_timestamp = 0;  // incremented whenever the assignment changes
     public:
         assignment(anum_manager & _m):m_values(_m) {}
         anum_manager & am() const { return m_values.m(); }
+        unsigned timestamp() const { return m_timestamp; }
         void swap(assignment & other) noexcept {
             m_values.swap(other.m_values);
             m_assigned.swap(other.m_assigned);
+            ++m_timestamp;
+            ++other.m_timestamp;
         }
         void copy(assignment const& other) {
+            ++m_timestamp;
             m_assigned.reset();
             m_assigned.append(other.m_assigned);
             m_values.reserve(m_assigned.size(), anum());
@@ -49,19 +54,21 @@ namespace nlsat {
         }
 
         void set_core(var x, anum & v) {
+            ++m_timestamp;
             m_values.reserve(x+1, anum());
             m_assigned.reserve(x+1, false); 
             m_assigned[x] = true;
             am().swap(m_values[x], v); 
         }
         void set(var x, anum const & v) {
+            ++m_timestamp;
             m_values.reserve(x+1, anum());
             m_assigned.reserve(x+1, false); 
             m_assigned[x] = true;
             am().set(m_values[x], v); 
         }
-        void reset(var x) { if (x < m_assigned.size()) m_assigned[x] = false; }
-        void reset() { m_assigned.reset(); }
+        void reset(var x) { ++m_timestamp; if (x < m_assigned.size()) m_assigned[x] = false; }
+        void reset() { ++m_timestamp; m_assigned.reset(); }
         bool is_assigned(var x) const { return m_assigned.get(x, false); }
         anum const & value(var x) const { return m_values[x]; }
         anum_manager & m() const override { return am(); }
@@ -69,6 +76,7 @@ namespace nlsat {
         anum const & operator()(var x) const override { SASSERT(is_assigned(x)); return value(x); }
         void swap(var x, var y) noexcept {
             SASSERT(x < m_values.size() && y < m_values.size());
+            ++m_timestamp;
             std::swap(m_assigned[x], m_assigned[y]);
             std::swap(m_values[x], m_values[y]);
         }
@@ -19,6 +19,7 @@ Revision History:
 --*/
 #include "nlsat/nlsat_evaluator.h"
 #include "nlsat/nlsat_solver.h"
+#include "util/map.h"
 
 namespace nlsat {
 
@@ -32,6 +33,18 @@ namespace nlsat {
         scoped_anum_vector       m_tmp_values;
         scoped_anum_vector       m_add_roots_tmp;
         scoped_anum_vector       m_inf_tmp;
+
+        // roots and signs of polynomials isolated under the current assignment.
+        // The cache is flushed when the assignment or the variable changes.
+        unsigned                 m_roots_timestamp = UINT_MAX;
+        var                      m_roots_var = null_var;
+        struct roots_range {
+            unsigned m_roots_begin, m_roots_end, m_signs_begin, m_signs_end;
+        };
+        u_map<roots_range>       m_roots_cache;     // polynomial id -> ranges in m_cached_roots and m_cached_signs
+        polynomial_ref_vector    m_cached_polys;
+        scoped_anum_vector       m_cached_roots;
+        svector<sign>            m_cached_signs;
         
         // sign tables: light version
         struct sign_table {
@@ -371,6 +384,8 @@ namespace nlsat {
             m_tmp_values(m_am),
             m_add_roots_tmp(m_am),
             m_inf_tmp(m_am),
+            m_cached_polys(pm),
+            m_cached_roots(m_am),
             m_sign_table_tmp(m_am) {
         }
 
@@ -463,10 +478,36 @@ namespace nlsat {
                 svector<sign> & signs = m_add_signs_tmp;
                 roots.reset();
                 signs.reset();
+                if (m_roots_timestamp != m_assignment.timestamp() || m_roots_var != x) {
+                    m_roots_timestamp = m_assignment.timestamp();
+                    m_roots_var = x;
+                    m_roots_cache.reset();
+                    m_cached_polys.reset();
+                    m_cached_roots.reset();
+                    m_cached_signs.reset();
+                }
+                roots_range r;
+                if (m_roots_cache.find(m_pm.id(p), r)) {
+                    for (unsigned i = r.m_roots_begin; i < r.m_roots_end; ++i)
+                        roots.push_back(m_cached_roots[i]);
+                    for (unsigned i = r.m_signs_begin; i < r.m_signs_end; ++i)
+                        signs.push_back(m_cached_signs[i]);
+                    t.add(roots, signs);
+                    return;
+                }
                 TRACE("nlsat_evaluator", tout << "x: " << x << " max_var(p): " << m_pm.max_var(p) << "\n";);
                 // Note: I added undef_var_assignment in the following statement, to allow us to obtain the infeasible interval sets
                 // even when the maximal variable is assigned. I need this feature to minimize conflict cores.
                 m_am.isolate_roots(polynomial_ref(p, m_pm), undef_var_assignment(m_assignment, x), roots, signs);
+                r.m_roots_begin = m_cached_roots.size();
+                r.m_roots_end = r.m_roots_begin + roots.size();
+                r.m_signs_begin = m_cached_signs.size();
+                r.m_signs_end = r.m_signs_begin + signs.size();
+                m_roots_cache.insert(m_pm.id(p), r);
+                m_cached_polys.push_back(p);
+                for (anum const& root : roots)
+                    m_cached_roots.push_back(root);
+                m_cached_signs.append(signs);
                 t.add(roots, signs);
             }
         }
@@ -91,6 +91,7 @@ private:
     struct stats {
         unsigned m_num_cores;
         unsigned m_num_cs;
+        unsigned m_num_exhausted;
         stats() { reset(); }
         void reset() {
             memset(this, 0, sizeof(*this));
@@ -135,6 +136,7 @@ private:
     unsigned         m_lns_conflicts = 1000;           // number of conflicts used for LNS improvement
     bool             m_enable_core_rotate = false;     // enable core rotation
     bool             m_use_totalizer = true;           // use totalizer instead of cardinality encoding
+    bool             m_exhaust = false;                // raise bounds of new rc2 cores while they are unsatisfiable
     std::string      m_trace_id;
     typedef ptr_vector<expr> exprs;
 
@@ -384,6 +386,7 @@ public:
     void collect_statistics(statistics& st) const override {
         st.update("maxsat-cores", m_stats.m_num_cores);
         st.update("maxsat-correction-sets", m_stats.m_num_cs);
+        st.update("maxsat-exhausted-cores", m_stats.m_num_exhausted);
     }
 
     lbool get_cores(vector<weighted_core>& cores) {
@@ -862,10 +865,36 @@ public:
         if (core.size() > 1) {
             m_unfold_upper += rational(core.size() - 2) * weight;
             expr* am = mk_atmost(ncore, 1, weight);
+            if (m_exhaust)
+                am = exhaust(ncore, 1, am, weight);
             new_assumption(am, weight);
         }
     }
 
+    /**
+     * \brief core exhaustion.
+     * am bounds the number of false soft constraints in a core by k.
+     * While am alone is unsatisfiable, at least k + 1 of them are false, so the
+     * lower bound increases by the weight of the core and the bound is raised.
+     */
+    expr* exhaust(expr_ref_vector const& ncore, unsigned k, expr* am, rational const& weight) {
+        expr_ref_vector core(m);
+        while (k + 1 < ncore.size() && m.inc()) {
+            if (check_sat(1, &am) != l_false)
+                break;
+            core.reset();
+            s().get_unsat_core(core);
+            if (!core.contains(am))
+                break;
+            ++m_stats.m_num_exhausted;
+            m_lower += weight;
+            m_unfold_upper -= weight;
+            ++k;
+            am = mk_atmost(ncore, k, weight);
+        }
+        return am;
+    }
+
     /** 
      * \brief hybrid of rc2 and binary resolution.
      * Create us := u1, .., u_n, where core has size n + 1
@@ -1062,6 +1091,7 @@ public:
         m_enable_core_rotate =      p.enable_core_rotate();
         m_lns_conflicts =           p.lns_conflicts();
         m_use_totalizer =           p.rc2_totalizer();
+        m_exhaust =                 p.rc2_exhaust();
 	if (m_c.num_objectives() > 1)
 	  m_add_upper_bound_block = false;
     }
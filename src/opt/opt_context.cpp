@@ -631,7 +631,9 @@ namespace opt {
 
     void context::yield() {
         SASSERT (m_pareto);
-        m_pareto->get_model(m_model, m_labels);
+        model_ref mdl;
+        m_pareto->get_model(mdl, m_labels);
+        set_model(mdl);
         update_bound(true);
         update_bound(false);
         TRACE("opt", model_smt2_pp(tout, m, *m_model.get(), 0););
@@ -61,6 +61,8 @@ namespace opt {
         update_best_model(mdl);
         for (unsigned i = 0; i < 2; ++i)
             improve_bs();
+        for (unsigned i = 0; i < 2; ++i)
+            improve_random();
         IF_VERBOSE(1, verbose_stream() << "(opt.lns :relax-cores " << m_cores.size() << ")\n");
         relax_cores();
         s.updt_params(old_p);
@@ -68,17 +70,18 @@ namespace opt {
         return m_num_improves;
     }
 
-    void lns::update_best_model(model_ref& mdl) {
+    bool lns::update_best_model(model_ref& mdl) {
         rational cost = ctx.cost(*mdl);
-        if (m_best_cost.is_zero() || m_best_cost >= cost) {
-            m_best_cost = cost;
-            m_best_model = mdl;
-            m_best_phase = s.get_phase();
-            m_best_bound = 0;
-            for (expr* e : ctx.soft()) 
-                if (!mdl->is_true(e))
-                    m_best_bound += 1;
-        }
+        if (!m_best_cost.is_zero() && m_best_cost < cost)
+            return false;
+        m_best_cost = cost;
+        m_best_model = mdl;
+        m_best_phase = s.get_phase();
+        m_best_bound = 0;
+        for (expr* e : ctx.soft()) 
+            if (!mdl->is_true(e))
+                m_best_bound += 1;
+        return true;
     }
 
     void lns::apply_best_model() {
@@ -147,6 +150,40 @@ namespace opt {
         m_unprocessed.shrink(j);
     }
 
+    /**
+     * Relax a random tenth of the satisfied soft constraints and
+     * try to satisfy the falsified soft constraints one at a time.
+     * A model is kept only if it does not increase the cost.
+     */
+    void lns::improve_random() {
+        model_ref mdl = m_best_model->copy();
+        m_hardened.reset();
+        m_unprocessed.reset();
+        for (expr* e : ctx.soft()) {
+            m_is_assumption.mark(e);
+            if (!mdl->is_true(e))
+                m_unprocessed.push_back(e);
+            else if (m_rand(10) != 0)
+                m_hardened.push_back(e);
+        }
+        shuffle(m_unprocessed.size(), m_unprocessed.data(), m_rand);
+        for (expr* e : m_unprocessed) {
+            if (!m.inc())
+                return;
+            if (mdl->is_true(e))
+                continue;
+            apply_best_model();
+            if (improve_step(mdl, e) != l_true)
+                continue;
+            if (update_best_model(mdl)) {
+                m_hardened.push_back(e);
+                ctx.update_model(mdl);
+            }
+            else
+                mdl = m_best_model->copy();
+        }
+    }
+
     struct lns::scoped_bounding {
         lns& m_lns;
         bool m_cores_are_valid { true };
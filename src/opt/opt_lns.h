@@ -16,6 +16,10 @@ Abstract:
     The soft constraints are assumed sorted by weight, such that the highest 
     weight soft constraint is first, followed by soft constraints of lower weight.
 
+    A second neighborhood keeps only a random subset of the satisfied soft
+    constraints hard, so that satisfying a falsified soft constraint may
+    trade it for satisfied soft constraints of lower weight.
+
 Author:
 
     Nikolaj Bjorner (nbjorner) 2021-02-01
@@ -59,9 +63,10 @@ namespace opt {
 
         struct scoped_bounding;
 
-        void update_best_model(model_ref& mdl);
+        bool update_best_model(model_ref& mdl);
         void improve_bs();
         void improve_bs1();
+        void improve_random();
         void apply_best_model();
 
         expr* unprocessed(unsigned i) const { return m_unprocessed[i]; }
@@ -58,6 +58,9 @@ namespace opt {
             else if (src[i] < dst[i] && !m.is_true(m_lower_fmls.get(i))) {
                 fmls[i] = m_lower_fmls.get(i);                
             }
+            // the objective has reached its known upper bound and cannot improve.
+            if (dst[i] >= m_upper[i]) 
+                fmls[i] = m.mk_false();
         }
     }
 
@@ -168,6 +171,8 @@ namespace opt {
                 steps = 0;
                 step_incs = 0;
                 ++delta_index;
+                while (delta_index + 1 < m_lower.size() && m_lower[delta_index] >= m_upper[delta_index])
+                    ++delta_index;
             }
             else {
                 if (num_scopes > 0) m_s->pop(num_scopes);        
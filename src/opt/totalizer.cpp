@@ -25,7 +25,10 @@ namespace opt {
     
     void totalizer::ensure_bound(node* n, unsigned k) {
         auto& lits = n->m_literals;
-        if (k > lits.size())
+        k = std::min(k, lits.size());
+        // outputs are defined for a prefix of the bounds, and the children of a
+        // node are extended before the node.
+        if (k == 0 || lits.get(k - 1))
             return;
         auto* l = n->m_left;
         auto* r = n->m_right;
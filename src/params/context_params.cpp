@@ -69,6 +69,9 @@ void context_params::set(char const * param, char const * value) {
     else if (p == "rlimit") {
         set_uint(m_rlimit, param, value);
     }
+    else if (p == "delete_budget") {
+        set_uint(m_delete_budget, param, value);
+    }
     else if (p == "type_check" || p == "well_sorted_check") {
         set_bool(m_well_sorted_check, param, value);
     }
@@ -149,6 +152,7 @@ void context_params::updt_params(params_ref const & p) {
     m_dot_proof_file    = p.get_str("dot_proof_file", "proof.dot");
     m_unsat_core        |= p.get_bool("unsat_core", m_unsat_core);
     m_debug_ref_count   = p.get_bool("debug_ref_count", m_debug_ref_count);
+    m_delete_budget     = p.get_uint("delete_budget", m_delete_budget);
     m_smtlib2_compliant = p.get_bool("smtlib2_compliant", m_smtlib2_compliant);
     m_statistics        = p.get_bool("stats", m_statistics);
     m_encoding          = p.get_str("encoding", m_encoding.c_str());
@@ -166,6 +170,7 @@ void context_params::collect_param_descrs(param_descrs & d) {
     d.insert("trace_file_name", CPK_STRING, "trace out file name (see option 'trace')", "z3.log");
     d.insert("dot_proof_file", CPK_STRING, "file in which to output graphical proofs", "proof.dot");
     d.insert("debug_ref_count", CPK_BOOL, "debug support for AST reference counting", "false");
+    d.insert("delete_budget", CPK_UINT, "maximal number of AST nodes freed when a term is released; the rest is freed incrementally and before check-sat (0: no bound)", "0");
     d.insert("smtlib2_compliant", CPK_BOOL, "enable/disable SMT-LIB 2.0 compliance", "false");
     d.insert("stats", CPK_BOOL, "enable/disable statistics", "false");
     d.insert("encoding", CPK_STRING, "string encoding used internally: unicode|bmp|ascii", "unicode");
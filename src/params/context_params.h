@@ -30,6 +30,7 @@ class context_params {
 
 public:
     unsigned         m_timeout { UINT_MAX } ;
+    unsigned         m_delete_budget { 0 };
     std::string      m_dot_proof_file;
     std::string      m_trace_file_name;
     bool             m_auto_config { true };
@@ -39,6 +39,7 @@ struct pattern_inference_params {
     int                           m_pi_nopat_weight = -1;
     bool                          m_pi_avoid_skolems = true;
     bool                          m_pi_warnings;
+    bool                          m_pi_cache;
     
     pattern_inference_params(params_ref const & p = params_ref()) {
         updt_params(p);
@@ -62,6 +62,13 @@ namespace smt2 {
                 next();
                 return;
             }
+            if (in_buffer()) {
+                // skip to the end of the line within the buffer
+                char const* nl = static_cast<char const*>(memchr(m_buffer + m_bpos, '\n', m_bend - m_bpos));
+                unsigned end = nl ? static_cast<unsigned>(nl - m_buffer) : m_bend;
+                m_spos += end - m_bpos;
+                m_bpos = end;
+            }
             next();
         }
     }
@@ -123,6 +130,18 @@ namespace smt2 {
             signed char n = m_normalized[static_cast<unsigned char>(c)];
             if (n == 'a' || n == '0' || n == '-') {
                 m_string.push_back(c);
+                if (in_buffer()) {
+                    // copy the rest of the symbol that is in the buffer at once
+                    unsigned end = m_bpos;
+                    for (; end < m_bend; ++end) {
+                        n = m_normalized[static_cast<unsigned char>(m_buffer[end])];
+                        if (n != 'a' && n != '0' && n != '-')
+                            break;
+                    }
+                    m_string.append(end - m_bpos, m_buffer + m_bpos);
+                    m_spos += end - m_bpos;
+                    m_bpos = end;
+                }
                 next();
             }
             else {
@@ -44,7 +44,7 @@ namespace smt2 {
         unsigned           m_bv_size;
         // end of data
         signed char        m_normalized[256];
-#define SCANNER_BUFFER_SIZE 1024
+#define SCANNER_BUFFER_SIZE (1 << 16)
         char               m_buffer[SCANNER_BUFFER_SIZE];
         unsigned           m_bpos;
         unsigned           m_bend;
@@ -57,6 +57,7 @@ namespace smt2 {
         
         
         char curr() const { return m_curr; }
+        bool in_buffer() const { return !m_interactive && !m_cache_input; }
         void new_line() { m_line++; m_spos = 0; }
         void next();
         
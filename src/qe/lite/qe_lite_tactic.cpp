@@ -2370,14 +2370,27 @@ public:
             return;
         }
         TRACE("qe_lite", tout << fmls << "\n";);
-        is_variable_test is_var(index_set, index_of_bound);
-        m_der.set_is_variable_proc(is_var);
-        m_fm.set_is_variable_proc(is_var);
-        m_array_der.set_is_variable_proc(is_var);
-        m_der(fmls);
-        m_fm(fmls);
-        // AG: disable m_array_der() since it interferes with other array handling
-        if (m_use_array_der) m_array_der(fmls);
+        // ground conjuncts do not take part in the elimination.
+        expr_ref_vector ground(m);
+        unsigned j = 0;
+        for (expr* f : fmls) {
+            if (is_ground(f))
+                ground.push_back(f);
+            else
+                fmls[j++] = f;
+        }
+        fmls.shrink(j);
+        if (!fmls.empty()) {
+            is_variable_test is_var(index_set, index_of_bound);
+            m_der.set_is_variable_proc(is_var);
+            m_fm.set_is_variable_proc(is_var);
+            m_array_der.set_is_variable_proc(is_var);
+            m_der(fmls);
+            m_fm(fmls);
+            // AG: disable m_array_der() since it interferes with other array handling
+            if (m_use_array_der) m_array_der(fmls);
+        }
+        fmls.append(ground);
         TRACE("qe_lite", for (unsigned i = 0; i < fmls.size(); ++i) tout << mk_pp(fmls[i].get(), m) << "\n";);
     }
 
@@ -667,7 +667,8 @@ void term_graph::merge(term &t1, term &t2) {
     m_pinned.reset();
     m_repick_repr = true;
 
-    if (a->get_class_size() > b->get_class_size())
+    // the larger class stays the root, so only the smaller class is traversed.
+    if (a->get_class_size() < b->get_class_size())
         std::swap(a, b); 
 
     // Remove parents of b from the cg table
@@ -181,8 +181,11 @@ class mbproj::impl {
                 expr_safe_replace sub(m);
                 sub.insert(v, t);
                 is_rem.mark(v);
+                // literals without v are unchanged and need not be rewritten again.
                 for (unsigned j = 0; j < lits.size(); ++j) {
                     sub(lits.get(j), tmp);
+                    if (tmp == lits.get(j))
+                        continue;
                     m_rw(tmp);
                     lits[j] = tmp;
                 }
@@ -240,7 +243,8 @@ class mbproj::impl {
         j = 0;
         for (expr* fml : fmls) {
             sub(fml, val);
-            m_rw(val);
+            if (val != fml)
+                m_rw(val);
             if (!m.is_true(val)) {
                 TRACE("qe", tout << mk_pp(fml, m) << " -> " << val << "\n";);
                 fmls[j++] = val;
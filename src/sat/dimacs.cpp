@@ -20,6 +20,11 @@ Revision History:
 #undef max
 #undef min
 #include "sat/sat_solver.h"
+#include "util/trace.h"
+#include <algorithm>
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 template<typename Buffer>
 static bool is_whitespace(Buffer & in) {
@@ -116,7 +121,7 @@ static void read_clause(Buffer & in, std::ostream& err, sat::literal_vector & li
 
 template<typename Buffer>
 static bool parse_dimacs_core(Buffer & in, std::ostream& err, sat::solver & solver) {
-    sat::literal_vector lits;
+    sat::literal_vector lits, batch;
     try {
         while (true) {
             skip_whitespace(in);
@@ -128,13 +133,19 @@ static bool parse_dimacs_core(Buffer & in, std::ostream& err, sat::solver & solv
             }
             else {
                 read_clause(in, err, solver, lits);
-                solver.mk_clause(lits.size(), lits.data());
+                batch.append(lits);
+                batch.push_back(sat::null_literal);
+                if (batch.size() >= (1u << 16)) {
+                    solver.add_clauses(batch);
+                    batch.reset();
+                }
             }
         }
     }
     catch (dimacs::lex_error) {
         return false;
     }
+    solver.add_clauses(batch);
     return true;
 }
 
@@ -144,6 +155,210 @@ bool parse_dimacs(std::istream & in, std::ostream& err, sat::solver & solver) {
     return parse_dimacs_core(_in, err, solver);
 }
 
+namespace {
+
+    /**
+       \brief Tokenizer state for one newline-aligned slice of a DIMACS buffer.
+
+       Literals are stored as integers and clauses are terminated by 0.
+       The tokens before the first 0 (head) and after the last 0 (tail) may
+       belong to clauses that straddle slice boundaries and are kept raw.
+       Complete clauses in between are normalized: duplicate literals are
+       removed and tautologies are dropped.
+    */
+    struct dimacs_chunk {
+        char const*  m_begin = nullptr;
+        char const*  m_end = nullptr;
+        svector<int> m_lits;
+        unsigned     m_head = UINT_MAX;   // index past the first 0, UINT_MAX if the slice has no 0
+        unsigned     m_tail = 0;          // index of the first token of the unterminated tail
+        unsigned     m_max_var = 0;
+        unsigned     m_num_tautologies = 0;
+        unsigned     m_num_duplicates = 0;
+        char const*  m_error = nullptr;
+    };
+
+    static bool is_space(char c) {
+        return (c >= 9 && c <= 13) || c == 32;
+    }
+
+    // sort literals of lits[start..] by variable, remove duplicates and
+    // return false if the clause is a tautology.
+    static bool normalize_clause(svector<int>& lits, unsigned start, unsigned& num_duplicates) {
+        auto lt = [](int a, int b) { return abs(a) < abs(b) || (abs(a) == abs(b) && a < b); };
+        std::sort(lits.begin() + start, lits.end(), lt);
+        unsigned j = start;
+        for (unsigned i = start; i < lits.size(); ++i) {
+            if (j > start && lits[j - 1] == lits[i]) {
+                ++num_duplicates;
+                continue;
+            }
+            if (j > start && lits[j - 1] == -lits[i])
+                return false;
+            lits[j++] = lits[i];
+        }
+        lits.shrink(j);
+        return true;
+    }
+
+    static void tokenize_chunk(dimacs_chunk& ch) {
+        char const* p = ch.m_begin;
+        char const* end = ch.m_end;
+        svector<int>& lits = ch.m_lits;
+        unsigned clause_start = 0;
+        bool at_line_start = true;
+        while (p < end) {
+            char c = *p;
+            if (c == '\n') {
+                at_line_start = true;
+                ++p;
+                continue;
+            }
+            if (is_space(c)) {
+                ++p;
+                continue;
+            }
+            if (at_line_start && (c == 'c' || c == 'p')) {
+                while (p < end && *p != '\n')
+                    ++p;
+                continue;
+            }
+            at_line_start = false;
+            bool neg = false;
+            if (c == '-' || c == '+') {
+                neg = c == '-';
+                ++p;
+            }
+            if (p == end || *p < '0' || *p > '9') {
+                ch.m_error = p;
+                return;
+            }
+            unsigned val = 0;
+            while (p < end && *p >= '0' && *p <= '9')
+                val = val * 10 + (*p++ - '0');
+            if (val != 0) {
+                ch.m_max_var = std::max(ch.m_max_var, val);
+                lits.push_back(neg ? -static_cast<int>(val) : static_cast<int>(val));
+                continue;
+            }
+            if (ch.m_head == UINT_MAX) {
+                lits.push_back(0);
+                ch.m_head = lits.size();
+            }
+            else if (normalize_clause(lits, clause_start, ch.m_num_duplicates))
+                lits.push_back(0);
+            else {
+                ++ch.m_num_tautologies;
+                lits.shrink(clause_start);
+            }
+            clause_start = lits.size();
+        }
+        ch.m_tail = clause_start;
+    }
+}
+
+bool parse_dimacs(std::istream & in, std::ostream& err, sat::solver & solver, unsigned num_threads) {
+    svector<char> buffer;
+    char block[1 << 16];
+    while (in) {
+        in.read(block, sizeof(block));
+        buffer.append(static_cast<unsigned>(in.gcount()), block);
+    }
+    char const* data = buffer.data();
+    char const* data_end = data + buffer.size();
+
+    // use more threads only when there is enough input to amortize their start-up.
+    unsigned const min_chunk_size = 1 << 22;
+#ifdef SINGLE_THREAD
+    num_threads = 1;
+#else
+    if (num_threads == 0)
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+#endif
+    num_threads = std::max(1u, std::min(num_threads, buffer.size() / min_chunk_size));
+
+    // split at line boundaries so that comment lines are recognized by each slice.
+    vector<dimacs_chunk> chunks(num_threads);
+    char const* start = data;
+    for (unsigned i = 0; i < num_threads; ++i) {
+        char const* stop = i + 1 == num_threads ? data_end : std::max(start, data + (buffer.size() / num_threads) * (i + 1));
+        while (stop < data_end && *stop != '\n')
+            ++stop;
+        chunks[i].m_begin = start;
+        chunks[i].m_end = stop;
+        start = stop;
+    }
+
+#ifndef SINGLE_THREAD
+    if (num_threads > 1) {
+        vector<std::thread> threads;
+        for (unsigned i = 1; i < num_threads; ++i)
+            threads.push_back(std::thread([&, i]() { tokenize_chunk(chunks[i]); }));
+        tokenize_chunk(chunks[0]);
+        for (auto& th : threads)
+            th.join();
+    }
+    else
+#endif
+        tokenize_chunk(chunks[0]);
+
+    unsigned max_var = 0, num_tautologies = 0, num_duplicates = 0;
+    for (dimacs_chunk const& ch : chunks) {
+        if (ch.m_error) {
+            unsigned line = static_cast<unsigned>(std::count(data, ch.m_error, '\n'));
+            char c = ch.m_error < data_end ? *ch.m_error : ' ';
+            err << "(error, \"unexpected char: " << c << " line: " << line << "\")\n";
+            return false;
+        }
+        max_var = std::max(max_var, ch.m_max_var);
+        num_tautologies += ch.m_num_tautologies;
+        num_duplicates += ch.m_num_duplicates;
+    }
+    while (max_var >= solver.num_vars())
+        solver.mk_var();
+
+    sat::literal_vector lits;
+    svector<int> carry;
+    auto add_clause = [&](int const* b, int const* e) {
+        lits.reset();
+        for (; b != e; ++b)
+            lits.push_back(sat::literal(abs(*b), *b < 0));
+        solver.mk_clause(lits.size(), lits.data());
+    };
+    // clauses that straddle slices are assembled in carry and normalized here.
+    auto add_carry = [&]() {
+        if (normalize_clause(carry, 0, num_duplicates))
+            add_clause(carry.begin(), carry.end());
+        else
+            ++num_tautologies;
+        carry.reset();
+    };
+    for (dimacs_chunk const& ch : chunks) {
+        int const* ls = ch.m_lits.data();
+        if (ch.m_head == UINT_MAX) {
+            carry.append(ch.m_lits.size(), ls);
+            continue;
+        }
+        carry.append(ch.m_head - 1, ls);
+        add_carry();
+        // complete clauses of the slice are normalized and imported in one batch.
+        lits.reset();
+        for (unsigned i = ch.m_head; i < ch.m_tail; ++i)
+            lits.push_back(ls[i] == 0 ? sat::null_literal : sat::literal(abs(ls[i]), ls[i] < 0));
+        solver.add_clauses(lits);
+        carry.append(ch.m_lits.size() - ch.m_tail, ls + ch.m_tail);
+    }
+    if (!carry.empty()) {
+        err << "(error, \"unterminated clause at end of input\")\n";
+        return false;
+    }
+    IF_VERBOSE(2, verbose_stream() << "(sat.dimacs :threads " << num_threads
+               << " :vars " << solver.num_vars()
+               << " :tautologies " << num_tautologies
+               << " :duplicates " << num_duplicates << ")\n";);
+    return true;
+}
+
 
 namespace dimacs {
 
@@ -226,8 +441,58 @@ namespace dimacs {
         }
     }
 
+    /**
+       \brief binary DRAT proofs consist of records starting with 'a' or 'd'
+       followed by variable-byte encoded literals. Textual proofs separate 
+       the leading 'a' or 'd' from the rest of the record by white space.
+     */
+    void drat_parser::detect_binary() {
+        m_first = false;
+        if (*in != 'a' && *in != 'd')
+            return;
+        int ch = in.peek();
+        m_binary = ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r';
+    }
+
+    bool drat_parser::next_binary() {
+        int ch = *in;
+        if (ch == EOF)
+            return false;
+        if (ch == 'a')
+            m_record.m_status = sat::status::redundant();
+        else if (ch == 'd')
+            m_record.m_status = sat::status::deleted();
+        else {
+            err << "(error, \"unexpected binary DRAT record: " << ch << "\")\n";
+            return false;
+        }
+        ++in;
+        m_record.m_lits.reset();
+        while (true) {
+            unsigned v = 0, shift = 0;
+            do {
+                ch = *in;
+                if (ch == EOF) {
+                    err << "(error, \"unexpected end of binary DRAT record\")\n";
+                    return false;
+                }
+                ++in;
+                v |= static_cast<unsigned>(ch & 127) << shift;
+                shift += 7;
+            }
+            while ((ch & 128) != 0 && shift < 32);
+            if (v == 0)
+                return true;
+            m_record.m_lits.push_back(sat::literal(v >> 1, (v & 1) != 0));
+        }
+    }
+
     bool drat_parser::next() {
         int theory_id;
+        if (m_first)
+            detect_binary();
+        if (m_binary)
+            return next_binary();
         try {
         loop:
             skip_whitespace(in);
@@ -25,6 +25,14 @@ Revision History:
 
 bool parse_dimacs(std::istream & s, std::ostream& err, sat::solver & solver);
 
+/**
+   \brief Parse a DIMACS input in bulk: the input is read into memory, split into
+   newline-aligned slices that are tokenized by up to num_threads threads (0 selects
+   the hardware concurrency), duplicate literals are removed and tautologies are
+   dropped before clauses are added to the solver.
+*/
+bool parse_dimacs(std::istream & s, std::ostream& err, sat::solver & solver, unsigned num_threads);
+
 namespace dimacs {
     struct lex_error {};
 
@@ -50,6 +58,9 @@ namespace dimacs {
         }
         
         unsigned line() const { return m_line; }
+
+        // character following the current character
+        int peek() const { return m_stream.peek(); }
     };
 
     struct drat_record {
@@ -75,12 +86,16 @@ namespace dimacs {
         drat_record        m_record;
         std::function<int(char const*)> m_read_theory_id;
         svector<char>      m_buffer;
+        bool               m_first = true;
+        bool               m_binary = false;
 
         char const* parse_sexpr();
         char const* parse_identifier();
         char const* parse_quoted_symbol();
         int read_theory_id();
         bool next();
+        bool next_binary();
+        void detect_binary();
 
     public:
         drat_parser(std::istream & _in, std::ostream& err):
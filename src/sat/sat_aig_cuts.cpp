@@ -15,16 +15,24 @@
 
   --*/
 
+#include <atomic>
 #include "util/trace.h"
+#include "util/scoped_ptr_vector.h"
 #include "sat/sat_aig_cuts.h"
 #include "sat/sat_solver.h"
 #include "sat/sat_lut_finder.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 namespace sat {
+
+    aig_cuts::augment_ctx::augment_ctx(unsigned max_sz, unsigned seed): m_rand(seed) {
+        m_cut_set1.init(m_region, max_sz, UINT_MAX);
+        m_cut_set2.init(m_region, max_sz, UINT_MAX);
+    }
         
-    aig_cuts::aig_cuts() {
-        m_cut_set1.init(m_region, m_config.m_max_cutset_size + 1, UINT_MAX);
-        m_cut_set2.init(m_region, m_config.m_max_cutset_size + 1, UINT_MAX);
+    aig_cuts::aig_cuts(): m_ctx(m_config.m_max_cutset_size + 1, 0) {
         m_empty_cuts.init(m_region, m_config.m_max_cutset_size + 1, UINT_MAX);
         m_num_cut_calls = 0;
         m_num_cuts = 0;
@@ -41,34 +49,154 @@ namespace sat {
     }
 
     void aig_cuts::augment(unsigned_vector const& ids) {
+        if (m_config.m_num_threads > 1 && !m_on_cut_add && !m_on_cut_del) {
+            augment_par(ids);
+            return;
+        }
+        for (unsigned id : ids) 
+            augment(id, m_ctx);
+        m_num_cuts += m_ctx.m_num_cuts;
+        m_ctx.m_num_cuts = 0;
+    }
+
+    /**
+       \brief group ids by their depth in the AIG. 
+       Nodes that depend on a node on the current DFS stack are cyclic.
+     */
+    void aig_cuts::levelize(unsigned_vector const& ids, vector<unsigned_vector>& levels, unsigned_vector& cyclic) {
+        enum { unvisited, expanded, done };
+        unsigned_vector state(m_aig.size(), (unsigned)unvisited), level(m_aig.size(), 0u);
+        bool_vector is_cyclic(m_aig.size(), false);
+        unsigned_vector todo;
+        auto for_each_child = [&](unsigned v, std::function<void(unsigned)> const& f) {
+            for (node const& n : m_aig[v]) 
+                if (!n.is_var()) 
+                    for (unsigned i = 0; i < n.size(); ++i) 
+                        f(child(n, i).var());
+        };
         for (unsigned id : ids) {
-            if (m_aig[id].empty()) {
-                continue;
-            }
-            IF_VERBOSE(20, m_cuts[id].display(verbose_stream() << "augment " << id << "\nbefore\n"));
-            for (node const& n : m_aig[id]) {
-                augment(id, n);
+            todo.push_back(id);
+            while (!todo.empty()) {
+                unsigned v = todo.back();
+                if (state[v] == done) {
+                    todo.pop_back();
+                }
+                else if (state[v] == unvisited) {
+                    state[v] = expanded;
+                    for_each_child(v, [&](unsigned w) { 
+                        if (w >= m_aig.size() || m_aig[w].empty())
+                            return;
+                        if (state[w] == unvisited)
+                            todo.push_back(w);  
+                    });
+                }
+                else {
+                    todo.pop_back();
+                    unsigned lvl = 0;
+                    for_each_child(v, [&](unsigned w) {
+                        if (w >= m_aig.size() || m_aig[w].empty())
+                            return;
+                        if (state[w] == done)
+                            lvl = std::max(lvl, level[w] + 1);
+                        else 
+                            is_cyclic[v] = true;
+                    });
+                    state[v] = done;
+                    level[v] = lvl;
+                    if (is_cyclic[v]) {
+                        cyclic.push_back(v);
+                        continue;
+                    }
+                    levels.reserve(lvl + 1);
+                    levels[lvl].push_back(v);
+                }
             }
+        }
+    }
 
-#if 0
-            // augment cuts directly       
-            m_cut_save.reset();
-            cut_set& cs = m_cuts[id];
-            for (cut const& c : cs) {
-                if (c.size() > 1) m_cut_save.push_back(c);
-            }
-            for (cut const& c : m_cut_save) {
-                lut lut(*this, c);
-                augment_lut(id, lut, cs);
+    /**
+       \brief augment cut sets level by level. 
+       The nodes of a level only read cut sets of lower levels, 
+       so they can be augmented concurrently.       
+     */
+    void aig_cuts::augment_par(unsigned_vector const& ids) {
+        vector<unsigned_vector> levels;
+        unsigned_vector cyclic;
+        levelize(ids, levels, cyclic);
+
+        // pre-allocate cut sets such that insertions do not allocate from the shared region.
+        m_last_touched.reserve(m_aig.size(), 0);
+        for (unsigned id : ids) 
+            m_cuts[id].reserve(max_cutset_size(id) + 2);
+
+        unsigned num_threads = m_config.m_num_threads;
+        scoped_ptr_vector<augment_ctx> ctxs;
+        for (unsigned i = 0; i < num_threads; ++i) 
+            ctxs.push_back(alloc(augment_ctx, m_config.m_max_cutset_size + 1, i + 1));
+
+        for (unsigned_vector const& lvl : levels) {
+#ifndef SINGLE_THREAD
+            // levels with few nodes are not worth spawning threads for.
+            if (lvl.size() >= 256) {
+                std::atomic<unsigned> next(0);
+                auto work = [&](unsigned t) {
+                    while (true) {
+                        unsigned i = next.fetch_add(32);
+                        if (i >= lvl.size())
+                            break;
+                        for (unsigned j = i; j < std::min(i + 32, lvl.size()); ++j)
+                            augment(lvl[j], *ctxs[t]);
+                    }
+                };
+                vector<std::thread> threads;
+                for (unsigned t = 1; t < num_threads; ++t)
+                    threads.push_back(std::thread([&, t]() { work(t); }));
+                work(0);
+                for (auto& th : threads)
+                    th.join();
+                continue;
             }
 #endif
-            IF_VERBOSE(20, m_cuts[id].display(verbose_stream() << "after\n"));            
+            for (unsigned id : lvl)
+                augment(id, m_ctx);
         }
+        for (unsigned id : cyclic)
+            augment(id, m_ctx);
+        for (augment_ctx* ctx : ctxs) 
+            m_num_cuts += ctx->m_num_cuts;
+        m_num_cuts += m_ctx.m_num_cuts;
+        m_ctx.m_num_cuts = 0;
+        IF_VERBOSE(10, verbose_stream() << "(sat.aig-cuts :threads " << num_threads << " :levels " << levels.size() 
+                   << " :cyclic " << cyclic.size() << ")\n");
     }
 
-    void aig_cuts::augment(unsigned id, node const& n) {
+    void aig_cuts::augment(unsigned id, augment_ctx& ctx) {
+        if (m_aig[id].empty()) {
+            return;
+        }
+        IF_VERBOSE(20, m_cuts[id].display(verbose_stream() << "augment " << id << "\nbefore\n"));
+        for (node const& n : m_aig[id]) {
+            augment(id, n, ctx);
+        }
+
+#if 0
+        // augment cuts directly       
+        m_cut_save.reset();
+        cut_set& cs = m_cuts[id];
+        for (cut const& c : cs) {
+            if (c.size() > 1) m_cut_save.push_back(c);
+        }
+        for (cut const& c : m_cut_save) {
+            lut lut(*this, c);
+            augment_lut(id, lut, cs);
+        }
+#endif
+        IF_VERBOSE(20, m_cuts[id].display(verbose_stream() << "after\n"));            
+    }
+
+    void aig_cuts::augment(unsigned id, node const& n, augment_ctx& ctx) {
         unsigned nc = n.size();
-        m_insertions = 0;
+        ctx.m_insertions = 0;
         cut_set& cs = m_cuts[id];
         if (!is_touched(id, n)) {
             // no-op
@@ -78,71 +206,71 @@ namespace sat {
         }
         else if (n.is_lut()) {
             lut lut(*this, n);
-            augment_lut(id, lut, cs);
+            augment_lut(id, lut, cs, ctx);
         }
         else if (n.is_ite()) {
-            augment_ite(id, n, cs);
+            augment_ite(id, n, cs, ctx);
         }
         else if (nc == 0) { 
             augment_aig0(id, n, cs);
         }
         else if (nc == 1) {
-            augment_aig1(id, n, cs);
+            augment_aig1(id, n, cs, ctx);
         }
         else if (nc == 2) {
-            augment_aig2(id, n, cs);
+            augment_aig2(id, n, cs, ctx);
         }
         else if (nc <= cut::max_cut_size()) {
-            augment_aigN(id, n, cs);
+            augment_aigN(id, n, cs, ctx);
         }
-        if (m_insertions > 0) {
+        if (ctx.m_insertions > 0) {
             touch(id);
         }
     }
 
-    bool aig_cuts::insert_cut(unsigned v, cut const& c, cut_set& cs) {
+    bool aig_cuts::insert_cut(unsigned v, cut const& c, cut_set& cs, augment_ctx& ctx) {
         if (!cs.insert(m_on_cut_add, m_on_cut_del, c)) {
             return true;
         }
-        m_num_cuts++;
-        if (++m_insertions > max_cutset_size(v)) {
+        ctx.m_num_cuts++;
+        if (++ctx.m_insertions > max_cutset_size(v)) {
             return false;
         }
         while (cs.size() >= max_cutset_size(v)) {
             // never evict the first entry, it is used for the starting point
-            unsigned idx = 1 + (m_rand() % (cs.size() - 1));
+            unsigned idx = 1 + (ctx.m_rand() % (cs.size() - 1));
             evict(cs, idx);
         }
         return true;
     }
 
-    void aig_cuts::augment_lut(unsigned v, lut const& n, cut_set& cs) {
+    void aig_cuts::augment_lut(unsigned v, lut const& n, cut_set& cs, augment_ctx& ctx) {
         IF_VERBOSE(4, n.display(verbose_stream() << "augment_lut " << v << " ") << "\n");
         literal l1 = n.child(0);
         VERIFY(&cs != &lit2cuts(l1));
         for (auto const& a : lit2cuts(l1)) {
-            m_tables[0] = &a;
-            m_lits[0] = l1;
+            ctx.m_tables[0] = &a;
+            ctx.m_lits[0] = l1;
             cut b(a);
-            augment_lut_rec(v, n, b, 1, cs);                        
+            augment_lut_rec(v, n, b, 1, cs, ctx);                        
         }
     }
 
-    void aig_cuts::augment_lut_rec(unsigned v, lut const& n, cut& a, unsigned idx, cut_set& cs) {
+    void aig_cuts::augment_lut_rec(unsigned v, lut const& n, cut& a, unsigned idx, cut_set& cs, augment_ctx& ctx) {
         if (idx < n.size()) {
             literal lit = n.child(idx); 
             VERIFY(&cs != &lit2cuts(lit));
             for (auto const& b : lit2cuts(lit)) {
                 cut ab;
                 if (!ab.merge(a, b)) continue;
-                m_tables[idx] = &b;
-                m_lits[idx] = lit;
-                augment_lut_rec(v, n, ab, idx + 1, cs);                
+                ctx.m_tables[idx] = &b;
+                ctx.m_lits[idx] = lit;
+                augment_lut_rec(v, n, ab, idx + 1, cs, ctx);                
             }
             return;
         }
         for (unsigned i = n.size(); i-- > 0; ) { 
-            m_luts[i] = m_tables[i]->shift_table(a);            
+            ctx.m_luts[i] = ctx.m_tables[i]->shift_table(a);            
         }
         uint64_t r = 0;
         SASSERT(a.size() <= 6);
@@ -154,7 +282,7 @@ namespace sat {
             // based on the j'th output bit in lut[i]
             // m_lits[i].sign() tracks if output bit is negated
             for (unsigned i = n.size(); i-- > 0; ) {
-                w |= (((m_luts[i] >> j) ^ (uint64_t)m_lits[i].sign()) & 1u) << i;
+                w |= (((ctx.m_luts[i] >> j) ^ (uint64_t)ctx.m_lits[i].sign()) & 1u) << i;
             }
             r |= ((n.table() >> w) & 1u) << j;
         } 
@@ -162,12 +290,12 @@ namespace sat {
         IF_VERBOSE(8,
             verbose_stream() << "lut: " << v << " - " << a << "\n";
             for (unsigned i = 0; i < n.size(); ++i) {
-                verbose_stream() << m_lits[i] << ": " << *m_tables[i] << "\n";
+                verbose_stream() << ctx.m_lits[i] << ": " << *ctx.m_tables[i] << "\n";
             });
-        insert_cut(v, a, cs);
+        insert_cut(v, a, cs, ctx);
     }  
 
-    void aig_cuts::augment_ite(unsigned v, node const& n, cut_set& cs) {
+    void aig_cuts::augment_ite(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx) {
         IF_VERBOSE(4, display(verbose_stream() << "augment_ite " << v << " ", n) << "\n");
         literal l1 = child(n, 0);
         literal l2 = child(n, 1);
@@ -190,7 +318,7 @@ namespace sat {
                     if (l3.sign()) t3 = ~t3;
                     abc.set_table((t1 & t2) | ((~t1) & t3));
                     if (n.sign()) abc.negate();
-                    if (!insert_cut(v, abc, cs)) return;
+                    if (!insert_cut(v, abc, cs, ctx)) return;
                 } 
             }
         }
@@ -205,7 +333,7 @@ namespace sat {
         push_back(cs, c);
     }
 
-    void aig_cuts::augment_aig1(unsigned v, node const& n, cut_set& cs) {
+    void aig_cuts::augment_aig1(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx) {
         IF_VERBOSE(4, display(verbose_stream() << "augment_aig1 " << v << " ", n) << "\n");
         SASSERT(n.is_and());
         literal lit = child(n, 0);
@@ -213,11 +341,11 @@ namespace sat {
         for (auto const& a : lit2cuts(lit)) {
             cut c(a);
             if (n.sign()) c.negate();
-            if (!insert_cut(v, c, cs)) return;             
+            if (!insert_cut(v, c, cs, ctx)) return;             
         }
     }
 
-    void aig_cuts::augment_aig2(unsigned v, node const& n, cut_set& cs) {
+    void aig_cuts::augment_aig2(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx) {
         IF_VERBOSE(4, display(verbose_stream() << "augment_aig2 " << v << " ", n) << "\n");
         SASSERT(n.is_and() || n.is_xor());
         literal l1 = child(n, 0);
@@ -236,13 +364,15 @@ namespace sat {
                 c.set_table(t3);
                 if (n.sign()) c.negate();
                 // validate_aig2(a, b, v, n, c); 
-                if (!insert_cut(v, c, cs)) return;                
+                if (!insert_cut(v, c, cs, ctx)) return;                
             }
         }
     }
 
-    void aig_cuts::augment_aigN(unsigned v, node const& n, cut_set& cs) {
+    void aig_cuts::augment_aigN(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx) {
         IF_VERBOSE(4, display(verbose_stream() << "augment_aigN " << v << " ", n) << "\n");
+        cut_set& m_cut_set1 = ctx.m_cut_set1;
+        cut_set& m_cut_set2 = ctx.m_cut_set2;
         m_cut_set1.reset(m_on_cut_del);
         SASSERT(n.is_and() || n.is_xor());
         literal lit = child(n, 0);
@@ -256,7 +386,7 @@ namespace sat {
         for (unsigned i = 1; i < n.size(); ++i) {
             m_cut_set2.reset(m_on_cut_del);
             lit = child(n, i);
-            m_insertions = 0;
+            ctx.m_insertions = 0;
             for (auto const& a : m_cut_set1) {
                 for (auto const& b : lit2cuts(lit)) {
                     cut c;
@@ -267,16 +397,16 @@ namespace sat {
                     uint64_t t3 = n.is_and() ? (t1 & t2) : (t1 ^ t2);
                     c.set_table(t3);
                     if (i + 1 == n.size() && n.sign()) c.negate();
-                    if (!insert_cut(UINT_MAX, c, m_cut_set2)) goto next_child;                    
+                    if (!insert_cut(UINT_MAX, c, m_cut_set2, ctx)) goto next_child;                    
                 }
             }
         next_child:
             m_cut_set1.swap(m_cut_set2);
         }
-        m_insertions = 0;
+        ctx.m_insertions = 0;
         for (auto & cut : m_cut_set1) {
             // validate_aigN(v, n, cut);
-            if (!insert_cut(v, cut, cs)) {
+            if (!insert_cut(v, cut, cs, ctx)) {
                 break;
             }
         }        
@@ -367,7 +497,7 @@ namespace sat {
         cut c;
         for (bool_var w : args) VERIFY(c.add(w));
         c.set_table(lut);
-        insert_cut(v, c, m_cuts[v]);
+        insert_cut(v, c, m_cuts[v], m_ctx);
     }
 
 
@@ -25,6 +25,17 @@
 
     Nikolaj Bjorner 2020-01-02
 
+  Notes:
+
+    With multiple threads, cut enumeration is levelized: nodes
+    are grouped by their depth in the AIG and the nodes of a level
+    are augmented in parallel once all lower levels are done.
+    Each thread uses its own scratch cut sets, and the cut sets of
+    a level are pre-allocated, so that the shared region is not
+    accessed concurrently. Nodes on cycles are augmented serially
+    after the levels. Parallel enumeration is disabled when the
+    cut additions are observed (by DRAT or cut validation).
+
   --*/
 
 #pragma once
@@ -63,10 +74,24 @@ namespace sat {
             unsigned m_max_aux;
             unsigned m_max_insertions;
             bool     m_full;
-        config(): m_max_cutset_size(20), m_max_aux(5), m_max_insertions(20), m_full(true) {}
+            unsigned m_num_threads;
+        config(): m_max_cutset_size(20), m_max_aux(5), m_max_insertions(20), m_full(true), m_num_threads(1) {}
         };
     private:
 
+        // scratch state of augmenting cut sets, one per thread.
+        struct augment_ctx {
+            region      m_region;
+            cut_set     m_cut_set1, m_cut_set2;
+            random_gen  m_rand;
+            unsigned    m_insertions { 0 };
+            unsigned    m_num_cuts { 0 };
+            cut const*  m_tables[6];
+            uint64_t    m_luts[6];
+            literal     m_lits[6];
+            augment_ctx(unsigned max_sz, unsigned seed);
+        };
+
         // encodes one of var, and, !and, xor, !xor, ite, !ite.
         class node {
             bool     m_sign{ false };
@@ -102,7 +127,8 @@ namespace sat {
         vector<svector<node>> m_aig;    
         literal_vector        m_literals;
         region                m_region;
-        cut_set               m_cut_set1, m_cut_set2, m_empty_cuts;
+        augment_ctx           m_ctx;
+        cut_set               m_empty_cuts;
         vector<cut_set>       m_cuts;
         unsigned_vector       m_max_cutset_size;
         unsigned_vector       m_last_touched;
@@ -113,9 +139,6 @@ namespace sat {
         on_clause_t           m_on_clause_add, m_on_clause_del;
         cut_set::on_update_t  m_on_cut_add, m_on_cut_del;
         literal_vector        m_clause;
-        cut const*            m_tables[6];
-        uint64_t              m_luts[6];
-        literal               m_lits[6];
 
         class to_root {
             literal_vector m_to_root;
@@ -159,20 +182,23 @@ namespace sat {
 
         unsigned_vector filter_valid_nodes() const;
         void augment(unsigned_vector const& ids);
-        void augment(unsigned id, node const& n);
-        void augment_ite(unsigned v,  node const& n, cut_set& cs);
+        void augment_par(unsigned_vector const& ids);
+        void levelize(unsigned_vector const& ids, vector<unsigned_vector>& levels, unsigned_vector& cyclic);
+        void augment(unsigned id, augment_ctx& ctx);
+        void augment(unsigned id, node const& n, augment_ctx& ctx);
+        void augment_ite(unsigned v,  node const& n, cut_set& cs, augment_ctx& ctx);
         void augment_aig0(unsigned v, node const& n, cut_set& cs);
-        void augment_aig1(unsigned v, node const& n, cut_set& cs);
-        void augment_aig2(unsigned v, node const& n, cut_set& cs);
-        void augment_aigN(unsigned v, node const& n, cut_set& cs);
+        void augment_aig1(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx);
+        void augment_aig2(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx);
+        void augment_aigN(unsigned v, node const& n, cut_set& cs, augment_ctx& ctx);
 
 
-        void augment_lut(unsigned v,  lut const& n, cut_set& cs);        
-        void augment_lut_rec(unsigned v, lut const& n, cut& a, unsigned idx, cut_set& cs);
+        void augment_lut(unsigned v,  lut const& n, cut_set& cs, augment_ctx& ctx);        
+        void augment_lut_rec(unsigned v, lut const& n, cut& a, unsigned idx, cut_set& cs, augment_ctx& ctx);
 
         cut_set const& lit2cuts(literal lit) const { return lit.var() < m_cuts.size() ? m_cuts[lit.var()] : m_empty_cuts; }
 
-        bool insert_cut(unsigned v, cut const& c, cut_set& cs);
+        bool insert_cut(unsigned v, cut const& c, cut_set& cs, augment_ctx& ctx);
 
         void flush_roots();
         bool flush_roots(bool_var var, to_root const& to_root, node& n);
@@ -212,6 +238,8 @@ namespace sat {
         void add_cut(bool_var v, uint64_t lut, bool_var_vector const& args);
         void set_root(bool_var v, literal r);
 
+        void set_num_threads(unsigned n) { m_config.m_num_threads = n; }
+
         void set_on_clause_add(on_clause_t& on_clause_add);
         void set_on_clause_del(on_clause_t& on_clause_del);
 
@@ -33,6 +33,7 @@ class sat_allocator {
     };
     char const *              m_id;
     size_t                    m_alloc_size;
+    size_t                    m_free_size;
     ptr_vector<chunk>         m_chunks;
     void *                    m_chunk_ptr;
     ptr_vector<void>          m_free[NUM_FREE];
@@ -44,13 +45,14 @@ class sat_allocator {
         return (static_cast<unsigned>(size >> PTR_ALIGNMENT) + ((0 != (size & MASK)) ? 1u : 0u));
     }
 public:
-    sat_allocator(char const * id = "unknown"): m_id(id), m_alloc_size(0), m_chunk_ptr(nullptr) {}
+    sat_allocator(char const * id = "unknown"): m_id(id), m_alloc_size(0), m_free_size(0), m_chunk_ptr(nullptr) {}
     ~sat_allocator() { reset(); }
     void reset() {
         for (chunk * ch : m_chunks) dealloc(ch);
         m_chunks.reset();
         for (unsigned i = 0; i < NUM_FREE; ++i) m_free[i].reset();
         m_alloc_size = 0;
+        m_free_size = 0;
         m_chunk_ptr = nullptr;
     }
     void * allocate(size_t size) {
@@ -62,6 +64,7 @@ public:
         if (!m_free[slot_id].empty()) {
             void* result = m_free[slot_id].back();
             m_free[slot_id].pop_back();
+            m_free_size -= align_size(size);
             return result;
         }
         if (m_chunks.empty()) {
@@ -86,10 +89,17 @@ public:
         }
         else {
             m_free[free_slot_id(size)].push_back(p);
+            m_free_size += align_size(size);
         }
     }
     size_t get_allocation_size() const { return m_alloc_size; }
 
+    // bytes held in free lists of chunks, that is, bytes lost to fragmentation.
+    size_t get_free_size() const { return m_free_size; }
+
+    // bytes reserved for chunks of small objects.
+    size_t get_chunk_size() const { return m_chunks.size() * sizeof(chunk); }
+
     char const* id() const { return m_id; }
 };
 
@@ -378,6 +378,7 @@ namespace sat {
         cfg.m_max_steps = 1000;
         cfg.m_random_seed = s.rand()();
         cfg.m_enable_exlin = m_config.m_enable_exlin;
+        cfg.m_enable_f4 = m_config.m_enable_f4;
 
         unsigned max_num_nodes = 1 << 18;
         ps.get_manager().set_max_num_nodes(max_num_nodes);
@@ -43,13 +43,15 @@ namespace sat {
             bool     m_compile_aig;
             bool     m_anf2phase;
             bool     m_enable_exlin;
+            bool     m_enable_f4;
             config():
                 m_max_clause_size(3),
                 m_max_clauses(10000),
                 m_compile_xor(true),
                 m_compile_aig(true),
                 m_anf2phase(false),
-                m_enable_exlin(false)
+                m_enable_exlin(false),
+                m_enable_f4(false)
             {}
         };
 
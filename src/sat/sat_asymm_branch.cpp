@@ -204,6 +204,84 @@ namespace sat {
 
     }
 
+    struct glue_size_lt {
+        bool operator()(clause const * c1, clause const * c2) const {
+            if (c1->glue() < c2->glue()) return true;
+            return c1->glue() == c2->glue() && c1->size() < c2->size();
+        }
+    };
+
+    /**
+       \brief vivify learned clauses with glue at most vivify_glue.
+       Candidates are processed in order of increasing glue and size 
+       until the budget of visited watches is exhausted.
+    */
+    void asymm_branch::vivify_learned() {
+        SASSERT(s.at_base_lvl());
+        s.propagate(false); 
+        if (s.m_inconsistent)
+            return;
+        ++m_vivify_calls;
+        unsigned elim0 = m_elim_learned_literals;
+        bool_vector saved_phase(s.m_phase);
+        flet<bool> _is_probing(s.m_is_probing, true);
+        flet<unsigned> _touch_index(m_touch_index, 0);  // all variables count as touched
+        flet<int64_t> _counter(m_counter, m_vivify_limit);
+        clause_vector& clauses = s.m_learned;
+        std::stable_sort(clauses.begin(), clauses.end(), glue_size_lt());
+        clause_vector::iterator it  = clauses.begin();
+        clause_vector::iterator it2 = it;
+        clause_vector::iterator end = clauses.end();
+        try {
+            for (; it != end; ++it) {
+                clause & c = *(*it);
+                if (m_counter < 0 || s.inconsistent() || c.glue() > m_vivify_glue) {
+                    for (; it != end; ++it, ++it2) 
+                        *it2 = *it;
+                    break;
+                }
+                if (!c.was_removed() && !c.frozen() && c.size() > 2 && !vivify(c)) 
+                    continue; // clause was removed
+                *it2 = *it;
+                ++it2;
+            }
+            clauses.set_end(it2);
+        }
+        catch (solver_exception & ex) {
+            for (; it != end; ++it, ++it2) 
+                *it2 = *it;
+            clauses.set_end(it2);
+            s.m_phase = saved_phase;
+            throw ex;
+        }
+        s.m_phase = saved_phase;
+        m_vivify_literals += m_elim_learned_literals - elim0;
+        IF_VERBOSE(2, verbose_stream() << "(sat-vivify :elim-literals " << (m_elim_learned_literals - elim0) << ")\n";);
+    }
+
+    /**
+       \brief propagate the negation of the literals of c until a conflict is found.
+       Returns false if the clause was removed.
+    */
+    bool asymm_branch::vivify(clause & c) {
+        SASSERT(s.scope_lvl() == 0);
+        for (literal lit : c) {
+            if (s.value(lit) == l_true) {
+                s.detach_clause(c);
+                s.del_clause(c);
+                return false;
+            }
+        }
+        s.checkpoint();
+        m_counter -= c.size();
+        scoped_detach scoped_d(s, c);  
+        unsigned new_sz = c.size();
+        unsigned flip_position = c.size() - 1;
+        if (!flip_literal_at(c, flip_position, new_sz))
+            return true;
+        return cleanup(scoped_d, c, flip_position, new_sz);
+    }
+
     /**
        \brief try asymmetric branching on all literals in clause.        
     */
@@ -478,6 +556,9 @@ namespace sat {
         m_asymm_branch_sampled = p.asymm_branch_sampled();
         m_asymm_branch_limit   = p.asymm_branch_limit();
         m_asymm_branch_all     = p.asymm_branch_all();
+        m_vivify               = p.asymm_branch_vivify();
+        m_vivify_glue          = p.asymm_branch_vivify_glue();
+        m_vivify_limit         = p.asymm_branch_vivify_limit();
         if (m_asymm_branch_limit > UINT_MAX)
             m_asymm_branch_limit = UINT_MAX;
     }
@@ -489,12 +570,16 @@ namespace sat {
     void asymm_branch::collect_statistics(statistics & st) const {
         st.update("sat elim literals", m_elim_literals);
         st.update("sat tr", m_tr);
+        st.update("sat vivify calls", m_vivify_calls);
+        st.update("sat vivify literals", m_vivify_literals);
     }
 
     void asymm_branch::reset_statistics() {
         m_elim_literals = 0;
         m_elim_learned_literals = 0;
         m_tr = 0;
+        m_vivify_calls = 0;
+        m_vivify_literals = 0;
     }
 
 };
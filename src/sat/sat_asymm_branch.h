@@ -44,11 +44,16 @@ namespace sat {
         bool       m_asymm_branch_sampled;
         bool       m_asymm_branch_all;
         int64_t    m_asymm_branch_limit;
+        bool       m_vivify;
+        unsigned   m_vivify_glue;
+        unsigned   m_vivify_limit;
 
         // stats
         unsigned   m_elim_literals;
         unsigned   m_elim_learned_literals;
         unsigned   m_tr;
+        unsigned   m_vivify_calls;
+        unsigned   m_vivify_literals;
 
         literal_vector m_pos, m_neg; // literals (complements of literals) in clauses sorted by discovery time (m_left in BIG).
         svector<std::pair<literal, unsigned>> m_pos1, m_neg1;
@@ -82,6 +87,8 @@ namespace sat {
         
         bool process_all(clause & c);
 
+        bool vivify(clause & c);
+
         void process_bin(big& big);
         
         bool flip_literal_at(clause const& c, unsigned flip_index, unsigned& new_sz);
@@ -95,6 +102,10 @@ namespace sat {
 
         void operator()(bool force);
 
+        bool should_vivify() const { return m_vivify; }
+
+        void vivify_learned();
+
         void updt_params(params_ref const & p);
         static void collect_param_descrs(param_descrs & d);
 
@@ -164,6 +164,14 @@ namespace sat {
         m_allocator.reset();
     }
 
+    /**
+       \brief fraction of the memory reserved for small clauses that sits in free lists.
+     */
+    double clause_allocator::get_fragmentation() const {
+        size_t chunks = m_allocator.get_chunk_size();
+        return chunks == 0 ? 0.0 : static_cast<double>(m_allocator.get_free_size()) / static_cast<double>(chunks);
+    }
+
     clause * clause_allocator::get_clause(clause_offset cls_off) const {
         SASSERT(cls_off == reinterpret_cast<clause_offset>(reinterpret_cast<clause*>(cls_off)));
         return reinterpret_cast<clause *>(cls_off);
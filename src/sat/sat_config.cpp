@@ -76,6 +76,9 @@ namespace sat {
         m_activity_scale  = p.reorder_activity_scale();
         m_search_sat_conflicts = p.search_sat_conflicts();
         m_search_unsat_conflicts = p.search_unsat_conflicts();
+        m_mode_switch = p.search_mode_switch();
+        m_mode_switch_factor = p.search_mode_switch_factor();
+        m_stable_restart = p.search_stable_restart();
         m_phase_sticky      = p.phase_sticky();
 
         m_restart_initial = p.restart_initial();
@@ -84,6 +87,7 @@ namespace sat {
         m_propagate_prefetch = p.propagate_prefetch();
         m_inprocess_max   = p.inprocess_max();
         m_inprocess_out   = p.inprocess_out();
+        m_inprocess_backoff = p.inprocess_backoff();
 
         m_random_freq     = p.random_freq();
         m_random_seed     = p.random_seed();
@@ -96,11 +100,20 @@ namespace sat {
         
         m_max_conflicts   = p.max_conflicts();
         m_num_threads     = p.threads();
+        m_par_max_shared_size = p.threads_max_shared_size();
+        m_par_max_shared_glue = p.threads_max_shared_glue();
+        m_par_deterministic = p.threads_deterministic();
+        m_par_sync_conflicts = std::max(1u, p.threads_sync_conflicts());
         m_ddfw_search     = p.ddfw_search();
         m_ddfw_threads    = p.ddfw_threads();
         m_prob_search     = p.prob_search();
         m_local_search    = p.local_search();
         m_local_search_threads = p.local_search_threads();
+        m_cube_and_conquer = p.cube_and_conquer();
+        m_cube_and_conquer_depth = p.cube_and_conquer_depth();
+        m_cube_and_conquer_threads = p.cube_and_conquer_threads();
+        m_cube_and_conquer_file = p.cube_and_conquer_file();
+        m_cube_and_conquer_dump = p.cube_and_conquer_dump();
         if (p.local_search_mode() == symbol("gsat"))
             m_local_search_mode = local_search_mode::gsat;
         else
@@ -111,6 +124,10 @@ namespace sat {
         m_anf_simplify      = p.anf();
         m_anf_delay         = p.anf_delay();
         m_anf_exlin         = p.anf_exlin();
+        m_anf_f4            = p.anf_f4();
+        m_gauss_simplify    = p.gauss();
+        m_gauss_delay       = p.gauss_delay();
+        m_gauss_max_vars    = p.gauss_max_vars();
         m_cut_simplify      = p.cut();
         m_cut_delay         = p.cut_delay();
         m_cut_aig           = p.cut_aig();
@@ -120,6 +137,7 @@ namespace sat {
         m_cut_dont_cares    = p.cut_dont_cares();
         m_cut_redundancies  = p.cut_redundancies();
         m_cut_force         = p.cut_force();
+        m_cut_threads       = p.cut_threads();
         m_lookahead_simplify = p.lookahead_simplify();
         m_lookahead_double = p.lookahead_double();
         m_lookahead_simplify_bca = p.lookahead_simplify_bca();
@@ -179,14 +197,18 @@ namespace sat {
             m_gc_strategy = GC_PSM;
         else if (s == symbol("psm_glue"))
             m_gc_strategy = GC_PSM_GLUE;
+        else if (s == symbol("tiered"))
+            m_gc_strategy = GC_TIERED;
         else 
             throw sat_param_exception("invalid gc strategy");
         m_gc_initial      = p.gc_initial();
         m_gc_increment    = p.gc_increment();
         m_gc_small_lbd    = p.gc_small_lbd();
+        m_gc_tier2_lbd    = p.gc_tier2_lbd();
         m_gc_k            = std::min(255u, p.gc_k());
         m_gc_burst        = p.gc_burst();
         m_gc_defrag       = p.gc_defrag();
+        m_gc_defrag_ratio = p.gc_defrag_ratio();
 
         m_force_cleanup   = p.force_cleanup();
 
@@ -196,6 +218,7 @@ namespace sat {
         m_minimize_lemmas = p.minimize_lemmas();
         m_core_minimize   = p.core_minimize();
         m_core_minimize_partial   = p.core_minimize_partial();
+        m_reuse_trail     = p.assumptions_reuse_trail();
         m_drat_check_unsat  = p.drat_check_unsat();
         m_drat_check_sat  = p.drat_check_sat();
         m_drat_file       = p.drat_file();
@@ -210,8 +233,12 @@ namespace sat {
              m_smt_proof_check ||
              m_drat_check_sat);
         m_drat_binary     = p.drat_binary();
+        m_drat_async      = p.drat_async();
         m_drat_activity   = p.drat_activity();
         m_dyn_sub_res     = p.dyn_sub_res();
+        m_shrink_lemmas   = p.minimize_lemmas_shrink();
+        m_minimize_lemmas_big = p.minimize_lemmas_big();
+        m_minimize_lemmas_big_budget = p.minimize_lemmas_big_budget();
 
         // Parameters used in Liang, Ganesh, Poupart, Czarnecki AAAI 2016.
         m_branching_heuristic = BH_VSIDS;
@@ -219,8 +246,10 @@ namespace sat {
             m_branching_heuristic = BH_VSIDS;
         else if (p.branching_heuristic() == symbol("chb")) 
             m_branching_heuristic = BH_CHB;
+        else if (p.branching_heuristic() == symbol("vmtf")) 
+            m_branching_heuristic = BH_VMTF;
         else 
-            throw sat_param_exception("invalid branching heuristic: accepted heuristics are 'vsids' or 'chb'");
+            throw sat_param_exception("invalid branching heuristic: accepted heuristics are 'vsids', 'chb' or 'vmtf'");
 
         m_anti_exploration = p.branching_anti_exploration();
         m_step_size_init = 0.40;
@@ -247,8 +276,10 @@ namespace sat {
             m_pb_resolve = PB_CARDINALITY;
         else if (s == "rounding") 
             m_pb_resolve = PB_ROUNDING;
+        else if (s == "cutting_planes") 
+            m_pb_resolve = PB_CUTTING_PLANES;
         else 
-            throw sat_param_exception("invalid PB resolve: 'cardinality' or 'rounding' expected");
+            throw sat_param_exception("invalid PB resolve: 'cardinality', 'rounding' or 'cutting_planes' expected");
 
         s = p.pb_lemma_format();
         if (s == "cardinality") 
@@ -45,17 +45,20 @@ namespace sat {
         GC_PSM,
         GC_GLUE,
         GC_GLUE_PSM,
-        GC_PSM_GLUE
+        GC_PSM_GLUE,
+        GC_TIERED
     };
 
     enum branching_heuristic {
         BH_VSIDS,
-        BH_CHB
+        BH_CHB,
+        BH_VMTF
     };
 
     enum pb_resolve {
         PB_CARDINALITY,
-        PB_ROUNDING
+        PB_ROUNDING,
+        PB_CUTTING_PLANES
     };
 
     enum pb_lemma_format {
@@ -96,6 +99,9 @@ namespace sat {
         unsigned           m_reorder_activity_scale;
         bool               m_propagate_prefetch;
         restart_strategy   m_restart;
+        bool               m_mode_switch;
+        double             m_mode_switch_factor;
+        unsigned           m_stable_restart;
         bool               m_restart_fast;
         unsigned           m_restart_initial;
         double             m_restart_factor; // for geometric case
@@ -106,16 +112,26 @@ namespace sat {
         double             m_slow_glue_avg;
         unsigned           m_inprocess_max;
         symbol             m_inprocess_out;
+        unsigned           m_inprocess_backoff;
         double             m_random_freq;
         unsigned           m_random_seed;
         unsigned           m_burst_search;
         bool               m_enable_pre_simplify;
         unsigned           m_max_conflicts;
         unsigned           m_num_threads;
+        unsigned           m_par_max_shared_size;
+        unsigned           m_par_max_shared_glue;
+        bool               m_par_deterministic;
+        unsigned           m_par_sync_conflicts;
         bool               m_ddfw_search;
         unsigned           m_ddfw_threads;
         bool               m_prob_search;
         unsigned           m_local_search_threads;
+        bool               m_cube_and_conquer;
+        unsigned           m_cube_and_conquer_depth;
+        unsigned           m_cube_and_conquer_threads;
+        symbol             m_cube_and_conquer_file;
+        symbol             m_cube_and_conquer_dump;
         bool               m_local_search;
         local_search_mode  m_local_search_mode;
         bool               m_local_search_dbg_flips;
@@ -129,9 +145,14 @@ namespace sat {
         bool               m_cut_dont_cares;
         bool               m_cut_redundancies;
         bool               m_cut_force;
+        unsigned           m_cut_threads;
         bool               m_anf_simplify;
         unsigned           m_anf_delay;
         bool               m_anf_exlin;
+        bool               m_anf_f4;
+        bool               m_gauss_simplify;
+        unsigned           m_gauss_delay;
+        unsigned           m_gauss_max_vars;
         bool               m_lookahead_simplify;
         bool               m_lookahead_simplify_bca;
         cutoff_t           m_lookahead_cube_cutoff;
@@ -159,9 +180,11 @@ namespace sat {
         unsigned           m_gc_initial;
         unsigned           m_gc_increment;
         unsigned           m_gc_small_lbd;
+        unsigned           m_gc_tier2_lbd;
         unsigned           m_gc_k;
         bool               m_gc_burst;
         bool               m_gc_defrag;
+        double             m_gc_defrag_ratio;
 
         bool               m_force_cleanup;
 
@@ -171,13 +194,18 @@ namespace sat {
 
         bool               m_minimize_lemmas;
         bool               m_dyn_sub_res;
+        bool               m_shrink_lemmas;
+        bool               m_minimize_lemmas_big;
+        unsigned           m_minimize_lemmas_big_budget;
         bool               m_core_minimize;
         bool               m_core_minimize_partial;
+        bool               m_reuse_trail;
 
         // drat proofs
         bool               m_drat;
         bool               m_drat_disable;
         bool               m_drat_binary;
+        bool               m_drat_async;
         symbol             m_drat_file;
         bool               m_smt_proof_check;
         bool               m_drat_check_unsat;
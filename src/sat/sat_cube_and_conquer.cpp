@@ -0,0 +1,227 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_cube_and_conquer.cpp
+
+Abstract:
+
+    Cube and conquer for the SAT core.
+
+--*/
+
+#include <fstream>
+#include <sstream>
+#include <atomic>
+#include "util/scoped_ptr_vector.h"
+#include "util/trace.h"
+#include "sat/sat_cube_and_conquer.h"
+#include "sat/sat_solver.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <mutex>
+#endif
+
+namespace sat {
+
+    unsigned cube_and_conquer::num_workers() const {
+        unsigned n = s.m_config.m_cube_and_conquer_threads;
+#ifdef SINGLE_THREAD
+        n = 1;
+#else
+        if (n == 0)
+            n = std::thread::hardware_concurrency();
+#endif
+        return std::max(1u, std::min(n, m_cubes.size()));
+    }
+
+    /**
+       \brief Split the problem using the lookahead solver on a copy of s.
+       Return l_true and set the model of s if a cube is satisfied by propagation,
+       l_false if all branches are refuted, and l_undef otherwise.
+    */
+    lbool cube_and_conquer::generate_cubes() {
+        params_ref p(s.m_params);
+        p.set_sym("lookahead.cube.cutoff", symbol("depth"));
+        p.set_uint("lookahead.cube.depth", s.m_config.m_cube_and_conquer_depth);
+        p.set_bool("cube_and_conquer", false);
+        solver cuber(p, s.rlimit());
+        cuber.copy(s);
+        bool_var_vector vars;
+        literal_vector lits;
+        while (true) {
+            lbool r = cuber.cube(vars, lits, UINT_MAX);
+            if (r == l_false)
+                return m_cubes.empty() ? l_false : l_undef;
+            if (r == l_true) {
+                s.set_model(cuber.get_model(), true);
+                return l_true;
+            }
+            m_cubes.push_back(lits);
+            vars.reset();
+        }
+    }
+
+    bool cube_and_conquer::read_cubes(char const* file_name) {
+        std::ifstream in(file_name);
+        if (in.bad() || in.fail())
+            return false;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream strm(line);
+            std::string tag;
+            if (!(strm >> tag) || tag != "a")
+                continue;
+            literal_vector cube;
+            int lit;
+            while (strm >> lit && lit != 0) {
+                unsigned v = static_cast<unsigned>(abs(lit));
+                if (v >= s.num_vars())
+                    return false;
+                cube.push_back(literal(v, lit < 0));
+            }
+            m_cubes.push_back(cube);
+        }
+        return true;
+    }
+
+    bool cube_and_conquer::write_cubes(char const* file_name) const {
+        std::ofstream out(file_name);
+        if (out.bad() || out.fail())
+            return false;
+        for (literal_vector const& cube : m_cubes) {
+            out << "a";
+            for (literal l : cube)
+                out << " " << (l.sign() ? -static_cast<int>(l.var()) : static_cast<int>(l.var()));
+            out << " 0\n";
+        }
+        return static_cast<bool>(out);
+    }
+
+    lbool cube_and_conquer::operator()() {
+        if (s.m_config.m_cube_and_conquer_file.is_non_empty_string()) {
+            if (!read_cubes(s.m_config.m_cube_and_conquer_file.str().c_str())) {
+                s.m_reason_unknown = "cube file could not be read";
+                return l_undef;
+            }
+        }
+        else {
+            lbool r = generate_cubes();
+            if (r != l_undef)
+                return r;
+        }
+        IF_VERBOSE(1, verbose_stream() << "(sat.cube-and-conquer :cubes " << m_cubes.size() << ")\n";);
+
+        if (s.m_config.m_cube_and_conquer_dump.is_non_empty_string()) {
+            std::string dump_file = s.m_config.m_cube_and_conquer_dump.str();
+            s.m_reason_unknown = write_cubes(dump_file.c_str()) ? "cubes written to " + dump_file : "cube file could not be written";
+            return l_undef;
+        }
+        if (m_cubes.empty())
+            return l_false;
+
+        unsigned num_threads = num_workers();
+        params_ref p(s.m_params);
+        p.set_bool("cube_and_conquer", false);
+        p.set_uint("threads", 1);
+        vector<reslimit> lims(num_threads);
+        scoped_limits limits(s.rlimit());
+        scoped_ptr_vector<solver> workers;
+        for (unsigned i = 0; i < num_threads; ++i) {
+            limits.push_child(&lims[i]);
+            solver* w = alloc(solver, p, lims[i]);
+            w->copy(s, true);
+            // variables in cubes are assumed in later calls, so they must not be eliminated.
+            w->set_incremental(true);
+            for (literal_vector const& cube : m_cubes)
+                for (literal l : cube)
+                    w->set_external(l.var());
+            workers.push_back(w);
+        }
+
+        std::atomic<unsigned> next(0);
+        int winner = -1;
+        lbool result = l_false;
+        std::string ex_msg;
+#ifndef SINGLE_THREAD
+        std::mutex mux;
+#define CC_LOCK() std::lock_guard<std::mutex> _lock(mux)
+#else
+#define CC_LOCK() {}
+#endif
+        auto finish = [&](unsigned id, lbool r) {
+            if (winner != -1)
+                return;
+            winner = id;
+            result = r;
+            next = m_cubes.size();
+            for (reslimit& rl : lims)
+                rl.cancel();
+        };
+
+        auto work = [&](unsigned id) {
+            solver& w = *workers[id];
+            unsigned imported = 0, exported = 0;
+            try {
+                while (true) {
+                    unsigned i = next++;
+                    if (i >= m_cubes.size())
+                        break;
+                    {
+                        CC_LOCK();
+                        for (; imported < m_units.size() && !w.inconsistent(); ++imported) {
+                            literal u = m_units[imported];
+                            if (!w.was_eliminated(u.var()) && w.value(u) == l_undef)
+                                w.mk_clause(1, &u);
+                        }
+                    }
+                    literal_vector const& cube = m_cubes[i];
+                    lbool r = w.inconsistent() ? l_false : w.check(cube.size(), cube.data());
+                    CC_LOCK();
+                    if (r != l_false) {
+                        finish(id, r);
+                        break;
+                    }
+                    ++m_num_refuted;
+                    if (w.inconsistent() || w.get_core().empty()) {
+                        finish(id, l_false);
+                        break;
+                    }
+                    unsigned sz = w.init_trail_size();
+                    for (exported = std::min(exported, sz); exported < sz; ++exported)
+                        m_units.push_back(w.m_trail[exported]);
+                }
+            }
+            catch (z3_exception& ex) {
+                CC_LOCK();
+                if (winner == -1)
+                    ex_msg = ex.msg();
+                finish(id, l_undef);
+            }
+        };
+
+#ifndef SINGLE_THREAD
+        vector<std::thread> threads;
+        for (unsigned id = 1; id < num_threads; ++id)
+            threads.push_back(std::thread([&, id]() { work(id); }));
+        work(0);
+        for (auto& th : threads)
+            th.join();
+#else
+        work(0);
+#endif
+#undef CC_LOCK
+
+        IF_VERBOSE(1, verbose_stream() << "(sat.cube-and-conquer :threads " << num_threads
+                   << " :refuted " << m_num_refuted << " :shared-units " << m_units.size() << ")\n";);
+        if (!ex_msg.empty())
+            throw default_exception(std::move(ex_msg));
+        if (winner != -1 && result == l_true)
+            s.set_model(workers[winner]->get_model(), true);
+        if (winner != -1 && result == l_undef)
+            s.m_reason_unknown = workers[winner]->get_reason_unknown();
+        return result;
+    }
+
+};
@@ -0,0 +1,51 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_cube_and_conquer.h
+
+Abstract:
+
+    Cube and conquer for the SAT core.
+
+    The lookahead solver splits the problem into cubes up to a
+    given depth. The cubes are then solved under assumptions by a
+    pool of solver copies. Workers claim the next unsolved cube
+    from a shared cursor, and units learned by one worker are
+    imported by the others before they start on their next cube.
+
+    Cubes can be written to and read from files in iCNF format
+    (one "a lit ... 0" line per cube), so that the cubing and the
+    conquering can be distributed over several machines.
+
+--*/
+#pragma once
+
+#include "sat/sat_types.h"
+#include "util/rlimit.h"
+
+namespace sat {
+
+    class solver;
+
+    class cube_and_conquer {
+        solver&                 s;
+        vector<literal_vector>  m_cubes;
+        literal_vector          m_units;        // units shared between workers
+        unsigned                m_num_refuted = 0;
+
+        lbool generate_cubes();
+        bool read_cubes(char const* file_name);
+        bool write_cubes(char const* file_name) const;
+        unsigned num_workers() const;
+
+    public:
+        cube_and_conquer(solver& s): s(s) {}
+
+        lbool operator()();
+
+        vector<literal_vector> const& cubes() const { return m_cubes; }
+    };
+
+};
@@ -95,6 +95,7 @@ namespace sat {
         s(_s), 
         m_trail_size(0),
         m_validator(nullptr) {  
+        m_aig_cuts.set_num_threads(s.get_config().m_cut_threads);
         if (s.get_config().m_drat) {
             std::function<void(literal_vector const& clause)> _on_add = 
                 [this](literal_vector const& clause) { s.m_drat.add(clause); };
@@ -93,6 +93,22 @@ namespace sat {
         m_cuts[m_size++] = c; 
     }
 
+    /**
+       \brief allocate room for n cuts, such that push_back does not allocate
+       while there are at most n cuts.
+     */
+    void cut_set::reserve(unsigned n) {
+        SASSERT(m_region);
+        if (m_cuts && m_max_size >= n) 
+            return;
+        n = std::max(n, m_max_size);
+        cut* new_cuts = new (*m_region) cut[n];
+        if (m_cuts)
+            std::uninitialized_copy(m_cuts, m_cuts + m_size, new_cuts);
+        m_cuts = new_cuts;
+        m_max_size = n;
+    }
+
     void cut_set::evict(on_update_t& on_del, cut const& c) {
         for (unsigned i = 0; i < m_size; ++i) {
             if (m_cuts[i] == c) {
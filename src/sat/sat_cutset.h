@@ -180,6 +180,7 @@ namespace sat {
         cut const * end() const { return m_cuts + m_size; }
         cut const & back() { return m_cuts[m_size-1]; }
         void push_back(on_update_t& on_add, cut const& c);
+        void reserve(unsigned n);
         void reset(on_update_t& on_del) { shrink(on_del, 0); }
         cut const & operator[](unsigned idx) const { return m_cuts[idx]; }
         void shrink(on_update_t& on_del, unsigned j); 
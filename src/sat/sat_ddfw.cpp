@@ -456,8 +456,9 @@ namespace sat {
     }
 
     void ddfw::do_parallel_sync() {
-        if (m_par->from_solver(*this)) 
-            m_par->to_solver(*this);
+        // publish the best assignment before refreshing clauses from the CDCL solver
+        m_par->to_solver(*this);
+        m_par->from_solver(*this);
         
         ++m_parsync_count;
         m_parsync_next *= 3;
@@ -468,6 +469,7 @@ namespace sat {
         m_model.reserve(num_vars());
         for (unsigned i = 0; i < num_vars(); ++i) 
             m_model[i] = to_lbool(value(i));
+        m_model_cost = m_unsat.size();
         save_priorities();
         if (m_plugin)
             m_plugin->on_save_model();
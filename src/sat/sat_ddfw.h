@@ -114,6 +114,7 @@ namespace sat {
         svector<double>      m_probs;       // var -> probability of flipping
         svector<double>      m_scores;      // reward -> score
         model                m_model;       // var -> best assignment
+        unsigned             m_model_cost = UINT_MAX; // number of unsatisfied clauses under m_model
         unsigned             m_init_weight = 2; 
         
         vector<unsigned_vector> m_use_list;
@@ -265,6 +266,8 @@ namespace sat {
 
         model const& get_model() const override { return m_model; }
 
+        unsigned get_model_cost() const override { return m_model_cost; }
+
         reslimit& rlimit() override { return m_limit; }
 
         void set_seed(unsigned n) override { m_rand.set_seed(n); }
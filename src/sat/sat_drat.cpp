@@ -21,6 +21,7 @@ Notes:
 --*/
 
 #include "util/rational.h"
+#include "util/async_file_buffer.h"
 #include "sat/sat_solver.h"
 #include "sat/sat_drat.h"
 
@@ -31,7 +32,12 @@ namespace sat {
     {
         if (s.get_config().m_drat && s.get_config().m_drat_file.is_non_empty_string()) {
             auto mode = s.get_config().m_drat_binary ? (std::ios_base::binary | std::ios_base::out | std::ios_base::trunc) : std::ios_base::out;
-            m_out = alloc(std::ofstream, s.get_config().m_drat_file.str(), mode);
+            if (s.get_config().m_drat_async) {
+                m_async_buffer = alloc(async_file_buffer, s.get_config().m_drat_file.str().c_str(), mode);
+                m_out = alloc(std::ostream, m_async_buffer);
+            }
+            else 
+                m_out = alloc(std::ofstream, s.get_config().m_drat_file.str(), mode);
             if (s.get_config().m_drat_binary) 
                 std::swap(m_out, m_bout);            
         }
@@ -42,6 +48,7 @@ namespace sat {
         if (m_bout) m_bout->flush();
         dealloc(m_out);
         dealloc(m_bout);
+        dealloc(m_async_buffer);
         for (auto & [c, st] : m_proof) 
             m_alloc.del_clause(&c);            
         m_proof.reset();
@@ -205,7 +212,8 @@ namespace sat {
 
         IF_VERBOSE(20, trace(verbose_stream(), 2, lits, st););
         if (st.is_deleted()) {
-            ;
+            if (m_del_watches)
+                del_watched(2, lits);
         }
         else {
             if (st.is_redundant() && st.is_sat()) 
@@ -240,8 +248,12 @@ namespace sat {
 
         m_proof.push_back({c, st});
         if (st.is_deleted()) {
-            if (n > 0) del_watch(c, c[0]);
-            if (n > 1) del_watch(c, c[1]);
+            if (m_del_watches)
+                del_watched(n, c.begin());
+            else {
+                if (n > 0) del_watch(c, c[0]);
+                if (n > 1) del_watch(c, c[1]);
+            }
             return;
         }
         unsigned num_watch = 0;
@@ -292,6 +304,37 @@ namespace sat {
         }
     }
 
+    /**
+       \brief remove one watched clause with the literals c.
+       The watched literals of a clause belong to the clause, so it is found
+       in the watch list of one of the literals.
+    */
+    void drat::del_watched(unsigned n, literal const* c) {
+        for (unsigned j = 0; j < n; ++j) {
+            if ((~c[j]).index() >= m_watches.size())
+                continue;
+            watch& w = m_watches[(~c[j]).index()];
+            for (unsigned i = 0; i < w.size(); ++i) {
+                unsigned idx = w[i];
+                watched_clause const& wc = m_watched_clauses[idx];
+                if (!match(n, c, *wc.m_clause))
+                    continue;
+                literal other = wc.m_l1 == c[j] ? wc.m_l2 : wc.m_l1;
+                w[i] = w.back();
+                w.pop_back();
+                watch& w2 = m_watches[(~other).index()];
+                for (unsigned k = 0; k < w2.size(); ++k) {
+                    if (w2[k] == idx) {
+                        w2[k] = w2.back();
+                        w2.pop_back();
+                        break;
+                    }
+                }
+                return;
+            }
+        }
+    }
+
     void drat::declare(literal l) {
         if (!m_check)
             return;
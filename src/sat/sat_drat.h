@@ -23,6 +23,8 @@ Notes:
 
 #include "sat_types.h"
 
+class async_file_buffer;
+
 namespace sat {
     class justification;
     class clause;
@@ -52,6 +54,7 @@ namespace sat {
         clause_allocator        m_alloc;
         std::ostream*           m_out = nullptr;
         std::ostream*           m_bout = nullptr;
+        async_file_buffer*      m_async_buffer = nullptr;
         svector<std::pair<clause&, status>> m_proof;
         svector<std::pair<literal, clause*>> m_units;
         vector<watch>           m_watches;
@@ -61,6 +64,7 @@ namespace sat {
         bool                    m_check_sat = false;
         bool                    m_check = false;
         bool                    m_activity = false;
+        bool                    m_del_watches = false;
         stats                   m_stats;
 
 
@@ -81,6 +85,7 @@ namespace sat {
         void propagate(literal l);
         void assign_propagate(literal l, clause* c);
         void del_watch(clause& c, literal l);
+        void del_watched(unsigned n, literal const* c);
         bool is_drup(unsigned n, literal const* c);
         bool is_drat(unsigned n, literal const* c);
         bool is_drat(unsigned n, literal const* c, unsigned pos);
@@ -111,6 +116,13 @@ namespace sat {
 
         void set_clause_eh(clause_eh& clause_eh) { m_clause_eh = &clause_eh; }
 
+        /**
+           \brief remove deleted clauses from the watch lists used for checking.
+           Deleted clauses are matched by their literals, so deletion also applies 
+           to clauses that were added as literal vectors.
+        */
+        void set_del_watches(bool f) { m_del_watches = f; }
+
         std::ostream* out() { return m_out; }
 
         bool is_cleaned(clause& c) const;        
@@ -29,6 +29,7 @@ namespace sat{
         m_miss = 0;
         m_hit1 = 0;
         m_hit2 = 0;
+        m.set_reorder_threshold(1 << 12);
     }
 
     bool elim_vars::operator()(bool_var v) {
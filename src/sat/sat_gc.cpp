@@ -55,6 +55,9 @@ namespace sat {
         case GC_PSM_GLUE:
             gc_psm_glue();
             break;
+        case GC_TIERED:
+            gc_tiered();
+            break;
         case GC_DYN_PSM:
             if (!m_assumptions.empty()) {
                 gc_glue_psm();
@@ -69,6 +72,13 @@ namespace sat {
             break;
         }
         if (m_ext) m_ext->gc();
+        if (m_asymm_branch.should_vivify() && !inconsistent()) {
+            pop(scope_lvl());
+            m_asymm_branch.vivify_learned();
+            if (inconsistent()) 
+                return;
+            reinit_assumptions();
+        }
         if (gc > 0 && should_defrag()) {
             defrag_clauses();
         }
@@ -282,6 +292,85 @@ namespace sat {
                    " :frozen " << frozen << " :activated " << activated << " :deleted " << deleted << ")\n";);
     }
 
+    /**
+       \brief Lex on (used, glue, size), used clauses first.
+    */
+    struct used_glue_lt {
+        bool operator()(clause const * c1, clause const * c2) const {
+            if (c1->was_used() != c2->was_used()) return c1->was_used();
+            if (c1->glue() < c2->glue()) return true;
+            return c1->glue() == c2->glue() && c1->size() < c2->size();
+        }
+    };
+
+    /**
+       \brief Use gc based on three tiers of learned clauses.
+       - core:  clauses with glue at most gc.small_lbd are never deleted.
+       - tier2: clauses with glue at most gc.tier2_lbd are kept while they are used.
+                They are demoted to the local tier after gc.k rounds without use,
+                or immediately when memory is scarce.
+       - local: the unused half of the remaining clauses, ordered by glue and size, is deleted.
+       Clauses are promoted when their glue is improved during propagation.
+    */
+    void solver::gc_tiered() {
+        TRACE("sat", tout << "gc\n";);
+        bool pressure = memory_pressure();
+        unsigned num_core = 0, num_tier2 = 0, num_demoted = 0;
+        unsigned lits_core = 0, lits_tier2 = 0, lits_local = 0;
+        clause_vector local;
+        unsigned j = 0;
+        for (clause* cp : m_learned) {
+            clause & c = *cp;
+            SASSERT(!c.frozen());
+            if (c.glue() <= m_config.m_gc_small_lbd) {
+                ++num_core;
+                lits_core += c.size();
+                c.unmark_used();
+                m_learned[j++] = cp;
+                continue;
+            }
+            if (c.glue() <= m_config.m_gc_tier2_lbd) {
+                if (c.was_used()) 
+                    c.reset_inact_rounds();
+                else 
+                    c.inc_inact_rounds();
+                if (c.inact_rounds() <= m_config.m_gc_k && !(pressure && !c.was_used())) {
+                    ++num_tier2;
+                    lits_tier2 += c.size();
+                    c.unmark_used();
+                    m_learned[j++] = cp;
+                    continue;
+                }
+                ++num_demoted;
+            }
+            local.push_back(cp);
+        }
+        m_learned.shrink(j);
+        std::stable_sort(local.begin(), local.end(), used_glue_lt());
+        unsigned sz = local.size();
+        unsigned deleted = 0;
+        for (unsigned i = 0; i < sz; ++i) {
+            clause & c = *local[i];
+            if (i >= sz / 2 && !c.was_used() && can_delete(c)) {
+                detach_clause(c);
+                del_clause(c);
+                ++deleted;
+                continue;
+            }
+            lits_local += c.size();
+            c.reset_inact_rounds();
+            c.unmark_used();
+            m_learned.push_back(&c);
+        }
+        m_stats.m_gc_clause += deleted;
+        IF_VERBOSE(SAT_VB_LVL, verbose_stream() << "(sat-gc :strategy tiered"
+                   << " :core " << num_core << " :tier2 " << num_tier2 << " :local " << (sz - deleted)
+                   << " :demoted " << num_demoted << " :deleted " << deleted 
+                   << " :core-bytes " << lits_core * sizeof(literal)
+                   << " :tier2-bytes " << lits_tier2 * sizeof(literal)
+                   << " :local-bytes " << lits_local * sizeof(literal) << ")\n";);
+    }
+
     // return true if should keep the clause, and false if we should delete it.
     bool solver::activate_frozen_clause(clause & c) {
         TRACE("sat_gc", tout << "reactivating:\n" << c << "\n";);
@@ -0,0 +1,95 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_inprocess.cpp
+
+Abstract:
+
+    Scheduler for in-processing techniques.
+
+--*/
+
+#include "sat/sat_inprocess.h"
+#include "util/util.h"
+#include "util/trace.h"
+
+namespace sat {
+
+    struct technique_keys {
+        char const* m_name;
+        char const* m_calls;
+        char const* m_skipped;
+        char const* m_removed;
+        char const* m_time;
+    };
+
+#define TECHNIQUE_KEYS(n) { n, "sat inprocess " n " calls", "sat inprocess " n " skipped", "sat inprocess " n " removed", "sat inprocess " n " time" }
+
+    static technique_keys const s_keys[IP_NUM_TECHNIQUES] = {
+        TECHNIQUE_KEYS("scc"),
+        TECHNIQUE_KEYS("elim"),
+        TECHNIQUE_KEYS("probing"),
+        TECHNIQUE_KEYS("asymm-branch"),
+        TECHNIQUE_KEYS("binspr"),
+        TECHNIQUE_KEYS("anf"),
+        TECHNIQUE_KEYS("gauss"),
+        TECHNIQUE_KEYS("cut")
+    };
+
+    bool inprocess_scheduler::should_run(inprocess_technique id) {
+        technique& t = m_techniques[id];
+        if (t.m_delay == 0)
+            return true;
+        --t.m_delay;
+        ++t.m_skipped;
+        return false;
+    }
+
+    void inprocess_scheduler::update(inprocess_technique id, double seconds, uint64_t yield) {
+        technique& t = m_techniques[id];
+        ++t.m_calls;
+        t.m_seconds += seconds;
+        t.m_yield += yield;
+        if (yield > 0) {
+            t.m_idle = 0;
+            t.m_delay = 0;
+        }
+        else {
+            if (t.m_idle < 31)
+                ++t.m_idle;
+            t.m_delay = std::min(m_max_delay, (1u << t.m_idle) - 1);
+        }
+        IF_VERBOSE(3, verbose_stream() << "(sat.inprocess " << s_keys[id].m_name << " :time " << seconds
+                   << " :yield " << yield << " :delay " << t.m_delay << ")\n";);
+    }
+
+    void inprocess_scheduler::reset() {
+        for (technique& t : m_techniques) {
+            t.m_idle = 0;
+            t.m_delay = 0;
+        }
+    }
+
+    void inprocess_scheduler::collect_statistics(statistics& st) const {
+        for (unsigned i = 0; i < IP_NUM_TECHNIQUES; ++i) {
+            technique const& t = m_techniques[i];
+            if (t.m_calls == 0 && t.m_skipped == 0)
+                continue;
+            st.update(s_keys[i].m_calls, t.m_calls);
+            st.update(s_keys[i].m_skipped, t.m_skipped);
+            st.update(s_keys[i].m_removed, static_cast<double>(t.m_yield));
+            st.update(s_keys[i].m_time, t.m_seconds);
+        }
+    }
+
+    void inprocess_scheduler::reset_statistics() {
+        for (technique& t : m_techniques) {
+            t.m_seconds = 0;
+            t.m_yield = 0;
+            t.m_calls = 0;
+            t.m_skipped = 0;
+        }
+    }
+};
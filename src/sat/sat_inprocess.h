@@ -0,0 +1,60 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    sat_inprocess.h
+
+Abstract:
+
+    Scheduler for in-processing techniques.
+
+    Each technique records the time it spends and the reduction
+    of the clause database it achieves. Techniques that repeatedly
+    fail to remove anything are skipped for an exponentially growing
+    number of in-processing rounds, bounded by a maximal delay.
+
+--*/
+#pragma once
+
+#include "util/statistics.h"
+
+namespace sat {
+
+    enum inprocess_technique {
+        IP_SCC,
+        IP_ELIM,
+        IP_PROBING,
+        IP_ASYMM_BRANCH,
+        IP_BINSPR,
+        IP_ANF,
+        IP_GAUSS,
+        IP_CUT,
+        IP_NUM_TECHNIQUES
+    };
+
+    class inprocess_scheduler {
+        struct technique {
+            double      m_seconds  { 0 };
+            uint64_t    m_yield    { 0 };
+            unsigned    m_calls    { 0 };
+            unsigned    m_skipped  { 0 };
+            unsigned    m_idle     { 0 };   // number of consecutive runs without yield
+            unsigned    m_delay    { 0 };   // number of rounds to skip
+        };
+        technique         m_techniques[IP_NUM_TECHNIQUES];
+        unsigned          m_max_delay { 16 };
+    public:
+        void set_max_delay(unsigned d) { m_max_delay = d; }
+
+        // determine whether technique id is scheduled in the current round.
+        bool should_run(inprocess_technique id);
+
+        // record the cost and the yield of a run of technique id.
+        void update(inprocess_technique id, double seconds, uint64_t yield);
+
+        void reset();
+        void collect_statistics(statistics& st) const;
+        void reset_statistics();
+    };
+};
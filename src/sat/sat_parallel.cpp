@@ -22,71 +22,87 @@ Revision History:
 
 namespace sat {
 
-    void parallel::vector_pool::next(unsigned& index) {
-        SASSERT(index < m_size);
-        unsigned n = index + 2 + get_length(index);
-        index = (n >= m_size) ? 0 : n;
+    parallel::clause_ring::~clause_ring() {
+        dealloc_svect(m_data);
     }
 
-    void parallel::vector_pool::reserve(unsigned num_threads, unsigned sz) {
-        m_vectors.reset();
-        m_vectors.resize(sz, 0);
-        m_heads.reset();
-        m_heads.resize(num_threads, 0);
-        m_at_end.reset();
-        m_at_end.resize(num_threads, true);
-        m_tail = 0;
-        m_size = sz;
-    }
-    
-    void parallel::vector_pool::begin_add_vector(unsigned owner, unsigned n) {
-        SASSERT(m_tail < m_size);
-        unsigned capacity = n + 2;
-        m_vectors.reserve(m_size + capacity, 0);
-        IF_VERBOSE(3, verbose_stream() << owner << ": begin-add " << n << " tail: " << m_tail << " size: " << m_size << "\n";);
-        for (unsigned i = 0; i < m_heads.size(); ++i) {
-            while (m_tail < m_heads[i] && m_heads[i] < m_tail + capacity) {
-                next(m_heads[i]);
-            }
-            m_at_end[i] = false;
-        }
-        m_vectors[m_tail++] = owner;
-        m_vectors[m_tail++] = n;    
+    void parallel::clause_ring::reserve(unsigned sz) {
+        unsigned cap = 16;
+        while (cap < sz)
+            cap *= 2;
+        dealloc_svect(m_data);
+        m_data = alloc_svect(std::atomic<unsigned>, cap);
+        for (unsigned i = 0; i < cap; ++i)
+            m_data[i].store(0, std::memory_order_relaxed);
+        m_mask = cap - 1;
+        m_reserved.store(0, std::memory_order_relaxed);
+        m_published.store(0, std::memory_order_relaxed);
     }
 
-    void parallel::vector_pool::add_vector_elem(unsigned e) {
-        m_vectors[m_tail++] = e;
+    /**
+       \brief add a clause to the ring. Only the owner of the ring calls push.
+       Entries are stored as a length followed by the literal indices.
+     */
+    void parallel::clause_ring::push(unsigned n, literal const* lits) {
+        SASSERT(2*(n + 1) <= capacity());
+        uint64_t tail = m_published.load(std::memory_order_relaxed);
+        uint64_t new_tail = tail + n + 1;
+        m_reserved.store(new_tail, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_data[tail & m_mask].store(n, std::memory_order_relaxed);
+        for (unsigned i = 0; i < n; ++i)
+            m_data[(tail + i + 1) & m_mask].store(lits[i].index(), std::memory_order_relaxed);
+        m_published.store(new_tail, std::memory_order_release);
     }
 
-    void parallel::vector_pool::end_add_vector() {
-        if (m_tail >= m_size) 
-            m_tail = 0;
-    }
-
-
-    bool parallel::vector_pool::get_vector(unsigned owner, unsigned& n, unsigned const*& ptr) {
-        unsigned head = m_heads[owner];      
-        unsigned iterations = 0;
-        while (head != m_tail || !m_at_end[owner]) {
-            ++iterations;
-            SASSERT(head < m_size && m_tail < m_size);            
-            bool is_self = owner == get_owner(head);
-            next(m_heads[owner]);
-            IF_VERBOSE(static_cast<unsigned>(iterations > m_size ? 0 : 3), verbose_stream() << owner << ": [" << head << ":" << m_heads[owner] << "] tail: " << m_tail << "\n";);
-            m_at_end[owner] = (m_heads[owner] == m_tail);
-            if (!is_self) {
-                n = get_length(head);
-                ptr = get_ptr(head);
+    bool parallel::clause_ring::get(uint64_t& cursor, literal_vector& out, unsigned& num_dropped) const {
+        uint64_t cap = capacity();
+        while (true) {
+            uint64_t tail = m_published.load(std::memory_order_acquire);
+            if (cursor == tail)
+                return false;
+            if (tail - cursor > cap) {
+                // the producer lapped this consumer. Skip to the newest clause boundary.
+                ++num_dropped;
+                cursor = tail;
+                return false;
+            }
+            unsigned n = m_data[cursor & m_mask].load(std::memory_order_relaxed);
+            bool valid = n + 1 <= tail - cursor;
+            out.reset();
+            for (unsigned i = 0; valid && i < n; ++i)
+                out.push_back(to_literal(m_data[(cursor + i + 1) & m_mask].load(std::memory_order_relaxed)));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t reserved = m_reserved.load(std::memory_order_relaxed);
+            if (valid && reserved - cursor <= cap) {
+                cursor += n + 1;
                 return true;
             }
-            head = m_heads[owner];
+            // the entry was overwritten while it was read.
+            ++num_dropped;
+            cursor = m_published.load(std::memory_order_acquire);
+        }
+    }
+
+    void parallel::reserve(unsigned num_owners, unsigned sz) {
+        m_rings.reset();
+        m_cursors.reset();
+        m_lits.reset();
+        for (unsigned i = 0; i < num_owners; ++i) {
+            m_rings.push_back(alloc(clause_ring));
+            m_rings.back()->reserve(sz);
         }
-        return false;
+        m_cursors.resize(num_owners);
+        for (auto& c : m_cursors)
+            c.resize(num_owners, 0);
+        m_lits.resize(num_owners);
     }
 
     parallel::parallel(solver& s): m_num_clauses(0), m_consumer_ready(false), m_scoped_rlimit(s.rlimit()) {}
 
     parallel::~parallel() {
+        IF_VERBOSE(1, verbose_stream() << "(sat-parallel :exported " << m_num_exported 
+                   << " :imported " << m_num_imported << " :dropped " << m_num_dropped << ")\n";);
         m_limits.reset();
         for (auto* s : m_solvers)
             dealloc(s);
@@ -136,62 +152,140 @@ namespace sat {
         }
     }
 
+    void parallel::export_clause(solver& s, unsigned n, literal const* lits) {
+        unsigned owner = s.m_par_id;
+        if (owner >= m_rings.size() || 2*(n + 1) > m_rings[owner]->capacity())
+            return;
+        m_rings[owner]->push(n, lits);
+        m_num_exported.fetch_add(1, std::memory_order_relaxed);
+    }
+
     void parallel::share_clause(solver& s, literal l1, literal l2) {        
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  l1 << " " << l2 << "\n";);
-        {
-            lock_guard lock(m_mux);
-            m_pool.begin_add_vector(s.m_par_id, 2);
-            m_pool.add_vector_elem(l1.index());
-            m_pool.add_vector_elem(l2.index());            
-            m_pool.end_add_vector();
-        }        
+        literal lits[2] = { l1, l2 };
+        export_clause(s, 2, lits);
     }
 
     void parallel::share_clause(solver& s, clause const& c) {        
-        if (s.get_config().m_num_threads == 1 || !enable_add(c) || s.m_par_syncing_clauses) return;
+        if (s.get_config().m_num_threads == 1 || !enable_add(s, c) || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        unsigned n = c.size();
-        unsigned owner = s.m_par_id;
-        IF_VERBOSE(3, verbose_stream() << owner << ": share " <<  c << "\n";);
-        lock_guard lock(m_mux);
-        m_pool.begin_add_vector(owner, n);                
-        for (unsigned i = 0; i < n; ++i) 
-            m_pool.add_vector_elem(c[i].index());
-        m_pool.end_add_vector();        
+        IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  c << "\n";);
+        export_clause(s, c.size(), c.begin());
     }
 
     void parallel::get_clauses(solver& s) {
         if (s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        lock_guard lock(m_mux);
         _get_clauses(s);        
     }
 
     void parallel::_get_clauses(solver& s) {
-        unsigned n;
-        unsigned const* ptr;
         unsigned owner = s.m_par_id;
-        while (m_pool.get_vector(owner, n, ptr)) {
-            m_lits.reset();
-            bool usable_clause = true;
-            for (unsigned i = 0; usable_clause && i < n; ++i) {
-                literal lit(to_literal(ptr[i]));                
-                m_lits.push_back(lit);
-                usable_clause = lit.var() <= s.m_par_num_vars && !s.was_eliminated(lit.var());
+        if (owner >= m_rings.size())
+            return;
+        literal_vector& lits = m_lits[owner];
+        unsigned num_imported = 0, num_dropped = 0;
+        for (unsigned producer = 0; producer < m_rings.size(); ++producer) {
+            if (producer == owner)
+                continue;
+            uint64_t& cursor = m_cursors[owner][producer];
+            while (m_rings[producer]->get(cursor, lits, num_dropped)) {
+                bool usable_clause = true;
+                for (unsigned i = 0; usable_clause && i < lits.size(); ++i) {
+                    literal lit = lits[i];
+                    usable_clause = lit.var() <= s.m_par_num_vars && !s.was_eliminated(lit.var());
+                }
+                IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << lits << "\n";);
+                SASSERT(lits.size() >= 2);
+                if (usable_clause) {
+                    s.mk_clause_core(lits.size(), lits.data(), sat::status::redundant());
+                    ++num_imported;
+                }
             }
-            IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << m_lits << "\n";);
-            SASSERT(n >= 2);
-            if (usable_clause) {
-                s.mk_clause_core(m_lits.size(), m_lits.data(), sat::status::redundant());
+        }
+        m_num_imported.fetch_add(num_imported, std::memory_order_relaxed);
+        m_num_dropped.fetch_add(num_dropped, std::memory_order_relaxed);
+    }
+
+    void parallel::init_sync(unsigned num_solvers) {
+        m_num_active = num_solvers;
+        m_num_arrived = 0;
+        m_num_finished = 0;
+        m_round = 0;
+        m_stop = false;
+        m_stopped.reset();
+        m_stopped.resize(num_solvers, false);
+    }
+
+    void parallel::end_round() {
+        m_num_arrived = 0;
+        ++m_round;
+        m_stop |= m_num_finished > 0;
+        m_sync_cv.notify_all();
+    }
+
+    bool parallel::barrier() {
+        std::unique_lock<std::mutex> lock(m_sync_mux);
+        if (m_stop)
+            return false;
+        uint64_t round = m_round;
+        if (++m_num_arrived == m_num_active)
+            end_round();
+        else
+            m_sync_cv.wait(lock, [&]() { return round != m_round; });
+        return !m_stop;
+    }
+
+    void parallel::finish(unsigned i) {
+        std::lock_guard<std::mutex> lock(m_sync_mux);
+        --m_num_active;
+        ++m_num_finished;
+        if (m_num_arrived > 0 && m_num_arrived == m_num_active)
+            end_round();
+    }
+
+    /**
+       \brief deterministic exchange.
+       All solvers publish their units and clauses before the first barrier and
+       import them between the first and the second barrier. No solver searches
+       while others import, so what each solver receives does not depend on timing.
+       Units are imported in a fixed order.
+     */
+    bool parallel::sync(solver& s, literal_vector const& in, unsigned& limit, literal_vector& out) {
+        if (s.m_par_syncing_clauses) 
+            return true;
+        flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
+        {
+            lock_guard lock(m_mux);
+            for (literal lit : in) {
+                if (!m_unit_set.contains(lit.index())) {
+                    m_unit_set.insert(lit.index());
+                    m_units.push_back(lit);
+                }
             }
-        }        
+        }
+        if (!barrier()) {
+            m_stopped.set(s.m_par_id, true);
+            return false;
+        }
+        _get_clauses(s);
+        {
+            lock_guard lock(m_mux);
+            out.append(m_units.size() - limit, m_units.data() + limit);
+            limit = m_units.size();
+        }
+        std::sort(out.begin(), out.end());
+        // no solver finishes between the two barriers.
+        barrier();
+        return true;
     }
 
-    bool parallel::enable_add(clause const& c) const {
+    bool parallel::enable_add(solver const& s, clause const& c) const {
         // plingeling, glucose heuristic:
-        return (c.size() <= 40 && c.glue() <= 8) || c.glue() <= 2;
+        auto const& cfg = s.get_config();
+        return (c.size() <= cfg.m_par_max_shared_size && c.glue() <= cfg.m_par_max_shared_glue) || c.glue() <= 2;
     }
 
     void parallel::_from_solver(solver& s) {
@@ -206,16 +300,21 @@ namespace sat {
     }
 
 
+    /**
+       \brief import the best assignment published by local search
+       as the best phase of the CDCL solver.
+     */
     void parallel::_to_solver(solver& s) {
-        return;
-#if 0
-        if (m_priorities.empty())
+        unsigned version = m_best_version.load(std::memory_order_relaxed);
+        if (version == s.m_par_best_version)
             return;
-        
-        for (bool_var v = 0; v < m_priorities.size(); ++v) 
-            s.update_activity(v, m_priorities[v]);
-        s.m_activity_inc = 128;
-#endif
+        s.m_par_best_version = version;
+        unsigned sz = std::min(m_best_phase.size(), s.m_best_phase.size());
+        for (unsigned v = 0; v < sz; ++v) {
+            s.m_best_phase[v] = m_best_phase[v];
+            s.m_phase[v] = m_best_phase[v];
+        }
+        IF_VERBOSE(2, verbose_stream() << "(sat-parallel import phase :unsat " << m_best_cost << ")\n";);
     }
 
     void parallel::from_solver(solver& s) {
@@ -224,18 +323,26 @@ namespace sat {
     }
 
     void parallel::to_solver(solver& s) {
+        if (m_best_version.load(std::memory_order_acquire) == s.m_par_best_version)
+            return;
         lock_guard lock(m_mux);
         _to_solver(s);
     }
 
+    /**
+       \brief publish the assignment of a local search thread if it 
+       improves on the best assignment found so far.
+     */
     void parallel::_to_solver(i_local_search& s) {        
-        return;
-#if 0
-        m_priorities.reset();
-        for (bool_var v = 0; m_solver_copy && v < m_solver_copy->num_vars(); ++v) {
-            m_priorities.push_back(s.get_priority(v));
-        }
-#endif
+        unsigned cost = s.get_model_cost();
+        if (cost >= m_best_cost.load(std::memory_order_relaxed))
+            return;
+        model const& mdl = s.get_model();
+        m_best_phase.reset();
+        for (lbool val : mdl)
+            m_best_phase.push_back(val == l_true);
+        m_best_cost.store(cost, std::memory_order_relaxed);
+        m_best_version.fetch_add(1, std::memory_order_release);
     }
 
     bool parallel::_from_solver(i_local_search& s) {
@@ -254,6 +361,8 @@ namespace sat {
     }
 
     void parallel::to_solver(i_local_search& s) {
+        if (s.get_model_cost() >= m_best_cost.load(std::memory_order_relaxed))
+            return;
         lock_guard lock(m_mux);
         _to_solver(s);               
     }
@@ -24,31 +24,37 @@ Revision History:
 #include "util/rlimit.h"
 #include "util/scoped_ptr_vector.h"
 #include "util/mutex.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 namespace sat {
 
     class parallel {
 
-        // shared pool of learned clauses.
-        class vector_pool {
-            unsigned_vector m_vectors;
-            unsigned        m_size{ 0 };
-            unsigned        m_tail{ 0 };
-            unsigned_vector m_heads;
-            bool_vector   m_at_end;
-            void next(unsigned& index);
-            unsigned get_owner(unsigned index) const { return m_vectors[index]; }
-            unsigned get_length(unsigned index) const { return m_vectors[index+1]; }
-            unsigned const* get_ptr(unsigned index) const { return m_vectors.data() + index + 2; }
+        // Single-producer ring buffer of shared clauses.
+        // Each worker exports into its own ring and consumers keep a private
+        // cursor per ring, so exchanging clauses does not take a lock.
+        // The producer publishes a reservation before overwriting entries;
+        // a consumer validates the reservation after copying a clause and 
+        // drops clauses that were overwritten while it was reading them.
+        class clause_ring {
+            std::atomic<unsigned>*  m_data      { nullptr };
+            unsigned                m_mask      { 0 };
+            std::atomic<uint64_t>   m_reserved  { 0 };
+            std::atomic<uint64_t>   m_published { 0 };
         public:
-            void reserve(unsigned num_owners, unsigned sz);
-            void begin_add_vector(unsigned owner, unsigned n);
-            void end_add_vector();
-            void add_vector_elem(unsigned e);
-            bool get_vector(unsigned owner, unsigned& n, unsigned const*& ptr);
+            ~clause_ring();
+            void reserve(unsigned sz);
+            unsigned capacity() const { return m_mask + 1; }
+            void push(unsigned n, literal const* lits);
+            // copy clauses published after cursor into out. 
+            // Returns false if there are no more clauses to retrieve.
+            bool get(uint64_t& cursor, literal_vector& out, unsigned& num_dropped) const;
         };
 
-        bool enable_add(clause const& c) const;
+        bool enable_add(solver const& s, clause const& c) const;
+        void export_clause(solver& s, unsigned n, literal const* lits);
         void _get_clauses(solver& s);
         void _from_solver(solver& s);
         void _to_solver(solver& s);
@@ -58,19 +64,47 @@ namespace sat {
         typedef hashtable<unsigned, u_hash, u_eq> index_set;
         literal_vector m_units;
         index_set      m_unit_set;
-        literal_vector m_lits;
-        vector_pool    m_pool;
         mutex          m_mux;
 
+        // lock-free clause exchange
+        scoped_ptr_vector<clause_ring> m_rings;
+        vector<svector<uint64_t>>      m_cursors;   // m_cursors[consumer][producer]
+        vector<literal_vector>         m_lits;      // scratch space per consumer
+        std::atomic<unsigned>          m_num_exported { 0 };
+        std::atomic<unsigned>          m_num_imported { 0 };
+        std::atomic<unsigned>          m_num_dropped  { 0 };
+
         // for exchange with local search:
         unsigned           m_num_clauses;
         scoped_ptr<solver> m_solver_copy;
         bool               m_consumer_ready;
         svector<double>    m_priorities;
 
+        // best assignment found by local search threads.
+        // Writers filter on m_best_cost before taking the lock, 
+        // readers compare m_best_version with the last version they imported.
+        bool_vector            m_best_phase;
+        std::atomic<unsigned>  m_best_cost    { UINT_MAX };
+        std::atomic<unsigned>  m_best_version { 0 };
+
         scoped_limits      m_scoped_rlimit;
         vector<reslimit>   m_limits;
         ptr_vector<solver> m_solvers;
+
+        // barrier for deterministic exchange.
+        // A round ends when every active solver arrived or finished.
+        // If a solver finished during the round, all solvers stop at its end.
+        std::mutex              m_sync_mux;
+        std::condition_variable m_sync_cv;
+        unsigned                m_num_active   { 0 };
+        unsigned                m_num_arrived  { 0 };
+        unsigned                m_num_finished { 0 };
+        uint64_t                m_round        { 0 };
+        bool                    m_stop         { false };
+        bool_vector             m_stopped;
+
+        bool barrier();
+        void end_round();
         
     public:
 
@@ -82,8 +116,8 @@ namespace sat {
 
         void push_child(reslimit& rl);
 
-        // reserve space
-        void reserve(unsigned num_owners, unsigned sz) { m_pool.reserve(num_owners, sz); }
+        // reserve space for a clause ring of sz literals per owner
+        void reserve(unsigned num_owners, unsigned sz);
 
         solver& get_solver(unsigned i) { return *m_solvers[i]; }
 
@@ -100,6 +134,18 @@ namespace sat {
         // receive clauses from shared clause pool
         void get_clauses(solver& s);
 
+        // deterministic exchange of units and clauses between num_solvers solvers.
+        void init_sync(unsigned num_solvers);
+
+        // wait for all active solvers, then import the units and clauses they published.
+        // Returns false if the solvers should stop because some solver finished.
+        bool sync(solver& s, literal_vector const& in, unsigned& limit, literal_vector& out);
+
+        // solver i returned from search.
+        void finish(unsigned i);
+
+        bool was_stopped(unsigned i) const { return m_stopped.get(i, false); }
+
         // exchange from solver state to local search and back.
         void from_solver(solver& s);
         void to_solver(solver& s);
@@ -28,8 +28,9 @@ namespace sat {
     */        
 
     vector<std::pair<unsigned, unsigned_vector>> proof_trim::trim() {
+        stop();
         m_result.reset();
-        m_propagated.resize(num_vars(), false);
+        m_propagated.resize(s.num_vars(), false);
 
 
         IF_VERBOSE(10, s.display(verbose_stream() << "trim\n"));
@@ -337,7 +338,112 @@ namespace sat {
         s.set_trim();
     }
 
-    void proof_trim::assume(unsigned id, bool is_initial) {
+    proof_trim::~proof_trim() {
+        try {
+            stop();
+        }
+        catch (z3_exception&) {
+        }
+    }
+
+    void proof_trim::updt_params(params_ref const& p) {
+        sync();
+        s.updt_params(p);
+    }
+
+    void proof_trim::push_step(step_kind k, unsigned id) {
+        step st { k, id, m_num_vars, m_input };
+#ifndef SINGLE_THREAD
+        if (m_concurrent) {
+            std::lock_guard<std::mutex> lock(m_mux);
+            if (!m_running) {
+                m_running = true;
+                m_thread = std::thread([this]() { replay(); });
+            }
+            m_queue.push_back(std::move(st));
+            m_cv.notify_all();
+            return;
+        }
+#endif
+        process(st);
+    }
+
+    void proof_trim::process(step const& st) {
+        while (s.num_vars() < st.m_num_vars)
+            s.mk_var(true, true);
+        m_clause.reset();
+        m_clause.append(st.m_clause);
+        switch (st.m_kind) {
+        case assume_step: do_assume(st.m_id, true); break;
+        case infer_step: do_assume(st.m_id, false); break;
+        case del_step: do_del(); break;
+        }
+    }
+
+    /**
+     * Background thread: replay queued proof steps in batches.
+     */
+    void proof_trim::replay() {
+#ifndef SINGLE_THREAD
+        vector<step> batch;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mux);
+                m_busy = false;
+                m_cv.notify_all();
+                m_cv.wait(lock, [&]() { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty())
+                    return;
+                batch.swap(m_queue);
+                m_busy = true;
+            }
+            try {
+                for (step const& st : batch) 
+                    if (!m_failed)
+                        process(st);
+            }
+            catch (z3_exception& ex) {
+                std::lock_guard<std::mutex> lock(m_mux);
+                m_failed = true;
+                m_ex_msg = ex.msg();
+            }
+            batch.reset();
+        }
+#endif
+    }
+
+    /**
+     * Wait until the background thread has replayed all queued steps.
+     */
+    void proof_trim::sync() {
+#ifndef SINGLE_THREAD
+        if (!m_running)
+            return;
+        std::unique_lock<std::mutex> lock(m_mux);
+        m_cv.wait(lock, [&]() { return m_queue.empty() && !m_busy; });
+#endif
+    }
+
+    void proof_trim::stop() {
+#ifndef SINGLE_THREAD
+        if (!m_running)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(m_mux);
+            m_stop = true;
+            m_cv.notify_all();
+        }
+        m_thread.join();
+        m_running = false;
+        m_stop = false;
+        if (m_failed) {
+            m_failed = false;
+            throw default_exception(std::move(m_ex_msg));
+        }
+#endif
+    }
+
+    void proof_trim::do_assume(unsigned id, bool is_initial) {
         std::sort(m_clause.begin(), m_clause.end()); 
         unsigned j = 0;
         sat::literal prev = null_literal;
@@ -416,13 +522,9 @@ namespace sat {
         return false;
     }
     
-    void proof_trim::del() {
+    void proof_trim::do_del() {
         std::sort(m_clause.begin(), m_clause.end());
         clause* cp = del(m_clause);
         m_trail.push_back({ 0, m_clause, cp, false, true });
     }
-    
-    void proof_trim::infer(unsigned id) {
-        assume(id, false);        
-    }
 }
@@ -14,7 +14,10 @@
     Nikolaj Bjorner 2023-10-04
 
   Notes:
-  
+
+    In concurrent mode, proof steps are queued by the producer and 
+    replayed by a background thread. When the empty clause is added
+    only the backward pass of trim remains.
 
 --*/
 
@@ -25,6 +28,11 @@
 #include "sat/sat_clause.h"
 #include "sat/sat_types.h"
 #include "sat/sat_solver.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
 
 namespace sat {
 
@@ -78,20 +86,55 @@ namespace sat {
         uint_set m_units;
         bool unit_or_binary_occurs();
         void set_conflict(literal_vector const& c, clause* cp) { m_conflict.reset(); m_conflict.append(c); m_conflict_clause = cp;}
+
+        enum step_kind { assume_step, infer_step, del_step };
+        struct step {
+            step_kind      m_kind;
+            unsigned       m_id;
+            unsigned       m_num_vars;
+            literal_vector m_clause;
+        };
+        literal_vector m_input;             // clause under construction by the producer
+        unsigned       m_num_vars = 0;      // variables created by the producer
+        bool           m_concurrent = false;
+        bool           m_running = false;
+        bool           m_stop = false;
+        bool           m_busy = false;
+        bool           m_failed = false;
+        std::string    m_ex_msg;
+        vector<step>   m_queue;
+#ifndef SINGLE_THREAD
+        std::mutex              m_mux;
+        std::condition_variable m_cv;
+        std::thread             m_thread;
+#endif
+
+        void push_step(step_kind k, unsigned id);
+        void process(step const& st);
+        void do_assume(unsigned id, bool is_initial);
+        void do_del();
+        void replay();
+        void sync();
+        void stop();
         
     public:
 
         proof_trim(params_ref const& p, reslimit& lim);
 
-        bool_var mk_var() { return s.mk_var(true, true); }
-        void init_clause() { m_clause.reset(); }
-        void add_literal(bool_var v, bool sign) { m_clause.push_back(literal(v, sign)); }
-        unsigned num_vars() { return s.num_vars(); }
+        ~proof_trim();
+
+        bool_var mk_var() { return m_num_vars++; }
+        void init_clause() { m_input.reset(); }
+        void add_literal(bool_var v, bool sign) { m_input.push_back(literal(v, sign)); }
+        unsigned num_vars() { return m_num_vars; }
+
+        void assume(unsigned id, bool is_initial = true) { push_step(is_initial ? assume_step : infer_step, id); }
+        void del() { push_step(del_step, 0); }
+        void infer(unsigned id) { push_step(infer_step, id); }
+        void updt_params(params_ref const& p);
 
-        void assume(unsigned id, bool is_initial = true);
-        void del();
-        void infer(unsigned id);
-        void updt_params(params_ref const& p) { s.updt_params(p); }
+        // replay proof steps on a background thread.
+        void set_concurrent(bool b) { m_concurrent = b; }
 
         vector<std::pair<unsigned, unsigned_vector>> trim();
 
@@ -24,7 +24,11 @@ Revision History:
 #include "sat/sat_elim_vars.h"
 #include "sat/sat_integrity_checker.h"
 #include "util/stopwatch.h"
+#include "util/scoped_ptr_vector.h"
 #include "util/trace.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
 
 namespace sat {
 
@@ -39,6 +43,12 @@ namespace sat {
             m_use_list[l.index()].insert(c);
     }
 
+    void use_list::insert(clause & c, unsigned lo, unsigned hi) {
+        for (literal l : c) 
+            if (lo <= l.index() && l.index() < hi)
+                m_use_list[l.index()].insert(c);
+    }
+
     void use_list::erase(clause & c) {
         for (literal l : c) 
             m_use_list[l.index()].erase(c);
@@ -120,6 +130,31 @@ namespace sat {
 
     void simplifier::register_clauses(clause_vector & cs) {
         std::stable_sort(cs.begin(), cs.end(), size_lt());
+#ifndef SINGLE_THREAD
+        if (m_res_threads > 1 && cs.size() >= 100000) {
+            // each thread owns a range of literals, so every occurrence list
+            // is filled by one thread in clause order.
+            unsigned num_threads = m_res_threads;
+            unsigned num_lits = 2 * s.num_vars();
+            auto insert = [&](unsigned id) {
+                unsigned lo = (num_lits / num_threads) * id;
+                unsigned hi = id + 1 == num_threads ? num_lits : (num_lits / num_threads) * (id + 1);
+                for (clause* c : cs)
+                    if (!c->frozen())
+                        m_use_list.insert(*c, lo, hi);
+            };
+            vector<std::thread> threads;
+            for (unsigned id = 1; id < num_threads; ++id)
+                threads.push_back(std::thread([&, id]() { insert(id); }));
+            insert(0);
+            for (auto& th : threads)
+                th.join();
+            for (clause* c : cs)
+                if (!c->frozen() && c->strengthened())
+                    m_sub_todo.insert(*c);
+            return;
+        }
+#endif
         for (clause* c : cs) {
             if (!c->frozen()) {
                 m_use_list.insert(*c);
@@ -1807,9 +1842,13 @@ namespace sat {
        Return false if the result is a tautology
     */
     bool simplifier::resolve(clause_wrapper const & c1, clause_wrapper const & c2, literal l, literal_vector & r) {
+        return resolve(c1, c2, l, r, m_visited, m_elim_counter);
+    }
+
+    bool simplifier::resolve(clause_wrapper const & c1, clause_wrapper const & c2, literal l, literal_vector & r, svector<char>& visited, int& counter) const {
         CTRACE("resolve_bug", !c1.contains(l) || !c2.contains(~l), tout << c1 << "\n" << c2 << "\nl: " << l << "\n";);
-        if (m_visited.size() <= 2*s.num_vars())
-            m_visited.resize(2*s.num_vars(), false);
+        if (visited.size() <= 2*s.num_vars())
+            visited.resize(2*s.num_vars(), false);
         if (c1.was_removed() && !c1.contains(l))
             return false;
         if (c2.was_removed() && !c2.contains(~l))
@@ -1817,13 +1856,13 @@ namespace sat {
         SASSERT(c1.contains(l));
         SASSERT(c2.contains(~l));
         bool res = true;
-        m_elim_counter -= c1.size() + c2.size();
+        counter -= c1.size() + c2.size();
         unsigned sz1 = c1.size();
         for (unsigned i = 0; i < sz1; ++i) {
             literal l1 = c1[i];
             if (l == l1)
                 continue;
-            m_visited[l1.index()] = true;
+            visited[l1.index()] = true;
             r.push_back(l1);
         }
 
@@ -1833,21 +1872,21 @@ namespace sat {
             literal l2 = c2[i];
             if (not_l == l2)
                 continue;
-            if ((~l2).index() >= m_visited.size()) {
-                //s.display(std::cout << l2 << " " << s.num_vars() << " " << m_visited.size() << "\n");
+            if ((~l2).index() >= visited.size()) {
+                //s.display(std::cout << l2 << " " << s.num_vars() << " " << visited.size() << "\n");
                 UNREACHABLE();
             }
-            if (m_visited[(~l2).index()]) {
+            if (visited[(~l2).index()]) {
                 res = false;
                 break;
             }
-            if (!m_visited[l2.index()])
+            if (!visited[l2.index()])
                 r.push_back(l2);
         }
 
         for (unsigned i = 0; i < sz1; ++i) {
             literal l1 = c1[i];
-            m_visited[l1.index()] = false;
+            visited[l1.index()] = false;
         }
         return res;
     }
@@ -1914,6 +1953,19 @@ namespace sat {
     }
 
     bool simplifier::try_eliminate(bool_var v) {
+        if (!check_eliminate(v, m_pos_cls, m_neg_cls, m_new_cls, m_visited, m_elim_counter))
+            return false;
+        return eliminate(v);
+    }
+
+    /**
+       \brief Check whether eliminating v by resolution does not increase the number of clauses.
+       The clauses containing v are collected in pos_cls and neg_cls.
+       The check only reads the clause database and uses the caller supplied scratch space,
+       so it can run concurrently for different variables while the database is not updated.
+    */
+    bool simplifier::check_eliminate(bool_var v, clause_wrapper_vector& pos_cls, clause_wrapper_vector& neg_cls,
+                                     literal_vector& new_cls, svector<char>& visited, int& counter) {
         if (value(v) != l_undef)
             return false;
 
@@ -1954,20 +2006,20 @@ namespace sat {
             s.m_clauses.size() <= m_res_cls_cutoff1)
             return false;
 
-        m_pos_cls.reset();
-        m_neg_cls.reset();
-        collect_clauses(pos_l, m_pos_cls);
-        collect_clauses(neg_l, m_neg_cls);
+        pos_cls.reset();
+        neg_cls.reset();
+        collect_clauses(pos_l, pos_cls);
+        collect_clauses(neg_l, neg_cls);
 
         TRACE("sat_simplifier", tout << "collecting number of after_clauses\n";);
         unsigned before_clauses = num_pos + num_neg;
         unsigned after_clauses  = 0;
-        for (clause_wrapper& c1 : m_pos_cls) {
-            for (clause_wrapper& c2 : m_neg_cls) {
-                m_new_cls.reset();
-                if (resolve(c1, c2, pos_l, m_new_cls)) {
+        for (clause_wrapper& c1 : pos_cls) {
+            for (clause_wrapper& c2 : neg_cls) {
+                new_cls.reset();
+                if (resolve(c1, c2, pos_l, new_cls, visited, counter)) {
                     TRACE("sat_simplifier", tout << c1 << "\n" << c2 << "\n-->\n";
-                          for (literal l : m_new_cls) tout << l << " "; tout << "\n";);
+                          for (literal l : new_cls) tout << l << " "; tout << "\n";);
                     after_clauses++;
                     if (after_clauses > before_clauses) {
                         TRACE("sat_simplifier", tout << "too many after clauses: " << after_clauses << "\n";);
@@ -1978,15 +2030,29 @@ namespace sat {
         }
         TRACE("sat_simplifier", tout << "eliminate " << v << ", before: " << before_clauses << " after: " << after_clauses << "\n";
               tout << "pos\n";
-              for (auto & c : m_pos_cls) 
+              for (auto & c : pos_cls) 
                   tout << c << "\n";
               tout << "neg\n";
-              for (auto & c : m_neg_cls) 
+              for (auto & c : neg_cls) 
                   tout << c << "\n";
               );
-        m_elim_counter -= num_pos * num_neg + before_lits;
+        counter -= 2 * (num_pos * num_neg + before_lits);
+        return true;
+    }
 
-        m_elim_counter -= num_pos * num_neg + before_lits;
+    /**
+       \brief Eliminate v by resolving the clauses collected in m_pos_cls and m_neg_cls.
+    */
+    bool simplifier::eliminate(bool_var v) {
+        literal pos_l(v, false);
+        literal neg_l(v, true);
+        unsigned num_pos = m_pos_cls.size();
+        unsigned num_neg = m_neg_cls.size();
+        unsigned before_lits = 0;
+        for (auto const& c : m_pos_cls)
+            before_lits += c.size();
+        for (auto const& c : m_neg_cls)
+            before_lits += c.size();
 
         // eliminate variable
         ++s.m_stats.m_elim_var_res;
@@ -2081,6 +2147,15 @@ namespace sat {
         bool_var_vector vars;
         order_vars_for_elim(vars);
         sat::elim_vars elim_bdd(*this);
+#ifndef SINGLE_THREAD
+        if (m_res_threads > 1 && vars.size() >= m_res_threads * 64) {
+            elim_vars_parallel(vars, elim_bdd);
+            m_pos_cls.finalize();
+            m_neg_cls.finalize();
+            m_new_cls.finalize();
+            return;
+        }
+#endif
         for (bool_var v : vars) {
             checkpoint();
             if (m_elim_counter < 0) 
@@ -2101,6 +2176,148 @@ namespace sat {
         m_new_cls.finalize();
     }
 
+#ifndef SINGLE_THREAD
+    struct simplifier::elim_candidate {
+        bool_var              m_var;
+        bool                  m_ok = false;
+        int                   m_counter = 0;
+        elim_candidate(bool_var v): m_var(v) {}
+    };
+
+    struct simplifier::elim_worker {
+        clause_wrapper_vector m_pos_cls;
+        clause_wrapper_vector m_neg_cls;
+        literal_vector        m_new_cls;
+        svector<char>         m_visited;
+    };
+
+    /**
+       \brief Mark the variables occurring in clauses with v or ~v.
+       Return false if one of them was already marked in the current round.
+    */
+    bool simplifier::mark_elim_neighbors(bool_var v, unsigned stamp) {
+        m_elim_neighbors.reset();
+        auto visit = [&](bool_var w) {
+            if (m_elim_stamp[w] == stamp)
+                return false;
+            if (m_elim_stamp[w] != stamp + 1) {
+                m_elim_stamp[w] = stamp + 1;
+                m_elim_neighbors.push_back(w);
+            }
+            return true;
+        };
+        bool ok = true;
+        for (unsigned sign = 0; ok && sign < 2; ++sign) {
+            literal l(v, sign != 0);
+            for (auto it = m_use_list.get(l).mk_iterator(); ok && !it.at_end(); it.next())
+                for (literal l2 : it.curr())
+                    if (!visit(l2.var())) {
+                        ok = false;
+                        break;
+                    }
+            for (watched const& w : get_wlist(~l))
+                if (ok && w.is_binary_clause())
+                    ok = visit(w.get_literal().var());
+        }
+        for (bool_var w : m_elim_neighbors)
+            m_elim_stamp[w] = ok ? stamp : 0;
+        return ok;
+    }
+
+    /**
+       \brief Bounded variable elimination with the profitability checks spread over threads.
+
+       Candidates are grouped into rounds of variables whose neighborhoods
+       (variables sharing a clause with them) are pairwise disjoint. Resolving
+       on one variable of a round then only produces and subsumes clauses over its own
+       neighborhood, so the checks computed for the other variables in the round stay valid.
+       The checks run concurrently on a read-only clause database; the eliminations,
+       model converter entries and clause additions are then applied sequentially in
+       candidate order, so the result does not depend on thread scheduling.
+    */
+    void simplifier::elim_vars_parallel(bool_var_vector const& vars, sat::elim_vars& elim_bdd) {
+        unsigned num_threads = m_res_threads;
+        unsigned const round_size = 256 * num_threads;
+        m_elim_stamp.reset();
+        m_elim_stamp.resize(s.num_vars(), 0);
+        scoped_ptr_vector<elim_worker> workers;
+        for (unsigned i = 0; i < num_threads; ++i)
+            workers.push_back(alloc(elim_worker));
+        vector<elim_candidate> round;
+        bool_var_vector todo(vars), deferred;
+        unsigned stamp = 1;
+        while (!todo.empty()) {
+            round.reset();
+            deferred.reset();
+            stamp += 2;
+            for (bool_var v : todo) {
+                if (round.size() >= round_size || is_external(v) || was_eliminated(v) || value(v) != l_undef || !mark_elim_neighbors(v, stamp))
+                    deferred.push_back(v);
+                else
+                    round.push_back(elim_candidate(v));
+            }
+            if (round.empty())
+                break;
+            // external, eliminated and assigned variables are not retried.
+            unsigned j = 0;
+            for (bool_var v : deferred)
+                if (!is_external(v) && !was_eliminated(v) && value(v) == l_undef)
+                    deferred[j++] = v;
+            deferred.shrink(j);
+
+            auto check = [&](unsigned id) {
+                elim_worker& w = *workers[id];
+                for (unsigned i = id; i < round.size(); i += num_threads) {
+                    elim_candidate& c = round[i];
+                    c.m_ok = check_eliminate(c.m_var, w.m_pos_cls, w.m_neg_cls, w.m_new_cls, w.m_visited, c.m_counter);
+                }
+            };
+            vector<std::thread> threads;
+            for (unsigned id = 1; id < num_threads; ++id)
+                threads.push_back(std::thread([&, id]() { check(id); }));
+            check(0);
+            for (auto& th : threads)
+                th.join();
+
+            // units derived while applying the round may propagate into other
+            // neighborhoods; the remaining candidates are then checked again.
+            unsigned trail_sz = s.m_trail.size();
+            for (elim_candidate const& c : round) {
+                checkpoint();
+                if (m_elim_counter < 0)
+                    return;
+                bool_var v = c.m_var;
+                if (s.m_trail.size() != trail_sz) {
+                    if (was_eliminated(v))
+                        continue;
+                    if (try_eliminate(v))
+                        m_num_elim_vars++;
+                    else if (elim_vars_bdd_enabled() && elim_bdd(v))
+                        m_num_elim_vars++;
+                }
+                else if (c.m_ok) {
+                    m_elim_counter += c.m_counter;
+                    literal pos_l(v, false);
+                    m_pos_cls.reset();
+                    m_neg_cls.reset();
+                    collect_clauses(pos_l, m_pos_cls);
+                    collect_clauses(~pos_l, m_neg_cls);
+                    eliminate(v);
+                    m_num_elim_vars++;
+                }
+                else {
+                    m_elim_counter += c.m_counter;
+                    if (elim_vars_bdd_enabled() && elim_bdd(v))
+                        m_num_elim_vars++;
+                }
+                if (s.inconsistent())
+                    return;
+            }
+            todo.swap(deferred);
+        }
+    }
+#endif
+
     void simplifier::updt_params(params_ref const & _p) {
         sat_simplifier_params p(_p);
         m_cce                     = p.cce();
@@ -2126,6 +2343,7 @@ namespace sat {
         m_subsumption             = p.subsumption();
         m_subsumption_limit       = p.subsumption_limit();
         m_elim_vars               = p.elim_vars();
+        m_res_threads             = p.resolution_threads();
         m_elim_vars_bdd           = false && p.elim_vars_bdd(); // buggy?
         m_elim_vars_bdd_delay     = p.elim_vars_bdd_delay();
         m_incremental_mode        = s.get_config().m_incremental && !p.override_incremental();
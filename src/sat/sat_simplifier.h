@@ -37,6 +37,7 @@ namespace pb {
 
 namespace sat {
     class solver;
+    class elim_vars;
 
     class use_list {
         vector<clause_use_list> m_use_list;
@@ -45,6 +46,7 @@ namespace sat {
         void init(unsigned num_vars);
         void reserve(unsigned num_vars) { while (m_use_list.size() <= 2*num_vars) m_use_list.push_back(clause_use_list()); }
         void insert(clause & c);
+        void insert(clause & c, unsigned lo, unsigned hi);
         void block(clause & c);
         void unblock(clause & c);
         void erase(clause & c);
@@ -105,6 +107,7 @@ namespace sat {
         bool                   m_elim_vars;
         bool                   m_elim_vars_bdd;
         unsigned               m_elim_vars_bdd_delay;
+        unsigned               m_res_threads;
 
         // stats
         unsigned               m_num_bce;
@@ -199,13 +202,24 @@ namespace sat {
         clause_wrapper_vector m_neg_cls;
         literal_vector m_new_cls;
         bool resolve(clause_wrapper const & c1, clause_wrapper const & c2, literal l, literal_vector & r);
+        bool resolve(clause_wrapper const & c1, clause_wrapper const & c2, literal l, literal_vector & r, svector<char>& visited, int& counter) const;
         void save_clauses(model_converter::entry & mc_entry, clause_wrapper_vector const & cs);
         void add_non_learned_binary_clause(literal l1, literal l2);
         void remove_bin_clauses(literal l);
         void remove_clauses(clause_use_list const & cs, literal l);
         bool try_eliminate(bool_var v);
+        bool check_eliminate(bool_var v, clause_wrapper_vector& pos_cls, clause_wrapper_vector& neg_cls,
+                             literal_vector& new_cls, svector<char>& visited, int& counter);
+        bool eliminate(bool_var v);
         void elim_vars();
 
+        struct elim_candidate;
+        struct elim_worker;
+        svector<unsigned>      m_elim_stamp;
+        bool_var_vector        m_elim_neighbors;
+        bool mark_elim_neighbors(bool_var v, unsigned stamp);
+        void elim_vars_parallel(bool_var_vector const& vars, sat::elim_vars& elim_bdd);
+
         struct blocked_cls_report;
         struct subsumption_report;
         struct elim_var_report;
@@ -30,8 +30,10 @@ Revision History:
 #include "sat/sat_integrity_checker.h"
 #include "sat/sat_lookahead.h"
 #include "sat/sat_ddfw.h"
+#include "sat/sat_cube_and_conquer.h"
 #include "sat/sat_prob.h"
 #include "sat/sat_anf_simplifier.h"
+#include "sat/sat_xor_simplifier.h"
 #include "sat/sat_cut_simplifier.h"
 #if defined(_MSC_VER) && !defined(_M_ARM) && !defined(_M_ARM64)
 # include <xmmintrin.h>
@@ -75,6 +77,7 @@ namespace sat {
         init_reason_unknown();
         updt_params(p);
         m_best_phase_size         = 0;
+        m_target_phase_size       = 0;
         m_conflicts_since_gc      = 0;
         m_conflicts_since_init    = 0;
         m_next_simplify           = 0;
@@ -134,6 +137,7 @@ namespace sat {
         m_best_phase.reset();
         m_phase.reset();
         m_prev_phase.reset();
+        m_target_phase.reset();
         m_assigned_since_gc.reset();
         m_last_conflict.reset();
         m_last_propagation.reset();
@@ -141,6 +145,7 @@ namespace sat {
         m_canceled.reset();
         m_reasoned.reset();
         m_case_split_queue.reset();
+        m_vmtf_queue.reset();
         m_simplifier.reset_todos();
         m_qhead = 0;
         m_trail.reset();
@@ -163,6 +168,7 @@ namespace sat {
             m_phase[v] = src.m_phase[v];
             m_best_phase[v] = src.m_best_phase[v];
             m_prev_phase[v] = src.m_prev_phase[v];
+            m_target_phase[v] = src.m_target_phase[v];
 
             // inherit activity:
             m_activity[v] = src.m_activity[v];
@@ -269,6 +275,7 @@ namespace sat {
         m_phase[v] = false;
         m_best_phase[v] = false;
         m_prev_phase[v] = false;
+        m_target_phase[v] = false;
         m_assigned_since_gc[v] = false;
         m_last_conflict[v] = 0;        
         m_last_propagation[v] = 0;
@@ -276,6 +283,7 @@ namespace sat {
         m_canceled[v] = 0;
         m_reasoned[v] = 0;
         m_case_split_queue.mk_var_eh(v);
+        m_vmtf_queue.mk_var_eh(v);
         m_simplifier.insert_elim_todo(v);
     }
 
@@ -310,6 +318,7 @@ namespace sat {
         m_phase.push_back(false);
         m_best_phase.push_back(false);
         m_prev_phase.push_back(false);
+        m_target_phase.push_back(false);
         m_assigned_since_gc.push_back(false);
         m_last_conflict.push_back(0);
         m_last_propagation.push_back(0);
@@ -317,6 +326,7 @@ namespace sat {
         m_canceled.push_back(0);
         m_reasoned.push_back(0);
         m_case_split_queue.mk_var_eh(v);
+        m_vmtf_queue.mk_var_eh(v);
         m_simplifier.insert_elim_todo(v);
         SASSERT(!was_eliminated(v));
         return v;
@@ -343,6 +353,7 @@ namespace sat {
 
     clause* solver::mk_clause(unsigned num_lits, literal * lits, sat::status st) {
         m_model_is_current = false;
+        m_assumption_trail_lim.reset();
             
 
         DEBUG_CODE({
@@ -363,6 +374,60 @@ namespace sat {
         }
     }
 
+    /**
+       \brief Bulk import of input clauses. At the base level, without user scopes
+       and proof logging, clauses are simplified once and attached directly,
+       bypassing the checks in mk_clause_core that only apply to search.
+       Clauses are allocated in sequence by the clause allocator.
+    */
+    void solver::add_clauses(unsigned num_lits, literal const* lits) {
+        m_model_is_current = false;
+        m_assumption_trail_lim.reset();
+        bool bulk = at_base_lvl() && m_user_scope_literals.empty() && !m_config.m_drat && !m_trim;
+        sat::status st = sat::status::asserted();
+        unsigned i = 0;
+        while (i < num_lits && !inconsistent()) {
+            m_bulk_literals.reset();
+            for (; i < num_lits && lits[i] != null_literal; ++i)
+                m_bulk_literals.push_back(lits[i]);
+            ++i;
+            unsigned sz = m_bulk_literals.size();
+            literal* ls = m_bulk_literals.data();
+            if (!bulk) {
+                mk_clause(sz, ls, st);
+                continue;
+            }
+            if (!simplify_clause(sz, ls))
+                continue;
+            ++m_stats.m_non_learned_generation;
+            if (!m_searching)
+                m_mc.add_clause(sz, ls);
+            switch (sz) {
+            case 0:
+                set_conflict();
+                break;
+            case 1:
+                assign_unit(ls[0]);
+                break;
+            case 2:
+                mk_bin_clause(ls[0], ls[1], st);
+                break;
+            default: {
+                m_stats.m_mk_clause++;
+                clause* c = alloc_clause(sz, ls, false);
+                clause_offset cls_off = cls_allocator().get_offset(c);
+                literal block_lit = (*c)[sz >> 1];
+                m_watches[(~(*c)[0]).index()].push_back(watched(block_lit, cls_off));
+                m_watches[(~(*c)[1]).index()].push_back(watched(block_lit, cls_off));
+                m_clauses.push_back(c);
+                for (unsigned k = 0; k < sz; ++k)
+                    m_touched[ls[k].var()] = m_touch_index;
+                break;
+            }
+            }
+        }
+    }
+
     clause* solver::mk_clause(literal l1, literal l2, sat::status st) {
         literal ls[2] = { l1, l2 };
         return mk_clause(2, ls, st);
@@ -657,14 +722,17 @@ namespace sat {
 
     bool solver::should_defrag() {
         if (m_defrag_threshold > 0) --m_defrag_threshold;
-        return m_defrag_threshold == 0 && m_config.m_gc_defrag;
+        return 
+            m_defrag_threshold == 0 && m_config.m_gc_defrag && 
+            cls_allocator().get_fragmentation() >= m_config.m_gc_defrag_ratio;
     }
 
     void solver::defrag_clauses() {
         m_defrag_threshold = 2;
         if (memory_pressure()) return;
         pop(scope_lvl());
-        IF_VERBOSE(2, verbose_stream() << "(sat-defrag)\n");
+        IF_VERBOSE(2, verbose_stream() << "(sat-defrag :fragmentation " << cls_allocator().get_fragmentation() << ")\n");
+        m_stats.m_defrag++;
         clause_allocator& alloc = m_cls_allocator[!m_cls_allocator_idx];
         ptr_vector<clause> new_clauses, new_learned;
         for (clause* c : m_clauses) c->unmark_used();
@@ -904,6 +972,7 @@ namespace sat {
         
         switch (m_config.m_branching_heuristic) {
         case BH_VSIDS: 
+        case BH_VMTF:
             break;
         case BH_CHB:
             m_last_propagation[v] = m_stats.m_conflict;
@@ -920,15 +989,8 @@ namespace sat {
             }
         }
         
-        if (m_config.m_propagate_prefetch) {
-#if defined(__GNUC__) || defined(__clang__)
-            __builtin_prefetch((const char*)((m_watches[l.index()].data())));
-#else
-    #if !defined(_M_ARM) && !defined(_M_ARM64)
-            _mm_prefetch((const char*)((m_watches[l.index()].data())), _MM_HINT_T1);
-    #endif
-#endif
-        }
+        if (m_config.m_propagate_prefetch) 
+            prefetch(m_watches[l.index()].data());
 
         SASSERT(!l.sign() || !m_phase[v]);
         SASSERT(l.sign()  || m_phase[v]);
@@ -938,6 +1000,16 @@ namespace sat {
         SASSERT(value(~l) == l_false);
     }
 
+    void solver::prefetch(void const* p) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch((const char*)p);
+#else
+    #if !defined(_M_ARM) && !defined(_M_ARM64)
+        _mm_prefetch((const char*)p, _MM_HINT_T1);
+    #endif
+#endif
+    }
+
     lbool solver::status(clause const & c) const {
         bool found_undef = false;
         for (literal lit : c) {
@@ -1027,12 +1099,16 @@ namespace sat {
         watch_list::iterator it = wlist.begin();
         watch_list::iterator it2 = it;
         watch_list::iterator end = wlist.end();
+        bool prefetch_clauses = m_config.m_propagate_prefetch;
 #define CONFLICT_CLEANUP() {                    \
                 for (; it != end; ++it, ++it2)  \
                     *it2 = *it;                 \
                 wlist.set_end(it2);             \
             }
         for (; it != end; ++it) {
+            // fetch the clause of the next watch while the current watch is processed.
+            if (prefetch_clauses && it + 1 != end && (it + 1)->is_clause() && value((it + 1)->get_blocked_literal()) != l_true) 
+                prefetch(&get_clause((it + 1)->get_clause_offset()));
             switch (it->get_kind()) {
             case watched::BINARY:
                 l1 = it->get_literal();
@@ -1226,10 +1302,12 @@ namespace sat {
     // -----------------------
     lbool solver::check(unsigned num_lits, literal const* lits) {
         init_reason_unknown();
-        pop_to_base_level();
+        bool reuse = reuse_assumption_trail(num_lits, lits);
+        if (!reuse)
+            pop_to_base_level();
         m_stats.m_units = init_trail_size();
         IF_VERBOSE(2, verbose_stream() << "(sat.solver)\n";);
-        SASSERT(at_base_lvl());
+        SASSERT(reuse || at_base_lvl());
 
         if (m_config.m_ddfw_search) {
             m_cleaner(true);
@@ -1243,6 +1321,10 @@ namespace sat {
             m_cleaner(true);
             return do_local_search(num_lits, lits);
         }
+        if (m_config.m_cube_and_conquer && num_lits == 0 && !m_par && !m_ext) {
+            m_cleaner(true);
+            return do_cube_and_conquer();
+        }
         if ((m_config.m_num_threads > 1 || m_config.m_local_search_threads > 0 || 
              m_config.m_ddfw_threads > 0) && !m_par && !m_ext) {
             SASSERT(scope_lvl() == 0);
@@ -1261,7 +1343,12 @@ namespace sat {
             if (check_inconsistent()) return l_false;
             propagate(false);
             if (check_inconsistent()) return l_false;
-            init_assumptions(num_lits, lits);
+            if (reuse) {
+                m_search_lvl = scope_lvl();
+                assign_assumptions(m_assumptions.size(), num_lits, lits);
+            }
+            else 
+                init_assumptions(num_lits, lits);
             propagate(false);
             if (check_inconsistent()) return l_false;
             if (m_config.m_force_cleanup) do_cleanup(true);
@@ -1436,6 +1523,11 @@ namespace sat {
         return invoke_local_search(num_lits, lits);
     }
 
+    lbool solver::do_cube_and_conquer() {
+        cube_and_conquer cc(*this);
+        return cc();
+    }
+
     lbool solver::do_ddfw_search(unsigned num_lits, literal const* lits) {
         if (m_ext) return l_undef;
         SASSERT(!m_local_search);
@@ -1465,9 +1557,10 @@ namespace sat {
 
         scoped_ptr_vector<i_local_search> ls;
         scoped_ptr_vector<solver> uw;
+        bool deterministic = m_config.m_par_deterministic;
         int num_extra_solvers = m_config.m_num_threads - 1;
-        int num_local_search  = static_cast<int>(m_config.m_local_search_threads);
-        int num_ddfw      = m_ext ? 0 : static_cast<int>(m_config.m_ddfw_threads);
+        int num_local_search  = deterministic ? 0 : static_cast<int>(m_config.m_local_search_threads);
+        int num_ddfw      = (m_ext || deterministic) ? 0 : static_cast<int>(m_config.m_ddfw_threads);
         int num_threads = num_extra_solvers + 1 + num_local_search + num_ddfw;        
         for (int i = 0; i < num_local_search; ++i) {
             local_search* l = alloc(local_search);
@@ -1496,6 +1589,8 @@ namespace sat {
         sat::parallel par(*this);
         par.reserve(num_threads, 1 << 12);
         par.init_solvers(*this, num_extra_solvers);
+        if (deterministic)
+            par.init_sync(num_extra_solvers + 1);
         for (unsigned i = 0; i < ls.size(); ++i) {
             par.push_child(ls[i]->rlimit());
         }
@@ -1512,6 +1607,8 @@ namespace sat {
         lbool result = l_undef;
         bool canceled = false;
         std::mutex mux;
+        svector<lbool> results(num_threads, l_undef);
+        bool_vector finished(num_threads, false);
 
         auto worker_thread = [&](int i) {
             try {
@@ -1525,6 +1622,13 @@ namespace sat {
                 else {
                     r = check(num_lits, lits);
                 }
+                if (deterministic) {
+                    // the result is chosen after all threads stopped at the same synchronization point.
+                    results[i] = r;
+                    finished[i] = true;
+                    par.finish(i);
+                    return;
+                }
                 bool first = false;
                 {
                     std::lock_guard<std::mutex> lock(mux);
@@ -1555,13 +1659,17 @@ namespace sat {
                 }
             }
             catch (z3_error & err) {
+                std::lock_guard<std::mutex> lock(mux);
                 error_code = err.error_code();
                 ex_kind = ERROR_EX;                
             }
             catch (z3_exception & ex) {
+                std::lock_guard<std::mutex> lock(mux);
                 ex_msg = ex.msg();
                 ex_kind = DEFAULT_EX;    
             }
+            if (deterministic && !finished[i])
+                par.finish(i);
         };
 
         if (!rlimit().inc()) {
@@ -1576,6 +1684,17 @@ namespace sat {
         for (auto & th : threads) {
             th.join();
         }
+        if (deterministic) {
+            // prefer the solver with the smallest index that found a result.
+            for (int i = 0; i < num_threads && finished_id == -1; ++i) 
+                if (finished[i] && results[i] != l_undef) 
+                    finished_id = i;
+            for (int i = 0; i < num_threads && finished_id == -1; ++i) 
+                if (finished[i] && !par.was_stopped(i)) 
+                    finished_id = i;
+            if (finished_id != -1)
+                result = results[finished_id];
+        }
         
         if (IS_AUX_SOLVER(finished_id)) {
             m_stats = par.get_solver(finished_id).m_stats;
@@ -1611,6 +1730,10 @@ namespace sat {
       \brief import lemmas/units from parallel sat solvers.
      */
     void solver::exchange_par() {
+        if (m_par && at_base_lvl() && m_config.m_num_threads > 1 && m_config.m_par_deterministic) {
+            exchange_par_sync();
+            return;
+        }
         if (m_par && at_base_lvl() && m_config.m_num_threads > 1) m_par->get_clauses(*this);
         if (m_par && at_base_lvl() && m_config.m_num_threads > 1) {
             // SASSERT(scope_lvl() == search_lvl());
@@ -1641,13 +1764,46 @@ namespace sat {
         }
     }
 
+    /*
+      \brief deterministic exchange with parallel sat solvers.
+      Solvers synchronize each time they performed threads.sync_conflicts conflicts.
+     */
+    void solver::exchange_par_sync() {
+        if (m_stats.m_conflict < m_par_next_sync)
+            return;
+        m_par_next_sync = m_stats.m_conflict + m_config.m_par_sync_conflicts;
+        unsigned sz = init_trail_size();
+        literal_vector in, out;
+        for (unsigned i = m_par_limit_out; i < sz; ++i) {
+            literal lit = m_trail[i];
+            if (lit.var() < m_par_num_vars)
+                out.push_back(lit);
+        }
+        m_par_limit_out = sz;
+        if (!m_par->sync(*this, out, m_par_limit_in, in)) {
+            set_canceled();
+            return;
+        }
+        unsigned num_in = 0;
+        for (unsigned i = 0; !inconsistent() && i < in.size(); ++i) {
+            literal lit = in[i];
+            if (lvl(lit.var()) != 0 || value(lit) != l_true) {
+                ++num_in;
+                assign_unit(lit);
+            }
+        }
+        IF_VERBOSE(2, verbose_stream() << "(sat-sync " << m_par_id << " :conflicts " << m_stats.m_conflict << " out: " << out.size() << " in: " << num_in << ")\n";);
+    }
+
     void solver::set_par(parallel* p, unsigned id) {
         m_par = p;
+        m_par_next_sync = m_stats.m_conflict + m_config.m_par_sync_conflicts;
         m_par_num_vars = num_vars();
         m_par_limit_in = 0;
         m_par_limit_out = 0;
         m_par_id = id; 
         m_par_syncing_clauses = false;
+        m_par_best_version = 0;
     }
 
     bool_var solver::next_var() {
@@ -1662,6 +1818,9 @@ namespace sat {
                 return next;
         }
 
+        if (use_vmtf()) 
+            return m_vmtf_queue.next_var([&](bool_var v) { return value(v) == l_undef && !was_eliminated(v); });
+
         while (!m_case_split_queue.empty()) {
             if (m_config.m_anti_exploration) {
                 next = m_case_split_queue.min_var();
@@ -1699,6 +1858,8 @@ namespace sat {
         case PS_LOCAL_SEARCH:
             if (m_search_state == s_unsat)
                 return m_phase[next];
+            if (m_config.m_mode_switch)
+                return m_target_phase[next];
             return m_best_phase[next];
         case PS_RANDOM:
             return (m_rand() % 2) == 0;
@@ -1852,16 +2013,80 @@ namespace sat {
             assign_scoped(nlit);
         }
 
-        for (unsigned i = 0; !inconsistent() && i < num_lits; ++i) {
+        m_assumption_trail_lim.reset();
+        assign_assumptions(0, num_lits, lits);
+
+        m_search_lvl = scope_lvl(); 
+        SASSERT(m_search_lvl == 1);
+    }
+
+    /**
+       \brief Assign the assumptions lits[start..num_lits). When assumptions.reuse_trail
+       is enabled, each assumption is propagated before the next one is assigned
+       and the trail size is recorded, so that a later check can keep the
+       assignment of a common prefix of the assumptions.
+    */
+    void solver::assign_assumptions(unsigned start, unsigned num_lits, literal const* lits) {
+        for (unsigned i = start; !inconsistent() && i < num_lits; ++i) {
             literal lit = lits[i];
             set_external(lit.var());
             SASSERT(is_external(lit.var()));
             add_assumption(lit);
             assign_scoped(lit);
+            if (m_config.m_reuse_trail && propagate(false))
+                m_assumption_trail_lim.push_back(m_trail.size());
         }
+    }
 
-        m_search_lvl = scope_lvl(); 
-        SASSERT(m_search_lvl == 1);
+    /**
+       \brief Backtrack to the assignment of the longest prefix of lits that was 
+       assumed and propagated in the previous check. The trail above the prefix 
+       is undone without leaving the assumption level, so the prefix is neither
+       re-assigned nor re-propagated. 
+       Return false if nothing can be reused, in which case the caller backtracks
+       to the base level.
+
+       All assumptions share a single decision level, so the trail is truncated 
+       within that level. Clauses learned after the prefix was propagated are 
+       not revisited. They still detect conflicts through their watches, but 
+       may miss a propagation on the prefix.
+    */
+    bool solver::reuse_assumption_trail(unsigned num_lits, literal const* lits) {
+        if (!m_config.m_reuse_trail || m_ext || m_par || m_config.m_ddfw_search || 
+            m_config.m_prob_search || m_config.m_local_search || m_config.m_cube_and_conquer ||
+            m_config.m_num_threads > 1 || m_config.m_local_search_threads > 0 || m_config.m_ddfw_threads > 0)
+            return false;
+        if (scope_lvl() == 0 || m_search_lvl != 1)
+            return false;
+        unsigned n = std::min(num_lits, std::min(m_assumptions.size(), m_assumption_trail_lim.size()));
+        unsigned k = 0;
+        while (k < n && lits[k] == m_assumptions[k])
+            ++k;
+        if (k == 0)
+            return false;
+
+        pop(scope_lvl() - 1);
+        m_inconsistent = false;
+        unsigned sz = m_assumption_trail_lim[k - 1];
+        SASSERT(sz <= m_trail.size());
+        for (unsigned i = m_trail.size(); i-- > sz; ) {
+            literal l  = m_trail[i];
+            bool_var v = l.var();
+            m_assignment[l.index()]    = l_undef;
+            m_assignment[(~l).index()] = l_undef;
+            m_case_split_queue.unassign_var_eh(v);
+            m_vmtf_queue.unassign_var_eh(v);
+        }
+        m_trail.shrink(sz);
+        m_qhead = sz;
+        m_assumption_trail_lim.shrink(k);
+        m_assumptions.shrink(k);
+        m_assumption_set.reset();
+        for (literal lit : m_assumptions)
+            m_assumption_set.insert(lit);
+        m_stats.m_reused_assumptions += k;
+        TRACE("sat", tout << "reuse assumptions: " << m_assumptions << " trail: " << sz << "\n";);
+        return true;
     }
 
     void solver::update_min_core() {
@@ -1966,6 +2191,8 @@ namespace sat {
         m_search_sat_conflicts    = m_config.m_search_sat_conflicts;
         m_search_next_toggle      = m_search_unsat_conflicts;
         m_best_phase_size         = 0;
+        m_target_phase_size       = 0;
+        m_stable_luby_idx         = 1;
 
         m_reorder.lo              = m_config.m_reorder_base;
         m_rephase.base            = m_config.m_rephase_base;
@@ -1994,6 +2221,7 @@ namespace sat {
         m_asymm_branch.init_search();
         m_stopwatch.reset();
         m_stopwatch.start();
+        m_propagations_at_init = num_propagations();
         m_core.reset();
         m_min_core_valid = false;
         m_min_core.reset();
@@ -2036,25 +2264,42 @@ namespace sat {
         report _rprt(*this);
         SASSERT(at_base_lvl());
 
+        // run an in-processing technique if it is scheduled and record its cost and yield.
+        auto inprocess = [&](inprocess_technique t, auto const& step) {
+            if (m_config.m_inprocess_backoff > 0 && !m_inprocess.should_run(t))
+                return;
+            uint64_t size = inprocess_size();
+            unsigned units = init_trail_size();
+            stopwatch sw;
+            sw.start();
+            step();
+            sw.stop();
+            uint64_t new_size = inprocess_size();
+            uint64_t yield = (size > new_size ? size - new_size : 0) + (init_trail_size() - units);
+            m_inprocess.update(t, sw.get_seconds(), inconsistent() ? 1 : yield);
+        };
+
         m_cleaner(m_config.m_force_cleanup);
         CASSERT("sat_simplify_bug", check_invariant());
 
-        m_scc();
+        inprocess(IP_SCC, [&]() { m_scc(); });
         CASSERT("sat_simplify_bug", check_invariant());
 
         if (m_ext) {
             m_ext->pre_simplify();
         }
       
-        m_simplifier(false);
+        inprocess(IP_ELIM, [&]() {
+            m_simplifier(false);
 
-        CASSERT("sat_simplify_bug", check_invariant());
-        CASSERT("sat_missed_prop", check_missed_propagation());
-        if (!m_learned.empty()) {
-            m_simplifier(true);
-            CASSERT("sat_missed_prop", check_missed_propagation());
             CASSERT("sat_simplify_bug", check_invariant());
-        }
+            CASSERT("sat_missed_prop", check_missed_propagation());
+            if (!m_learned.empty()) {
+                m_simplifier(true);
+                CASSERT("sat_missed_prop", check_missed_propagation());
+                CASSERT("sat_simplify_bug", check_invariant());
+            }
+        });
         sort_watch_lits();
         CASSERT("sat_simplify_bug", check_invariant());
 
@@ -2065,10 +2310,10 @@ namespace sat {
             m_ext->simplify();
         }
 
-        m_probing();
+        inprocess(IP_PROBING, [&]() { m_probing(); });
         CASSERT("sat_missed_prop", check_missed_propagation());
         CASSERT("sat_simplify_bug", check_invariant());
-        m_asymm_branch(false);
+        inprocess(IP_ASYMM_BRANCH, [&]() { m_asymm_branch(false); });
 
         if (m_config.m_lookahead_simplify && !m_ext) {
             lookahead lh(*this);
@@ -2094,20 +2339,31 @@ namespace sat {
         }
 
         if (m_config.m_binspr && !inconsistent()) {
-            m_binspr();
+            inprocess(IP_BINSPR, [&]() { m_binspr(); });
         }
 
         if (m_config.m_anf_simplify && m_simplifications > m_config.m_anf_delay && !inconsistent()) {
-            anf_simplifier anf(*this);
-            anf_simplifier::config cfg;
-            cfg.m_enable_exlin = m_config.m_anf_exlin;
-            anf();
-            anf.collect_statistics(m_aux_stats);
-            // TBD: throttle anf_delay based on yield
+            inprocess(IP_ANF, [&]() {
+                anf_simplifier anf(*this);
+                anf_simplifier::config cfg;
+                cfg.m_enable_exlin = m_config.m_anf_exlin;
+                cfg.m_enable_f4 = m_config.m_anf_f4;
+                anf.set(cfg);
+                anf();
+                anf.collect_statistics(m_aux_stats);
+            });
+        }
+
+        if (m_config.m_gauss_simplify && m_simplifications > m_config.m_gauss_delay && !inconsistent()) {
+            inprocess(IP_GAUSS, [&]() {
+                xor_simplifier xs(*this, m_config.m_gauss_max_vars);
+                xs();
+                xs.collect_statistics(m_aux_stats);
+            });
         }
         
         if (m_cut_simplifier && m_simplifications > m_config.m_cut_delay && !inconsistent()) {
-            (*m_cut_simplifier)();
+            inprocess(IP_CUT, [&]() { (*m_cut_simplifier)(); });
         }
 
         if (m_config.m_inprocess_out.is_non_empty_string()) {
@@ -2119,6 +2375,19 @@ namespace sat {
         }
     }
 
+    /**
+       \brief size measure used to compute the yield of in-processing:
+       the number of literals in irredundant clauses, counting binary clauses.
+     */
+    uint64_t solver::inprocess_size() const {
+        uint64_t sz = 0;
+        for (clause const* c : m_clauses)
+            sz += c->size();
+        unsigned given = 0, redundant = 0;
+        num_binary(given, redundant);
+        return sz + 2 * static_cast<uint64_t>(given);
+    }
+
     bool solver::set_root(literal l, literal r) {
         return !m_ext || m_ext->set_root(l, r);
     }
@@ -2266,7 +2535,7 @@ namespace sat {
         if (m_conflicts_since_restart <= m_restart_threshold) return false;
         if (scope_lvl() < 2 + search_lvl()) return false;
         if (m_case_split_queue.empty()) return false;
-        if (m_config.m_restart != RS_EMA) return true;
+        if (current_restart_strategy() != RS_EMA) return true;
         return 
             m_fast_glue_avg + search_lvl() <= scope_lvl() && 
             m_config.m_restart_margin * m_slow_glue_avg <= m_fast_glue_avg;
@@ -2280,6 +2549,7 @@ namespace sat {
              << std::setw(6) << m_stats.m_decision << " "
              << std::setw(4) << m_stats.m_restart 
              << mk_stat(*this)
+             << " " << std::setw(7) << propagations_per_second()
              << " " << std::setw(6) << std::setprecision(2) << m_stopwatch.get_current_seconds() << ")\n";
         std::string str = std::move(strm).str();
         svector<size_t> nums;
@@ -2301,16 +2571,16 @@ namespace sat {
             m_restart_logs >= 20 + m_last_position_log || 
             (m_restart_logs >= 6 + m_last_position_log && (!same || diff > 3))) {
             m_last_position_log = m_restart_logs;
-            //           conflicts          restarts          learned            gc               time
-            //                     decisions         clauses            units          memory
-            int adjust[9] = { -3,      -3,      -3,      -1,      -3,      -2,   -1,     -2,       -1 };
-            char const* tag[9]  = { ":conflicts ", ":decisions ", ":restarts ", ":clauses/bin ", ":learned/bin ", ":units ", ":gc ", ":memory ", ":time" };
+            //           conflicts          restarts          learned            gc               props/s
+            //                     decisions         clauses            units          memory           time
+            int adjust[10] = { -3,      -3,      -3,      -1,      -3,      -2,   -1,     -2,       -3,      -1 };
+            char const* tag[10]  = { ":conflicts ", ":decisions ", ":restarts ", ":clauses/bin ", ":learned/bin ", ":units ", ":gc ", ":memory ", ":props/s ", ":time" };
             std::stringstream l1, l2;
             l1 << "(sat.stats ";
             l2 << "(sat.stats ";
             size_t p1 = 11, p2 = 11;
-            SASSERT(nums.size() == 9);
-            for (unsigned i = 0; i < 9 && i < nums.size(); ++i) {
+            SASSERT(nums.size() == 10);
+            for (unsigned i = 0; i < 10 && i < nums.size(); ++i) {
                 size_t p = nums[i];
                 if (i & 0x1) {
                     // odd positions
@@ -2336,6 +2606,17 @@ namespace sat {
         IF_VERBOSE(1, verbose_stream() << str);            
     }
 
+    uint64_t solver::num_propagations() const {
+        return static_cast<uint64_t>(m_stats.m_propagate) + m_stats.m_bin_propagate + m_stats.m_ter_propagate;
+    }
+
+    unsigned solver::propagations_per_second() const {
+        double secs = m_stopwatch.get_current_seconds();
+        if (secs <= 0.001)
+            return 0;
+        return static_cast<unsigned>((num_propagations() - m_propagations_at_init) / secs);
+    }
+
     void solver::do_restart(bool to_base) {        
         m_stats.m_restart++;
         m_restarts++;
@@ -2360,6 +2641,15 @@ namespace sat {
         if (to_base || scope_lvl() == search_lvl()) 
             return scope_lvl() - search_lvl();        
         else {
+            if (use_vmtf()) {
+                bool_var next = m_vmtf_queue.next_var([&](bool_var v) { return value(v) == l_undef && !was_eliminated(v); });
+                if (next == null_bool_var)
+                    return scope_lvl() - search_lvl();
+                unsigned n = search_lvl();
+                for (; n < scope_lvl() && m_vmtf_queue.more_active(scope_literal(n).var(), next); ++n) {
+                }
+                return n - search_lvl();
+            }
             bool_var next = m_case_split_queue.min_var();
 
             // Implementations of Marijn's idea of reusing the 
@@ -2388,9 +2678,34 @@ namespace sat {
         set_activity(v, new_act);
     }
 
+    /**
+       \brief With search.mode_switch, stable mode restarts using a luby sequence
+       and focused mode restarts based on the glue averages.
+    */
+    restart_strategy solver::current_restart_strategy() const {
+        if (!m_config.m_mode_switch || !is_two_phase())
+            return m_config.m_restart;
+        return m_search_state == s_sat ? RS_LUBY : RS_EMA;
+    }
+
+    /**
+       \brief VMTF is used for decisions when it is selected, except in stable mode
+       with search.mode_switch, which uses VSIDS.
+    */
+    bool solver::use_vmtf() const {
+        if (m_config.m_branching_heuristic != BH_VMTF)
+            return false;
+        return !m_config.m_mode_switch || !is_two_phase() || m_search_state == s_unsat;
+    }
+
     void solver::set_next_restart() {
         m_conflicts_since_restart = 0;
-        switch (m_config.m_restart) {
+        if (current_restart_strategy() == RS_LUBY && m_config.m_mode_switch) {
+            m_stable_luby_idx++;
+            m_restart_threshold = m_config.m_stable_restart * get_luby(m_stable_luby_idx);
+            return;
+        }
+        switch (current_restart_strategy()) {
         case RS_GEOMETRIC:
             m_restart_threshold = static_cast<unsigned>(m_restart_threshold * m_config.m_restart_factor);
             break;
@@ -2596,8 +2911,12 @@ namespace sat {
         }
         
         if (m_config.m_minimize_lemmas) {
+            if (m_config.m_shrink_lemmas)
+                shrink_lemma();
             minimize_lemma();
             reset_lemma_var_marks();
+            if (m_config.m_minimize_lemmas_big)
+                minimize_lemma_big();
             if (m_config.m_dyn_sub_res)
                 dyn_sub_res();
             TRACE("sat_lemma", tout << "new lemma (after minimization) size: " << m_lemma.size() << "\n" << m_lemma << "\n";);
@@ -2650,6 +2969,10 @@ namespace sat {
         }
         m_lemma.reset();
         TRACE("sat_conflict_detail", tout << "consistent " << (!m_inconsistent) << " scopes: " << scope_lvl() << " backtrack: " << backtrack_lvl << " backjump: " << backjump_lvl << "\n";);
+        if (!m_vmtf_bumped.empty()) {
+            m_vmtf_queue.bump(m_vmtf_bumped, [&](bool_var v) { return value(v) == l_undef; });
+            m_vmtf_bumped.reset();
+        }
         decay_activity();
         updt_phase_counters();
     }
@@ -2878,6 +3201,12 @@ namespace sat {
             case BH_CHB:
                 m_last_conflict[var] = m_stats.m_conflict;
                 break;
+            case BH_VMTF:
+                if (use_vmtf())
+                    m_vmtf_bumped.push_back(var);
+                else
+                    inc_activity(var);
+                break;
             default:
                 break;
             }
@@ -2919,6 +3248,13 @@ namespace sat {
             TRACE("forget_phase", tout << "forgetting phase of v" << v << "\n";);
             m_phase[v] = m_rand() % 2 == 0;
         }
+        if (m_config.m_mode_switch && is_sat_phase() && head > m_target_phase_size) {
+            m_target_phase_size = head;
+            for (unsigned i = 0; i < head; ++i) {
+                bool_var v = m_trail[i].var();
+                m_target_phase[v] = m_phase[v];
+            }
+        }
         if (is_sat_phase() && head >= m_best_phase_size) {
             m_best_phase_size = head;
             IF_VERBOSE(12, verbose_stream() << "sticky trail: " << head << "\n");
@@ -2940,7 +3276,17 @@ namespace sat {
 
     void solver::do_toggle_search_state() {
 
-        if (is_two_phase()) {
+        if (is_two_phase() && m_config.m_mode_switch) {
+            std::swap(m_fast_glue_backup, m_fast_glue_avg);
+            std::swap(m_slow_glue_backup, m_slow_glue_avg);
+            // stable and focused mode alternate on a geometric schedule.
+            if (m_search_state == s_sat) 
+                m_search_unsat_conflicts = static_cast<unsigned>(m_search_unsat_conflicts * m_config.m_mode_switch_factor);
+            else 
+                m_search_sat_conflicts = static_cast<unsigned>(m_search_sat_conflicts * m_config.m_mode_switch_factor);
+            ++m_stats.m_mode_switch;
+        }
+        else if (is_two_phase()) {
             m_best_phase_size = 0;
             std::swap(m_fast_glue_backup, m_fast_glue_avg);
             std::swap(m_slow_glue_backup, m_slow_glue_avg);
@@ -2962,6 +3308,15 @@ namespace sat {
         }
 
         m_phase_counter = 0;
+        if (m_config.m_mode_switch && is_two_phase()) {
+            IF_VERBOSE(2, verbose_stream() << "(sat.mode " << (m_search_state == s_sat ? "stable" : "focused") 
+                       << " :conflicts " << m_search_next_toggle << ")\n";);
+            m_conflicts_since_restart = 0;
+            if (m_search_state == s_sat)
+                m_restart_threshold = m_config.m_stable_restart * get_luby(m_stable_luby_idx);
+            else
+                m_restart_threshold = m_config.m_restart_initial;
+        }
     }
 
     bool solver::should_rephase() {
@@ -2969,7 +3324,44 @@ namespace sat {
 //        return m_rephase.should_apply(m_conflicts_since_init);
     }
 
+    /**
+       \brief Rephasing in stable mode cycles through the best phase, the original
+       phase, the best phase, and the phase found by a bounded random walk.
+       The target phase restarts from the selected phase.
+    */
+    void solver::do_stable_rephase() {
+        switch (m_rephase.count % 4) {
+        case 1:
+            for (auto& p : m_phase) p = false;
+            break;
+        case 3:
+            if (!m_ext) {
+                bounded_local_search();
+                for (unsigned i = 0; i < m_phase.size(); ++i) 
+                    m_phase[i] = m_best_phase[i];              
+                break;
+            }
+            Z3_fallthrough;
+        default:
+            for (unsigned i = 0; i < m_phase.size(); ++i) 
+                m_phase[i] = m_best_phase[i];  
+            break;
+        }
+        m_target_phase.reset();
+        m_target_phase.append(m_phase);
+        m_target_phase_size = 0;
+    }
+
     void solver::do_rephase() {
+        if (m_par) 
+            m_par->to_solver(*this);
+        if (m_config.m_mode_switch && is_two_phase() && m_search_state == s_sat) {
+            do_stable_rephase();
+            m_rephase_inc += m_config.m_rephase_base;
+            m_rephase_lim += m_rephase_inc;
+            m_rephase.inc(m_conflicts_since_init, num_clauses());
+            return;
+        }
         switch (m_config.m_phase) {
         case PS_ALWAYS_TRUE:
             for (auto& p : m_phase) p = true;
@@ -3315,6 +3707,182 @@ namespace sat {
         return j < sz;
     }
 
+    /**
+       \brief All-UIP shrinking. The literals of m_lemma assigned at a
+       decision level are replaced by the unique implication point of
+       the level, when they can be derived from it together with
+       literals of m_lemma at lower levels.
+       The variables of m_lemma are marked. Intermediary literals
+       at the level being resolved are tracked using the literal marks.
+    */
+    bool solver::shrink_lemma() {
+        SASSERT(m_unmark.empty());
+        unsigned sz = m_lemma.size();
+        if (sz <= 2)
+            return false;
+        m_shrink_open.reserve(scope_lvl() + 1, 0u);
+        m_shrink_uip.reserve(scope_lvl() + 1, null_literal);
+        m_shrink_levels.reset();
+        unsigned conflict_lvl = lvl(m_lemma[0]);
+        for (unsigned i = 1; i < sz; ++i) {
+            unsigned l = lvl(m_lemma[i]);
+            if (l > 0 && l != conflict_lvl && m_shrink_open[l]++ == 0)
+                m_shrink_levels.push_back(l);
+        }
+        unsigned num_active = 0;
+        for (unsigned l : m_shrink_levels) {
+            if (m_shrink_open[l] > 1)
+                ++num_active;
+            else
+                m_shrink_open[l] = 0;
+        }
+
+        for (unsigned i = m_trail.size(); num_active > 0 && i-- > 0; ) {
+            literal t = m_trail[i];
+            unsigned l = lvl(t);
+            if (m_shrink_open[l] == 0)
+                continue;
+            if (!is_marked(t.var()) && !is_marked_lit(t))
+                continue;
+            if (m_shrink_open[l] == 1) {
+                m_shrink_uip[l] = ~t;
+                m_shrink_open[l] = 0;
+                --num_active;
+                continue;
+            }
+            --m_shrink_open[l];
+            if (!shrink_resolve(t, l)) {
+                m_shrink_open[l] = 0;
+                --num_active;
+            }
+        }
+        for (literal t : m_shrink_marked)
+            unmark_lit(t);
+        m_shrink_marked.reset();
+
+        unsigned j = 1;
+        for (unsigned i = 1; i < sz; ++i) {
+            literal lit = m_lemma[i];
+            if (m_shrink_uip[lvl(lit)] == null_literal)
+                m_lemma[j++] = lit;
+            else
+                reset_mark(lit.var());
+        }
+        for (unsigned l : m_shrink_levels) {
+            literal u = m_shrink_uip[l];
+            if (u != null_literal) {
+                m_lemma[j++] = u;
+                mark(u.var());
+            }
+            m_shrink_uip[l] = null_literal;
+            m_shrink_open[l] = 0;
+        }
+        m_lemma.shrink(j);
+        m_stats.m_shrunken_lits += sz - j;
+        return j < sz;
+    }
+
+    /**
+       \brief Resolve the true literal t at level l with its antecedent.
+       Return false if the antecedent contains a literal at a different level
+       that is not in m_lemma.
+    */
+    bool solver::shrink_resolve(literal t, unsigned l) {
+        auto add = [&](literal a) {
+            bool_var v = a.var();
+            unsigned al = lvl(v);
+            if (al == 0 || is_marked(v) || is_marked_lit(~a))
+                return true;
+            if (al != l)
+                return false;
+            mark_lit(~a);
+            m_shrink_marked.push_back(~a);
+            ++m_shrink_open[l];
+            return true;
+        };
+        justification const& js = m_justification[t.var()];
+        switch (js.get_kind()) {
+        case justification::NONE:
+            return false;
+        case justification::BINARY:
+            return add(js.get_literal());
+        case justification::CLAUSE: {
+            clause& c = get_clause(js);
+            for (literal a : c)
+                if (a != t && !add(a))
+                    return false;
+            return true;
+        }
+        case justification::EXT_JUSTIFICATION:
+            fill_ext_antecedents(t, js, false);
+            for (literal a : m_ext_antecedents)
+                if (!add(~a))
+                    return false;
+            return true;
+        default:
+            UNREACHABLE();
+            return false;
+        }
+    }
+
+    /**
+       \brief Remove literals l from m_lemma when ~l is reachable from the negation
+       of another literal l' of m_lemma along binary clauses. The lemma then resolves
+       with the implied binary clause l' or ~l. The first literal is never removed.
+    */
+    bool solver::minimize_lemma_big() {
+        unsigned sz = m_lemma.size();
+        if (sz <= 1)
+            return false;
+        m_big_stamp.reserve(2 * num_vars(), 0u);
+        if (++m_big_stamp_id == 0) {
+            m_big_stamp.fill(0u);
+            m_big_stamp_id = 1;
+        }
+        for (unsigned i = 1; i < sz; ++i)
+            mark_lit(~m_lemma[i]);
+        unsigned budget = m_config.m_minimize_lemmas_big_budget;
+        for (unsigned i = 0; i < sz && budget > 0; ++i) {
+            literal src = ~m_lemma[i];
+            if (i > 0 && !is_marked_lit(src))
+                continue;
+            if (m_big_stamp[src.index()] == m_big_stamp_id)
+                continue;
+            m_big_stamp[src.index()] = m_big_stamp_id;
+            m_big_todo.reset();
+            m_big_todo.push_back(src);
+            while (!m_big_todo.empty() && budget > 0) {
+                literal u = m_big_todo.back();
+                m_big_todo.pop_back();
+                for (watched const& w : get_wlist(u)) {
+                    if (!w.is_binary_clause())
+                        continue;
+                    if (budget == 0)
+                        break;
+                    --budget;
+                    literal x = w.get_literal();
+                    if (m_big_stamp[x.index()] == m_big_stamp_id)
+                        continue;
+                    m_big_stamp[x.index()] = m_big_stamp_id;
+                    if (is_marked_lit(x))
+                        unmark_lit(x);
+                    m_big_todo.push_back(x);
+                }
+            }
+        }
+        unsigned j = 1;
+        for (unsigned i = 1; i < sz; ++i) {
+            literal lit = m_lemma[i];
+            if (is_marked_lit(~lit)) {
+                unmark_lit(~lit);
+                m_lemma[j++] = lit;
+            }
+        }
+        m_lemma.shrink(j);
+        m_stats.m_big_minimized_lits += sz - j;
+        return j < sz;
+    }
+
     /**
        \brief Reset the mark of the variables in the current lemma.
     */
@@ -3585,6 +4153,7 @@ namespace sat {
 
         for (bool_var w = m_justification.size(); w-- > v;) {
             m_case_split_queue.del_var_eh(w);
+            m_vmtf_queue.del_var_eh(w);
             m_probing.reset_cache(literal(w, true));
             m_probing.reset_cache(literal(w, false));
         }
@@ -3602,6 +4171,7 @@ namespace sat {
         m_phase.shrink(v);
         m_best_phase.shrink(v);
         m_prev_phase.shrink(v);
+        m_target_phase.shrink(v);
         m_assigned_since_gc.shrink(v);
         m_simplifier.reset_todos();
     }
@@ -3616,10 +4186,14 @@ namespace sat {
         SASSERT(num_scopes <= scope_lvl());
         unsigned new_lvl = scope_lvl() - num_scopes;
         scope & s        = m_scopes[new_lvl];
+        if (new_lvl == 0)
+            m_assumption_trail_lim.reset();
         m_inconsistent   = false; // TBD: use model seems to make this redundant: s.m_inconsistent;
         unassign_vars(s.m_trail_lim, new_lvl);
-        for (bool_var v : m_vars_to_free)
+        for (bool_var v : m_vars_to_free) {
             m_case_split_queue.del_var_eh(v);
+            m_vmtf_queue.del_var_eh(v);
+        }
         m_scope_lvl -= num_scopes;
         reinit_clauses(s.m_clauses_to_reinit_lim);
         m_scopes.shrink(new_lvl);
@@ -3644,6 +4218,7 @@ namespace sat {
             m_assignment[(~l).index()] = l_undef;
             SASSERT(value(v) == l_undef);
             m_case_split_queue.unassign_var_eh(v);
+            m_vmtf_queue.unassign_var_eh(v);
             if (m_config.m_anti_exploration) {
                 m_canceled[v] = m_stats.m_conflict;
             }
@@ -3753,6 +4328,7 @@ namespace sat {
         m_asymm_branch.updt_params(p);
         m_probing.updt_params(p);
         m_scc.updt_params(p);
+        m_inprocess.set_max_delay(m_config.m_inprocess_backoff);
         m_rand.set_seed(m_config.m_random_seed);
         m_step_size = m_config.m_step_size_init;
         m_drat.updt_config();
@@ -3785,6 +4361,7 @@ namespace sat {
         if (m_ext) m_ext->collect_statistics(st);
         if (m_local_search) m_local_search->collect_statistics(st);
         if (m_cut_simplifier) m_cut_simplifier->collect_statistics(st);
+        m_inprocess.collect_statistics(st);
         st.copy(m_aux_stats);
     }
 
@@ -3794,6 +4371,7 @@ namespace sat {
         m_simplifier.reset_statistics();
         m_asymm_branch.reset_statistics();
         m_probing.reset_statistics();
+        m_inprocess.reset_statistics();
         m_aux_stats.reset();
     }
 
@@ -3804,7 +4382,7 @@ namespace sat {
     // -----------------------
 
     void solver::rescale_activity() {
-        SASSERT(m_config.m_branching_heuristic == BH_VSIDS);
+        SASSERT(m_config.m_branching_heuristic != BH_CHB);
         for (unsigned& act : m_activity) {
             act >>= 14;
         }
@@ -3827,6 +4405,8 @@ namespace sat {
     void solver::move_to_front(bool_var b) {
         if (b >= num_vars())
             return;
+        if (m_config.m_branching_heuristic == BH_VMTF)
+            m_vmtf_queue.bump(b, value(b) == l_undef);
         if (m_case_split_queue.empty())
             return;
         bool_var next = m_case_split_queue.min_var();
@@ -4756,12 +5336,17 @@ namespace sat {
         st.update("sat restarts", m_restart);
         st.update("sat minimized lits", m_minimized_lits);
         st.update("sat subs resolution dyn", m_dyn_sub_res);
+        st.update("sat shrunken lits", m_shrunken_lits);
+        st.update("sat minimized lits big", m_big_minimized_lits);
         st.update("sat blocked correction sets", m_blocked_corr_sets);
         st.update("sat units", m_units);
         st.update("sat elim bool vars res", m_elim_var_res);
         st.update("sat elim bool vars bdd", m_elim_var_bdd);
         st.update("sat backjumps", m_backjumps);
         st.update("sat backtracks", m_backtracks);
+        st.update("sat defrag", m_defrag);
+        st.update("sat mode switches", m_mode_switch);
+        st.update("sat reused assumptions", m_reused_assumptions);
     }
 
     void stats::reset() {
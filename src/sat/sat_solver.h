@@ -20,6 +20,7 @@ Revision History:
 
 #include <cmath>
 #include "util/var_queue.h"
+#include "util/vmtf_queue.h"
 #include "util/params.h"
 #include "util/statistics.h"
 #include "util/stopwatch.h"
@@ -41,6 +42,7 @@ Revision History:
 #include "sat/sat_asymm_branch.h"
 #include "sat/sat_cut_simplifier.h"
 #include "sat/sat_probing.h"
+#include "sat/sat_inprocess.h"
 #include "sat/sat_mus.h"
 #include "sat/sat_binspr.h"
 #include "sat/sat_drat.h"
@@ -72,6 +74,8 @@ namespace sat {
         unsigned m_del_clause;
         unsigned m_minimized_lits;
         unsigned m_dyn_sub_res;
+        unsigned m_shrunken_lits;
+        unsigned m_big_minimized_lits;
         unsigned m_non_learned_generation;
         unsigned m_blocked_corr_sets;
         unsigned m_elim_var_res;
@@ -79,6 +83,9 @@ namespace sat {
         unsigned m_units;
         unsigned m_backtracks;
         unsigned m_backjumps;
+        unsigned m_defrag;
+        unsigned m_mode_switch;
+        unsigned m_reused_assumptions;
         stats() { reset(); }
         void reset();
         void collect_statistics(statistics & st) const;
@@ -115,6 +122,7 @@ namespace sat {
         bool                    m_is_probing { false };
         mus                     m_mus;           // MUS for minimal core extraction
         binspr                  m_binspr;
+        inprocess_scheduler     m_inprocess;
         bool                    m_inconsistent;
         bool                    m_searching;
         // A conflict is usually a single justification. That is, a justification
@@ -152,6 +160,8 @@ namespace sat {
         bool_vector             m_phase; 
         bool_vector             m_best_phase;
         bool_vector             m_prev_phase;
+        bool_vector             m_target_phase;  // longest conflict free trail since the last stable rephase
+        unsigned                m_target_phase_size;
         svector<char>           m_assigned_since_gc;
         search_state            m_search_state; 
         unsigned                m_search_unsat_conflicts;
@@ -165,6 +175,8 @@ namespace sat {
         backoff                 m_rephase;
         backoff                 m_reorder;
         var_queue<unsigned_vector> m_case_split_queue;
+        vmtf_queue              m_vmtf_queue;
+        bool_var_vector         m_vmtf_bumped;
         unsigned                m_qhead;
         unsigned                m_scope_lvl;
         unsigned                m_search_lvl;
@@ -189,12 +201,14 @@ namespace sat {
         svector<scope>          m_scopes;
         scoped_limit_trail      m_vars_lim;
         stopwatch               m_stopwatch;
+        uint64_t                m_propagations_at_init = 0;
         params_ref              m_params;
         no_drat_params          m_no_drat_params;
         scoped_ptr<solver>      m_clone; // for debugging purposes
         literal_vector          m_assumptions;      // additional assumptions during check
         literal_set             m_assumption_set;   // set of enabled assumptions
         literal_set             m_ext_assumption_set;   // set of enabled assumptions
+        unsigned_vector         m_assumption_trail_lim; // trail size after propagating each assumption, used by assumptions.reuse_trail
         literal_vector          m_core;             // unsat core
 
         unsigned                m_par_id;        
@@ -202,6 +216,8 @@ namespace sat {
         unsigned                m_par_limit_out;
         unsigned                m_par_num_vars;
         bool                    m_par_syncing_clauses;
+        unsigned                m_par_best_version = 0;
+        uint64_t                m_par_next_sync = 0;
 
         class lookahead*        m_cuber;
         class i_local_search*   m_local_search;
@@ -224,11 +240,13 @@ namespace sat {
         friend class scc;
         friend class pb::solver;
         friend class anf_simplifier;
+        friend class xor_simplifier;
         friend class cut_simplifier;
         friend class parallel;
         friend class lookahead;
         friend class local_search;
         friend class ddfw;
+        friend class cube_and_conquer;
         friend class prob;
         friend class unit_walk;
         friend struct mk_stat;
@@ -285,6 +303,12 @@ namespace sat {
         clause* mk_clause(literal l1, literal l2, sat::status st = sat::status::asserted());
         clause* mk_clause(literal l1, literal l2, literal l3, sat::status st = sat::status::asserted());
 
+        /**
+           \brief Add the input clauses stored in lits, each clause terminated by null_literal.
+        */
+        void add_clauses(unsigned num_lits, literal const* lits);
+        void add_clauses(literal_vector const& lits) { add_clauses(lits.size(), lits.data()); }
+
         random_gen& rand() { return m_rand; }
 
         void set_trim() { m_trim = true; }
@@ -482,6 +506,7 @@ namespace sat {
         bool propagate_literal(literal l, bool update);
         void propagate_clause(clause& c, bool update, unsigned assign_level, clause_offset cls_off);
         void set_watch(clause& c, unsigned idx, clause_offset cls_off);
+        static void prefetch(void const* p);
         
         // -----------------------
         //
@@ -541,6 +566,7 @@ namespace sat {
         unsigned m_simplifications = 0;
         unsigned m_restart_threshold = 0;
         unsigned m_luby_idx = 0;
+        unsigned m_stable_luby_idx = 0;
         unsigned m_conflicts_since_gc = 0;
         unsigned m_gc_threshold = 0;
         unsigned m_defrag_threshold = 0;
@@ -563,6 +589,8 @@ namespace sat {
         bool           m_min_core_valid { false };
         void init_reason_unknown() { m_reason_unknown = "no reason given"; }
         void init_assumptions(unsigned num_lits, literal const* lits);
+        void assign_assumptions(unsigned start, unsigned num_lits, literal const* lits);
+        bool reuse_assumption_trail(unsigned num_lits, literal const* lits);
         void reassert_min_core();
         void update_min_core();
         void resolve_weighted();
@@ -582,16 +610,23 @@ namespace sat {
         unsigned m_restart_logs;
         unsigned restart_level(bool to_base);
         void log_stats();
+        uint64_t num_propagations() const;
+        unsigned propagations_per_second() const;
         bool should_cancel();
         bool should_restart() const;
         void set_next_restart();
+        restart_strategy current_restart_strategy() const;
+        bool use_vmtf() const;
         void update_activity(bool_var v, double p);
         bool reached_max_conflicts();
         void sort_watch_lits();
+        uint64_t inprocess_size() const;
         void exchange_par();
+        void exchange_par_sync();
         lbool check_par(unsigned num_lits, literal const* lits);
         lbool do_local_search(unsigned num_lits, literal const* lits);
         lbool do_ddfw_search(unsigned num_lits, literal const* lits);
+        lbool do_cube_and_conquer();
         lbool do_prob_search(unsigned num_lits, literal const* lits);
         lbool invoke_local_search(unsigned num_lits, literal const* lits);
         void  bounded_local_search();
@@ -613,6 +648,7 @@ namespace sat {
         void save_psm();
         void gc_half(char const * st_name);
         void gc_dyn_psm();
+        void gc_tiered();
         bool activate_frozen_clause(clause & c);
         unsigned psm(clause const & c) const;
         bool can_delete(clause const & c) const;
@@ -676,6 +712,7 @@ namespace sat {
         bool is_two_phase() const;
         bool should_rephase();
         void do_rephase();
+        void do_stable_rephase();
         bool should_reorder();
         void do_reorder();
         svector<char> m_diff_levels;
@@ -697,6 +734,20 @@ namespace sat {
         void reset_lemma_var_marks();
         bool dyn_sub_res();
 
+        // all-UIP shrinking
+        unsigned_vector   m_shrink_open;     // per level: number of unresolved literals, 0 if the level is not shrunk
+        literal_vector    m_shrink_uip;      // per level: literal replacing the literals of the level
+        unsigned_vector   m_shrink_levels;
+        literal_vector    m_shrink_marked;
+        bool shrink_lemma();
+        bool shrink_resolve(literal t, unsigned l);
+
+        // minimization using the binary implication graph
+        unsigned_vector   m_big_stamp;
+        unsigned          m_big_stamp_id = 0;
+        literal_vector    m_big_todo;
+        bool minimize_lemma_big();
+
         // -----------------------
         //
         // Backtracking
@@ -714,6 +765,7 @@ namespace sat {
         literal_vector m_user_scope_literals;
         vector<svector<bool_var>> m_free_var_freeze;
         literal_vector m_aux_literals;
+        literal_vector m_bulk_literals;
         svector<bin_clause> m_user_bin_clauses;
 
         void gc_vars(bool_var max_var);
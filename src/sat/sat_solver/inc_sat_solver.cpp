@@ -176,9 +176,16 @@ public:
     }
 
     lbool check_sat_core(unsigned sz, expr * const * assumptions) override {
-        m_solver.pop_to_base_level();
+        // with sat.assumptions.reuse_trail the SAT solver backtracks on its own 
+        // and keeps the assignment of a common prefix of the assumptions.
+        // This requires that no new clauses are added for this check.
+        bool reuse = m_solver.get_config().m_reuse_trail && m_is_cnf && is_internalized();
+        for (unsigned i = 0; reuse && i < sz; ++i) 
+            reuse = is_literal(assumptions[i]);
+        if (!reuse)
+            m_solver.pop_to_base_level();
         m_core.reset();
-        if (m_solver.inconsistent()) return l_false;
+        if (m_solver.at_base_lvl() && m_solver.inconsistent()) return l_false;
         expr_ref_vector _assumptions(m);
         obj_map<expr, expr*> asm2fml;
         for (unsigned i = 0; i < sz; ++i) {
@@ -678,6 +685,10 @@ public:
         ensure_euf()->user_propagate_register_fixed(fixed_eh);
     }
     
+    void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) override {
+        ensure_euf()->user_propagate_register_fixed_batch(fixed_batch_eh);
+    }
+    
     void user_propagate_register_final(user_propagator::final_eh_t& final_eh) override {
         ensure_euf()->user_propagate_register_final(final_eh);
     }
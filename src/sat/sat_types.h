@@ -89,6 +89,8 @@ namespace sat {
         virtual unsigned num_non_binary_clauses() const = 0;
         virtual reslimit& rlimit() = 0;
         virtual model const& get_model() const = 0;
+        // number of clauses falsified by the assignment returned by get_model, if known.
+        virtual unsigned get_model_cost() const { return UINT_MAX; }
         virtual void collect_statistics(statistics& st) const = 0;        
         virtual double get_priority(bool_var v) const = 0;
         virtual bool get_value(bool_var v) const { return true; }
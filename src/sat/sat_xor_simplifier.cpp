@@ -0,0 +1,135 @@
+/*++
+  Copyright (c) 2026 Microsoft Corporation
+
+  Module Name:
+
+   sat_xor_simplifier.cpp
+
+  Abstract:
+   
+    Gauss-Jordan elimination on xor constraints.
+
+  --*/
+
+#include "util/union_find.h"
+#include "util/stopwatch.h"
+#include "math/simplex/bit_matrix.h"
+#include "sat/sat_xor_simplifier.h"
+#include "sat/sat_solver.h"
+#include "sat/sat_elim_eqs.h"
+#include "sat/sat_xor_finder.h"
+
+namespace sat {
+
+    struct xor_simplifier::report {
+        xor_simplifier& s;
+        stopwatch       m_watch;
+        report(xor_simplifier& s): s(s) { m_watch.start(); }
+        ~report() {
+            m_watch.stop();
+            IF_VERBOSE(2, 
+                       verbose_stream() << " (sat.xor.simplifier" 
+                       << " :num-xors " << s.m_stats.m_num_xors 
+                       << " :num-units " << s.m_stats.m_num_units 
+                       << " :num-eqs " << s.m_stats.m_num_eqs 
+                       << m_watch << ")\n");
+        }
+    };
+
+    void xor_simplifier::collect_xors(vector<literal_vector>& xors) {
+        clause_vector clauses(s.clauses());
+        std::function<void(literal_vector const&)> f = 
+            [&](literal_vector const& x) { xors.push_back(x); };
+        xor_finder xf(s);
+        xf.set(f);
+        xf(clauses);
+    }
+
+    /**
+       \brief Each xor x1 ^ .. ^ xn is a row x1 + .. + xn + 1 = 0 over GF(2), 
+       where the literal ~x contributes x + 1. The last column of the matrix
+       holds the constant.
+     */
+    void xor_simplifier::operator()() {
+        report _report(*this);
+        vector<literal_vector> xors;
+        collect_xors(xors);
+        m_stats.m_num_xors += xors.size();
+        if (xors.empty())
+            return;
+
+        unsigned_vector var2col(s.num_vars(), UINT_MAX);
+        bool_var_vector col2var;
+        for (literal_vector const& x : xors) {
+            for (literal l : x) {
+                if (var2col[l.var()] == UINT_MAX) {
+                    var2col[l.var()] = col2var.size();
+                    col2var.push_back(l.var());
+                }
+            }
+        }
+        if (col2var.size() > m_max_vars)
+            return;
+
+        bit_matrix bm;
+        unsigned const_col = col2var.size();
+        bm.reset(const_col + 1);
+        for (literal_vector const& x : xors) {
+            auto row = bm.add_row();
+            bool c = true;
+            for (literal l : x) {
+                row.set(var2col[l.var()]);
+                c ^= l.sign();
+            }
+            row.set(const_col, c);
+        }
+        bm.solve();
+
+        union_find_default_ctx ctx;
+        union_find<> uf(ctx);
+        for (unsigned i = 2*s.num_vars(); i--> 0; ) uf.mk_var();
+        unsigned old_num_eqs = m_stats.m_num_eqs;
+        bool_var_vector vars;
+        for (auto const& r : bm) {
+            vars.reset();
+            bool c = false;
+            for (unsigned col : r) {
+                if (col == const_col) 
+                    c = true;
+                else
+                    vars.push_back(col2var[col]);
+                if (vars.size() > 2)
+                    break;
+            }
+            if (vars.empty() && c) {
+                s.set_conflict();
+                break;
+            }
+            else if (vars.size() == 1) {
+                // x + c = 0
+                s.assign_unit(literal(vars[0], !c));
+                ++m_stats.m_num_units;
+                if (s.inconsistent())
+                    break;
+            }
+            else if (vars.size() == 2) {
+                // x + y + c = 0
+                literal x(vars[0], false), y(vars[1], c);
+                uf.merge(x.index(), y.index());
+                uf.merge((~x).index(), (~y).index());
+                ++m_stats.m_num_eqs;
+            }
+        }
+        if (!s.inconsistent() && old_num_eqs < m_stats.m_num_eqs) {
+            elim_eqs elim(s);
+            elim(uf);
+        }
+    }
+
+    void xor_simplifier::collect_statistics(statistics& st) const {
+        st.update("sat xor units", m_stats.m_num_units);
+        st.update("sat xor eqs",   m_stats.m_num_eqs);
+        st.update("sat xor xors",  m_stats.m_num_xors);
+    }
+
+}
@@ -0,0 +1,48 @@
+/*++
+  Copyright (c) 2026 Microsoft Corporation
+
+  Module Name:
+
+   sat_xor_simplifier.h
+
+  Abstract:
+   
+    Gauss-Jordan elimination on xor constraints.
+
+    Xor constraints are extracted from clauses and solved as a
+    linear system over GF(2) using a packed bit matrix. Solved rows
+    with a single variable are units and rows with two variables
+    are equivalences. A row that reduces to 0 = 1 is a conflict.
+
+  --*/
+#pragma once
+
+#include "util/statistics.h"
+#include "sat/sat_types.h"
+
+namespace sat {
+
+    class solver;
+
+    class xor_simplifier {
+        struct report;
+
+        struct stats {
+            unsigned m_num_xors, m_num_units, m_num_eqs;
+            stats() { reset(); }
+            void reset() { memset(this, 0, sizeof(*this)); }
+        };
+
+        solver&         s;
+        stats           m_stats;
+        unsigned        m_max_vars;
+
+        void collect_xors(vector<literal_vector>& xors);
+
+    public:
+        xor_simplifier(solver& s, unsigned max_vars) : s(s), m_max_vars(max_vars) {}
+        
+        void operator()();
+        void collect_statistics(statistics& st) const;
+    };
+}
@@ -943,7 +943,7 @@ namespace arith {
                 continue;
             theory_var other = m_model_eqs.insert_if_not_there(v);
             TRACE("arith", tout << "insert: v" << v << " := " << get_value(v) << " found: v" << other << "\n";);
-            if (!is_equal(other, v))
+            if (!is_equal(other, v) && !m_assumed_eqs.contains(assumed_eq_key(v, other)))
                 m_assume_eq_candidates.push_back({ v, other });
         }
 
@@ -972,6 +972,11 @@ namespace arith {
                 continue;
             if (n1->get_root() == n2->get_root())
                 continue;
+            uint64_t key = assumed_eq_key(v1, v2);
+            if (m_assumed_eqs.contains(key))
+                continue;
+            m_assumed_eqs.insert(key);
+            ctx.push(insert_map<hashtable<uint64_t, u64_hash, u64_eq>, uint64_t>(m_assumed_eqs, key));
             literal eq = eq_internalize(n1, n2);
             ctx.mark_relevant(eq);
             switch (s().value(eq)) {
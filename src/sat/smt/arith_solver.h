@@ -226,6 +226,7 @@ namespace arith {
 
         svector<std::pair<theory_var, theory_var> >       m_assume_eq_candidates;
         unsigned                                          m_assume_eq_head = 0;
+        hashtable<uint64_t, u64_hash, u64_eq>             m_assumed_eqs;   // pairs already proposed in the current scope
         indexed_uint_set                                         m_tmp_var_set;
 
         unsigned                                          m_num_conflicts = 0;
@@ -402,6 +403,10 @@ namespace arith {
         void random_update();
         bool assume_eqs();
         bool delayed_assume_eqs();
+        static uint64_t assumed_eq_key(theory_var v1, theory_var v2) {
+            if (v1 > v2) std::swap(v1, v2);
+            return (static_cast<uint64_t>(v1) << 32ull) | static_cast<uint64_t>(v2);
+        }
         bool is_eq(theory_var v1, theory_var v2);
         bool use_nra_model();
         bool include_func_interp(enode* n) const;
@@ -75,7 +75,10 @@ namespace bv {
     /**
        \brief expose the multiplication circuit lazily.
        It adds clauses for multiplier output one by one to enforce
-       the semantics of multipliers.
+       the semantics of multipliers. Output bit i only depends on the
+       partial products of the low i+1 bits of the arguments, so the
+       clauses for bit i only cover that part of the circuit.
+       Return true if all output bits are already exposed.
      */
 
     bool solver::check_lazy_mul(app* e, expr* arg_value, expr* mul_value) {
@@ -93,7 +96,7 @@ namespace bv {
         auto set_bits = [&](unsigned j, expr_ref_vector& bits) {
             bits.reset();
             for (unsigned i = 0; i < sz; ++i)
-                bits.push_back(bv.mk_bit2bool(e->get_arg(0), j));            
+                bits.push_back(bv.mk_bit2bool(e->get_arg(j), i));
         };
         if (!m_lazymul.find(e, lz)) {
             set_bits(0, args);
@@ -109,15 +112,15 @@ namespace bv {
             ctx.push(insert_obj_map(m_lazymul, e));
         }
         if (lz->m_out.size() == lz->m_bits)
-            return false;
+            return true;
         for (unsigned i = lz->m_bits; i <= diff; ++i) {
             sat::literal bit1 = mk_literal(lz->m_out.get(i));
             sat::literal bit2 = mk_literal(bv.mk_bit2bool(e, i));
             add_equiv(bit1, bit2);
         }
         ctx.push(value_trail(lz->m_bits));
-        IF_VERBOSE(1, verbose_stream() << "expand lazy mul " << mk_pp(e, m) << " to " << diff << "\n");
-        lz->m_bits = diff;
+        IF_VERBOSE(2, verbose_stream() << "expand lazy mul " << mk_bounded_pp(e, m) << " to " << diff << "\n");
+        lz->m_bits = diff + 1;
         return false;
     }
 
@@ -145,12 +148,9 @@ namespace bv {
         if (!check_mul_invertibility(e, args, r1))
             return false;
 
-#if 0
-        // unsound?
-
-        if (!check_lazy_mul(e, r1, r2))
+        if (!check_word_level(e, args, r1, r2))
             return false;
-#endif
+
         // Some other possible approaches:
         // algebraic rules:
         // x*(y+z), and there are nodes for x*y or x*z -> x*(y+z) = x*y + x*z
@@ -170,6 +170,10 @@ namespace bv {
         if (m_cheap_axioms)
             return true;
 
+        // blast the part of the multiplier up to the lowest wrong bit
+        if (!check_lazy_mul(e, r1, r2))
+            return false;
+
         set_delay_internalize(e, internalize_mode::no_delay_i);
         internalize_circuit(e);
         return false;
@@ -369,6 +373,157 @@ namespace bv {
         return true;
     }
 
+    /**
+     * Refine a delayed operator at the word level before its circuit is created.
+     * 
+     * The current values of the arguments are generalized to known bits and
+     * unsigned intervals, and a lemma is added that excludes the value of the
+     * term for all arguments in the same abstraction:
+     * 
+     * - the low d+1 bits of x + y and x * y only depend on the low d+1 bits of x and y.
+     * - x < 2^a, y < 2^b, a + b <= sz => x * y < 2^(a+b)
+     * - 2^(a-1) <= x < 2^a, 2^(b-1) <= y < 2^b, a + b <= sz => x * y >= 2^(a+b-2)
+     * - y != 0 => udiv(x, y) <= x, urem(x, y) <= x, urem(x, y) < y
+     * - monotonicity at the current values x0, y0, when x0 * y0 does not overflow:
+     *   x <= x0, y <= y0 => x * y <= x0 * y0
+     *   x0 <= x < 2^a, y0 <= y < 2^b, a + b <= sz => x0 * y0 <= x * y
+     *   x0 <= x, 0 < y <= y0 => x0 / y0 <= udiv(x, y)
+     *   x <= x0, y0 <= y => udiv(x, y) <= x0 / y0
+     * 
+     * Each term is refined at most m_bv_delay_refine times before it is bit-blasted.
+     */
+    bool solver::check_word_level(app* e, expr_ref_vector const& arg_values, expr* value, expr* expected) {
+        unsigned num_refinements = 0;
+        m_word_refinements.find(e, num_refinements);
+        if (num_refinements >= get_config().m_bv_delay_refine)
+            return true;
+        rational z, r;
+        unsigned sz;
+        if (!bv.is_numeral(value, z, sz) || !bv.is_numeral(expected, r))
+            return true;
+        vector<rational> vals;
+        for (expr* a : arg_values) {
+            rational v;
+            if (!bv.is_numeral(a, v))
+                return true;
+            vals.push_back(v);
+        }
+        auto bits_of = [&](expr* x) -> literal_vector const& {
+            return m_bits[expr2enode(x)->get_th_var(get_id())];
+        };
+        // the literal that is false under the current value of bit i of x
+        auto differs = [&](expr* x, unsigned i) {
+            literal b = bits_of(x)[i];
+            return s().value(b) == l_true ? ~b : b;
+        };
+        // the literal that is false when x < 2^a
+        auto add_above = [&](literal_vector& lits, expr* x, unsigned a) {
+            for (unsigned i = a; i < sz; ++i)
+                lits.push_back(bits_of(x)[i]);
+        };
+        auto ule = [&](expr* x, expr* y) {
+            return mk_literal(bv.mk_ule(x, y));
+        };
+        auto num = [&](rational const& v) {
+            return bv.mk_numeral(v, sz);
+        };
+        bool refined = false;
+        switch (e->get_decl_kind()) {
+        case OP_BMUL: {
+            bool has_zero = any_of(vals, [&](rational const& v) { return v.is_zero(); });
+            unsigned hi = 0;
+            for (auto const& v : vals)
+                hi += v.get_num_bits();
+            if (!has_zero && hi <= sz && z.get_num_bits() > hi) {
+                literal_vector lits;
+                for (unsigned i = 0; i < vals.size(); ++i)
+                    add_above(lits, e->get_arg(i), vals[i].get_num_bits());
+                lits.push_back(~bits_of(e)[z.get_num_bits() - 1]);
+                add_clause(lits);
+                refined = true;
+            }
+            unsigned lo = hi - vals.size();
+            if (!has_zero && hi <= sz && z.get_num_bits() <= lo) {
+                literal_vector lits;
+                for (unsigned i = 0; i < vals.size(); ++i) {
+                    unsigned a = vals[i].get_num_bits();
+                    lits.push_back(~bits_of(e->get_arg(i))[a - 1]);
+                    add_above(lits, e->get_arg(i), a);
+                }
+                add_above(lits, e, lo);
+                add_clause(lits);
+                refined = true;
+            }
+            if (!refined && !has_zero && hi <= sz && vals.size() == 2) {
+                expr* x = e->get_arg(0), *y = e->get_arg(1);
+                if (z > r) 
+                    add_clause(~ule(x, num(vals[0])), ~ule(y, num(vals[1])), ule(e, num(r)));
+                else {
+                    literal_vector lits;
+                    lits.push_back(~ule(num(vals[0]), x));
+                    lits.push_back(~ule(num(vals[1]), y));
+                    add_above(lits, x, vals[0].get_num_bits());
+                    add_above(lits, y, vals[1].get_num_bits());
+                    lits.push_back(ule(num(r), e));
+                    add_clause(lits);
+                }
+                refined = true;
+            }
+            if (refined)
+                break;
+            Z3_fallthrough;
+        }
+        case OP_BADD: {
+            unsigned d = 0;
+            while (z.get_bit(d) == r.get_bit(d))
+                ++d;
+            literal_vector lits;
+            for (expr* arg : *e)
+                for (unsigned i = 0; i <= d; ++i)
+                    lits.push_back(differs(arg, i));
+            literal b = bits_of(e)[d];
+            lits.push_back(r.get_bit(d) ? b : ~b);
+            add_clause(lits);
+            refined = true;
+            break;
+        }
+        case OP_BUDIV_I:
+        case OP_BUREM_I: {
+            if (vals[1].is_zero())
+                break;
+            expr* x = e->get_arg(0), *y = e->get_arg(1);
+            literal y_is_zero = eq_internalize(y, bv.mk_zero(sz));
+            if (z > vals[0]) {
+                add_clause(y_is_zero, ule(e, x));
+                refined = true;
+            }
+            if (e->get_decl_kind() == OP_BUREM_I && z >= vals[1]) {
+                add_clause(y_is_zero, ~ule(y, e));
+                refined = true;
+            }
+            if (!refined && e->get_decl_kind() == OP_BUDIV_I && z != r) {
+                if (z < r) 
+                    add_clause(~ule(num(vals[0]), x), ~ule(y, num(vals[1])), y_is_zero, ule(num(r), e));
+                else 
+                    add_clause(~ule(x, num(vals[0])), ~ule(num(vals[1]), y), ule(e, num(r)));
+                refined = true;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        if (!refined)
+            return true;
+        if (num_refinements == 0)
+            ctx.push(insert_obj_map<expr, unsigned>(m_word_refinements, e));
+        else
+            ctx.push(remove_obj_map<expr, unsigned>(m_word_refinements, e, num_refinements));
+        m_word_refinements.insert(e, num_refinements + 1);
+        IF_VERBOSE(2, verbose_stream() << "word-level refinement of " << mk_bounded_pp(e, m) << "\n");
+        return false;
+    }
+
     bool solver::check_bv_eval(euf::enode* n) {
         expr_ref_vector args(m);
         app* a = n->get_app();
@@ -377,6 +532,8 @@ namespace bv {
         auto r2 = eval_args(n, args);
         if (r1 == r2)
             return true;
+        if (!check_word_level(a, args, r1, r2))
+            return false;
         if (m_cheap_axioms)
             return true;
         set_delay_internalize(a, internalize_mode::no_delay_i);
@@ -301,6 +301,7 @@ namespace bv {
         };
 
         obj_map<expr, internalize_mode> m_delay_internalize;
+        obj_map<expr, unsigned>         m_word_refinements;
         bool m_cheap_axioms{ true };
         bool should_bit_blast(app * n);
         bool check_delay_internalized(expr* e);
@@ -310,6 +311,7 @@ namespace bv {
         bool check_mul_zero(app* n, expr_ref_vector const& arg_values, expr* value1, expr* value2);
         bool check_mul_one(app* n, expr_ref_vector const& arg_values, expr* value1, expr* value2);
         bool check_umul_no_overflow(app* n, expr_ref_vector const& arg_values, expr* value);
+        bool check_word_level(app* e, expr_ref_vector const& arg_values, expr* value, expr* expected);
         bool check_bv_eval(euf::enode* n);
         bool check_bool_eval(euf::enode* n);
         void encode_msb_tail(expr* x, expr_ref_vector& xs);
@@ -97,6 +97,43 @@ namespace dt {
         m_dfs.push_back(std::make_pair(ENTER, n));
     }
 
+    /**
+       \brief Record that the class of n gained a constructor or was merged.
+       A cycle that is created by the new edges passes through the class of n,
+       so occurs_check only has to start from touched classes.
+       Edges through sequence and array arguments change without a merge of
+       datatype classes, so such constructors fall back to checking every class.
+    */
+    void solver::oc_touch(enode* n) {
+        if (m_oc_full)
+            return;
+        if (is_constructor(n)) {
+            for (enode* arg : euf::enode_args(n)) {
+                sort* s = arg->get_sort(), * se;
+                if ((m_sutil.is_seq(s, se) && dt.is_datatype(se)) ||
+                    (m_autil.is_array(s) && dt.is_datatype(get_array_range(s)))) {
+                    m_oc_full = true;
+                    return;
+                }
+            }
+        }
+        m_oc_todo.push_back(n);
+        ctx.push(push_back_vector(m_oc_todo));
+    }
+
+    bool solver::oc_check_touched() {
+        for (unsigned i = m_oc_qhead; i < m_oc_todo.size(); ++i) {
+            enode* n = m_oc_todo[i]->get_root();
+            if (is_datatype(n) && dt.is_recursive(n->get_sort()) && !oc_cycle_free(n) && occurs_check(n))
+                return true;
+        }
+        if (m_oc_qhead < m_oc_todo.size()) {
+            ctx.push(value_trail<unsigned>(m_oc_qhead));
+            m_oc_qhead = m_oc_todo.size();
+        }
+        return false;
+    }
+
     /**
        \brief Assert the axiom (antecedent => lhs = rhs)
        antecedent may be null_literal
@@ -218,6 +255,7 @@ namespace dt {
         ctx.attach_th_var(n, this, r);
         if (is_constructor(n)) {
             d->m_constructor = n;
+            oc_touch(n);
             assert_accessor_axioms(n);
         }
         else if (is_update_field(n)) 
@@ -507,6 +545,7 @@ namespace dt {
         for (enode* e : d2->m_recognizers)
             if (e)
                 add_recognizer(v1, e);
+        oc_touch(var2enode(v1));
     }
 
     ptr_vector<euf::enode> const& solver::get_array_args(enode* n) {
@@ -726,6 +765,8 @@ namespace dt {
         int num_vars = get_num_vars();
         sat::check_result r = sat::check_result::CR_DONE;
         final_check_st _guard(*this);
+        if (!m_oc_full && oc_check_touched())
+            return sat::check_result::CR_CONTINUE;
         int start = s().rand()();
         for (int i = 0; i < num_vars; i++) {
             theory_var v = (i + start) % num_vars;
@@ -734,7 +775,7 @@ namespace dt {
             enode* node = var2enode(v);
             if (!is_datatype(node))
                 continue;
-            if (dt.is_recursive(node->get_sort()) && !oc_cycle_free(node) && occurs_check(node))
+            if (m_oc_full && dt.is_recursive(node->get_sort()) && !oc_cycle_free(node) && occurs_check(node))
                 return sat::check_result::CR_CONTINUE;
             if (get_config().m_dt_lazy_splits == 0)
                 continue;
@@ -99,6 +99,9 @@ namespace dt {
         enode_pair_vector     m_used_eqs; // conflict, if any
         parent_tbl            m_parent; // parent explanation for occurs_check
         svector<stack_entry>  m_dfs; // stack for DFS for occurs_check
+        ptr_vector<enode>     m_oc_todo; // nodes whose class gained edges since the last occurs_check
+        unsigned              m_oc_qhead = 0;
+        bool                  m_oc_full = false; // fall back to checking every class
         sat::literal_vector   m_lits;
 
         void clear_mark();
@@ -110,6 +113,8 @@ namespace dt {
         bool oc_cycle_free(enode * n) const { return n->get_root()->is_marked2(); }
 
         void oc_push_stack(enode * n);
+        void oc_touch(enode * n);
+        bool oc_check_touched();
         ptr_vector<enode> m_nodes, m_todo;
         ptr_vector<enode> const& get_array_args(enode* n);
         ptr_vector<enode> const& get_seq_args(enode* n, enode*& sibling);
@@ -387,6 +387,7 @@ namespace euf {
         m_params.set_bool("euf", false);
         m_sat_solver.updt_params(m_params);
         m_drat.updt_config();        
+        m_drat.set_del_watches(true);
         m_rup = symbol("rup");
         solver_params sp(m_params);
         m_check_rup = sp.proof_check_rup();
@@ -150,7 +150,11 @@ namespace euf {
             m_solver->assert_expr(mk_or(clause));
         }
         
-        void del(expr_ref_vector const& clause) {            
+        void del(expr_ref_vector const& clause) {
+            if (!m_check_rup)
+                return;
+            mk_clause(clause);
+            m_drat.del(m_clause);
         }
 
         
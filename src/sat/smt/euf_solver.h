@@ -544,6 +544,10 @@ namespace euf {
             check_for_user_propagator();
             m_user_propagator->register_fixed(fixed_eh);
         }
+        void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) {
+            check_for_user_propagator();
+            m_user_propagator->register_fixed_batch(fixed_batch_eh);
+        }
         void user_propagate_register_eq(user_propagator::eq_eh_t& eq_eh) {
             check_for_user_propagator();
             m_user_propagator->register_eq(eq_eh);
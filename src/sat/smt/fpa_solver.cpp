@@ -36,6 +36,7 @@ namespace fpa {
         params_ref p;
         p.set_bool("arith_lhs", true);
         m_th_rw.updt_params(p);
+        m_converter.set_delay(get_config().m_fp_lazy);
     }
 
     solver::~solver() {
@@ -86,9 +87,106 @@ namespace fpa {
         if (unit_propagate())
             return sat::check_result::CR_CONTINUE;
         SASSERT(m_nodes.size() <= m_nodes_qhead);
+        if (check_delayed())
+            return sat::check_result::CR_CONTINUE;
         return sat::check_result::CR_DONE;
     }
 
+    /**
+     * The value of a bit-vector term in the current assignment.
+     */
+    bool solver::get_bv_value(expr* b, expr_ref& value) {
+        if (m_bv_util.is_numeral(b)) {
+            value = b;
+            return true;
+        }
+        euf::enode* n = expr2enode(b);
+        if (!n)
+            return false;
+        auto* bv = ctx.fid2solver(m_bv_util.get_family_id());
+        theory_var v = n->get_th_var(m_bv_util.get_family_id());
+        sat::literal_vector lits;
+        return bv && v != euf::null_theory_var && bv->is_fixed(v, value, lits);
+    }
+
+    /**
+     * The value of a converted argument fp(sgn, exp, sig) or bv2rm(b) of a delayed term.
+     */
+    bool solver::get_fp_value(expr* e, expr_ref& value) {
+        expr* a = nullptr, * b = nullptr, * c = nullptr;
+        expr_ref va(m), vb(m), vc(m);
+        if (m_fpa_util.is_fp(e, a, b, c)) {
+            if (!get_bv_value(a, va) || !get_bv_value(b, vb) || !get_bv_value(c, vc))
+                return false;
+            value = m_converter.bv2fpa_value(e->get_sort(), va, vb, vc);
+            return true;
+        }
+        if (m_fpa_util.is_bv2rm(e)) {
+            if (!get_bv_value(to_app(e)->get_arg(0), va))
+                return false;
+            value = m_converter.bv2rm_value(va);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Evaluate a delayed operation on the values of its arguments and compare
+     * the result with the value of the bits that represent it.
+     */
+    bool solver::check_delayed(app* e) {
+        expr_ref_vector args(m);
+        expr_ref value(m), result(m);
+        for (expr* arg : *e) {
+            if (!get_fp_value(arg, value))
+                return false;
+            args.push_back(value);
+        }
+        if (!get_bv_value(m_converter.wrap(e), value))
+            return false;
+        value = m_converter.bv2fpa_value(e->get_sort(), value);
+        result = m.mk_app(e->get_decl(), args);
+        m_th_rw(result);
+        mpf_manager& mpfm = m_fpa_util.fm();
+        scoped_mpf r(mpfm), v(mpfm);
+        if (!m_fpa_util.is_numeral(result, r) || !m_fpa_util.is_numeral(value, v))
+            return false;
+        if (mpfm.is_nan(r))
+            return mpfm.is_nan(v);
+        return !mpfm.is_nan(v) && mpfm.eq(r, v) && mpfm.sgn(r) == mpfm.sgn(v);
+    }
+
+    /**
+     * Replace the abstraction of a delayed operation by its circuit.
+     */
+    void solver::expand_delayed(app* e) {
+        TRACE("t_fpa", tout << "expand " << mk_ismt2_pp(e, m) << "\n";);
+        expr_ref circuit(m);
+        m_converter.mk_circuit(e, circuit);
+        expr_ref cc(m_converter.wrap(circuit), m);
+        m_th_rw(cc);
+        add_unit(eq_internalize(m_converter.wrap(e), cc));
+        add_units(mk_side_conditions());
+        m_delayed_expanded.insert(e);
+        ctx.push(insert_obj_trail<app>(m_delayed_expanded, e));
+        ++m_stats.m_num_delayed_expanded;
+    }
+
+    /**
+     * Operations whose value is not the value of the operation applied to the
+     * values of the arguments are expanded into circuits.
+     */
+    bool solver::check_delayed() {
+        bool expanded = false;
+        for (app* e : m_delayed) {
+            if (m_delayed_expanded.contains(e) || check_delayed(e))
+                continue;
+            expand_delayed(e);
+            expanded = true;
+        }
+        return expanded;
+    }
+
     void solver::attach_new_th_var(enode* n) {
         theory_var v = mk_var(n);
         ctx.attach_th_var(n, this, v);
@@ -135,6 +233,10 @@ namespace fpa {
         TRACE("fp", tout << "post: " << mk_bounded_pp(e, m) << "\n";);
         m_nodes.push_back(std::tuple(n, sign, root));
         ctx.push(push_back_trail(m_nodes));
+        if (m_converter.is_delayed(e)) {
+            m_delayed.push_back(to_app(e));
+            ctx.push(push_back_vector(m_delayed));
+        }
         return true;
     }
 
@@ -417,6 +519,10 @@ namespace fpa {
         return out;
     }
 
+    void solver::collect_statistics(statistics& st) const {
+        st.update("fpa delayed expanded", m_stats.m_num_delayed_expanded);
+    }
+
     void solver::finalize_model(model& mdl) {
         model new_model(m);
 
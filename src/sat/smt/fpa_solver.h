@@ -38,6 +38,14 @@ namespace fpa {
         obj_map<expr, expr*>      m_conversions;
         svector<std::tuple<enode*, bool, bool>> m_nodes;
         unsigned                  m_nodes_qhead = 0;
+        ptr_vector<app>           m_delayed;
+        obj_hashtable<app>        m_delayed_expanded;
+
+        struct stats {
+            unsigned m_num_delayed_expanded = 0;
+            void reset() { *this = stats(); }
+        };
+        stats                     m_stats;
 
         bool visit(expr* e) override;
         bool visited(expr* e) override;
@@ -50,6 +58,12 @@ namespace fpa {
         void unit_propagate(std::tuple<enode*, bool, bool> const& t);
         void ensure_equality_relation(theory_var x, theory_var y);      
 
+        bool get_bv_value(expr* b, expr_ref& value);
+        bool get_fp_value(expr* e, expr_ref& value);
+        bool check_delayed(app* e);
+        void expand_delayed(app* e);
+        bool check_delayed();
+
     public:
         solver(euf::solver& ctx);
         ~solver() override;
@@ -69,6 +83,7 @@ namespace fpa {
         void add_value(euf::enode* n, model& mdl, expr_ref_vector& values) override;
         bool add_dep(euf::enode* n, top_sort<euf::enode>& dep) override;
         void finalize_model(model& mdl) override;
+        void collect_statistics(statistics& st) const override;
 
         bool unit_propagate() override;
         void get_antecedents(sat::literal l, sat::ext_justification_idx idx, sat::literal_vector& r, bool probing) override { UNREACHABLE(); }
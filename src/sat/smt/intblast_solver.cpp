@@ -466,9 +466,60 @@ namespace intblast {
     }
 
     bool solver::is_bounded(expr* x, rational const& N) {
-        return any_of(m_vars, [&](expr* v) {
-            return is_translated(v) && translated(v) == x && bv_size(v) <= N;
-        });
+        rational ub;
+        return upper_bound(x, ub) && ub <= N;
+    }
+
+    /*
+    * Compute ub, such that 0 <= e < ub, from the structure of the translated expression e.
+    * The depth is bounded because translated expressions are DAGs.
+    */
+    bool solver::upper_bound(expr* e, rational& ub, unsigned depth) {
+        rational v, ub2;
+        expr* x, * y, * z;
+        if (a.is_numeral(e, v)) {
+            ub = v + 1;
+            return v >= 0;
+        }
+        if (bv.is_bv2int(e, x)) {
+            ub = bv_size(x);
+            return true;
+        }
+        if (a.is_mod(e, x, y) && a.is_numeral(y, v) && v > 0) {
+            ub = v;
+            return true;
+        }
+        if (depth < 6) {
+            if (a.is_idiv(e, x, y) && a.is_numeral(y, v) && v > 0 && upper_bound(x, ub, depth + 1)) {
+                ub = div(ub - 1, v) + 1;
+                return true;
+            }
+            if (m.is_ite(e, x, y, z) && upper_bound(y, ub, depth + 1) && upper_bound(z, ub2, depth + 1)) {
+                ub = std::max(ub, ub2);
+                return true;
+            }
+            if (a.is_add(e) || a.is_mul(e)) {
+                bool is_add = a.is_add(e);
+                rational max_val = is_add ? rational::zero() : rational::one();
+                for (expr* arg : *to_app(e)) {
+                    if (!upper_bound(arg, ub2, depth + 1))
+                        return false;
+                    if (is_add)
+                        max_val += ub2 - 1;
+                    else
+                        max_val *= ub2 - 1;
+                }
+                ub = max_val + 1;
+                return true;
+            }
+        }
+        for (expr* v : m_vars) {
+            if (is_translated(v) && translated(v) == e) {
+                ub = bv_size(v);
+                return true;
+            }
+        }
+        return false;
     }
 
     bool solver::is_non_negative(expr* bv_expr, expr* e) {
@@ -541,16 +592,16 @@ namespace intblast {
     expr* solver::amod(expr* bv_expr, expr* x, rational const& N) {
         rational v;
         expr* r, *c, * t, * e;
-        if (m.is_ite(x, c, t, e))
+        if (a.is_numeral(x, v))
+            r = a.mk_int(mod(v, N));
+        else if (is_bounded(x, N))
+            r = x;
+        else if (m.is_ite(x, c, t, e))
             r = m.mk_ite(c, amod(bv_expr, t, N), amod(bv_expr, e, N));
         else if (a.is_idiv(x, t, e) && a.is_numeral(t, v) && 0 <= v && v < N && is_non_negative(bv_expr, e))
             r = x;
         else if (a.is_mod(x, t, e) && a.is_numeral(t, v) && 0 <= v && v < N)
             r = x;
-        else if (a.is_numeral(x, v))
-            r = a.mk_int(mod(v, N));
-        else if (is_bounded(x, N))
-            r = x;
         else 
             r = a.mk_mod(x, a.mk_int(N));
         return r;
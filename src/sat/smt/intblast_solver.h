@@ -74,6 +74,7 @@ namespace intblast {
         expr* umod(expr* bv_expr, unsigned i);
         expr* smod(expr* bv_expr, unsigned i);
         bool is_bounded(expr* v, rational const& N);
+        bool upper_bound(expr* e, rational& ub, unsigned depth = 0);
         bool is_non_negative(expr* bv_expr, expr* e);
         expr_ref mul(expr* x, expr* y);
         expr_ref add(expr* x, expr* y);
@@ -634,6 +634,7 @@ namespace pb {
        
         m_overflow = false;
         reset_coeffs();
+        init_visited();
         m_num_marks = 0;
         m_bound = 0;
         literal consequent = s().m_not_l;
@@ -730,6 +731,8 @@ namespace pb {
                 }
                 case pb::tag_t::pb_t: {
                     pbc& p = cnstr.to_pb();
+                    if (s().m_config.m_pb_resolve == sat::PB_CUTTING_PLANES && process_pb(p, consequent, offset))
+                        break;
                     m_lemma.reset();
                     inc_bound(offset);
                     inc_coeff(consequent, offset);
@@ -770,6 +773,7 @@ namespace pb {
             while (true) {
                 consequent = lits[idx];
                 v = consequent.var();
+                mark_visited(v);
                 if (s().is_marked(v)) {
                     if (s().lvl(v) == m_conflict_lvl) {
                         break;
@@ -1294,6 +1298,51 @@ namespace pb {
         }
     }
 
+    /**
+     * Add offset times the pseudo-Boolean reason p of consequent to the
+     * conflict. Literals that are assigned after the consequent are weakened
+     * away and p is rounded such that the consequent has coefficient 1, so
+     * that it cancels against the conflict and the result remains a
+     * conflict. If consequent is null, p is the conflict itself.
+     * Return false, without changing the conflict, if the scaled
+     * coefficients could overflow; the caller then uses the clausal
+     * explanation of p.
+     */
+    bool solver::process_pb(pbc& p, literal consequent, unsigned offset) {
+        ineq& r = m_reason;
+        r.reset(0);
+        unsigned k = p.k();
+        for (wliteral wl : p) {
+            if (wl.second == consequent || consequent == sat::null_literal || !is_visited(wl.second.var()))
+                r.push(wl.second, wl.first);
+            else {
+                SASSERT(k > wl.first);
+                k -= wl.first;
+            }
+        }
+        if (p.lit() != sat::null_literal)
+            r.push(~p.lit(), k);
+        r.m_k = k;
+        if (consequent != sat::null_literal)
+            round_to_one(r, consequent.var());
+        uint64_t max_coeff = r.m_k;
+        for (wliteral wl : r.m_wlits)
+            max_coeff = std::max(max_coeff, static_cast<uint64_t>(wl.first));
+        if (static_cast<uint64_t>(offset) * max_coeff > INT_MAX)
+            return false;
+        ++m_stats.m_num_pb_resolves;
+        inc_bound(static_cast<int64_t>(offset) * r.m_k);
+        for (unsigned i = 0; i < r.size(); ++i) {
+            literal l = r.lit(i);
+            unsigned c = offset * r.coeff(i);
+            if (l != consequent && is_false(l))
+                process_antecedent(l, c);
+            else
+                inc_coeff(l, c);
+        }
+        return true;
+    }
+
     void solver::process_antecedent(literal l, unsigned offset) {
         SASSERT(value(l) == l_false);
         bool_var v = l.var();
@@ -3201,6 +3250,7 @@ namespace pb {
         st.update("pb propagations", m_stats.m_num_propagations);
         st.update("pb conflicts", m_stats.m_num_conflicts);
         st.update("pb resolves", m_stats.m_num_resolves);
+        st.update("pb native resolves", m_stats.m_num_pb_resolves);
         st.update("pb cuts", m_stats.m_num_cut);
         st.update("pb gc", m_stats.m_num_gc);
         st.update("pb overflow", m_stats.m_num_overflow);
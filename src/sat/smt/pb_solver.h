@@ -48,6 +48,7 @@ namespace pb {
             unsigned m_num_propagations;
             unsigned m_num_conflicts;
             unsigned m_num_resolves;
+            unsigned m_num_pb_resolves;
             unsigned m_num_bin_subsumes;
             unsigned m_num_clause_subsumes;
             unsigned m_num_pb_subsumes;
@@ -303,6 +304,7 @@ namespace pb {
         void process_antecedent(literal l, unsigned offset);
         void process_antecedent(literal l) { process_antecedent(l, 1); }
         void process_card(card& c, unsigned offset);
+        bool process_pb(pbc& p, literal consequent, unsigned offset);
         void cut();
         bool create_asserting_lemma();
 
@@ -326,6 +328,7 @@ namespace pb {
         void push_lit(literal_vector& lits, literal lit);
 
         ineq m_A, m_B, m_C;
+        ineq m_reason;
         void active2pb(ineq& p);
         constraint* active2lemma();
         constraint* active2constraint();
@@ -383,6 +383,8 @@ namespace q {
             ++m_stats.m_num_propagations;
 
         auto& j = justification::from_index(j_idx);
+        if (is_conflict)
+            j.m_clause.m_stat->inc_num_conflicts();
         sat::literal_vector lits;
         lits.push_back(~j.m_clause.m_literal);
         for (unsigned i = 0; i < j.m_clause.size(); ++i) 
@@ -18,6 +18,15 @@ Revision History:
 
     Ported to self-contained egraph 
 
+Notes:
+
+    Code trees are shared between patterns with a common prefix and are
+    updated incrementally when patterns are added and removed on backtracking.
+    The interpreter dispatches once per instruction through a switch with
+    gotos, and the instructions for one to six arguments are already
+    specialized. Compiling hot trees to separate matchers would have to
+    replicate the sharing and the incremental updates of the trees.
+
 --*/
 #include <algorithm>
 
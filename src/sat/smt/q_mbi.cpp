@@ -50,6 +50,7 @@ namespace q {
         m_model = nullptr;
         ctx.save_model(m_model);
         m_instantiations.reset();
+        m_instantiated.reset();
         for (sat::literal lit : m_qs.m_universal) {
             quantifier* q = to_quantifier(ctx.bool_var2expr(lit.var()));
             if (!ctx.is_relevant(lit.var()))
@@ -235,6 +236,13 @@ namespace q {
             qlit.neg();
         ctx.rewrite(proj);
         TRACE("q", tout << "project: " << proj << "\n";);
+        // different models can project to the same instance
+        lit_expr_pair key(qlit.index(), proj->get_id());
+        if (m_instantiated.contains(key)) {
+            ++m_stats.m_num_duplicates;
+            return;
+        }
+        m_instantiated.insert(key);
         IF_VERBOSE(11, verbose_stream() << "mbi:\n" << mk_pp(q, m) << "\n" << proj << "\n");
         ++m_stats.m_num_instantiations;        
         unsigned generation = ctx.get_max_generation(proj);
@@ -668,6 +676,7 @@ namespace q {
             m_solver->collect_statistics(st);
         st.update("q mbi instantiations", m_stats.m_num_instantiations);
         st.update("q mbi num checks", m_stats.m_num_checks);
+        st.update("q mbi duplicate instantiations", m_stats.m_num_duplicates);
     }
 
 }
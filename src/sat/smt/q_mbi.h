@@ -33,6 +33,7 @@ namespace q {
     class mbqi {
         struct stats {
             unsigned m_num_instantiations;
+            unsigned m_num_duplicates;
             unsigned m_num_checks;
             
             stats() { reset(); }
@@ -75,6 +76,8 @@ namespace q {
         symbol                                 m_mbqi = symbol("mbqi");
         typedef std::tuple<sat::literal, expr_ref, expr_ref_vector, unsigned> instantiation_t;
         vector<instantiation_t> m_instantiations;
+        typedef std::pair<unsigned, unsigned> lit_expr_pair;
+        hashtable<lit_expr_pair, pair_hash<unsigned_hash, unsigned_hash>, default_eq<lit_expr_pair>> m_instantiated; // (qlit, projection) pairs of the current round
         vector<mbp::def>        m_defs;
 
         expr_ref_vector extract_binding(quantifier* q);
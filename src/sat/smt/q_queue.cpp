@@ -36,7 +36,7 @@ namespace q {
         m_subst(m)
     {
         init_parser_vars();
-        m_vals.resize(15, 0.0f);
+        m_vals.resize(16, 0.0f);
         setup();
     }
 
@@ -54,6 +54,8 @@ namespace q {
     }
 
     void queue::init_parser_vars() {
+#define CONFLICTS 15
+        m_parser.add_var("conflicts");
 #define COST 14
         m_parser.add_var("cost");
 #define MIN_TOP_GENERATION 13
@@ -90,6 +92,7 @@ namespace q {
         quantifier_stat * stat  = f.c->m_stat;
         quantifier* q = f.q();
         app* pat = f.m_pattern;
+        m_vals[CONFLICTS]          = static_cast<float>(stat->get_num_conflicts());
         m_vals[COST]               = cost;
         m_vals[MIN_TOP_GENERATION] = static_cast<float>(f.m_min_top_generation);
         m_vals[MAX_TOP_GENERATION] = static_cast<float>(f.m_max_top_generation);
@@ -112,9 +115,24 @@ namespace q {
         set_values(f, 0);
         float r = m_evaluator(m_cost_function, m_vals.size(), m_vals.data());
         f.c->m_stat->update_max_cost(r);
+        if (is_throttled(*f.c->m_stat) && r < m_params.m_qi_lazy_threshold) {
+            ++m_stats.m_num_throttled;
+            r = static_cast<float>(m_params.m_qi_lazy_threshold);
+        }
         return r;
     }
 
+    /**
+     * A quantifier is throttled when it produced more than qi.throttle instances
+     * per conflict. Its instances are then delayed to the final check.
+     */
+    bool queue::is_throttled(quantifier_stat const& stat) const {
+        if (m_params.m_qi_throttle == 0)
+            return false;
+        uint64_t limit = static_cast<uint64_t>(m_params.m_qi_throttle) * (1 + stat.get_num_conflicts());
+        return stat.get_num_instances() > limit;
+    }
+
     unsigned queue::get_new_gen(binding& f, float cost) {
         set_values(f, cost);
         float r = m_evaluator(m_new_gen_function, m_vals.size(), m_vals.data());
@@ -160,6 +178,8 @@ namespace q {
             return;
         }
         stat->inc_num_instances();
+        if (stat->get_num_instances() % m_params.m_qi_profile_freq == 0)
+            display_profile(verbose_stream(), q, *stat);
 
         m_stats.m_num_instances++;
 
@@ -247,6 +267,21 @@ namespace q {
         return instantiated;
     }
 
+    std::ostream& queue::display_profile(std::ostream& out, quantifier* q, quantifier_stat const& stat) const {
+        out << "[quantifier_instances] ";
+        out.width(10);
+        out << q->get_qid() << " : ";
+        out.width(6);
+        out << stat.get_num_instances() << " : ";
+        out.width(3);
+        out << stat.get_num_instances_simplify_true() << " : ";
+        out.width(3);
+        out << stat.get_num_conflicts() << " : ";
+        out.width(3);
+        out << stat.get_max_generation() << " : " << stat.get_max_cost() << "\n";
+        return out;
+    }
+
     void queue::collect_statistics(::statistics & st) const {
         float fmin = 0.0f, fmax = 0.0f;
         bool found = false;
@@ -260,6 +295,7 @@ namespace q {
         }
         st.update("q instantiations", m_stats.m_num_instances);
         st.update("q lazy instantiations", m_stats.m_num_lazy_instances);
+        st.update("q throttled instantiations", m_stats.m_num_throttled);
         st.update("q missed instantiations", m_delayed_entries.size());
         st.update("q min missed cost", fmin);
         st.update("q max missed cost", fmax);
@@ -35,7 +35,7 @@ namespace q {
     class queue {
 
         struct stats {
-            unsigned m_num_instances, m_num_lazy_instances;
+            unsigned m_num_instances, m_num_lazy_instances, m_num_throttled;
             void reset() { memset(this, 0, sizeof(*this)); }
             stats() { reset(); }
         };
@@ -65,6 +65,7 @@ namespace q {
         svector<entry>                m_delayed_entries;
 
         float get_cost(binding& f);
+        bool is_throttled(quantifier_stat const& stat) const;
         void set_values(binding& f, float cost);
         void init_parser_vars();
         void setup();
@@ -83,5 +84,7 @@ namespace q {
 
         void collect_statistics(::statistics & st) const;
 
+        std::ostream& display_profile(std::ostream& out, quantifier* q, quantifier_stat const& stat) const;
+
     };
 }
@@ -37,15 +37,21 @@ namespace sls {
         finalize();
     }
 
+    void solver::stop_workers() {
+        for (auto* w : m_workers)
+            w->m_sls->cancel();
+        for (auto* w : m_workers) {
+            w->m_thread.join();
+            w->m_sls->collect_statistics(m_st);
+        }
+    }
+
     void solver::finalize() {
-        if (!m_completed && m_sls) {
-            m_sls->cancel();
-            m_thread.join();
-            m_sls->collect_statistics(m_st);
-            m_sls = nullptr;
-            m_shared = nullptr;
-            m_slsm = nullptr;
+        if (!m_workers.empty()) {
+            stop_workers();
+            m_workers.reset();
             m_units = nullptr;
+            m_shared = nullptr;
         }
     }
 
@@ -56,6 +62,7 @@ namespace sls {
     bool solver::unit_propagate() {
         force_push();
         sample_local_search();
+        set_phases();
         return false;
     }
 
@@ -87,9 +94,9 @@ namespace sls {
     }       
 
     void solver::init_search() {
-        if (m_sls) {
-            m_sls->cancel();
-            m_thread.join();
+        if (!m_workers.empty()) {
+            stop_workers();
+            m_workers.reset();
             m_result = l_undef;
             m_completed = false;
             m_has_units = false;
@@ -99,67 +106,119 @@ namespace sls {
         // set up state for local search solver here
 
         m_shared = alloc(ast_manager);
-        m_slsm = alloc(ast_manager);
         m_units = alloc(expr_ref_vector, *m_shared);
-        ast_translation tr(m, *m_slsm);
         
         m_completed = false;
+        m_has_new_model = false;
         m_result = l_undef;
         m_model = nullptr;
-        m_sls = alloc(bv::sls, *m_slsm, s().params());
-        
-        for (expr* a : ctx.get_assertions())
-            m_sls->assert_expr(tr(a));
-
-        std::function<bool(expr*, unsigned)> eval = [&](expr* e, unsigned r) {
-            return false;
-        };
-
-        m_sls->init();
-        m_sls->init_eval(eval);
-        m_sls->updt_params(s().params());
-        m_sls->init_unit([&]() { 
-            if (!m_has_units)
-                return expr_ref(*m_slsm);
-            expr_ref e(*m_slsm);
-            {
+        m_best_repair_size = UINT_MAX;
+        m_winner = UINT_MAX;
+        m_num_done = 0;
+
+        unsigned num_threads = std::max(1u, ctx.get_config().m_sls_threads);
+        params_ref p = s().params();
+        unsigned seed = p.get_uint("random_seed", 0);
+        unsigned max_repairs = p.get_uint("max_repairs", 1000);
+        for (unsigned i = 0; i < num_threads; ++i) {
+            auto* w = alloc(worker);
+            m_workers.push_back(w);
+            w->m = alloc(ast_manager);
+            // workers differ in their seed and in how many repairs they attempt before a restart
+            params_ref q = p;
+            q.set_uint("random_seed", seed + i);
+            q.set_uint("max_repairs", max_repairs <= (UINT_MAX >> 3) ? max_repairs << (i % 4) : max_repairs);
+            w->m_sls = alloc(bv::sls, *w->m, q);
+            ast_translation tr(m, *w->m);
+            for (expr* a : ctx.get_assertions())
+                w->m_sls->assert_expr(tr(a));
+
+            std::function<bool(expr*, unsigned)> eval = [&](expr* e, unsigned r) {
+                return false;
+            };
+
+            w->m_sls->init();
+            w->m_sls->init_eval(eval);
+            w->m_sls->updt_params(q);
+            w->m_sls->init_unit([this, w]() { 
+                if (!m_has_units)
+                    return expr_ref(*w->m);
+                expr_ref e(*w->m);
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (w->m_units_head == m_units->size())
+                        return expr_ref(*w->m);
+                    ast_translation tr(*m_shared, *w->m);
+                    e = tr(m_units->get(w->m_units_head++));
+                }
+                return e;
+            });
+            w->m_sls->set_model([this, w](model& mdl) {
                 std::lock_guard<std::mutex> lock(m_mutex);
-                if (m_units->empty())
-                    return expr_ref(*m_slsm);
-                ast_translation tr(*m_shared, *m_slsm);
-                e = tr(m_units->back());
-                m_units->pop_back();
-            }
-            return e;
-        });
-        m_sls->set_model([&](model& mdl) {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            ast_translation tr(*m_shared, m);
-            m_model = mdl.translate(tr);
-        });
-                                     
-        m_thread = std::thread([this]() { run_local_search(); });        
+                // only keep models that improve on the best model of all workers
+                unsigned sz = w->m_sls->get_min_repair_size();
+                if (sz >= m_best_repair_size)
+                    return;
+                m_best_repair_size = sz;
+                ast_translation tr(*w->m, m);
+                m_model = mdl.translate(tr);
+                m_has_new_model = true;
+            });
+        }
+        for (unsigned i = 0; i < num_threads; ++i)
+            m_workers[i]->m_thread = std::thread([this, i]() { run_local_search(i); });
     }
 
     void solver::sample_local_search() {
         if (!m_completed)
             return;        
-        m_thread.join();
+        stop_workers();
         m_completed = false;
-        m_sls->collect_statistics(m_st);
         if (m_result == l_true) {
             IF_VERBOSE(2, verbose_stream() << "(sat.sls :model-completed)\n";);
-            auto mdl = m_sls->get_model();
-            ast_translation tr(*m_slsm, m);
+            auto mdl = m_workers[m_winner]->m_sls->get_model();
+            ast_translation tr(*m_workers[m_winner]->m, m);
             m_model = mdl->translate(tr);
             s().set_canceled();
         }
-        m_sls = nullptr;
+        m_workers.reset();
+    }
+
+    /**
+     * Use the best model found so far as phase for Boolean constants.
+     */
+    void solver::set_phases() {
+        if (!m_has_new_model)
+            return;
+        model_ref mdl;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            mdl = m_model;
+            m_has_new_model = false;
+        }
+        if (!mdl)
+            return;
+        for (sat::bool_var v = 0; v < s().num_vars(); ++v) {
+            expr* e = ctx.bool_var2expr(v);
+            if (!e || !is_uninterp_const(e))
+                continue;
+            if (mdl->is_true(e))
+                s().set_phase(sat::literal(v, false));
+            else if (mdl->is_false(e))
+                s().set_phase(sat::literal(v, true));
+        }
     }
 
-    void solver::run_local_search() {
-        m_result = (*m_sls)();
-        m_completed = true;
+    void solver::run_local_search(unsigned i) {
+        lbool r = (*m_workers[i]->m_sls)();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_num_done;
+        if (r != l_undef && m_winner == UINT_MAX) {
+            m_winner = i;
+            m_result = r;
+        }
+        if (r != l_undef || m_num_done == m_workers.size())
+            m_completed = true;
     }
 
 #endif
@@ -62,22 +62,32 @@ namespace euf {
 namespace sls {
 
     class solver : public euf::th_euf_solver {
+        struct worker {
+            scoped_ptr<ast_manager> m;
+            scoped_ptr<bv::sls> m_sls;
+            std::thread m_thread;
+            unsigned m_units_head = 0;
+        };
         std::atomic<lbool> m_result;
-        std::atomic<bool> m_completed, m_has_units;
-        std::thread m_thread;
+        std::atomic<bool> m_completed, m_has_units, m_has_new_model;
         std::mutex  m_mutex;
         // m is accessed by the main thread
-        // m_slsm is accessed by the sls thread
-        // m_shared is only accessed at synchronization points
-        scoped_ptr<ast_manager> m_shared, m_slsm;
-        scoped_ptr<bv::sls> m_sls;
+        // the manager of a worker is accessed by the worker thread
+        // m_shared and the fields below m_mutex are only accessed at synchronization points
+        scoped_ptr<ast_manager> m_shared;
+        scoped_ptr_vector<worker> m_workers;
         scoped_ptr<expr_ref_vector> m_units;
         model_ref m_model;
+        unsigned m_best_repair_size = UINT_MAX;
+        unsigned m_winner = UINT_MAX;
+        unsigned m_num_done = 0;
         unsigned m_trail_lim = 0;
         statistics m_st;
 
-        void run_local_search();
+        void run_local_search(unsigned i);
         void sample_local_search();
+        void stop_workers();
+        void set_phases();
         bool is_unit(expr*);
 
     public:
@@ -22,7 +22,9 @@ Author:
 namespace user_solver {
 
     solver::solver(euf::solver& ctx) :
-        th_euf_solver(ctx, symbol(user_propagator::plugin::name()), ctx.get_manager().mk_family_id(user_propagator::plugin::name()))
+        th_euf_solver(ctx, symbol(user_propagator::plugin::name()), ctx.get_manager().mk_family_id(user_propagator::plugin::name())),
+        m_fixed_batch_terms(ctx.get_manager()),
+        m_fixed_batch_values(ctx.get_manager())
     {}
 
     solver::~solver() {
@@ -79,19 +81,39 @@ namespace user_solver {
     }
 
     sat::check_result solver::check() {
-        if (!(bool)m_final_eh)
-            return sat::check_result::CR_DONE;
         unsigned sz = m_prop.size();
-        m_final_eh(m_user_context, this);
+        flush_fixed_batch();
+        if ((bool)m_final_eh)
+            m_final_eh(m_user_context, this);
         return sz == m_prop.size() ? sat::check_result::CR_DONE : sat::check_result::CR_CONTINUE;
     }
 
     void solver::new_fixed_eh(euf::theory_var v, expr* value, unsigned num_lits, sat::literal const* jlits) {
-        if (!m_fixed_eh)
+        if (!has_fixed())
             return;
         force_push();
         m_id2justification.setx(v, sat::literal_vector(num_lits, jlits), sat::literal_vector());
-        m_fixed_eh(m_user_context, this, var2expr(v), value);
+        new_fixed(v, value);
+    }
+
+    void solver::new_fixed(euf::theory_var v, expr* value) {
+        if (!m_fixed_batch_eh) {
+            m_fixed_eh(m_user_context, this, var2expr(v), value);
+            return;
+        }
+        // delivered by flush_fixed_batch at the end of the propagation round
+        m_fixed_batch_terms.push_back(var2expr(v));
+        m_fixed_batch_values.push_back(value);
+    }
+
+    bool solver::flush_fixed_batch() {
+        if (m_fixed_batch_terms.empty())
+            return false;
+        expr_ref_vector terms(m), values(m);
+        terms.swap(m_fixed_batch_terms);
+        values.swap(m_fixed_batch_values);
+        m_fixed_batch_eh(m_user_context, this, terms.size(), terms.data(), values.data());
+        return true;
     }
 
     bool solver::decide(sat::bool_var& var, lbool& phase) {
@@ -132,7 +154,7 @@ namespace user_solver {
     }
 
     void solver::asserted(sat::literal lit) {
-        if (!m_fixed_eh)
+        if (!has_fixed())
             return;
         auto* n = bool_var2enode(lit.var());
         euf::theory_var v = n->get_th_var(get_id());
@@ -143,7 +165,7 @@ namespace user_solver {
         sat::literal_vector lits;
         lits.push_back(lit);
         m_id2justification.setx(v, lits, sat::literal_vector());
-        m_fixed_eh(m_user_context, this, var2expr(v), lit.sign() ? m.mk_false() : m.mk_true());
+        new_fixed(v, lit.sign() ? m.mk_false() : m.mk_true());
     }
 
     void solver::new_eq_eh(euf::th_eq const& eq) {
@@ -172,6 +194,8 @@ namespace user_solver {
         unsigned old_sz = m_prop_lim.size() - num_scopes;
         m_prop.shrink(m_prop_lim[old_sz]);
         m_prop_lim.shrink(old_sz);
+        m_fixed_batch_terms.reset();
+        m_fixed_batch_values.reset();
         m_pop_eh(m_user_context, this, num_scopes);
     }
 
@@ -190,7 +214,7 @@ namespace user_solver {
     }
 
     bool solver::unit_propagate() {
-        if (m_qhead == m_prop.size() && m_replay_qhead == m_clauses_to_replay.size())
+        if (m_qhead == m_prop.size() && m_replay_qhead == m_clauses_to_replay.size() && m_fixed_batch_terms.empty())
             return false;
         force_push();
 
@@ -210,7 +234,8 @@ namespace user_solver {
             else
                 propagate_new_fixed(prop);
         }
-        return np < m_stats.m_num_propagations || replayed;
+        bool flushed = !s().inconsistent() && flush_fixed_batch();
+        return np < m_stats.m_num_propagations || replayed || flushed;
     }
 
     void solver::replay_clause(expr_ref_vector const& clause) {
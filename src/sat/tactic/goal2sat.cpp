@@ -48,13 +48,19 @@ Notes:
 #include<sstream>
 
 struct goal2sat::imp : public sat::sat_internalizer {
+    // polarities of occurrences, used for polarity aware encoding.
+    static const unsigned POS = 1, NEG = 2, BOTH = 3;
+
+    static unsigned flip(unsigned pol) { return ((pol & POS) << 1) | ((pol & NEG) >> 1); }
+
     struct frame {
         app *    m_t;
         unsigned m_root:1;
         unsigned m_sign:1;
+        unsigned m_pol:2;   // polarity of the occurrence of t, before applying m_sign
         unsigned m_idx;
-        frame(app * t, bool r, bool s, unsigned idx):
-            m_t(t), m_root(r), m_sign(s), m_idx(idx) {}
+        frame(app * t, bool r, bool s, unsigned pol, unsigned idx):
+            m_t(t), m_root(r), m_sign(s), m_pol(pol), m_idx(idx) {}
     };
     ast_manager &               m;
     pb_util                     pb;
@@ -76,6 +82,10 @@ struct goal2sat::imp : public sat::sat_internalizer {
     bool                        m_default_external;
     bool                        m_euf = false;
     bool                        m_top_level = false;
+    bool                        m_pg = false;
+    unsigned                    m_occ_pol = BOTH;  // polarity of the occurrence being converted
+    unsigned                    m_def_pol = BOTH;  // directions of the definition being converted
+    svector<unsigned char>      m_var_pol;         // bool var |-> directions of the definition that were added
     sat::literal_vector         aig_lits;
     
     imp(ast_manager & _m, params_ref const & p, sat::solver_core & s, atom2bool_var & map, dep2asm_map& dep2asm, bool default_external):
@@ -100,6 +110,59 @@ struct goal2sat::imp : public sat::sat_internalizer {
         m_ite_extra  = p.get_bool("ite_extra", true);
         m_max_memory = megabytes_to_bytes(p.get_uint("max_memory", UINT_MAX));
         m_euf = sp.euf() || sp.smt();
+        m_pg = sp.pg_encoding() && !m_euf;
+    }
+
+    /**
+       Polarity aware encoding adds only the direction of a definition that
+       is needed by the occurrences seen so far. The cut simplifier relies on
+       full definitions.
+    */
+    bool use_pg() {
+        return m_pg && !aig();
+    }
+
+    unsigned child_pol(app* t, unsigned idx, unsigned pol) const {
+        if (t->get_family_id() != m.get_basic_family_id())
+            return BOTH;
+        switch (t->get_decl_kind()) {
+        case OP_OR:
+        case OP_AND:
+            return pol;
+        case OP_NOT:
+            return flip(pol);
+        case OP_IMPLIES:
+            return idx == 0 ? flip(pol) : pol;
+        case OP_ITE:
+            return idx == 0 ? BOTH : pol;
+        default:
+            return BOTH;
+        }
+    }
+
+    /**
+       Return the literal defining t and set dirs to the directions of the definition 
+       that have to be added. A cached literal whose definition is missing directions 
+       is reused. It is re-added to the cache trail so that it is dropped from the cache 
+       when the scope of the new clauses is popped.
+    */
+    sat::literal mk_def_lit(app* t, unsigned& dirs) {
+        sat::literal l;
+        if (m_app2lit.find(t, l)) {
+            SASSERT(!l.sign());
+            m_var_pol.reserve(l.var() + 1, BOTH);
+            dirs = m_def_pol & ~m_var_pol[l.var()];
+            m_var_pol[l.var()] |= dirs;
+            force_push();
+            m_cache_trail.push_back(t);
+            return l;
+        }
+        l = sat::literal(add_var(false, t), false);
+        cache(t, l);
+        dirs = m_def_pol;
+        m_var_pol.reserve(l.var() + 1, 0);
+        m_var_pol[l.var()] = dirs;
+        return l;
     }
 
     void throw_op_not_handled(std::string const& s) {
@@ -343,7 +406,7 @@ struct goal2sat::imp : public sat::sat_internalizer {
 
     bool convert_app(app* t, bool root, bool sign) {
         if (!m_euf && pb.is_pb(t)) {
-            m_frame_stack.push_back(frame(to_app(t), root, sign, 0));
+            m_frame_stack.push_back(frame(to_app(t), root, sign, BOTH, 0));
             return false;
         }
         else {
@@ -352,10 +415,15 @@ struct goal2sat::imp : public sat::sat_internalizer {
         }
     }
 
-    bool process_cached(app* t, bool root, bool sign) {
+    bool process_cached(app* t, bool root, bool sign, unsigned pol) {
         sat::literal l = sat::null_literal;
         if (!m_app2lit.find(t, l))
             return false;
+        if (!root && t->get_family_id() == m.get_basic_family_id() && l.var() < m_var_pol.size()) {
+            unsigned need = sign ? flip(pol) : pol;
+            if ((m_var_pol[l.var()] & need) != need)
+                return false;
+        }
         if (sign)
             l.neg();
         if (root)
@@ -365,13 +433,13 @@ struct goal2sat::imp : public sat::sat_internalizer {
         return true;
     }
 
-    bool visit(expr * t, bool root, bool sign) {
+    bool visit(expr * t, bool root, bool sign, unsigned pol) {
         SASSERT(m.is_bool(t));
         if (!is_app(t)) {
             convert_atom(t, root, sign);
             return true;
         }
-        if (process_cached(to_app(t), root, sign))
+        if (process_cached(to_app(t), root, sign, pol))
             return true;
         if (to_app(t)->get_family_id() != m.get_basic_family_id()) 
             return convert_app(to_app(t), root, sign);   
@@ -382,11 +450,11 @@ struct goal2sat::imp : public sat::sat_internalizer {
         case OP_ITE:
         case OP_XOR:
         case OP_IMPLIES:
-            m_frame_stack.push_back(frame(to_app(t), root, sign, 0));
+            m_frame_stack.push_back(frame(to_app(t), root, sign, pol, 0));
             return false;
         case OP_EQ:            
             if (m.is_bool(to_app(t)->get_arg(1))) {
-                m_frame_stack.push_back(frame(to_app(t), root, sign, 0));
+                m_frame_stack.push_back(frame(to_app(t), root, sign, pol, 0));
                 return false;
             }
             else {
@@ -430,15 +498,15 @@ struct goal2sat::imp : public sat::sat_internalizer {
             m_result_stack.shrink(old_sz);
         }
         else {
-            if (process_cached(t, root, sign))
+            if (process_cached(t, root, sign, m_occ_pol))
                 return;
             SASSERT(num <= m_result_stack.size());
-            sat::bool_var k = add_var(false, t);
-            sat::literal  l(k, false);
-            cache(t, l);
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(t, dirs);
             sat::literal * lits = m_result_stack.end() - num;       
-            for (unsigned i = 0; i < num; i++) 
-                mk_clause(~lits[i], l, mk_tseitin(~lits[i], l));
+            if (dirs & NEG)
+                for (unsigned i = 0; i < num; i++) 
+                    mk_clause(~lits[i], l, mk_tseitin(~lits[i], l));
                        
             m_result_stack.push_back(~l);
             lits = m_result_stack.end() - num - 1;
@@ -448,7 +516,8 @@ struct goal2sat::imp : public sat::sat_internalizer {
             }
             // remark: mk_clause may perform destructive updated to lits.
             // I have to execute it after the binary mk_clause above.
-            mk_clause(num+1, lits, mk_tseitin(num+1, lits));
+            if (dirs & POS)
+                mk_clause(num+1, lits, mk_tseitin(num+1, lits));
             if (aig()) 
                 aig()->add_or(l, num, aig_lits.data());
                         
@@ -481,17 +550,18 @@ struct goal2sat::imp : public sat::sat_internalizer {
             m_result_stack.shrink(old_sz);
         }
         else {
-            if (process_cached(t, root, sign))
+            if (process_cached(t, root, sign, m_occ_pol))
                 return;
             SASSERT(num <= m_result_stack.size());
-            sat::bool_var k = add_var(false, t);
-            sat::literal  l(k, false);
-            cache(t, l);
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(t, dirs);
             sat::literal * lits = m_result_stack.end() - num;
 
             // l => /\ lits
-            for (unsigned i = 0; i < num; i++) {
-                mk_clause(~l, lits[i], mk_tseitin(~l, lits[i]));
+            if (dirs & POS) {
+                for (unsigned i = 0; i < num; i++) {
+                    mk_clause(~l, lits[i], mk_tseitin(~l, lits[i]));
+                }
             }
             // /\ lits => l
             for (unsigned i = 0; i < num; ++i) {
@@ -503,7 +573,8 @@ struct goal2sat::imp : public sat::sat_internalizer {
                 aig_lits.reset();
                 aig_lits.append(num, lits);
             }
-            mk_clause(num+1, lits, mk_tseitin(num+1, lits));
+            if (dirs & NEG)
+                mk_clause(num+1, lits, mk_tseitin(num+1, lits));
             if (aig()) {
                 aig()->add_and(l, num, aig_lits.data());
             }        
@@ -535,18 +606,23 @@ struct goal2sat::imp : public sat::sat_internalizer {
             }
         }
         else {
-            if (process_cached(n, root, sign))
+            if (process_cached(n, root, sign, m_occ_pol))
                 return;
-            sat::bool_var k = add_var(false, n);
-            sat::literal  l(k, false);
-            cache(n, l);
-            mk_clause(~l, ~c, t, mk_tseitin(~l, ~c, t));
-            mk_clause(~l,  c, e, mk_tseitin(~l, c, e));
-            mk_clause(l,  ~c, ~t, mk_tseitin(l, ~c, ~t));
-            mk_clause(l,   c, ~e, mk_tseitin(l, c, ~e));
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(n, dirs);
+            if (dirs & POS) {
+                mk_clause(~l, ~c, t, mk_tseitin(~l, ~c, t));
+                mk_clause(~l,  c, e, mk_tseitin(~l, c, e));
+            }
+            if (dirs & NEG) {
+                mk_clause(l,  ~c, ~t, mk_tseitin(l, ~c, ~t));
+                mk_clause(l,   c, ~e, mk_tseitin(l, c, ~e));
+            }
             if (m_ite_extra) {
-                mk_clause(~t, ~e, l, mk_tseitin(~t, ~e, l));
-                mk_clause(t,  e, ~l, mk_tseitin(t, e, ~l));
+                if (dirs & NEG)
+                    mk_clause(~t, ~e, l, mk_tseitin(~t, ~e, l));
+                if (dirs & POS)
+                    mk_clause(t,  e, ~l, mk_tseitin(t, e, ~l));
             }
             if (aig()) aig()->add_ite(l, c, t, e);
             if (sign)
@@ -567,14 +643,15 @@ struct goal2sat::imp : public sat::sat_internalizer {
             mk_root_clause(sign ? lit : ~lit);            
         }
         else {
-            if (process_cached(t, root, sign))
+            if (process_cached(t, root, sign, m_occ_pol))
                 return;
-            sat::bool_var k = add_var(false, t);
-            sat::literal  l(k, false);
-            cache(t, l);
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(t, dirs);
             // l <=> ~lit
-            mk_clause(lit, l, mk_tseitin(lit, l));
-            mk_clause(~lit, ~l, mk_tseitin(~lit, ~l));
+            if (dirs & NEG)
+                mk_clause(lit, l, mk_tseitin(lit, l));
+            if (dirs & POS)
+                mk_clause(~lit, ~l, mk_tseitin(~lit, ~l));
             if (sign)
                 l.neg();
             m_result_stack.push_back(l);
@@ -599,15 +676,17 @@ struct goal2sat::imp : public sat::sat_internalizer {
             }            
         }
         else {
-            if (process_cached(t, root, sign))
+            if (process_cached(t, root, sign, m_occ_pol))
                 return;
-            sat::bool_var k = add_var(false, t);
-            sat::literal  l(k, false);
-            cache(t, l);
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(t, dirs);
             // l <=> (l1 => l2)
-            mk_clause(~l, ~l1, l2, mk_tseitin(~l, ~l1, l2));
-            mk_clause(l1, l, mk_tseitin(l1, l));
-            mk_clause(~l2, l, mk_tseitin(~l2, l));
+            if (dirs & POS)
+                mk_clause(~l, ~l1, l2, mk_tseitin(~l, ~l1, l2));
+            if (dirs & NEG) {
+                mk_clause(l1, l, mk_tseitin(l1, l));
+                mk_clause(~l2, l, mk_tseitin(~l2, l));
+            }
             if (sign)
                 l.neg();
             m_result_stack.push_back(l);
@@ -637,19 +716,22 @@ struct goal2sat::imp : public sat::sat_internalizer {
             }                  
         }
         else {
-            if (process_cached(t, root, sign))
+            if (process_cached(t, root, sign, m_occ_pol))
                 return;
-            sat::bool_var k = add_var(false, t);
-            sat::literal  l(k, false);
+            unsigned dirs;
+            sat::literal  l = mk_def_lit(t, dirs);
             if (m.is_xor(t))
                 l1.neg();
-            mk_clause(~l,  l1, ~l2, mk_tseitin(~l, l1, ~l2));
-            mk_clause(~l, ~l1,  l2, mk_tseitin(~l, ~l1, l2));
-            mk_clause(l,   l1,  l2, mk_tseitin(l, l1, l2));
-            mk_clause(l,  ~l1, ~l2, mk_tseitin(l, ~l1, ~l2));
+            if (dirs & POS) {
+                mk_clause(~l,  l1, ~l2, mk_tseitin(~l, l1, ~l2));
+                mk_clause(~l, ~l1,  l2, mk_tseitin(~l, ~l1, l2));
+            }
+            if (dirs & NEG) {
+                mk_clause(l,   l1,  l2, mk_tseitin(l, l1, l2));
+                mk_clause(l,  ~l1, ~l2, mk_tseitin(l, ~l1, ~l2));
+            }
             if (aig()) aig()->add_iff(l, l1, l2);
 
-            cache(t, l);
             if (sign)
                 l.neg();
             m_result_stack.push_back(l);
@@ -784,14 +866,14 @@ struct goal2sat::imp : public sat::sat_internalizer {
         }
     };
 
-    void process(expr* n, bool is_root) {
+    void process(expr* n, bool is_root, unsigned pol) {
         TRACE("goal2sat", tout << "process-begin " << mk_bounded_pp(n, m, 2) 
             << " root: " << is_root 
             << " result-stack: " << m_result_stack.size() 
             << " frame-stack: " << m_frame_stack.size() << "\n";);
         scoped_stack _sc(*this, is_root);
         unsigned sz = m_frame_stack.size();
-        if (visit(n, is_root, false)) 
+        if (visit(n, is_root, false, pol)) 
             return;
         
         while (m_frame_stack.size() > sz) {
@@ -805,24 +887,26 @@ struct goal2sat::imp : public sat::sat_internalizer {
             app * t    = _fr.m_t;
             bool root  = _fr.m_root;
             bool sign  = _fr.m_sign;
+            unsigned pol = _fr.m_pol;
             TRACE("goal2sat_bug", tout << "result stack\n";
             tout << "ref-count: " << t->get_ref_count() << "\n";
                   tout << mk_bounded_pp(t, m, 3) << " root: " << root << " sign: " << sign << "\n";
                   tout << m_result_stack << "\n";);
-            if (_fr.m_idx == 0 && process_cached(t, root, sign)) {
+            if (_fr.m_idx == 0 && process_cached(t, root, sign, pol)) {
                 m_frame_stack.pop_back();
                 continue;
             }
             if (m.is_not(t) && (root || (!m.is_not(t->get_arg(0)) && fsz != sz + 1))) {
                 m_frame_stack.pop_back();
-                visit(t->get_arg(0), root, !sign);
+                visit(t->get_arg(0), root, !sign, pol);
                 continue;
             }
             unsigned num = t->get_num_args();
             while (m_frame_stack[fsz-1].m_idx < num) {
-                expr * arg = t->get_arg(m_frame_stack[fsz-1].m_idx);
+                unsigned idx = m_frame_stack[fsz-1].m_idx;
+                expr * arg = t->get_arg(idx);
                 m_frame_stack[fsz - 1].m_idx++;
-                if (!visit(arg, false, false))
+                if (!visit(arg, false, false, child_pol(t, idx, sign ? flip(pol) : pol)))
                     goto loop;
                 TRACE("goal2sat_bug", tout << "visit " << mk_bounded_pp(arg, m, 2) << " result stack: " << m_result_stack.size() << "\n";);
             }
@@ -830,7 +914,11 @@ struct goal2sat::imp : public sat::sat_internalizer {
                   tout << mk_bounded_pp(t, m, 2) << " root: " << root << " sign: " << sign << "\n";
                   tout << m_result_stack << "\n";);
             SASSERT(m_frame_stack.size() > sz);
-            convert(t, root, sign);
+            {
+                flet<unsigned> _occ(m_occ_pol, pol);
+                flet<unsigned> _def(m_def_pol, sign ? flip(pol) : pol);
+                convert(t, root, sign);
+            }
             m_frame_stack.pop_back();            
         }
         TRACE("goal2sat", tout 
@@ -846,7 +934,7 @@ struct goal2sat::imp : public sat::sat_internalizer {
         (void)sz;
         SASSERT(n->get_ref_count() > 0);
         TRACE("goal2sat", tout << "internalize " << mk_bounded_pp(n, m, 2) << "\n";);
-        process(n, false);
+        process(n, false, BOTH);
         SASSERT(m_result_stack.size() == sz + 1);
         sat::literal result = m_result_stack.back();
         TRACE("goal2sat", tout << "done internalize " << result << " " << mk_bounded_pp(n, m, 2) << "\n";);
@@ -892,7 +980,7 @@ struct goal2sat::imp : public sat::sat_internalizer {
         flet<bool> _top(m_top_level, true);
         VERIFY(m_result_stack.empty());
         TRACE("goal2sat", tout << "assert: " << mk_bounded_pp(n, m, 3) << "\n";);
-        process(n, true);
+        process(n, true, use_pg() ? POS : BOTH);
         CTRACE("goal2sat", !m_result_stack.empty(), tout << m_result_stack << "\n";);
         SASSERT(m_result_stack.empty());
         add_assertion(n);
@@ -149,7 +149,7 @@ void verify_solution(char const * file_name) {
         std::cerr << "(error \"failed to open file '" << file_name << "'\")" << std::endl;
         exit(ERR_OPEN_FILE);
     }
-    parse_dimacs(in, std::cerr, solver);
+    parse_dimacs(in, std::cerr, solver, 0);
     
     sat::model const & m = g_solver->get_model();
     for (unsigned i = 1; i < m.size(); i++) {
@@ -238,7 +238,7 @@ unsigned read_dimacs(char const * file_name) {
             std::cerr << "(error \"failed to open file '" << file_name << "'\")" << std::endl;
             exit(ERR_OPEN_FILE);
         }
-        parse_dimacs(in, std::cerr, solver);
+        parse_dimacs(in, std::cerr, solver, 0);
     }
     else {
         parse_dimacs(std::cin, std::cerr, solver);
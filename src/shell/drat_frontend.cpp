@@ -67,7 +67,7 @@ public:
 unsigned read_drat(char const* drat_file) {
     ast_manager m;
     reg_decl_plugins(m);
-    std::ifstream ins(drat_file);
+    std::ifstream ins(drat_file, std::ios_base::in | std::ios_base::binary);
     dimacs::drat_parser drat(ins, std::cerr);
     
     std::function<int(char const* r)> read_theory = [&](char const* r) {
@@ -203,6 +203,7 @@ class dl_graph {
     unsigned                m_timestamp;
     unsigned                m_last_enabled_edge;
     edge_id_vector          m_enabled_edges;
+    unsigned_vector         m_relax_count;    // per var, used by enable_edges
 
     // SCC for cheap equality propagation --
     svector<char>           m_unfinished_set; // per var
@@ -529,6 +530,81 @@ public:
         return r;
     }
 
+    // Enable a batch of edges and restore feasibility with a single
+    // queue-based Bellman-Ford pass, instead of one Dijkstra pass per edge.
+    // A variable that is relaxed more often than there are variables lies
+    // on a negative cycle. In that case the batch is not enabled, the
+    // assignment is restored and false is returned; enabling the edges one
+    // by one then produces the cycle through the last enabled edge.
+    // The method assumes the graph is feasible before the invocation.
+    bool enable_edges(unsigned n, edge_id const* ids) {
+        SASSERT(is_feasible_dbg());
+        SASSERT(m_assignment_stack.empty());
+        unsigned old_timestamp = m_timestamp;
+        unsigned num_enabled = m_enabled_edges.size();
+        dl_var_vector& queue = m_visited;
+        SASSERT(queue.empty());
+        for (unsigned i = 0; i < n; ++i) {
+            edge& e = m_edges[ids[i]];
+            if (e.is_enabled())
+                continue;
+            e.enable(m_timestamp++);
+            m_enabled_edges.push_back(ids[i]);
+            dl_var s = e.get_source();
+            if (!is_feasible(e) && m_mark[s] == DL_UNMARKED) {
+                m_mark[s] = DL_FOUND;
+                queue.push_back(s);
+            }
+        }
+        m_relax_count.reserve(m_assignment.size(), 0);
+        unsigned max_relax = m_assignment.size();
+        numeral gamma;
+        bool ok = true;
+        unsigned head = 0;
+        for (; ok && head < queue.size(); ++head) {
+            ++m_stats.m_propagation_cost;
+            dl_var source = queue[head];
+            m_mark[source] = DL_UNMARKED;
+            for (edge_id e_id : m_out_edges[source]) {
+                edge& e = m_edges[e_id];
+                if (!e.is_enabled())
+                    continue;
+                set_gamma(e, gamma);
+                if (!gamma.is_neg())
+                    continue;
+                dl_var target = e.get_target();
+                acc_assignment(target, gamma);
+                if (++m_relax_count[target] > max_relax) {
+                    ok = false;
+                    break;
+                }
+                if (m_mark[target] == DL_UNMARKED) {
+                    m_mark[target] = DL_FOUND;
+                    queue.push_back(target);
+                }
+            }
+        }
+        for (dl_var v : queue)
+            m_mark[v] = DL_UNMARKED;
+        for (auto const& a : m_assignment_stack)
+            m_relax_count[a.get_var()] = 0;
+        queue.reset();
+        if (!ok) {
+            undo_assignments();
+            for (unsigned i = m_enabled_edges.size(); i-- > num_enabled; )
+                m_edges[m_enabled_edges[i]].disable();
+            m_enabled_edges.shrink(num_enabled);
+            m_timestamp = old_timestamp;
+            return false;
+        }
+        m_assignment_stack.reset();
+        if (m_enabled_edges.size() > num_enabled)
+            m_last_enabled_edge = m_enabled_edges.back();
+        SASSERT(is_feasible_dbg());
+        SASSERT(check_invariant());
+        return true;
+    }
+
 
     // This method should only be invoked when add_edge returns false.
     // That is, there is a negative cycle in the graph.
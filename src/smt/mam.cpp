@@ -3146,6 +3146,83 @@ namespace {
         bool                        m_check_missing_instances;
 #endif
 
+        // Matches buffered during a round of E-matching when qi.batch is enabled.
+        // The bindings of a match are stored contiguously in m_batch_bindings.
+        struct batched_match {
+            quantifier * m_qa;
+            app *        m_pat;
+            unsigned     m_bindings;
+            unsigned     m_num_bindings;
+            unsigned     m_max_generation;
+            unsigned     m_min_top_generation;
+            unsigned     m_max_top_generation;
+        };
+        bool                        m_batch_mode = false;
+        svector<batched_match>      m_batch;
+        ptr_vector<enode>           m_batch_bindings;
+        unsigned_vector             m_batch_order;
+        vector<std::tuple<enode *, enode *>> m_batch_used_enodes; // always empty, batching is disabled when used enodes are logged
+
+        bool use_batch() const {
+            return m_context.get_fparams().m_qi_batch && !m.has_trace_stream() && !is_trace_enabled("causality");
+        }
+
+        enode * const * batch_bindings(batched_match const & b) const {
+            return m_batch_bindings.data() + b.m_bindings;
+        }
+
+        // Compare two buffered matches by quantifier and the roots of their bindings.
+        // Returns -1, 0, 1.
+        int compare_bindings(batched_match const & a, batched_match const & b) const {
+            if (a.m_qa != b.m_qa)
+                return a.m_qa->get_id() < b.m_qa->get_id() ? -1 : 1;
+            if (a.m_num_bindings != b.m_num_bindings)
+                return a.m_num_bindings < b.m_num_bindings ? -1 : 1;
+            enode * const * as = batch_bindings(a);
+            enode * const * bs = batch_bindings(b);
+            for (unsigned i = 0; i < a.m_num_bindings; ++i) {
+                unsigned ia = as[i]->get_root()->get_owner_id();
+                unsigned ib = bs[i]->get_root()->get_owner_id();
+                if (ia != ib)
+                    return ia < ib ? -1 : 1;
+            }
+            return 0;
+        }
+
+        /**
+           \brief Insert the buffered matches into the instance queue.
+           Matches are grouped by quantifier and bindings modulo congruence,
+           so duplicates are dropped in one pass keeping the one with the smallest generation.
+           No equalities are merged during a round of matching, so the roots are stable.
+        */
+        void flush_batch() {
+            if (m_batch.empty())
+                return;
+            m_batch_order.reset();
+            for (unsigned i = 0; i < m_batch.size(); ++i)
+                m_batch_order.push_back(i);
+            std::sort(m_batch_order.begin(), m_batch_order.end(), [&](unsigned i, unsigned j) {
+                int c = compare_bindings(m_batch[i], m_batch[j]);
+                if (c != 0)
+                    return c < 0;
+                if (m_batch[i].m_max_generation != m_batch[j].m_max_generation)
+                    return m_batch[i].m_max_generation < m_batch[j].m_max_generation;
+                return i < j;
+            });
+            batched_match const * prev = nullptr;
+            for (unsigned i : m_batch_order) {
+                batched_match const & b = m_batch[i];
+                if (prev && compare_bindings(*prev, b) == 0)
+                    continue;
+                prev = &b;
+                m_context.add_instance(b.m_qa, b.m_pat, b.m_num_bindings, batch_bindings(b), nullptr,
+                                       b.m_max_generation, b.m_min_top_generation, b.m_max_top_generation, m_batch_used_enodes);
+            }
+            TRACE("mam", tout << "flushed " << m_batch.size() << " matches\n";);
+            m_batch.reset();
+            m_batch_bindings.reset();
+        }
+
         enode_vector * mk_tmp_vector() {
             enode_vector * r = m_pool.mk();
             r->reset();
@@ -3863,6 +3940,8 @@ namespace {
                 m_to_match.reset();
             }
             m_new_patterns.reset();
+            m_batch.reset();
+            m_batch_bindings.reset();
             m_trail_stack.pop_scope(num_scopes);
         }
 
@@ -3871,6 +3950,8 @@ namespace {
             m_trees.reset();
             m_to_match.reset();
             m_new_patterns.reset();
+            m_batch.reset();
+            m_batch_bindings.reset();
             m_is_plbl.reset();
             m_is_clbl.reset();
             reset_pp_pc();
@@ -3890,10 +3971,13 @@ namespace {
 
         void match() override {
             TRACE("trigger_bug", tout << "match\n"; display(tout););
+            flet<bool> _batch(m_batch_mode, use_batch());
             for (code_tree* t : m_to_match) {
                 SASSERT(t->has_candidates());
-                if (!m_interpreter.execute(t))
+                if (!m_interpreter.execute(t)) {
+                    flush_batch();
                     return;
+                }
                 t->reset_candidates();
             }
             m_to_match.reset();
@@ -3901,9 +3985,16 @@ namespace {
                 match_new_patterns();
                 m_new_patterns.reset();
             }
+            flush_batch();
         }
 
         void rematch(bool use_irrelevant) override {
+            flet<bool> _batch(m_batch_mode, use_batch());
+            rematch_core(use_irrelevant);
+            flush_batch();
+        }
+
+        void rematch_core(bool use_irrelevant) {
             ptr_vector<code_tree>::iterator it  = m_trees.begin_code_trees();
             ptr_vector<code_tree>::iterator end = m_trees.end_code_trees();
             unsigned lbl = 0;
@@ -3949,6 +4040,11 @@ namespace {
 #endif
             unsigned min_gen = 0, max_gen = 0;
             m_interpreter.get_min_max_top_generation(min_gen, max_gen);
+            if (m_batch_mode) {
+                m_batch.push_back({ qa, pat, m_batch_bindings.size(), num_bindings, max_generation, min_gen, max_gen });
+                m_batch_bindings.append(num_bindings, bindings);
+                return;
+            }
             m_context.add_instance(qa, pat, num_bindings, bindings, nullptr, max_generation, min_gen, max_gen, used_enodes);
         }
 
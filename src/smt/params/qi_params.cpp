@@ -28,15 +28,19 @@ void qi_params::updt_params(params_ref const & _p) {
     m_mbqi_trace = p.mbqi_trace();
     m_mbqi_force_template = p.mbqi_force_template();
     m_mbqi_id = p.mbqi_id();
+    m_mbqi_threads = p.mbqi_threads();
     m_qe_lite = p.q_lite();
     m_qi_profile = p.qi_profile();
     m_qi_profile_freq = p.qi_profile_freq();
     m_qi_max_instances = p.qi_max_instances();
+    m_qi_throttle = p.qi_throttle();
     m_qi_eager_threshold = p.qi_eager_threshold();
     m_qi_lazy_threshold = p.qi_lazy_threshold();
     m_qi_cost = p.qi_cost();
     m_qi_max_eager_multipatterns = p.qi_max_multi_patterns();
     m_qi_quick_checker = static_cast<quick_checker_mode>(p.qi_quick_checker());
+    m_qi_batch = p.qi_batch();
+    m_qi_cache_instances = p.qi_cache_instances();
 }
 
 #define DISPLAY_PARAM(X) out << #X"=" << X << '\n';
@@ -54,6 +58,9 @@ void qi_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_qi_lazy_quick_checker);
     DISPLAY_PARAM(m_qi_promote_unsat);
     DISPLAY_PARAM(m_qi_max_instances);
+    DISPLAY_PARAM(m_qi_throttle);
+    DISPLAY_PARAM(m_qi_batch);
+    DISPLAY_PARAM(m_qi_cache_instances);
     DISPLAY_PARAM(m_qi_lazy_instantiation);
     DISPLAY_PARAM(m_qi_conservative_final_check);
     DISPLAY_PARAM(m_mbqi);
@@ -63,4 +70,5 @@ void qi_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_mbqi_trace);
     DISPLAY_PARAM(m_mbqi_force_template);
     DISPLAY_PARAM(m_mbqi_id);
+    DISPLAY_PARAM(m_mbqi_threads);
 }
@@ -40,8 +40,11 @@ struct qi_params {
     bool               m_qi_lazy_quick_checker = true;
     bool               m_qi_promote_unsat = true;
     unsigned           m_qi_max_instances = UINT_MAX;
+    unsigned           m_qi_throttle = 0;
     bool               m_qi_lazy_instantiation = false;
     bool               m_qi_conservative_final_check = false;
+    bool               m_qi_batch = false;
+    bool               m_qi_cache_instances = false;
     bool               m_qe_lite = false;
 
     bool               m_mbqi = true;
@@ -51,6 +54,7 @@ struct qi_params {
     bool               m_mbqi_trace = false;
     unsigned           m_mbqi_force_template = 10;
     const char *       m_mbqi_id = nullptr;
+    unsigned           m_mbqi_threads = 1;
 
     qi_params(params_ref const & p = params_ref()):
         /*
@@ -26,9 +26,12 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_auto_config = p.auto_config() && gparams::get_value("auto_config") == "true"; // auto-config is not scoped by smt in gparams.
     m_random_seed = p.random_seed();
     m_relevancy_lvl = p.relevancy();
+    m_relevancy_lazy = p.relevancy_lazy();
+    m_revive_terms = p.revive_terms();
     m_ematching   = p.ematching();
     m_induction   = p.induction();
     m_clause_proof = p.clause_proof();
+    m_phase_timing = p.phase_timing();
     m_phase_selection = static_cast<phase_selection>(p.phase_selection());
     if (m_phase_selection > PS_THEORY) throw default_exception("illegal phase selection numeral");
     m_phase_caching_on = p.phase_caching_on();
@@ -48,11 +51,19 @@ void smt_params::updt_local_params(params_ref const & _p) {
     m_threads       = p.threads();
     m_threads_max_conflicts  = p.threads_max_conflicts();
     m_threads_cube_frequency = p.threads_cube_frequency();
+    m_threads_share_lemmas = p.threads_share_lemmas();
+    m_lemma_gc_tiered = p.lemma_gc_tiered();
+    m_lemma_gc_core_glue = p.lemma_gc_core_glue();
+    m_lemma_gc_tier2_glue = p.lemma_gc_tier2_glue();
+    m_lemma_gc_tier2_rounds = p.lemma_gc_tier2_rounds();
     m_core_validate = p.core_validate();
+    m_consequences_chunk_size = std::max(1u, p.consequences_chunk_size());
     m_sls_enable = p.sls_enable();
+    m_sls_threads = p.sls_threads();
     m_logic = _p.get_sym("logic", m_logic);
     m_string_solver = p.string_solver();
     m_up_persist_clauses = p.up_persist_clauses();
+    m_fp_lazy = p.fp_lazy();
     validate_string_solver(m_string_solver);
     if (_p.get_bool("arith.greatest_error_pivot", false))
         m_arith_pivot_strategy = arith_pivot_strategy::ARITH_PIVOT_GREATEST_ERROR;
@@ -109,6 +120,8 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_binary_clause_opt);
     DISPLAY_PARAM(m_relevancy_lvl);
     DISPLAY_PARAM(m_relevancy_lemma);
+    DISPLAY_PARAM(m_relevancy_lazy);
+    DISPLAY_PARAM(m_revive_terms);
     DISPLAY_PARAM(m_random_seed);
     DISPLAY_PARAM(m_random_var_freq);
     DISPLAY_PARAM(m_inv_decay);
@@ -123,6 +136,7 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_threads);
     DISPLAY_PARAM(m_threads_max_conflicts);
     DISPLAY_PARAM(m_threads_cube_frequency);
+    DISPLAY_PARAM(m_threads_share_lemmas);
     DISPLAY_PARAM(m_simplify_clauses);
     DISPLAY_PARAM(m_tick);
     DISPLAY_PARAM(m_display_features);
@@ -130,6 +144,7 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_ematching);
     DISPLAY_PARAM(m_induction);
     DISPLAY_PARAM(m_clause_proof);
+    DISPLAY_PARAM(m_phase_timing);
     DISPLAY_PARAM(m_proof_log);
 
     DISPLAY_PARAM(m_case_split_strategy);
@@ -149,11 +164,16 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_restart_agility_threshold);
 
     DISPLAY_PARAM(m_up_persist_clauses);
+    DISPLAY_PARAM(m_fp_lazy);
     DISPLAY_PARAM(m_lemma_gc_strategy);
     DISPLAY_PARAM(m_lemma_gc_half);
     DISPLAY_PARAM(m_recent_lemmas_size);
     DISPLAY_PARAM(m_lemma_gc_initial);
     DISPLAY_PARAM(m_lemma_gc_factor);
+    DISPLAY_PARAM(m_lemma_gc_tiered);
+    DISPLAY_PARAM(m_lemma_gc_core_glue);
+    DISPLAY_PARAM(m_lemma_gc_tier2_glue);
+    DISPLAY_PARAM(m_lemma_gc_tier2_rounds);
     DISPLAY_PARAM(m_new_old_ratio);
     DISPLAY_PARAM(m_new_clause_activity);
     DISPLAY_PARAM(m_old_clause_activity);
@@ -177,6 +197,7 @@ void smt_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_progress_sampling_freq);
 
     DISPLAY_PARAM(m_core_validate);
+    DISPLAY_PARAM(m_consequences_chunk_size);
 
     DISPLAY_PARAM(m_preprocess);
     DISPLAY_PARAM(m_user_theory_preprocess_axioms);
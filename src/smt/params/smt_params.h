@@ -70,7 +70,8 @@ enum case_split_strategy {
     CS_RELEVANCY, // case split based on relevancy
     CS_RELEVANCY_ACTIVITY, // case split based on relevancy and activity
     CS_RELEVANCY_GOAL, // based on relevancy and the current goal
-    CS_ACTIVITY_THEORY_AWARE_BRANCHING // activity-based case split, but theory solvers can manipulate activity
+    CS_ACTIVITY_THEORY_AWARE_BRANCHING, // activity-based case split, but theory solvers can manipulate activity
+    CS_SCORED // activity plus theory scores, irrelevant atoms are skipped
 };
 
 struct smt_params : public preprocessor_params,
@@ -91,6 +92,8 @@ struct smt_params : public preprocessor_params,
     bool             m_binary_clause_opt = true;
     unsigned         m_relevancy_lvl = 2;
     bool             m_relevancy_lemma = false;
+    bool             m_relevancy_lazy = false;
+    unsigned         m_revive_terms = 0;
     unsigned         m_random_seed = 0;
     double           m_random_var_freq = 0.01;
     double           m_inv_decay = 1.052;
@@ -106,6 +109,7 @@ struct smt_params : public preprocessor_params,
     unsigned         m_threads = 1;
     unsigned         m_threads_max_conflicts = UINT_MAX;
     unsigned         m_threads_cube_frequency = 2;
+    unsigned         m_threads_share_lemmas = 8;
     bool             m_simplify_clauses = true;
     unsigned         m_tick = 1000;
     bool             m_display_features = false;
@@ -113,8 +117,10 @@ struct smt_params : public preprocessor_params,
     bool             m_ematching = true;
     bool             m_induction = false;
     bool             m_clause_proof = false;
+    bool             m_phase_timing = false;
     symbol           m_proof_log;
     bool             m_sls_enable = false;
+    unsigned         m_sls_threads = 1;
 
     // -----------------------------------
     //
@@ -164,6 +170,10 @@ struct smt_params : public preprocessor_params,
     unsigned          m_recent_lemmas_size = 100;
     unsigned          m_lemma_gc_initial = 5000;
     double            m_lemma_gc_factor = 1.1;
+    bool              m_lemma_gc_tiered = false;
+    unsigned          m_lemma_gc_core_glue = 2;
+    unsigned          m_lemma_gc_tier2_glue = 6;
+    unsigned          m_lemma_gc_tier2_rounds = 7;
     unsigned          m_new_old_ratio = 16;     //!< the ratio of new and old clauses.
     unsigned          m_new_clause_activity = 10;
     unsigned          m_old_clause_activity = 500;
@@ -179,6 +189,14 @@ struct smt_params : public preprocessor_params,
 
     bool             m_up_persist_clauses = false;
 
+    // -----------------------------------
+    //
+    // Floating point
+    //
+    // -----------------------------------
+
+    bool             m_fp_lazy = false;
+
     // -----------------------------------
     //
     // SMT-LIB (debug) pretty printer
@@ -220,6 +238,7 @@ struct smt_params : public preprocessor_params,
     //
     // -----------------------------------
     bool             m_core_validate = false;
+    unsigned         m_consequences_chunk_size = 100;
 
     // -----------------------------------
     //
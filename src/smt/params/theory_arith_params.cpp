@@ -40,6 +40,7 @@ void theory_arith_params::updt_params(params_ref const & _p) {
     m_nl_arith_propagate_linear_monomials = p.arith_nl_propagate_linear_monomials();
     m_nl_arith_optimize_bounds = p.arith_nl_optimize_bounds();
     m_nl_arith_cross_nested = p.arith_nl_cross_nested();
+    m_arith_dl_batch = p.arith_dl_batch();
 
     arith_rewriter_params ap(_p);
     m_arith_eq2ineq = ap.eq2ineq();
@@ -80,6 +81,7 @@ void theory_arith_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_arith_propagation_threshold);
     DISPLAY_PARAM(m_arith_pivot_strategy);
     DISPLAY_PARAM(m_arith_add_binary_bounds);
+    DISPLAY_PARAM(m_arith_dl_batch);
     DISPLAY_PARAM((unsigned)m_arith_propagation_strategy);
     DISPLAY_PARAM(m_arith_eq_bounds);
     DISPLAY_PARAM(m_arith_lazy_adapter);
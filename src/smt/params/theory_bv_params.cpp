@@ -27,6 +27,7 @@ void theory_bv_params::updt_params(params_ref const & _p) {
     m_bv_reflect = p.bv_reflect();
     m_bv_enable_int2bv2int = p.bv_enable_int2bv(); 
     m_bv_delay = p.bv_delay();
+    m_bv_delay_refine = p.bv_delay_refine();
     m_bv_size_reduce = p.bv_size_reduce();
     m_bv_solver = p.bv_solver();
 }
@@ -42,6 +43,7 @@ void theory_bv_params::display(std::ostream & out) const {
     DISPLAY_PARAM(m_bv_blast_max_size);
     DISPLAY_PARAM(m_bv_enable_int2bv2int);
     DISPLAY_PARAM(m_bv_delay);
+    DISPLAY_PARAM(m_bv_delay_refine);
     DISPLAY_PARAM(m_bv_size_reduce);
     DISPLAY_PARAM(m_bv_solver);
 }
@@ -23,6 +23,10 @@ struct theory_seq_params {
      * Enable splitting guided by length constraints
      */
     bool m_split_w_len = false;
+    /*
+     * Fix the lengths of sequence variables from the arithmetic model before branching on word equations
+     */
+    bool m_seq_length_first = false;
     bool m_seq_validate = false;
     unsigned m_seq_max_unfolding = UINT_MAX/4;
     unsigned m_seq_min_unfolding = 1;
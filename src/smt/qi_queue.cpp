@@ -24,6 +24,7 @@ Revision History:
 #include "smt/smt_context.h"
 #include "smt/qi_queue.h"
 #include <iostream>
+#include <algorithm>
 
 namespace smt {
 
@@ -38,7 +39,8 @@ namespace smt {
         m_parser(m),
         m_evaluator(m),
         m_subst(m),
-        m_instances(m) {
+        m_instances(m),
+        m_cache_pinned(m) {
         init_parser_vars();
         m_vals.resize(15, 0.0f);
     }
@@ -152,6 +154,10 @@ namespace smt {
 
     void qi_queue::instantiate() {
         unsigned since_last_check = 0;
+        if (m_revive)
+            revive_cached_instances();
+        if (m_params.m_qi_batch)
+            std::stable_sort(m_new_entries.begin(), m_new_entries.end(), [](entry const& a, entry const& b) { return a.m_cost < b.m_cost; });
         for (entry & curr : m_new_entries) {
             if (m_context.get_cancel_flag()) {
                 break;
@@ -325,6 +331,8 @@ namespace smt {
         unsigned gen = get_new_gen(q, generation, ent.m_cost);
         display_instance_profile(f, q, num_bindings, bindings, proof_id, gen);
         m_context.internalize_instance(lemma, pr1, gen);
+        if (m_params.m_qi_cache_instances && !ent.m_revived)
+            cache_instance(ent);
         if (f->get_def()) {
             m_context.internalize(f->get_def(), true);
         }
@@ -380,6 +388,10 @@ namespace smt {
         m_instances.shrink(s.m_instances_lim);
         m_new_entries.reset();
         m_scopes.shrink(new_lvl);
+        if (new_lvl < m_context.get_base_level() && !m_cache.empty()) {
+            prune_cache(new_lvl);
+            m_revive = !m_cache.empty();
+        }
         TRACE("new_entries_bug", tout << "[qi:pop-scope]\n";);
     }
 
@@ -388,6 +400,87 @@ namespace smt {
         m_delayed_entries.reset();
         m_instances.reset();
         m_scopes.reset();
+        m_cache.reset();
+        m_cache_bindings.reset();
+        m_cache_pinned.reset();
+        m_revive = false;
+    }
+
+    /**
+       \brief Record an instance that was created inside a user scope
+       from a quantifier and bindings that live in an enclosing scope.
+       Popping the user scope removes the instance, but not its ingredients.
+    */
+    void qi_queue::cache_instance(entry const & ent) {
+        fingerprint * f = ent.m_qb;
+        quantifier * q  = static_cast<quantifier*>(f->get_data());
+        unsigned base   = m_context.get_base_level();
+        if (base == 0 || !m_context.b_internalized(q))
+            return;
+        unsigned lvl = 0;
+        for (unsigned i = 0; i < f->get_num_args(); ++i)
+            lvl = std::max(lvl, f->get_arg(i)->get_iscope_lvl());
+        if (lvl >= base)
+            return;
+        m_cache.push_back({ q, m_cache_bindings.size(), f->get_num_args(), lvl, ent.m_generation, ent.m_cost });
+        m_cache_bindings.append(f->get_num_args(), f->get_args());
+        m_cache_pinned.push_back(q);
+    }
+
+    /**
+       \brief Remove the cached instances whose bindings are deleted when
+       backtracking to lvl.
+    */
+    void qi_queue::prune_cache(unsigned lvl) {
+        unsigned j = 0, k = 0;
+        for (unsigned i = 0; i < m_cache.size(); ++i) {
+            cached_instance c = m_cache[i];
+            if (c.m_level > lvl)
+                continue;
+            for (unsigned l = 0; l < c.m_num_bindings; ++l)
+                m_cache_bindings[k + l] = m_cache_bindings[c.m_bindings + l];
+            c.m_bindings = k;
+            k += c.m_num_bindings;
+            m_cache_pinned[j] = c.m_q;
+            m_cache[j++] = c;
+        }
+        m_cache.shrink(j);
+        m_cache_bindings.shrink(k);
+        m_cache_pinned.shrink(j);
+    }
+
+    /**
+       \brief Re-insert cached instances without matching.
+       The fingerprint table filters the instances that are still present.
+       Entries whose quantifier was removed, or that were re-inserted at the
+       level of their bindings, are no longer needed.
+    */
+    void qi_queue::revive_cached_instances() {
+        m_revive = false;
+        unsigned lvl = m_context.get_scope_level();
+        bool prune = false;
+        for (cached_instance & c : m_cache) {
+            if (!m_context.b_internalized(c.m_q)) {
+                c.m_level = UINT_MAX;
+                prune = true;
+                continue;
+            }
+            enode * const * bindings = m_cache_bindings.data() + c.m_bindings;
+            fingerprint * f = m_context.add_fingerprint(c.m_q, c.m_q->get_id(), c.m_num_bindings, bindings);
+            if (!f)
+                continue;
+            entry e(f, c.m_cost, c.m_generation);
+            e.m_revived = true;
+            m_new_entries.push_back(e);
+            m_stats.m_num_revived_instances++;
+            if (lvl <= c.m_level) {
+                c.m_level = UINT_MAX;
+                prune = true;
+            }
+        }
+        if (prune)
+            prune_cache(UINT_MAX - 1);
+        TRACE("qi_queue", tout << "revived cached instances: " << m_new_entries.size() << "\n";);
     }
 
     void qi_queue::init_search_eh() {
@@ -502,6 +595,8 @@ namespace smt {
     void qi_queue::collect_statistics(::statistics & st) const {
         st.update("quant instantiations", m_stats.m_num_instances);
         st.update("lazy quant instantiations", m_stats.m_num_lazy_instances);
+        if (m_stats.m_num_revived_instances > 0)
+            st.update("revived quant instantiations", m_stats.m_num_revived_instances);
         st.update("missed quant instantiations", m_delayed_entries.size());
         float min, max;
         get_min_max_costs(min, max);
@@ -33,7 +33,7 @@ namespace smt {
     class context;
 
     struct qi_queue_stats {
-        unsigned m_num_instances, m_num_lazy_instances;
+        unsigned m_num_instances, m_num_lazy_instances, m_num_revived_instances;
         void reset() { memset(this, 0, sizeof(qi_queue_stats)); }
         qi_queue_stats() { reset(); }
     };
@@ -55,9 +55,10 @@ namespace smt {
         struct entry {
             fingerprint * m_qb;
             float         m_cost;
-            unsigned      m_generation:31;
+            unsigned      m_generation:30;
             unsigned      m_instantiated:1;
-            entry(fingerprint * f, float c, unsigned g):m_qb(f), m_cost(c), m_generation(g), m_instantiated(false) {}
+            unsigned      m_revived:1;
+            entry(fingerprint * f, float c, unsigned g):m_qb(f), m_cost(c), m_generation(g), m_instantiated(false), m_revived(false) {}
         };
         svector<entry>                m_new_entries;
         svector<entry>                m_delayed_entries;
@@ -70,6 +71,25 @@ namespace smt {
         };
         svector<scope>                m_scopes;
 
+        // Instances whose quantifier and bindings were internalized below the base level.
+        // They are re-inserted after a user pop removes them (qi.cache_instances).
+        struct cached_instance {
+            quantifier * m_q;
+            unsigned     m_bindings;     // offset into m_cache_bindings
+            unsigned     m_num_bindings;
+            unsigned     m_level;        // maximal scope level of the bindings
+            unsigned     m_generation;
+            float        m_cost;
+        };
+        svector<cached_instance>      m_cache;
+        ptr_vector<enode>             m_cache_bindings;
+        expr_ref_vector               m_cache_pinned;
+        bool                          m_revive = false;
+
+        void cache_instance(entry const & ent);
+        void prune_cache(unsigned new_lvl);
+        void revive_cached_instances();
+
         void init_parser_vars();
         q::quantifier_stat * set_values(quantifier * q, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation, float cost);
         float get_cost(quantifier * q, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation);
@@ -88,7 +108,7 @@ namespace smt {
         */
         void insert(fingerprint * f, app * pat, unsigned generation, unsigned min_top_generation, unsigned max_top_generation);
         void instantiate();
-        bool has_work() const { return !m_new_entries.empty(); }
+        bool has_work() const { return !m_new_entries.empty() || m_revive; }
         void init_search_eh();
         bool final_check_eh();
         void push_scope();
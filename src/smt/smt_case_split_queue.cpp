@@ -24,6 +24,7 @@ Revision History:
 #include "ast/ast_pp.h"
 #include "util/map.h"
 #include "util/hashtable.h"
+#include "util/dary_heap.h"
 
 using namespace smt;
 
@@ -62,6 +63,17 @@ namespace {
 
     typedef heap<theory_aware_act_lt> theory_aware_act_queue;
 
+    struct scored_act_lt {
+        svector<double> const & m_activity;
+        svector<double> const & m_score;
+        scored_act_lt(svector<double> const & act, svector<double> const & s):m_activity(act),m_score(s) {}
+        bool operator()(bool_var v1, bool_var v2) const {
+            return m_activity[v1] + m_score[v1] > m_activity[v2] + m_score[v2];
+        }
+    };
+
+    typedef dary_heap<scored_act_lt> scored_act_queue;
+
     /**
        \brief Case split queue based on activity and random splits.
     */
@@ -1243,6 +1255,141 @@ namespace {
 
         }
     };
+    /**
+       \brief Case split queue ordered by activity plus a score supplied by the theory solvers
+       through add_theory_aware_branching_info.
+
+       The scores and preferred phases are kept in dense vectors indexed by boolean variable,
+       and the queue is a 4-ary heap. When relevancy_lvl() >= 2, variables that are not relevant
+       are dropped from the queue when they reach the top and are re-inserted by relevant_eh.
+    */
+    class scored_case_split_queue : public case_split_queue {
+        context &          m_context;
+        smt_params &       m_params;
+        svector<double>    m_score;
+        svector<lbool>     m_phase;
+        scored_act_queue   m_queue;
+
+        void reserve(bool_var v) {
+            if (v >= static_cast<bool_var>(m_score.size())) {
+                m_score.resize(v + 1, 0.0);
+                m_phase.resize(v + 1, l_undef);
+            }
+            m_queue.reserve(v + 1);
+        }
+
+        bool is_candidate(bool_var v) const {
+            return m_context.get_assignment(v) == l_undef && (m_context.relevancy_lvl() < 2 || m_context.is_relevant(v));
+        }
+
+    public:
+        scored_case_split_queue(context & ctx, smt_params & p):
+            m_context(ctx),
+            m_params(p),
+            m_queue(1024, scored_act_lt(ctx.get_activity_vector(), m_score)) {
+        }
+
+        void activity_increased_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.decreased(v);
+        }
+
+        void activity_decreased_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.increased(v);
+        }
+
+        void mk_var_eh(bool_var v) override {
+            reserve(v);
+            if (!m_queue.contains(v))
+                m_queue.insert(v);
+        }
+
+        void del_var_eh(bool_var v) override {
+            if (m_queue.contains(v))
+                m_queue.erase(v);
+            // boolean variables are recycled, so the theory information must not survive.
+            m_score[v] = 0.0;
+            m_phase[v] = l_undef;
+        }
+
+        void unassign_var_eh(bool_var v) override {
+            if (!m_queue.contains(v))
+                m_queue.insert(v);
+        }
+
+        void relevant_eh(expr * n) override {
+            if (!m_context.b_internalized(n))
+                return;
+            bool_var v = m_context.get_bool_var(n);
+            if (!m_queue.contains(v) && m_context.get_assignment(v) == l_undef)
+                m_queue.insert(v);
+        }
+
+        void init_search_eh() override {}
+
+        void end_search_eh() override {}
+
+        void reset() override {
+            m_queue.reset();
+        }
+
+        void push_scope() override {}
+
+        void pop_scope(unsigned num_scopes) override {}
+
+        void next_case_split(bool_var & next, lbool & phase) override {
+            phase = l_undef;
+
+            if (m_context.get_random_value() < static_cast<int>(m_params.m_random_var_freq * random_gen::max_value())) {
+                next = m_context.get_random_value() % m_context.get_num_b_internalized();
+                TRACE("random_split", tout << "next: " << next << " get_assignment(next): " << m_context.get_assignment(next) << "\n";);
+                if (is_candidate(next)) {
+                    phase = m_phase[next];
+                    return;
+                }
+            }
+
+            while (!m_queue.empty()) {
+                next = m_queue.erase_min();
+                if (is_candidate(next)) {
+                    phase = m_phase[next];
+                    return;
+                }
+            }
+
+            next = null_bool_var;
+        }
+
+        void add_theory_aware_branching_info(bool_var v, double priority, lbool phase) override {
+            TRACE("theory_aware_branching", tout << "Add theory-aware branching information for l#" << v << ": priority=" << priority << std::endl;);
+            reserve(v);
+            double old_score = m_score[v];
+            m_score[v] = priority;
+            m_phase[v] = phase;
+            if (m_queue.contains(v)) {
+                if (priority > old_score)
+                    m_queue.decreased(v);
+                else
+                    m_queue.increased(v);
+            }
+        }
+
+        void display(std::ostream & out) override {
+            bool first = true;
+            for (bool_var v : m_queue) {
+                if (m_context.get_assignment(v) == l_undef) {
+                    if (first) {
+                        out << "remaining case-splits:\n";
+                        first = false;
+                    }
+                    out << "#" << m_context.bool_var2expr(v)->get_id() << " ";
+                }
+            }
+            if (!first)
+                out << "\n";
+        }
+    };
 }
 
 namespace smt {
@@ -1270,6 +1417,8 @@ namespace smt {
             return alloc(rel_goal_case_split_queue, ctx, p);
         case CS_ACTIVITY_THEORY_AWARE_BRANCHING:
             return alloc(theory_aware_branching_queue, ctx, p);
+        case CS_SCORED:
+            return alloc(scored_case_split_queue, ctx, p);
         default:
             return alloc(act_case_split_queue, ctx, p);
         }
@@ -63,6 +63,88 @@ namespace smt {
         return true;
     }
 
+    unsigned cg_table::flat_table::find_slot(unsigned tid, unsigned a1, unsigned a2) const {
+        if (m_slots.empty())
+            return UINT_MAX;
+        unsigned mask = m_slots.size() - 1;
+        unsigned idx = hash(tid, a1, a2) & mask;
+        while (true) {
+            slot const& s = m_slots[idx];
+            if (is_free(s))
+                return UINT_MAX;
+            if (s.m_node != deleted() && s.m_tid == tid && s.m_arg1 == a1 && s.m_arg2 == a2)
+                return idx;
+            idx = (idx + 1) & mask;
+        }
+    }
+
+    enode * cg_table::flat_table::insert_if_not_there(unsigned tid, unsigned a1, unsigned a2, enode * n) {
+        if (4 * (m_size + m_num_deleted + 1) > 3 * m_slots.size())
+            rehash(std::max(16u, 4 * (m_size + 1) > m_slots.size() ? 2 * m_slots.size() : m_slots.size()));
+        unsigned mask = m_slots.size() - 1;
+        unsigned idx = hash(tid, a1, a2) & mask;
+        unsigned del_idx = UINT_MAX;
+        while (true) {
+            slot& s = m_slots[idx];
+            if (is_free(s))
+                break;
+            if (s.m_node == deleted()) {
+                if (del_idx == UINT_MAX)
+                    del_idx = idx;
+            }
+            else if (s.m_tid == tid && s.m_arg1 == a1 && s.m_arg2 == a2)
+                return s.m_node;
+            idx = (idx + 1) & mask;
+        }
+        if (del_idx != UINT_MAX) {
+            idx = del_idx;
+            --m_num_deleted;
+        }
+        m_slots[idx] = { tid, a1, a2, n };
+        ++m_size;
+        return n;
+    }
+
+    void cg_table::flat_table::erase(unsigned tid, unsigned a1, unsigned a2) {
+        unsigned idx = find_slot(tid, a1, a2);
+        if (idx == UINT_MAX)
+            return;
+        m_slots[idx].m_node = deleted();
+        --m_size;
+        ++m_num_deleted;
+    }
+
+    void cg_table::flat_table::rehash(unsigned capacity) {
+        svector<slot> old;
+        old.swap(m_slots);
+        m_slots.resize(capacity, slot{ 0, 0, 0, nullptr });
+        m_num_deleted = 0;
+        unsigned mask = capacity - 1;
+        for (slot const& s : old) {
+            if (!is_used(s))
+                continue;
+            unsigned idx = hash(s.m_tid, s.m_arg1, s.m_arg2) & mask;
+            while (!is_free(m_slots[idx]))
+                idx = (idx + 1) & mask;
+            m_slots[idx] = s;
+        }
+    }
+
+    void cg_table::flat_table::compact() {
+        if (m_num_deleted <= m_size && 4 * m_num_deleted <= m_slots.size())
+            return;
+        unsigned capacity = std::max(16u, m_slots.size());
+        while (capacity > 16 && 8 * m_size < capacity)
+            capacity /= 2;
+        rehash(capacity);
+    }
+
+    void cg_table::flat_table::reset() {
+        m_slots.reset();
+        m_size = 0;
+        m_num_deleted = 0;
+    }
+
     cg_table::cg_table(ast_manager & m):
         m_manager(m) {
     }
@@ -76,7 +158,8 @@ namespace smt {
         SASSERT(d->get_arity() >= 1);
         switch (d->get_arity()) {
         case 1:
-            r = TAG(void*, alloc(unary_table), UNARY);
+            // unary and binary applications are stored in m_flat.
+            r = TAG(void*, nullptr, UNARY);
             SASSERT(GET_TAG(r) == UNARY);
             return r;
         case 2:
@@ -87,12 +170,12 @@ namespace smt {
                 return r;
             }
             else if (d->is_commutative()) {
-                r = TAG(void*, alloc(comm_table, cg_comm_hash(), cg_comm_eq(m_commutativity)), BINARY_COMM);
+                r = TAG(void*, nullptr, BINARY_COMM);
                 SASSERT(GET_TAG(r) == BINARY_COMM);
                 return r;
             }
             else {
-                r = TAG(void*, alloc(binary_table), BINARY);
+                r = TAG(void*, nullptr, BINARY);
                 SASSERT(GET_TAG(r) == BINARY);
                 return r;
             }
@@ -124,22 +207,11 @@ namespace smt {
     
     void cg_table::reset() {
         for (void* t : m_tables) {
-            switch (GET_TAG(t)) {
-            case UNARY:
-                dealloc(UNTAG(unary_table*, t));
-                break;
-            case BINARY:
-                dealloc(UNTAG(binary_table*, t));
-                break;
-            case BINARY_COMM:
-                dealloc(UNTAG(comm_table*, t));
-                break;
-            case NARY:
+            if (GET_TAG(t) == NARY)
                 dealloc(UNTAG(table*, t));
-                break;
-            }
         }
         m_tables.reset();
+        m_flat.reset();
         for (auto const& kv : m_func_decl2id) {
             m_manager.dec_ref(kv.m_key);
         }
@@ -150,47 +222,16 @@ namespace smt {
         for (auto const& kv : m_func_decl2id) {
             void * t = m_tables[kv.m_value];
             out << mk_pp(kv.m_key, m_manager) << ": ";
-            switch (GET_TAG(t)) {
-            case UNARY: 
-                display_unary(out, t);
-                break;            
-            case BINARY: 
-                display_binary(out, t);
-                break;
-            case BINARY_COMM: 
-                display_binary_comm(out, t);
-                break;            
-            case NARY: 
+            if (GET_TAG(t) == NARY)
                 display_nary(out, t);
-                break;
-            }
+            else
+                display_flat(out, kv.m_value);
         }        
     }
 
-    void cg_table::display_binary(std::ostream& out, void* t) const {
-        binary_table* tb = UNTAG(binary_table*, t);
-        out << "b ";
-        for (enode* n : *tb) {
-            out << n->get_owner_id() << " " << cg_binary_hash()(n) << " ";
-        }
-        out << "\n";
-    }
-    
-    void cg_table::display_binary_comm(std::ostream& out, void* t) const {
-        comm_table* tb = UNTAG(comm_table*, t);
-        out << "bc ";
-        for (enode* n : *tb) {
-            out << n->get_owner_id() << " ";
-        }
-        out << "\n";
-    }
-    
-    void cg_table::display_unary(std::ostream& out, void* t) const {
-        unary_table* tb = UNTAG(unary_table*, t);
-        out << "un ";
-        for (enode* n : *tb) {
-            out << n->get_owner_id() << " ";
-        }
+    void cg_table::display_flat(std::ostream& out, unsigned tid) const {
+        out << "flat ";
+        m_flat.for_each(tid, [&](enode* n) { out << n->get_owner_id() << " "; });
         out << "\n";
     }
     
@@ -213,17 +254,20 @@ namespace smt {
         void * t = get_table(n); 
         switch (static_cast<table_kind>(GET_TAG(t))) {
         case UNARY:
-            n_prime = UNTAG(unary_table*, t)->insert_if_not_there(n);
-            return enode_bool_pair(n_prime, false);
-        case BINARY:
-            n_prime = UNTAG(binary_table*, t)->insert_if_not_there(n);
-            TRACE("cg_table", tout << "insert: " << n->get_owner_id() << " " << cg_binary_hash()(n) << " inserted: " << (n == n_prime) << " " << n_prime->get_owner_id() << "\n";
-                  display_binary(tout, t); tout << "contains_ptr: " << contains_ptr(n) << "\n";); 
+        case BINARY: {
+            unsigned a1, a2;
+            signature(n, false, a1, a2);
+            n_prime = m_flat.insert_if_not_there(n->get_func_decl_id(), a1, a2, n);
+            TRACE("cg_table", tout << "insert: " << n->get_owner_id() << " inserted: " << (n == n_prime) << " " << n_prime->get_owner_id() << "\n";);
             return enode_bool_pair(n_prime, false);
-        case BINARY_COMM:
-            m_commutativity = false;
-            n_prime = UNTAG(comm_table*, t)->insert_if_not_there(n);
-            return enode_bool_pair(n_prime, m_commutativity);
+        }
+        case BINARY_COMM: {
+            unsigned a1, a2;
+            signature(n, true, a1, a2);
+            n_prime = m_flat.insert_if_not_there(n->get_func_decl_id(), a1, a2, n);
+            bool comm = n_prime != n && n_prime->get_arg(0)->get_root() != n->get_arg(0)->get_root();
+            return enode_bool_pair(n_prime, comm);
+        }
         default:
             n_prime = UNTAG(table*, t)->insert_if_not_there(n);
             return enode_bool_pair(n_prime, false);
@@ -235,15 +279,14 @@ namespace smt {
         void * t = get_table(n); 
         switch (static_cast<table_kind>(GET_TAG(t))) {
         case UNARY:
-            UNTAG(unary_table*, t)->erase(n);
-            break;
         case BINARY:
-            TRACE("cg_table", tout << "erase: " << n->get_owner_id() << " " << cg_binary_hash()(n) << " contains: " << contains_ptr(n) << "\n";);
-            UNTAG(binary_table*, t)->erase(n);
-            break;
-        case BINARY_COMM:
-            UNTAG(comm_table*, t)->erase(n);
+        case BINARY_COMM: {
+            unsigned a1, a2;
+            signature(n, GET_TAG(t) == BINARY_COMM, a1, a2);
+            TRACE("cg_table", tout << "erase: " << n->get_owner_id() << " contains: " << contains_ptr(n) << "\n";);
+            m_flat.erase(n->get_func_decl_id(), a1, a2);
             break;
+        }
         default:
             UNTAG(table*, t)->erase(n);
             break;
@@ -32,79 +32,57 @@ namespace smt {
        \brief Congruence table.
     */
     class cg_table {
-        struct cg_unary_hash {
-            unsigned operator()(enode * n) const {
-                SASSERT(n->get_num_args() == 1);
-                return n->get_arg(0)->get_root()->hash();
-            }
-        };
-
-        struct cg_unary_eq {
-            bool operator()(enode * n1, enode * n2) const {
-                SASSERT(n1->get_num_args() == 1);
-                SASSERT(n2->get_num_args() == 1);
-                SASSERT(n1->get_decl() == n2->get_decl());
-                return n1->get_arg(0)->get_root() == n2->get_arg(0)->get_root();
-            }
-        };
-
-        typedef chashtable<enode *, cg_unary_hash, cg_unary_eq> unary_table;
-        
-        struct cg_binary_hash {
-            unsigned operator()(enode * n) const {
-                SASSERT(n->get_num_args() == 2);
-                return combine_hash(n->get_arg(0)->get_root()->hash(), n->get_arg(1)->get_root()->hash());
-            }
-        };
-
-        struct cg_binary_eq {
-            bool operator()(enode * n1, enode * n2) const {
-                SASSERT(n1->get_num_args() == 2);
-                SASSERT(n2->get_num_args() == 2);
-                SASSERT(n1->get_decl() == n2->get_decl());
-                return 
-                    n1->get_arg(0)->get_root() == n2->get_arg(0)->get_root() &&
-                    n1->get_arg(1)->get_root() == n2->get_arg(1)->get_root();
+        /**
+           \brief Open addressing table for unary and binary applications.
+
+           A slot stores the signature of an application: the id of its table
+           (one per function symbol) and the ids of the roots of its arguments,
+           so that probing does not dereference enodes. The arguments of
+           commutative applications are stored in increasing order.
+           Erased slots are marked as deleted and removed by rehashing, which
+           is triggered on insertion or in batch when scopes are popped.
+        */
+        class flat_table {
+            struct slot {
+                unsigned m_tid;
+                unsigned m_arg1;
+                unsigned m_arg2;
+                enode *  m_node;
+            };
+            svector<slot> m_slots;
+            unsigned      m_size = 0;
+            unsigned      m_num_deleted = 0;
+
+            static enode * deleted() { return reinterpret_cast<enode*>(1); }
+            static bool is_free(slot const& s) { return s.m_node == nullptr; }
+            static bool is_used(slot const& s) { return s.m_node != nullptr && s.m_node != deleted(); }
+
+            static unsigned hash(unsigned tid, unsigned a1, unsigned a2) {
+                unsigned a = tid, b = a1, c = a2;
+                mix(a, b, c);
+                return c;
             }
-        };
+            void rehash(unsigned capacity);
+            unsigned find_slot(unsigned tid, unsigned a1, unsigned a2) const;
 
-        typedef chashtable<enode*, cg_binary_hash, cg_binary_eq> binary_table;
-        
-        struct cg_comm_hash {
-            unsigned operator()(enode * n) const {
-                SASSERT(n->get_num_args() == 2);
-                unsigned h1 = n->get_arg(0)->get_root()->hash();
-                unsigned h2 = n->get_arg(1)->get_root()->hash();
-                if (h1 > h2)
-                    std::swap(h1, h2);
-                return hash_u((h1 << 16) | (h2 & 0xFFFF));
+        public:
+            enode * find(unsigned tid, unsigned a1, unsigned a2) const {
+                unsigned idx = find_slot(tid, a1, a2);
+                return idx == UINT_MAX ? nullptr : m_slots[idx].m_node;
             }
-        };
-        
-        struct cg_comm_eq {
-            bool & m_commutativity;
-            cg_comm_eq(bool & c):m_commutativity(c) {}
-            bool operator()(enode * n1, enode * n2) const {
-                SASSERT(n1->get_num_args() == 2);
-                SASSERT(n2->get_num_args() == 2);
-                SASSERT(n1->get_decl() == n2->get_decl());
-                enode * c1_1 = n1->get_arg(0)->get_root();
-                enode * c1_2 = n1->get_arg(1)->get_root();
-                enode * c2_1 = n2->get_arg(0)->get_root();
-                enode * c2_2 = n2->get_arg(1)->get_root();
-                if (c1_1 == c2_1 && c1_2 == c2_2) {
-                    return true;
-                }
-                if (c1_1 == c2_2 && c1_2 == c2_1) {
-                    m_commutativity = true;
-                    return true;
-                }
-                return false;
+            enode * insert_if_not_there(unsigned tid, unsigned a1, unsigned a2, enode * n);
+            void erase(unsigned tid, unsigned a1, unsigned a2);
+            void compact();
+            void reset();
+            unsigned size() const { return m_size; }
+            template<typename F>
+            void for_each(unsigned tid, F const& f) const {
+                for (slot const& s : m_slots)
+                    if (is_used(s) && s.m_tid == tid)
+                        f(s.m_node);
             }
         };
 
-        typedef chashtable<enode*, cg_comm_hash, cg_comm_eq> comm_table;
-
         struct cg_hash {
             unsigned operator()(enode * n) const;
         };
@@ -116,8 +94,8 @@ namespace smt {
         typedef chashtable<enode*, cg_hash, cg_eq> table;
 
         ast_manager &                 m_manager;
-        bool                          m_commutativity; //!< true if the last found congruence used commutativity
         ptr_vector<void>              m_tables;
+        flat_table                    m_flat;
         obj_map<func_decl, unsigned>  m_func_decl2id;
 
         enum table_kind {
@@ -128,6 +106,13 @@ namespace smt {
         };
 
         void * mk_table_for(func_decl * d);
+
+        static void signature(enode * n, bool comm, unsigned& a1, unsigned& a2) {
+            a1 = n->get_arg(0)->get_root()->get_owner_id();
+            a2 = n->get_num_args() == 1 ? 0 : n->get_arg(1)->get_root()->get_owner_id();
+            if (comm && a1 > a2)
+                std::swap(a1, a2);
+        }
         unsigned set_func_decl_id(enode * n);
         
         void * get_table(enode * n) {
@@ -153,18 +138,7 @@ namespace smt {
         void erase(enode * n);
 
         bool contains(enode * n) const {
-            SASSERT(n->get_num_args() > 0);
-            void * t = const_cast<cg_table*>(this)->get_table(n); 
-            switch (static_cast<table_kind>(GET_TAG(t))) {
-            case UNARY:
-                return UNTAG(unary_table*, t)->contains(n);
-            case BINARY:
-                return UNTAG(binary_table*, t)->contains(n);
-            case BINARY_COMM:
-                return UNTAG(comm_table*, t)->contains(n);
-            default:
-                return UNTAG(table*, t)->contains(n);
-            }
+            return find(n) != nullptr;
         }
 
         enode * find(enode * n) const {
@@ -173,41 +147,31 @@ namespace smt {
             void * t = const_cast<cg_table*>(this)->get_table(n); 
             switch (static_cast<table_kind>(GET_TAG(t))) {
             case UNARY:
-                return UNTAG(unary_table*, t)->find(n, r) ? r : nullptr;
             case BINARY:
-                return UNTAG(binary_table*, t)->find(n, r) ? r : nullptr;
-            case BINARY_COMM:
-                return UNTAG(comm_table*, t)->find(n, r) ? r : nullptr;
+            case BINARY_COMM: {
+                unsigned a1, a2;
+                signature(n, GET_TAG(t) == BINARY_COMM, a1, a2);
+                return m_flat.find(n->get_func_decl_id(), a1, a2);
+            }
             default:
                 return UNTAG(table*, t)->find(n, r) ? r : nullptr;
             }
         }
 
         bool contains_ptr(enode * n) const {
-            enode * r;
-            SASSERT(n->get_num_args() > 0);
-            void * t = const_cast<cg_table*>(this)->get_table(n); 
-            switch (static_cast<table_kind>(GET_TAG(t))) {
-            case UNARY:
-                return UNTAG(unary_table*, t)->find(n, r) && n == r;
-            case BINARY:
-                return UNTAG(binary_table*, t)->find(n, r) && n == r;
-            case BINARY_COMM:
-                return UNTAG(comm_table*, t)->find(n, r) && n == r;
-            default:
-                return UNTAG(table*, t)->find(n, r) && n == r;
-            }
+            return find(n) == n;
         }
 
+        /**
+           \brief Remove deleted entries after scopes were popped.
+        */
+        void pop_scope_eh() { m_flat.compact(); }
+
         void reset();
 
         void display(std::ostream & out) const;
 
-        void display_binary(std::ostream& out, void* t) const;
-
-        void display_binary_comm(std::ostream& out, void* t) const;
-
-        void display_unary(std::ostream& out, void* t) const;
+        void display_flat(std::ostream& out, unsigned tid) const;
 
         void display_nary(std::ostream& out, void* t) const;
 
@@ -67,7 +67,7 @@ namespace smt {
         static unsigned get_obj_size(unsigned num_lits, clause_kind k, bool has_atoms, bool has_del_eh, bool has_justification) {
             unsigned r = sizeof(clause) + sizeof(literal) * num_lits;
             if (smt::is_lemma(k)) 
-                r += sizeof(unsigned);
+                r += 2 * sizeof(unsigned);
             /* dvitek: Fix alignment issues on 64-bit platforms.  The
              * 'if' statement below probably isn't worthwhile since
              * I'm guessing the allocator is probably going to round
@@ -92,10 +92,19 @@ namespace smt {
             return reinterpret_cast<unsigned *>(m_lits + m_capacity);
         }
 
+        // glue of a lemma in the upper 24 bits, rounds without use in the lower 7 bits, and a used flag.
+        unsigned const * get_glue_addr() const {
+            return get_activity_addr() + 1;
+        }
+
+        unsigned * get_glue_addr() {
+            return get_activity_addr() + 1;
+        }
+
         clause_del_eh * const * get_del_eh_addr() const {
             unsigned const * addr = get_activity_addr();
             if (is_lemma())
-                addr ++;
+                addr += 2;
             /* dvitek: It would be better to use uintptr_t than
              * size_t, but we need to wait until c++11 support is
              * really available.
@@ -250,6 +259,52 @@ namespace smt {
             set_activity(get_activity() + 1);
         }
 
+        /**
+           \brief Number of decision levels in the lemma when it was created,
+           or the smallest number seen since during conflict resolution.
+        */
+        unsigned get_glue() const {
+            SASSERT(is_lemma());
+            return *(get_glue_addr()) >> 8;
+        }
+
+        void set_glue(unsigned glue) {
+            SASSERT(is_lemma());
+            glue = std::min(glue, (1u << 24) - 1);
+            *(get_glue_addr()) = (glue << 8) | (*(get_glue_addr()) & 0xFF);
+        }
+
+        bool was_used() const {
+            SASSERT(is_lemma());
+            return (*(get_glue_addr()) & 0x80) != 0;
+        }
+
+        void mark_used() {
+            SASSERT(is_lemma());
+            *(get_glue_addr()) |= 0x80;
+        }
+
+        void unmark_used() {
+            SASSERT(is_lemma());
+            *(get_glue_addr()) &= ~0x80u;
+        }
+
+        unsigned inact_rounds() const {
+            SASSERT(is_lemma());
+            return *(get_glue_addr()) & 0x7F;
+        }
+
+        void inc_inact_rounds() {
+            SASSERT(is_lemma());
+            if (inact_rounds() < 0x7F)
+                ++*(get_glue_addr());
+        }
+
+        void reset_inact_rounds() {
+            SASSERT(is_lemma());
+            *(get_glue_addr()) &= ~0x7Fu;
+        }
+
         std::ostream& display(std::ostream & out, ast_manager & m, expr * const * bool_var2expr_map) const;
         
         std::ostream& display_smt2(std::ostream & out, ast_manager & m, expr * const * bool_var2expr_map) const;
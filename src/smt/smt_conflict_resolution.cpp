@@ -521,8 +521,15 @@ namespace smt {
             case b_justification::CLAUSE: {
                 clause * cls = js.get_clause();
                 TRACE("conflict_smt2", m_ctx.display_clause_smt2(tout, *cls););
-                if (cls->is_lemma())
+                if (cls->is_lemma()) {
                     cls->inc_clause_activity();
+                    if (m_ctx.get_fparams().m_lemma_gc_tiered) {
+                        cls->mark_used();
+                        unsigned glue = m_ctx.compute_glue(*cls);
+                        if (glue < cls->get_glue())
+                            cls->set_glue(glue);
+                    }
+                }
                 unsigned num_lits = cls->get_num_literals();
                 unsigned i        = 0;
                 if (consequent != false_literal) {
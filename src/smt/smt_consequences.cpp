@@ -375,7 +375,9 @@ namespace smt {
         m_case_split_queue->init_search_eh();
         unsigned num_iterations = 0;
         unsigned num_fixed_eqs = 0;
-        unsigned chunk_size = 100; 
+        // rounds that end without a model only fix candidates, test more candidates per round after them.
+        unsigned chunk_size = m_fparams.m_consequences_chunk_size;
+        unsigned const max_chunk_size = std::max(chunk_size, 100u * m_fparams.m_consequences_chunk_size);
 
         init_assumptions(assumptions);
         num_units = 0;
@@ -434,6 +436,10 @@ namespace smt {
             if (is_sat == l_true) {
                 TRACE("context", display(tout););
                 delete_unfixed(unfixed);
+                chunk_size = m_fparams.m_consequences_chunk_size;
+            }
+            else if (num_vars >= chunk_size) {
+                chunk_size = std::min(2 * chunk_size, max_chunk_size);
             }
             extract_fixed_consequences(num_units, _assumptions, conseq);
             num_fixed_eqs += extract_fixed_eqs(conseq);
@@ -69,6 +69,8 @@ namespace smt {
         m_b_internalized_stack(m),
         m_e_internalized_stack(m),
         m_l_internalized_stack(m),
+        m_term_pops_pinned(m),
+        m_terms_to_revive(m),
         m_final_check_idx(0),
         m_cg_table(m),
         m_units_to_reassert(m),
@@ -1694,6 +1696,7 @@ namespace smt {
      */
     bool context::propagate() {
         TRACE("propagate", tout << "propagating... " << m_qhead << ":" << m_assigned_literals.size() << "\n";);
+        scoped_watch_if _sw(m_phase_times.m_propagate, m_fparams.m_phase_timing);
         while (true) {
             if (inconsistent())
                 return false;
@@ -2386,6 +2389,54 @@ namespace smt {
         }
     }
 
+    /**
+       \brief Count the terms whose enodes are removed when backtracking to new_lvl < m_base_lvl.
+       Terms that were removed by m_revive_terms user pops are re-internalized by revive_terms.
+       Terms that are only referenced by m_term_pops are forgotten.
+    */
+    void context::record_popped_terms(unsigned new_lvl) {
+        for (unsigned i = m_e_internalized_stack.size(); i-- > 0; ) {
+            expr * n = m_e_internalized_stack.get(i);
+            if (get_enode(n)->get_iscope_lvl() <= new_lvl)
+                break;
+            auto * e = m_term_pops.insert_if_not_there3(n, 0);
+            if (e->get_data().m_value == 0)
+                m_term_pops_pinned.push_back(n);
+            if (++e->get_data().m_value == m_fparams.m_revive_terms)
+                m_terms_to_revive.push_back(n);
+        }
+        unsigned j = 0;
+        for (expr * n : m_term_pops_pinned) {
+            if (n->get_ref_count() == 1 && m_term_pops[n] < m_fparams.m_revive_terms) 
+                m_term_pops.remove(n);
+            else 
+                m_term_pops_pinned[j++] = n;
+        }
+        m_term_pops_pinned.shrink(j);
+    }
+
+    /**
+       \brief Internalize at the base level the terms that were repeatedly removed by user pops,
+       so that later scopes can reuse their enodes, boolean variables and theory variables.
+    */
+    void context::revive_terms() {
+        if (m_terms_to_revive.empty() || m_scope_lvl != m_base_lvl || inconsistent())
+            return;
+        TRACE("revive_terms", tout << "reviving " << m_terms_to_revive.size() << " terms\n";);
+        for (expr * n : m_terms_to_revive) {
+            m_term_pops.remove(n);
+            if (!e_internalized(n))
+                internalize(n, false);
+        }
+        m_stats.m_num_revived_terms += m_terms_to_revive.size();
+        m_terms_to_revive.reset();
+        unsigned j = 0;
+        for (expr * n : m_term_pops_pinned) 
+            if (m_term_pops.contains(n))
+                m_term_pops_pinned[j++] = n;
+        m_term_pops_pinned.shrink(j);
+    }
+
     /**
        \brief Backtrack 'num_scopes' scope levels. Return the number
        of boolean variables before reinitializing clauses. This value
@@ -2420,6 +2471,8 @@ namespace smt {
             units_to_reassert_lim = s.m_units_to_reassert_lim;
 
             if (new_lvl < m_base_lvl) {
+                if (m_fparams.m_revive_terms > 0)
+                    record_popped_terms(new_lvl);
                 base_scope & bs = m_base_scopes[new_lvl];
                 del_clauses(m_lemmas, bs.m_lemmas_lim);
                 m_simp_qhead = bs.m_simp_qhead_lim;
@@ -2448,6 +2501,7 @@ namespace smt {
             del_justifications(m_justifications, s.m_justifications_lim);
 
             m_asserted_formulas.pop_scope(num_scopes);
+            m_cg_table.pop_scope_eh();
 
             CTRACE("propagate_atoms", !m_atom_propagation_queue.empty(), tout << m_atom_propagation_queue << "\n";);
 
@@ -2654,6 +2708,7 @@ namespace smt {
         // Remark: when assumptions are used m_scope_lvl >= m_search_lvl > m_base_lvl. Therefore, no simplification is performed.
         if (m_scope_lvl > m_base_lvl)
             return;
+        scoped_watch_if _sw(m_phase_times.m_simplify, m_fparams.m_phase_timing);
 
         unsigned sz = m_assigned_literals.size();
         SASSERT(m_simp_qhead <= sz);
@@ -2718,6 +2773,9 @@ namespace smt {
     inline void context::del_inactive_lemmas() {
         if (m_fparams.m_lemma_gc_strategy == LGC_NONE)
             return;
+        scoped_watch_if _sw(m_phase_times.m_gc, m_fparams.m_phase_timing);
+        if (m_fparams.m_lemma_gc_tiered)
+            del_inactive_lemmas3();
         else if (m_fparams.m_lemma_gc_half)
             del_inactive_lemmas1();
         else
@@ -2833,6 +2891,107 @@ namespace smt {
         IF_VERBOSE(2, verbose_stream() << " :num-deleted-clauses " << num_del_cls << ")" << std::endl;);
     }
 
+    /**
+       \brief Delete lemmas based on three tiers of glue.
+       - core:  lemmas with glue at most lemma_gc_core_glue are kept.
+       - tier2: lemmas with glue at most lemma_gc_tier2_glue are kept while they are used in conflicts.
+                They are moved to the local tier after lemma_gc_tier2_rounds rounds without use.
+       - local: the unused half of the remaining lemmas, ordered by glue and activity, is deleted.
+       The m_recent_lemmas_size most recent lemmas are not considered.
+    */
+    void context::del_inactive_lemmas3() {
+        unsigned sz            = m_lemmas.size();
+        unsigned start_at      = m_base_lvl == 0 ? 0 : m_base_scopes[m_base_lvl - 1].m_lemmas_lim;
+        SASSERT(start_at <= sz);
+        if (start_at + m_fparams.m_recent_lemmas_size >= sz)
+            return;
+        unsigned end_at        = sz - m_fparams.m_recent_lemmas_size;
+        unsigned num_core = 0, num_tier2 = 0, num_del_cls = 0;
+        clause_vector local;
+        unsigned j = start_at;
+        for (unsigned i = start_at; i < end_at; ++i) {
+            clause * cls = m_lemmas[i];
+            if (cls->deleted() && can_delete(cls)) {
+                del_clause(true, cls);
+                num_del_cls++;
+                continue;
+            }
+            unsigned glue = cls->get_glue();
+            if (glue <= m_fparams.m_lemma_gc_core_glue) {
+                ++num_core;
+                cls->unmark_used();
+                m_lemmas[j++] = cls;
+                continue;
+            }
+            if (glue <= m_fparams.m_lemma_gc_tier2_glue) {
+                if (cls->was_used())
+                    cls->reset_inact_rounds();
+                else
+                    cls->inc_inact_rounds();
+                if (cls->inact_rounds() <= m_fparams.m_lemma_gc_tier2_rounds) {
+                    ++num_tier2;
+                    cls->unmark_used();
+                    m_lemmas[j++] = cls;
+                    continue;
+                }
+            }
+            local.push_back(cls);
+        }
+        std::stable_sort(local.begin(), local.end(), [](clause * c1, clause * c2) {
+            if (c1->was_used() != c2->was_used()) return c1->was_used();
+            if (c1->get_glue() != c2->get_glue()) return c1->get_glue() < c2->get_glue();
+            return c1->get_activity() > c2->get_activity();
+        });
+        unsigned num_local = local.size();
+        for (unsigned i = 0; i < num_local; ++i) {
+            clause * cls = local[i];
+            if (i >= num_local / 2 && !cls->was_used() && can_delete(cls)) {
+                del_clause(true, cls);
+                num_del_cls++;
+                continue;
+            }
+            cls->reset_inact_rounds();
+            cls->unmark_used();
+            m_lemmas[j++] = cls;
+        }
+        // keep recent clauses
+        for (unsigned i = end_at; i < sz; i++) {
+            clause * cls = m_lemmas[i];
+            if (cls->deleted() && can_delete(cls)) {
+                del_clause(true, cls);
+                num_del_cls++;
+            }
+            else {
+                m_lemmas[j++] = cls;
+            }
+        }
+        m_lemmas.shrink(j);
+        IF_VERBOSE(2, verbose_stream() << "(smt.delete-inactive-lemmas :core " << num_core << " :tier2 " << num_tier2
+                   << " :local " << num_local << " :num-deleted-clauses " << num_del_cls << ")" << std::endl;);
+    }
+
+    /**
+       \brief Return the number of distinct decision levels of the literals.
+       Unassigned literals count as one additional level.
+    */
+    unsigned context::compute_glue(unsigned num_lits, literal const * lits) {
+        if (++m_glue_stamp == 0) {
+            m_glue_stamps.reset();
+            m_glue_stamp = 1;
+        }
+        m_glue_stamps.reserve(m_scope_lvl + 2, 0);
+        unsigned glue = 0;
+        for (unsigned i = 0; i < num_lits; ++i) {
+            literal l = lits[i];
+            unsigned lvl = get_assignment(l) == l_undef ? m_scope_lvl + 1 : get_assign_level(l);
+            if (m_glue_stamps[lvl] != m_glue_stamp) {
+                m_glue_stamps[lvl] = m_glue_stamp;
+                ++glue;
+            }
+        }
+        return glue;
+    }
+
     /**
        \brief Return true if "cls" has more than (or equal to) k unassigned literals.
     */
@@ -3209,6 +3368,7 @@ namespace smt {
         if (m_internalizing_assertions) return;
         flet<bool> _internalizing(m_internalizing_assertions, true);
         TRACE("internalize_assertions", tout << "internalize_assertions()...\n";);
+        revive_terms();
         timeit tt(get_verbosity_level() >= 100, "smt.preprocessing");
         unsigned qhead = 0;
         do {
@@ -3791,10 +3951,13 @@ namespace smt {
             return false;
         if (status == l_true && m_qmanager->has_quantifiers()) {
             // possible outcomes   DONE l_true, DONE l_undef, CONTINUE
-            mk_proto_model();
             quantifier_manager::check_model_result cmr = quantifier_manager::UNKNOWN;
-            if (m_proto_model.get()) {
-                cmr = m_qmanager->check_model(m_proto_model.get(), m_model_generator->get_root2value());
+            {
+                scoped_watch_if _sw(m_phase_times.m_mbqi, m_fparams.m_phase_timing);
+                mk_proto_model();
+                if (m_proto_model.get()) {
+                    cmr = m_qmanager->check_model(m_proto_model.get(), m_model_generator->get_root2value());
+                }
             }
             switch (cmr) {
             case quantifier_manager::SAT:
@@ -3985,6 +4148,7 @@ namespace smt {
     final_check_status context::final_check() {
         TRACE("final_check", tout << "final_check inconsistent: " << inconsistent() << "\n"; display(tout); display_normalized_enodes(tout););
         CASSERT("relevancy", check_relevancy());
+        scoped_watch_if _sw(m_phase_times.m_final_check, m_fparams.m_phase_timing);
         
         if (m_fparams.m_model_on_final_check) {
             mk_proto_model();
@@ -4080,6 +4244,7 @@ namespace smt {
 
 
     bool context::resolve_conflict() {
+        scoped_watch_if _sw(m_phase_times.m_conflict, m_fparams.m_phase_timing);
         m_stats.m_num_conflicts++;
         m_num_conflicts ++;
         m_num_conflicts_since_restart ++;
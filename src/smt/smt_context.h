@@ -43,6 +43,7 @@ Revision History:
 #include "util/trail.h"
 #include "util/ref.h"
 #include "util/timer.h"
+#include "util/stopwatch.h"
 #include "util/statistics.h"
 #include "smt/fingerprints.h"
 #include "smt/proto_model/proto_model.h"
@@ -78,6 +79,12 @@ namespace smt {
     public:
         statistics                  m_stats;
 
+        // time spent per phase of the search, collected when smt.phase_timing is set.
+        struct phase_times {
+            stopwatch m_propagate, m_conflict, m_final_check, m_simplify, m_gc, m_mbqi;
+        };
+        phase_times                 m_phase_times;
+
         std::ostream& display_last_failure(std::ostream& out) const;
         std::string last_failure_as_string() const;
         void set_reason_unknown(char const* msg) { m_unknown = msg; }
@@ -114,6 +121,15 @@ namespace smt {
         expr_ref_vector             m_e_internalized_stack; // stack of the expressions already internalized as enodes.
         quantifier_ref_vector       m_l_internalized_stack;
 
+        // terms removed by user pops and the number of times they were removed (smt.revive_terms).
+        obj_map<expr, unsigned>     m_term_pops;
+        expr_ref_vector             m_term_pops_pinned;
+        expr_ref_vector             m_terms_to_revive;
+
+        void record_popped_terms(unsigned new_lvl);
+
+        void revive_terms();
+
         ptr_vector<justification>   m_justifications;
 
         unsigned                    m_final_check_idx = 0; // circular counter used for implementing fairness
@@ -464,6 +480,12 @@ namespace smt {
             return get_assign_level(l.var());
         }
 
+        unsigned compute_glue(unsigned num_lits, literal const * lits);
+
+        unsigned compute_glue(clause const & cls) {
+            return compute_glue(cls.get_num_literals(), cls.begin());
+        }
+
         /**
            \brief Return the scope level when v was internalized.
         */
@@ -1008,6 +1030,8 @@ namespace smt {
         unsigned           m_luby_idx;
         double             m_agility;
         unsigned           m_lemma_gc_threshold;
+        unsigned_vector    m_glue_stamps;
+        unsigned           m_glue_stamp { 0 };
 
         void assign_core(literal l, b_justification j, bool decision = false);
         void trace_assign(literal l, b_justification j, bool decision) const;
@@ -1211,6 +1235,8 @@ namespace smt {
 
         void del_inactive_lemmas2();
 
+        void del_inactive_lemmas3();
+
         bool more_than_k_unassigned_literals(clause * cls, unsigned k);
 
 
@@ -1725,6 +1751,19 @@ namespace smt {
             m_clause_proof.register_on_clause(ctx, on_clause);
         }
 
+        /**
+           \brief Register a callback that is invoked on learned clauses and theory lemmas
+           after they are simplified. Used for sharing lemmas between parallel workers.
+        */
+        typedef std::function<void(unsigned, literal const*)> lemma_eh_t;
+
+        void register_on_lemma(lemma_eh_t const& on_lemma) { m_on_lemma = on_lemma; }
+
+    protected:
+        lemma_eh_t m_on_lemma;
+
+    public:
+
         /*
          * user-propagator
          */
@@ -1746,6 +1785,12 @@ namespace smt {
             m_user_propagator->register_fixed(fixed_eh);
         }
         
+        void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) {
+            if (!m_user_propagator) 
+                throw default_exception("user propagator must be initialized");
+            m_user_propagator->register_fixed_batch(fixed_batch_eh);
+        }
+        
         void user_propagate_register_eq(user_propagator::eq_eh_t& eq_eh) {
             if (!m_user_propagator) 
                 throw default_exception("user propagator must be initialized");
@@ -421,8 +421,19 @@ namespace smt {
         st.update("interface eqs", m_stats.m_num_interface_eqs);
         st.update("max generation", m_stats.m_max_generation);
         st.update("minimized lits", m_stats.m_num_minimized_lits);
+        if (m_stats.m_num_revived_terms > 0)
+            st.update("revived terms", m_stats.m_num_revived_terms);
         st.update("num checks", m_stats.m_num_checks);
         st.update("mk bool var", m_stats.m_num_mk_bool_var ? m_stats.m_num_mk_bool_var - 1 : 0);
+        if (m_fparams.m_phase_timing) {
+            st.update("time propagate", m_phase_times.m_propagate.get_seconds());
+            st.update("time conflict", m_phase_times.m_conflict.get_seconds());
+            st.update("time final check", m_phase_times.m_final_check.get_seconds());
+            st.update("time simplify", m_phase_times.m_simplify.get_seconds());
+            st.update("time gc", m_phase_times.m_gc.get_seconds());
+            st.update("time mbqi", m_phase_times.m_mbqi.get_seconds());
+        }
+        m_region.collect_statistics(st);
         m_qmanager->collect_statistics(st);
         m_asserted_formulas.collect_statistics(st);
         for (theory* th : m_theory_set) {
@@ -1422,6 +1422,8 @@ namespace smt {
 
         unsigned activity = 1;
         bool  lemma = is_lemma(k);
+        if (lemma && m_on_lemma)
+            m_on_lemma(num_lits, lits);
         m_stats.m_num_mk_lits += num_lits;
         switch (num_lits) {
         case 0:
@@ -1467,6 +1469,7 @@ namespace smt {
             m_clause_proof.add(*cls, &simp_lits);
             if (lemma) {
                 cls->set_activity(activity);
+                cls->set_glue(compute_glue(*cls));
                 if (k == CLS_LEARNED) {
                     int w2_idx  = select_learned_watch_lit(cls);
                     cls->swap_lits(1, w2_idx);
@@ -1657,7 +1660,7 @@ namespace smt {
     }
 
     void context::add_and_rel_watches(app * n) {
-        if (relevancy()) {
+        if (relevancy() && !m_relevancy_propagator->lazy_watches()) {
             relevancy_eh * eh = m_relevancy_propagator->mk_and_relevancy_eh(n);
             for (expr * arg : *n) {
                 // if one child is assigned to false, the and-parent must be notified
@@ -1668,7 +1671,7 @@ namespace smt {
     }
 
     void context::add_or_rel_watches(app * n) {
-        if (relevancy()) {
+        if (relevancy() && !m_relevancy_propagator->lazy_watches()) {
             relevancy_eh * eh = m_relevancy_propagator->mk_or_relevancy_eh(n);
             for (expr * arg : *n) {
                 // if one child is assigned to true, the or-parent must be notified
@@ -282,6 +282,10 @@ namespace smt {
         m_imp->m_kernel.user_propagate_register_fixed(fixed_eh);
     }
     
+    void kernel::user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) {
+        m_imp->m_kernel.user_propagate_register_fixed_batch(fixed_batch_eh);
+    }
+    
     void kernel::user_propagate_register_final(user_propagator::final_eh_t& final_eh) {
         m_imp->m_kernel.user_propagate_register_final(final_eh);
     }
@@ -310,6 +310,8 @@ namespace smt {
 
         void user_propagate_register_fixed(user_propagator::fixed_eh_t& fixed_eh);
 
+        void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh);
+
         void user_propagate_register_final(user_propagator::final_eh_t& final_eh);
         
         void user_propagate_register_eq(user_propagator::eq_eh_t& eq_eh);
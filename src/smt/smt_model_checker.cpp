@@ -33,8 +33,14 @@ Revision History:
 #include "smt/smt_model_checker.h"
 #include "smt/smt_context.h"
 #include "smt/smt_model_finder.h"
+#include "ast/ast_translation.h"
 #include "model/model_pp.h"
 #include <tuple>
+#include <atomic>
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <mutex>
+#endif
 
 namespace smt {
 
@@ -53,7 +59,24 @@ namespace smt {
         m_pinned_exprs(m) {
     }
 
+    /**
+       \brief Auxiliary context with its own manager, used to check
+       quantifiers against the candidate model in parallel.
+    */
+    struct model_checker::worker {
+        ast_manager         m;
+        smt_params          m_params;
+        scoped_ptr<context> m_ctx;
+        worker(ast_manager & src, smt_params const & p):
+            m(src, true),
+            m_params(p) {
+            m_params.m_array_fake_support = true;
+            m_ctx = alloc(context, m, m_params);
+        }
+    };
+
     model_checker::~model_checker() {
+        m_workers.reset();
         m_aux_context = nullptr; // delete aux context before fparams
         m_fparams = nullptr;
     }
@@ -140,20 +163,19 @@ namespace smt {
     }
 
     /**
-       \brief Assert in m_aux_context, the constraint
+       \brief Return the constraint
 
          sk = e_1 OR ... OR sk = e_n
 
          where {e_1, ..., e_n} is the universe.
      */
-    void model_checker::restrict_to_universe(expr * sk, obj_hashtable<expr> const & universe) {
+    expr_ref model_checker::mk_universe_restriction(expr * sk, obj_hashtable<expr> const & universe) {
         SASSERT(!universe.empty());
         ptr_buffer<expr> eqs;
         for (expr * e : universe) {
             eqs.push_back(m.mk_eq(sk, e));
         }
-        expr_ref fml(m.mk_or(eqs.size(), eqs.data()), m);
-        m_aux_context->assert_expr(fml);
+        return expr_ref(m.mk_or(eqs.size(), eqs.data()), m);
     }
 
     /**
@@ -163,6 +185,18 @@ namespace smt {
     */
 
     bool model_checker::assert_neg_q_m(quantifier * q, expr_ref_vector & sks) {
+        expr_ref_vector fmls(m);
+        if (!mk_neg_q_m(q, sks, fmls))
+            return false;
+        for (expr * f : fmls)
+            m_aux_context->assert_expr(f);
+        return true;
+    }
+
+    /**
+       \brief Collect in fmls the constraints asserted by assert_neg_q_m.
+    */
+    bool model_checker::mk_neg_q_m(quantifier * q, expr_ref_vector & sks, expr_ref_vector & fmls) {
         expr_ref tmp(m);
         
         TRACE("model_checker", tout << "curr_model:\n"; model_pp(tout, *m_curr_model););
@@ -181,7 +215,7 @@ namespace smt {
             sks[num_decls - i - 1]        = sk;
             subst_args[num_decls - i - 1] = sk;
             if (m_curr_model->is_finite(s)) {
-                restrict_to_universe(sk, m_curr_model->get_known_universe(s));
+                fmls.push_back(mk_universe_restriction(sk, m_curr_model->get_known_universe(s)));
             }
         }
 
@@ -190,7 +224,7 @@ namespace smt {
         expr_ref r(m);
         r = m.mk_not(sk_body);
         TRACE("model_checker", tout << "mk_neg_q_m:\n" << mk_ismt2_pp(r, m) << "\n";);
-        m_aux_context->assert_expr(r);
+        fmls.push_back(r);
         return true;
     }
 
@@ -515,14 +549,18 @@ namespace smt {
     //
 
     void model_checker::check_quantifiers(bool& found_relevant, unsigned& num_failures) {
+        ptr_vector<quantifier> qs;
         for (quantifier * q : *m_qm) {
-            if (!(m_qm->mbqi_enabled(q) &&
-                  m_context->is_relevant(q) &&
-                  m_context->get_assignment(q) == l_true &&
-                  (!m_context->get_fparams().m_ematching || !m.is_lambda_def(q)))) {
-                continue;
-            }
-
+            if (m_qm->mbqi_enabled(q) &&
+                m_context->is_relevant(q) &&
+                m_context->get_assignment(q) == l_true &&
+                (!m_context->get_fparams().m_ematching || !m.is_lambda_def(q))) 
+                qs.push_back(q);
+        }
+        bool_vector satisfied(qs.size(), false);
+        check_parallel(qs, satisfied);
+        for (unsigned i = 0; i < qs.size(); ++i) {
+            quantifier * q = qs[i];
             TRACE("model_checker",
                   tout << "Check: " << mk_pp(q, m) << "\n";
                   tout << m_context->get_assignment(q) << "\n";);
@@ -531,6 +569,8 @@ namespace smt {
                 verbose_stream() << "(smt.mbqi :checking " << q->get_qid() << ")\n";
             }
             found_relevant = true;
+            if (satisfied[i])
+                continue;
             if (!check(q)) {
                 if (m_params.m_mbqi_trace || get_verbosity_level() >= 5) {
                     IF_VERBOSE(0, verbose_stream() << "(smt.mbqi :failed " << q->get_qid() << ")\n");
@@ -541,6 +581,75 @@ namespace smt {
         }
     }
 
+    /**
+       \brief Check the quantifiers in qs against m_curr_model using mbqi.threads
+       auxiliary contexts. satisfied[i] is set if qs[i] is satisfied by the model.
+       The remaining quantifiers are checked again by check(q), which extracts
+       the new instances using the model finder of the main context.
+    */
+    void model_checker::check_parallel(ptr_vector<quantifier> const & qs, bool_vector & satisfied) {
+#ifndef SINGLE_THREAD
+        unsigned num_threads = std::min(m_params.m_mbqi_threads, qs.size());
+        if (num_threads <= 1 || m.has_trace_stream())
+            return;
+        vector<expr_ref_vector> fmls;
+        for (quantifier * q : qs) {
+            expr_ref_vector sks(m);
+            fmls.push_back(expr_ref_vector(m));
+            if (!mk_neg_q_m(get_flat_quantifier(q), sks, fmls.back()))
+                fmls.back().reset();
+        }
+        while (m_workers.size() < num_threads)
+            m_workers.push_back(alloc(worker, m, *m_fparams));
+
+        svector<lbool> results(qs.size(), l_undef);
+        std::atomic<unsigned> next(0);
+        std::mutex mux;
+        scoped_limits sl(m.limit());
+        for (unsigned i = 0; i < num_threads; ++i)
+            sl.push_child(&m_workers[i]->m.limit());
+
+        auto work = [&](worker & w) {
+            while (true) {
+                unsigned i = next++;
+                if (i >= qs.size())
+                    break;
+                if (fmls[i].empty())
+                    continue;
+                try {
+                    expr_ref_vector fs(w.m);
+                    {
+                        std::lock_guard<std::mutex> lock(mux);
+                        ast_translation tr(m, w.m);
+                        for (expr * f : fmls[i])
+                            fs.push_back(tr(f));
+                    }
+                    scoped_ctx_push _push(w.m_ctx.get());
+                    for (expr * f : fs)
+                        w.m_ctx->assert_expr(f);
+                    results[i] = w.m_ctx->check();
+                }
+                catch (...) {
+                    results[i] = l_undef;
+                }
+            }
+        };
+        vector<std::thread> threads;
+        for (unsigned i = 1; i < num_threads; ++i)
+            threads.push_back(std::thread([&, i]() { work(*m_workers[i]); }));
+        work(*m_workers[0]);
+        for (auto & th : threads)
+            th.join();
+
+        unsigned num_satisfied = 0;
+        for (unsigned i = 0; i < qs.size(); ++i) {
+            satisfied[i] = results[i] == l_false && is_safe_for_mbqi(qs[i]);
+            num_satisfied += satisfied[i];
+        }
+        IF_VERBOSE(10, verbose_stream() << "(smt.mbqi :threads " << num_threads << " :checked " << qs.size() << " :satisfied " << num_satisfied << ")\n";);
+#endif
+    }
+
     void model_checker::init_search_eh() {
         m_max_cexs = m_params.m_mbqi_max_cexs;
         m_iteration_idx = 0;
@@ -21,6 +21,7 @@ Revision History:
 #pragma once
 
 #include "util/obj_hashtable.h"
+#include "util/scoped_ptr_vector.h"
 #include "ast/ast.h"
 #include "ast/array_decl_plugin.h"
 #include "ast/normal_forms/defined_names.h"
@@ -48,6 +49,8 @@ namespace smt {
         obj_map<enode, app *> const *               m_root2value; // temp field to store mapping received in the check method.
         model_finder &                              m_model_finder;
         scoped_ptr<context>                         m_aux_context; // Auxiliary context used for model checking quantifiers.
+        struct worker;
+        scoped_ptr_vector<worker>                   m_workers;     // Auxiliary contexts, each with its own manager, used by mbqi.threads.
         unsigned                                    m_max_cexs;
         unsigned                                    m_iteration_idx;
         proto_model *                               m_curr_model;
@@ -61,10 +64,12 @@ namespace smt {
         expr * get_term_from_ctx(expr * val);
         expr * get_type_compatible_term(expr * val);
         expr_ref replace_value_from_ctx(expr * e);
-        void restrict_to_universe(expr * sk, obj_hashtable<expr> const & universe);
+        expr_ref mk_universe_restriction(expr * sk, obj_hashtable<expr> const & universe);
+        bool mk_neg_q_m(quantifier * q, expr_ref_vector & sks, expr_ref_vector & fmls);
         bool assert_neg_q_m(quantifier * q, expr_ref_vector & sks);
         bool add_blocking_clause(model * cex, expr_ref_vector & sks);
         bool check(quantifier * q);
+        void check_parallel(ptr_vector<quantifier> const & qs, bool_vector & satisfied);
         void check_quantifiers(bool& found_relevant, unsigned& num_failures);
 
         struct instance {
@@ -21,6 +21,7 @@ Author:
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
 #include "ast/ast_translation.h"
+#include "ast/for_each_expr.h"
 #include "smt/smt_parallel.h"
 #include "smt/smt_lookahead.h"
 
@@ -36,9 +37,33 @@ namespace smt {
 #else
 
 #include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
 
 namespace smt {
-    
+
+    /**
+       Barrier-free parallel search.
+
+       Workers run independent copies of the context. When a worker exceeds
+       its conflict budget on a cube it either returns the cube to its own
+       queue or splits it with lookahead and pushes both halves. Idle workers
+       take work from the back of their own queue, steal from the front of
+       the fullest queue of another worker, and otherwise solve the root problem.
+       Units found at base level and the negated cores of refuted cubes are
+       published to all workers, which import them before each check.
+
+       Short learned clauses and theory lemmas are exchanged in a compact form:
+       each atom is translated once into the main manager and numbered, and a
+       lemma is stored as a sequence of atom indices with signs. A worker
+       translates an atom only the first time it imports a lemma using it.
+       Lemmas with Skolem functions are not shared, since such symbols are
+       local to the worker that introduced them.
+
+       Shared state lives in the manager of the main context and is only
+       accessed while holding the lock.
+    */
     lbool parallel::operator()(expr_ref_vector const& asms) {
 
         lbool result = l_undef;
@@ -46,6 +71,7 @@ namespace smt {
         flet<unsigned> _nt(ctx.m_fparams.m_threads, 1);
         unsigned thread_max_conflicts = ctx.get_fparams().m_threads_max_conflicts;
         unsigned max_conflicts = ctx.get_fparams().m_max_conflicts;
+        unsigned cube_frequency = std::max(1u, ctx.get_fparams().m_threads_cube_frequency);
 
         // try first sequential with a low conflict budget to make super easy problems cheap
         unsigned max_c = std::min(thread_max_conflicts, 40u);
@@ -72,7 +98,6 @@ namespace smt {
         par_exception_kind ex_kind = DEFAULT_EX;
         unsigned error_code = 0;
         bool done = false;
-        unsigned num_rounds = 0;
         if (m.has_trace_stream())
             throw default_exception("trace streams have to be off in parallel mode");
 
@@ -92,147 +117,293 @@ namespace smt {
             sl.push_child(&(new_m->limit()));
         }
 
-        auto cube = [](context& ctx, expr_ref_vector& lasms, expr_ref& c) {
-            lookahead lh(ctx);
-            c = lh.choose();
-            if (c) {
-                if ((ctx.get_random_value() % 2) == 0) 
-                    c = c.get_manager().mk_not(c);
-                lasms.push_back(c);
+        // lemmas buffered by a worker between exchanges, and its cache of imported atoms.
+        struct lemma_buffer {
+            expr_ref_vector atoms;
+            bool_vector     signs;
+            unsigned_vector sizes;
+            svector<char>   shareable;   // per bool_var: 0 unknown, 1 shareable, 2 not shareable
+            expr_ref_vector cache;
+            lemma_buffer(ast_manager& m): atoms(m), cache(m) {}
+        };
+        scoped_ptr_vector<lemma_buffer> buffers;
+        unsigned share_size = ctx.get_fparams().m_threads_share_lemmas;
+
+        auto collect_lemma = [&](unsigned i, unsigned n, literal const* lits) {
+            if (n == 0 || n > share_size)
+                return;
+            context& pctx = *pctxs[i];
+            lemma_buffer& b = *buffers[i];
+            for (unsigned j = 0; j < n; ++j) {
+                bool_var v = lits[j].var();
+                if (v == true_bool_var)
+                    return;
+                b.shareable.reserve(v + 1, 0);
+                if (b.shareable[v] == 0) {
+                    expr* e = pctx.bool_var2expr(v);
+                    b.shareable[v] = (e && !has_skolem_functions(e)) ? 1 : 2;
+                }
+                if (b.shareable[v] != 1)
+                    return;
+            }
+            for (unsigned j = 0; j < n; ++j) {
+                b.atoms.push_back(pctx.bool_var2expr(lits[j].var()));
+                b.signs.push_back(lits[j].sign());
             }
+            b.sizes.push_back(n);
         };
 
+        for (unsigned i = 0; i < num_threads; ++i) {
+            buffers.push_back(alloc(lemma_buffer, *pms[i]));
+            if (share_size > 0)
+                pctxs[i]->register_on_lemma([&, i](unsigned n, literal const* lits) { collect_lemma(i, n, lits); });
+        }
+
+        std::mutex mux;
+        // shared lemmas are stored as [owner, size, 2*atom + sign, ...] over shared_atoms.
+        expr_ref_vector shared_atoms(m);
+        obj_map<expr, unsigned> atom2id;
+        unsigned_vector shared_clauses;
+        unsigned_vector clause_lim(num_threads, 0u);
+        unsigned num_shared_lemmas = 0;
         obj_hashtable<expr> unit_set;
-        expr_ref_vector unit_trail(ctx.m);
-        unsigned_vector unit_lim;
-        for (unsigned i = 0; i < num_threads; ++i) unit_lim.push_back(0);
+        expr_ref_vector shared_units(m), shared_lemmas(m);
+        unsigned_vector unit_lim(num_threads, 0u), lemma_lim(num_threads, 0u), export_lim(num_threads, 0u);
+        std::vector<std::deque<expr_ref_vector>> cubes(num_threads);
+        uint64_t total_conflicts = 0;
+        unsigned num_stolen = 0, num_refuted = 0, num_splits = 0;
+
+        auto finish = [&](unsigned i, lbool r) {
+            if (done)
+                return;
+            done = true;
+            finished_id = i;
+            result = r;
+            for (ast_manager* pm : pms)
+                pm->limit().cancel();
+        };
 
-        std::function<void(void)> collect_units = [&,this]() {
-            for (unsigned i = 0; i < num_threads; ++i) {
-                context& pctx = *pctxs[i];
-                pctx.pop_to_base_lvl();
-                ast_translation tr(pctx.m, ctx.m);
+        // called with the lock held and worker i at base level.
+        auto exchange = [&](unsigned i) {
+            context& pctx = *pctxs[i];
+            {
+                ast_translation tr(pctx.m, m);
                 unsigned sz = pctx.assigned_literals().size();
-                for (unsigned j = unit_lim[i]; j < sz; ++j) {
+                for (unsigned j = export_lim[i]; j < sz; ++j) {
                     literal lit = pctx.assigned_literals()[j];
                     expr_ref e(pctx.bool_var2expr(lit.var()), pctx.m);
+                    if (!e)
+                        continue;
                     if (lit.sign()) e = pctx.m.mk_not(e);
-                    expr_ref ce(tr(e.get()), ctx.m);
+                    expr_ref ce(tr(e.get()), m);
                     if (!unit_set.contains(ce)) {
                         unit_set.insert(ce);
-                        unit_trail.push_back(ce);
+                        shared_units.push_back(ce);
+                    }
+                }
+            }
+            lemma_buffer& b = *buffers[i];
+            if (!b.sizes.empty()) {
+                ast_translation tr(pctx.m, m);
+                unsigned k = 0;
+                for (unsigned sz : b.sizes) {
+                    shared_clauses.push_back(i);
+                    shared_clauses.push_back(sz);
+                    for (unsigned j = 0; j < sz; ++j, ++k) {
+                        expr_ref a(tr(b.atoms.get(k)), m);
+                        unsigned id;
+                        if (!atom2id.find(a, id)) {
+                            id = shared_atoms.size();
+                            shared_atoms.push_back(a);
+                            atom2id.insert(a, id);
+                        }
+                        shared_clauses.push_back(2 * id + b.signs[k]);
                     }
+                    ++num_shared_lemmas;
                 }
+                b.atoms.reset();
+                b.signs.reset();
+                b.sizes.reset();
             }
 
-            unsigned sz = unit_trail.size();
-            for (unsigned i = 0; i < num_threads; ++i) {
-                context& pctx = *pctxs[i];
-                ast_translation tr(ctx.m, pctx.m);
-                for (unsigned j = unit_lim[i]; j < sz; ++j) {
-                    expr_ref src(ctx.m), dst(pctx.m);
-                    dst = tr(unit_trail.get(j));
-                    pctx.assert_expr(dst);
+            ast_translation tr(m, pctx.m);
+            for (; unit_lim[i] < shared_units.size(); ++unit_lim[i]) 
+                pctx.assert_expr(tr(shared_units.get(unit_lim[i])));
+            for (; lemma_lim[i] < shared_lemmas.size(); ++lemma_lim[i])
+                pctx.assert_expr(tr(shared_lemmas.get(lemma_lim[i])));
+            unsigned& lim = clause_lim[i];
+            while (lim < shared_clauses.size()) {
+                unsigned owner = shared_clauses[lim];
+                unsigned start = lim + 2;
+                lim = start + shared_clauses[lim + 1];
+                if (owner == i)
+                    continue;
+                expr_ref_vector lits(pctx.m);
+                for (unsigned j = start; j < lim; ++j) {
+                    unsigned id = shared_clauses[j] >> 1;
+                    if (b.cache.size() <= id)
+                        b.cache.resize(id + 1);
+                    if (!b.cache.get(id))
+                        b.cache.set(id, tr(shared_atoms.get(id)));
+                    expr* a = b.cache.get(id);
+                    lits.push_back((shared_clauses[j] & 1) ? pctx.m.mk_not(a) : a);
                 }
-                unit_lim[i] = sz;
+                pctx.assert_expr(mk_or(lits));
             }
-            IF_VERBOSE(1, verbose_stream() << "(smt.thread :units " << sz << ")\n");
+            export_lim[i] = pctx.assigned_literals().size();
         };
 
-        std::mutex mux;
+        // called with the lock held. Return false if there is no cube to work on.
+        auto take_cube = [&](unsigned i, expr_ref_vector& cube) {
+            unsigned owner = i;
+            if (cubes[i].empty()) {
+                for (unsigned j = 0; j < num_threads; ++j)
+                    if (cubes[j].size() > cubes[owner].size())
+                        owner = j;
+                if (cubes[owner].empty())
+                    return false;
+                ++num_stolen;
+            }
+            expr_ref_vector c(m);
+            if (owner == i) {
+                c.swap(cubes[i].back());
+                cubes[i].pop_back();
+            }
+            else {
+                c.swap(cubes[owner].front());
+                cubes[owner].pop_front();
+            }
+            ast_translation tr(m, cube.get_manager());
+            for (expr* e : c)
+                cube.push_back(tr(e));
+            return true;
+        };
 
-        auto worker_thread = [&](int i) {
+        auto publish_cube = [&](unsigned i, expr_ref_vector const& cube) {
+            ast_translation tr(cube.get_manager(), m);
+            cubes[i].push_back(expr_ref_vector(m));
+            for (expr* e : cube)
+                cubes[i].back().push_back(tr(e));
+        };
+
+        auto worker_thread = [&](unsigned i) {
             try {
                 context& pctx = *pctxs[i];
                 ast_manager& pm = *pms[i];
-                expr_ref_vector lasms(pasms[i]);
-                expr_ref c(pm);
-
-                pctx.get_fparams().m_max_conflicts = std::min(thread_max_conflicts, max_conflicts);
-                if (num_rounds > 0 && (pctx.get_fparams().m_threads_cube_frequency % num_rounds) == 0) 
-                    cube(pctx, lasms, c);
-                IF_VERBOSE(1, verbose_stream() << "(smt.thread " << i; 
-                           if (num_rounds > 0) verbose_stream() << " :round " << num_rounds;
-                           if (c) verbose_stream() << " :cube " << mk_bounded_pp(c, pm, 3);
-                           verbose_stream() << ")\n";);
-                lbool r = pctx.check(lasms.size(), lasms.data());
-                
-                if (r == l_undef && pctx.m_num_conflicts >= max_conflicts) 
-                    ; // no-op
-                else if (r == l_undef && pctx.m_num_conflicts >= thread_max_conflicts) 
-                    return;
-                else if (r == l_false && pctx.unsat_core().contains(c)) {
-                    IF_VERBOSE(1, verbose_stream() << "(smt.thread " << i << " :learn " << mk_bounded_pp(c, pm, 3) << ")");
-                    pctx.assert_expr(mk_not(mk_and(pctx.unsat_core())));
-                    return;
-                } 
-                
+                unsigned budget = thread_max_conflicts;
+                unsigned num_attempts = 0;
+                while (true) {
+                    expr_ref_vector cube(pm);
+                    {
+                        std::lock_guard<std::mutex> lock(mux);
+                        if (done)
+                            return;
+                        exchange(i);
+                        take_cube(i, cube);
+                    }
+                    expr_ref_vector lasms(pasms[i]);
+                    lasms.append(cube);
+                    pctx.get_fparams().m_max_conflicts = std::min(budget, max_conflicts);
+                    IF_VERBOSE(1, verbose_stream() << "(smt.thread " << i << " :budget " << budget;
+                               if (!cube.empty()) verbose_stream() << " :cube " << mk_bounded_pp(mk_and(cube), pm, 3);
+                               verbose_stream() << ")\n";);
+                    lbool r = pctx.check(lasms.size(), lasms.data());
+                    bool out_of_budget = r == l_undef && pctx.m_num_conflicts >= pctx.get_fparams().m_max_conflicts;
+                    bool refuted = r == l_false && any_of(cube, [&](expr* c) { return pctx.unsat_core().contains(c); });
+                    if (!out_of_budget && !refuted) {
+                        std::lock_guard<std::mutex> lock(mux);
+                        finish(i, r);
+                        return;
+                    }
+                    pctx.pop_to_base_lvl();
+                    expr_ref_vector split(pm);
+                    if (out_of_budget && ++num_attempts % cube_frequency == 0) {
+                        lookahead lh(pctx);
+                        expr_ref c = lh.choose();
+                        if (c) 
+                            split.push_back(c);
+                    }
 
-                bool first = false;
-                {
                     std::lock_guard<std::mutex> lock(mux);
-                    if (finished_id == UINT_MAX) {
-                        finished_id = i;
-                        first = true;
-                        result = r;
-                        done = true;
+                    if (done)
+                        return;
+                    total_conflicts += pctx.m_num_conflicts;
+                    if (refuted) {
+                        // the cube is refuted: share the negated core with all workers.
+                        ++num_refuted;
+                        expr_ref lemma(mk_not(mk_and(pctx.unsat_core())), pm);
+                        IF_VERBOSE(1, verbose_stream() << "(smt.thread " << i << " :learn " << mk_bounded_pp(lemma, pm, 3) << ")\n");
+                        ast_translation tr(pm, m);
+                        shared_lemmas.push_back(tr(lemma.get()));
+                        continue;
                     }
-                    if (!first && r != l_undef && result == l_undef) {
-                        finished_id = i;
-                        result = r;                        
+                    if (total_conflicts >= max_conflicts) {
+                        finish(i, l_undef);
+                        return;
                     }
-                    else if (!first) return;
-                }
-
-                for (ast_manager* m : pms) {
-                    if (m != &pm) m->limit().cancel();
+                    if (split.empty()) {
+                        if (!cube.empty())
+                            publish_cube(i, cube);
+                    }
+                    else {
+                        ++num_splits;
+                        cube.push_back(pm.mk_not(split.get(0)));
+                        publish_cube(i, cube);
+                        cube.pop_back();
+                        cube.push_back(split.get(0));
+                        publish_cube(i, cube);
+                    }
+                    budget = budget >= UINT_MAX / 2 ? UINT_MAX : 2 * budget;
                 }
-
             }
             catch (z3_error & err) {
-                if (finished_id == UINT_MAX) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!done) {
                     error_code = err.error_code();
                     ex_kind = ERROR_EX;
-                    done = true;
+                    finish(UINT_MAX, l_undef);
                 }
             }
             catch (z3_exception & ex) {
-                if (finished_id == UINT_MAX) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!done) {
                     ex_msg = ex.msg();
                     ex_kind = DEFAULT_EX;
-                    done = true;
+                    finish(UINT_MAX, l_undef);
                 }
             }
             catch (...) {
-                if (finished_id == UINT_MAX) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (!done) {
                     ex_msg = "unknown exception";
                     ex_kind = ERROR_EX;
-                    done = true;
+                    finish(UINT_MAX, l_undef);
                 }
             }
         };
 
         // for debugging:  num_threads = 1;
 
-        while (true) {
-            vector<std::thread> threads(num_threads);
-            for (unsigned i = 0; i < num_threads; ++i) {
-                threads[i] = std::thread([&, i]() { worker_thread(i); });
-            }
-            for (auto & th : threads) {
-                th.join();
-            }
-            if (done) break;
-
-            collect_units();
-            ++num_rounds;
-            max_conflicts = (max_conflicts < thread_max_conflicts) ? 0 : (max_conflicts - thread_max_conflicts);
-            thread_max_conflicts *= 2;            
+        vector<std::thread> threads(num_threads);
+        for (unsigned i = 0; i < num_threads; ++i) {
+            threads[i] = std::thread([&, i]() { worker_thread(i); });
+        }
+        for (auto & th : threads) {
+            th.join();
         }
+        IF_VERBOSE(1, verbose_stream() << "(smt.parallel :units " << shared_units.size() 
+                   << " :lemmas " << shared_lemmas.size() << " :shared-lemmas " << num_shared_lemmas 
+                   << " :atoms " << shared_atoms.size() << " :splits " << num_splits
+                   << " :stolen " << num_stolen << " :refuted " << num_refuted << ")\n");
 
         for (context* c : pctxs) {
             c->collect_statistics(ctx.m_aux_stats);
         }
+        ctx.m_aux_stats.update("parallel cube splits", num_splits);
+        ctx.m_aux_stats.update("parallel cubes stolen", num_stolen);
+        ctx.m_aux_stats.update("parallel cubes refuted", num_refuted);
+        ctx.m_aux_stats.update("parallel shared units", shared_units.size());
+        ctx.m_aux_stats.update("parallel shared lemmas", num_shared_lemmas);
 
         if (finished_id == UINT_MAX) {
             switch (ex_kind) {
@@ -122,73 +122,70 @@ namespace smt {
         return mk_relevancy_eh(ite_term_relevancy_eh(c, t, e));
     }
     
+    /**
+       Event handlers are kept in singly linked lists whose cells live in a
+       single vector, one list per expression and kind, with heads indexed
+       by expression id. Cells are created in stack order, so backtracking
+       restores the heads and shrinks the vector without releasing memory.
+
+       When lazy watches are enabled, the arguments of a disjunction
+       (conjunction) are watched only after it became relevant and true
+       (false) without a relevant argument justifying it.
+    */
     struct relevancy_propagator_imp : public relevancy_propagator {
         unsigned                       m_qhead = 0;
         expr_ref_vector                m_relevant_exprs; 
         uint_set                       m_is_relevant;
-        typedef list<relevancy_eh *>   relevancy_ehs;
-        obj_map<expr, relevancy_ehs *> m_relevant_ehs;
-        obj_map<expr, relevancy_ehs *> m_watches[2];
-        struct eh_trail {
-            enum class kind { POS_WATCH, NEG_WATCH, HANDLER };
-            kind   m_kind;
-            expr * m_node;
-            eh_trail(expr * n):m_kind(kind::HANDLER), m_node(n) {}
-            eh_trail(expr * n, bool val):m_kind(val ? kind::POS_WATCH : kind::NEG_WATCH), m_node(n) {}
-            kind get_kind() const { return m_kind; }
-            expr * get_node() const { return m_node; }
+        enum eh_kind { HANDLER, NEG_WATCH, POS_WATCH, LAZY_WATCH };
+        struct eh_cell {
+            relevancy_eh * m_eh;
+            unsigned       m_next;
+            eh_kind        m_kind;
+            expr *         m_node;
         };
-        svector<eh_trail>              m_trail;
+        svector<eh_cell>               m_cells;
+        unsigned_vector                m_heads[3];
+        uint_set                       m_lazy;       // disjunctions/conjunctions with watches installed on demand
         struct scope {
             unsigned m_relevant_exprs_lim;
             unsigned m_trail_lim;
         };
         svector<scope>                 m_scopes;
         bool                           m_propagating = false;
+        bool                           m_lazy_watches;
 
         relevancy_propagator_imp(context & ctx):
-            relevancy_propagator(ctx), m_relevant_exprs(ctx.get_manager()) {}
+            relevancy_propagator(ctx), m_relevant_exprs(ctx.get_manager()), 
+            m_lazy_watches(ctx.get_fparams().m_relevancy_lazy) {}
 
         ~relevancy_propagator_imp() override {
             ast_manager & m = get_manager();
-            unsigned i = m_trail.size();
-            while (i != 0) {
-                --i;
-                m.dec_ref(m_trail[i].get_node());
-            }
+            for (eh_cell const& c : m_cells)
+                m.dec_ref(c.m_node);
         }
 
-        relevancy_ehs * get_handlers(expr * n) {
-            relevancy_ehs * r = nullptr;
-            m_relevant_ehs.find(n, r);
-            SASSERT(m_relevant_ehs.contains(n) || r == 0);
-            return r;
-        }
+        bool lazy_watches() const override { return m_lazy_watches; }
 
-        void set_handlers(expr * n, relevancy_ehs * ehs) {
-            if (ehs == nullptr)
-                m_relevant_ehs.erase(n);
-            else
-                m_relevant_ehs.insert(n, ehs);
+        unsigned get_head(eh_kind k, expr * n) const {
+            unsigned id = n->get_id();
+            return id < m_heads[k].size() ? m_heads[k][id] : UINT_MAX;
         }
 
-        relevancy_ehs * get_watches(expr * n, bool val) {
-            relevancy_ehs * r = nullptr;
-            m_watches[val ? 1 : 0].find(n, r);
-            SASSERT(m_watches[val ? 1 : 0].contains(n) || r == 0);
-            return r;
-        }
+        unsigned get_handlers(expr * n) const { return get_head(HANDLER, n); }
 
-        void set_watches(expr * n, bool val, relevancy_ehs * ehs) {
-            if (ehs == nullptr)
-                m_watches[val ? 1 : 0].erase(n);
-            else
-                m_watches[val ? 1 : 0].insert(n, ehs);
-        }
+        unsigned get_watches(expr * n, bool val) const { return get_head(val ? POS_WATCH : NEG_WATCH, n); }
 
-        void push_trail(eh_trail const & t) {
-            get_manager().inc_ref(t.get_node());
-            m_trail.push_back(t);
+        void push_cell(eh_kind k, expr * n, relevancy_eh * eh) {
+            get_manager().inc_ref(n);
+            unsigned id = n->get_id();
+            if (k == LAZY_WATCH) {
+                m_lazy.insert(id);
+                m_cells.push_back({ eh, UINT_MAX, k, n });
+                return;
+            }
+            m_heads[k].reserve(id + 1, UINT_MAX);
+            m_cells.push_back({ eh, m_heads[k][id], k, n });
+            m_heads[k][id] = m_cells.size() - 1;
         }
         
         void add_handler(expr * source, relevancy_eh * eh) override {
@@ -199,8 +196,7 @@ namespace smt {
             }
             else {
                 SASSERT(eh);
-                push_trail(eh_trail(source));
-                set_handlers(source, new (get_region()) relevancy_ehs(eh, get_handlers(source)));
+                push_cell(HANDLER, source, eh);
             }
         }
         
@@ -215,8 +211,7 @@ namespace smt {
                 return;
             case l_undef:
                 SASSERT(eh);
-                set_watches(n, val, new (get_region()) relevancy_ehs(eh, get_watches(n, val)));
-                push_trail(eh_trail(n, val));
+                push_cell(val ? POS_WATCH : NEG_WATCH, n, eh);
                 break;
             case l_true:
                 eh->operator()(*this, n, val);
@@ -241,6 +236,20 @@ namespace smt {
                 break;
             }
         }
+
+        /**
+           \brief Watch the arguments of the relevant disjunction (val = true) or
+           conjunction (val = false) n for being assigned to val.
+        */
+        void add_lazy_watches(app * n, bool val) {
+            if (m_lazy.contains(n->get_id()))
+                return;
+            relevancy_eh * eh = val ? mk_or_relevancy_eh(n) : mk_and_relevancy_eh(n);
+            push_cell(LAZY_WATCH, n, eh);
+            for (expr * arg : *n)
+                if (m_context.find_assignment(arg) == l_undef)
+                    push_cell(val ? POS_WATCH : NEG_WATCH, arg, eh);
+        }
         
         bool is_relevant_core(expr * n) const { return m_is_relevant.contains(n->get_id()); }
         
@@ -252,7 +261,7 @@ namespace smt {
             m_scopes.push_back(scope());
             scope & s                  = m_scopes.back();
             s.m_relevant_exprs_lim     = m_relevant_exprs.size();
-            s.m_trail_lim              = m_trail.size();
+            s.m_trail_lim              = m_cells.size();
         }
 
         void pop(unsigned num_scopes) override {
@@ -283,23 +292,19 @@ namespace smt {
         }
 
         void undo_trail(unsigned old_lim) {
-            SASSERT(old_lim <= m_trail.size());
+            SASSERT(old_lim <= m_cells.size());
             ast_manager & m = get_manager();
-            unsigned i = m_trail.size();
+            unsigned i = m_cells.size();
             while (i != old_lim) {
                 --i;
-                eh_trail & t = m_trail[i];
-                expr * n = t.get_node();
-                relevancy_ehs * ehs;
-                switch (t.get_kind()) {
-                case eh_trail::kind::POS_WATCH: ehs = get_watches(n, true); SASSERT(ehs); set_watches(n, true, ehs->tail()); break;
-                case eh_trail::kind::NEG_WATCH: ehs = get_watches(n, false); SASSERT(ehs); set_watches(n, false, ehs->tail()); break;
-                case eh_trail::kind::HANDLER:   ehs = get_handlers(n); SASSERT(ehs); set_handlers(n, ehs->tail()); break;
-                default: UNREACHABLE(); break;
-                }
-                m.dec_ref(n);
+                eh_cell const& c = m_cells[i];
+                if (c.m_kind == LAZY_WATCH)
+                    m_lazy.remove(c.m_node->get_id());
+                else 
+                    m_heads[c.m_kind][c.m_node->get_id()] = c.m_next;
+                m.dec_ref(c.m_node);
             }
-            m_trail.shrink(old_lim);
+            m_cells.shrink(old_lim);
         }
 
         void set_relevant(expr * n) {
@@ -388,6 +393,8 @@ namespace smt {
                 }
                 if (true_arg)
                     mark_as_relevant(true_arg);
+                else if (lazy_watches())
+                    add_lazy_watches(n, true);
                 break;
             } }
         }
@@ -410,6 +417,8 @@ namespace smt {
                 }
                 if (false_arg)
                     mark_as_relevant(false_arg);
+                else if (lazy_watches())
+                    add_lazy_watches(n, false);
                 break;
             }
             case l_undef:
@@ -483,11 +492,8 @@ namespace smt {
                     }
                 }
                 
-                relevancy_ehs * ehs = get_handlers(n);
-                while (ehs != nullptr) {
-                    ehs->head()->operator()(*this, n);
-                    ehs = ehs->tail();
-                }
+                for (unsigned i = get_handlers(n); i != UINT_MAX; i = m_cells[i].m_next) 
+                    m_cells[i].m_eh->operator()(*this, n);
             }
         }
 
@@ -506,11 +512,8 @@ namespace smt {
                 else if (m.is_and(n))
                     propagate_relevant_and(to_app(n));
             }
-            relevancy_ehs * ehs = get_watches(n, val);
-            while (ehs != nullptr) {
-                ehs->head()->operator()(*this, n, val);
-                ehs = ehs->tail();
-            }
+            for (unsigned i = get_watches(n, val); i != UINT_MAX; i = m_cells[i].m_next) 
+                m_cells[i].m_eh->operator()(*this, n, val);
         }
 
         void display(std::ostream & out) const override {
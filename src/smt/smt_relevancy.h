@@ -150,6 +150,12 @@ namespace smt {
         */
         virtual void pop(unsigned num_scopes) = 0;
 
+        /**
+           \brief Return true if the arguments of disjunctions and conjunctions are
+           watched only once the disjunction or conjunction becomes relevant.
+        */
+        virtual bool lazy_watches() const = 0;
+
         /**
            \brief Display relevant expressions.
         */
@@ -255,6 +255,21 @@ namespace smt {
             ;
     }
 
+    /**
+       \brief Difference logic problems with too many variables for a dense
+       distance matrix, in clausal form with only unit and binary clauses,
+       such as scheduling problems. theory_diff_logic does not support
+       ite-terms.
+    */
+    static bool is_sparse_diff_logic(static_features const & st) {
+        return 
+            !st.is_dense() &&
+            st.m_num_uninterpreted_constants >= 1000 &&
+            st.m_num_ite_terms == 0 &&
+            st.m_cnf &&
+            st.m_num_bin_clauses + st.m_num_units == st.m_num_clauses;
+    }
+
     static void check_no_uninterpreted_functions(static_features const & st, char const * logic) {
         if (st.m_num_uninterpreted_functions != 0)
             throw default_exception("Benchmark contains uninterpreted function symbols, but specified logic does not support them.");
@@ -364,6 +379,17 @@ namespace smt {
                 m_context.register_plugin(alloc(smt::theory_dense_i, m_context));
     
         }
+        else if (!m_params.m_arith_auto_config_simplex && is_sparse_diff_logic(st)) {
+            // large graphs: the dense solver keeps an n x n matrix, use the
+            // adjacency-list based difference logic solver instead.
+            TRACE("setup", tout << "using sparse diff logic...\n";);
+            m_params.m_arith_bound_prop           = bound_prop_mode::BP_NONE;
+            m_params.m_arith_propagation_strategy = arith_prop_strategy::ARITH_PROP_AGILITY;
+            if (!m_params.m_model && st.arith_k_sum_is_small())
+                m_context.register_plugin(alloc(smt::theory_fidl, m_context));
+            else
+                m_context.register_plugin(alloc(smt::theory_idl, m_context));
+        }
         else {
             // if (st.arith_k_sum_is_small()) {
             //    TRACE("setup", tout << "using small integer simplex...\n";
@@ -228,6 +228,10 @@ namespace {
             m_context.user_propagate_register_fixed(fixed_eh);
         }
 
+        void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) override {
+            m_context.user_propagate_register_fixed_batch(fixed_batch_eh);
+        }
+
         void user_propagate_register_final(user_propagator::final_eh_t& final_eh) override {
             m_context.user_propagate_register_final(final_eh);
         }
@@ -318,6 +318,7 @@ public:
     user_propagator::pop_eh_t   m_pop_eh;
     user_propagator::fresh_eh_t m_fresh_eh;
     user_propagator::fixed_eh_t m_fixed_eh;
+    user_propagator::fixed_batch_eh_t m_fixed_batch_eh;
     user_propagator::final_eh_t m_final_eh;
     user_propagator::eq_eh_t    m_eq_eh;
     user_propagator::eq_eh_t    m_diseq_eh;
@@ -336,6 +337,7 @@ public:
             return;
         m_ctx->user_propagate_init(m_user_ctx, m_push_eh, m_pop_eh, m_fresh_eh);
         if (m_fixed_eh)   m_ctx->user_propagate_register_fixed(m_fixed_eh);
+        if (m_fixed_batch_eh) m_ctx->user_propagate_register_fixed_batch(m_fixed_batch_eh);
         if (m_final_eh)   m_ctx->user_propagate_register_final(m_final_eh);
         if (m_eq_eh)      m_ctx->user_propagate_register_eq(m_eq_eh);
         if (m_diseq_eh)   m_ctx->user_propagate_register_diseq(m_diseq_eh);
@@ -350,6 +352,7 @@ public:
         m_user_ctx = nullptr;
         m_vars.reset();
         m_fixed_eh = nullptr;
+        m_fixed_batch_eh = nullptr;
         m_final_eh = nullptr;
         m_eq_eh = nullptr;
         m_diseq_eh = nullptr;
@@ -380,6 +383,10 @@ public:
         m_fixed_eh = fixed_eh;
     }
 
+    void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) override {
+        m_fixed_batch_eh = fixed_batch_eh;
+    }
+
     void user_propagate_register_final(user_propagator::final_eh_t& final_eh) override {
         m_final_eh = final_eh;
     }
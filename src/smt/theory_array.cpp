@@ -206,6 +206,11 @@ namespace smt {
         TRACE("array", tout << "axiom 2a: #" << select->get_owner_id() << " #" << store->get_owner_id() << "\n";);
         SASSERT(is_select(select));
         SASSERT(is_store(store));
+        if (m_params.m_array_lazy_axioms) {
+            m_lazy_axiom2.push_back(std::make_pair(select, store));
+            m_trail_stack.push(push_back_trail<enode_pair, false>(m_lazy_axiom2));
+            return;
+        }
         if (assert_store_axiom2(store, select))
             m_stats.m_num_axiom2a++;
     }
@@ -214,6 +219,8 @@ namespace smt {
         TRACE("array_axiom2b", tout << "axiom 2b: #" << select->get_owner_id() << " #" << store->get_owner_id() << "\n";);
         SASSERT(is_select(select));
         SASSERT(is_store(store));
+        if (m_params.m_array_lazy_axioms && is_axiom2_satisfied(select, store))
+            return false;
         if (assert_store_axiom2(store, select)) {
             m_stats.m_num_axiom2b++;
             return true;
@@ -225,10 +232,70 @@ namespace smt {
         TRACE("array", tout << "extensionality: #" << a1->get_owner_id() << " #" << a2->get_owner_id() << "\n";);
         SASSERT(is_array_sort(a1));
         SASSERT(is_array_sort(a2));
+        if (m_params.m_array_extensional && m_params.m_array_lazy_axioms) {
+            m_lazy_ext.push_back(std::make_pair(a1, a2));
+            m_trail_stack.push(push_back_trail<enode_pair, false>(m_lazy_ext));
+            return;
+        }
         if (m_params.m_array_extensional && assert_extensionality(a1, a2)) 
             m_stats.m_num_extensionality++;
     }
 
+    /**
+       \brief Return true if the axiom 
+       
+           i = j or select(store(a, i, v), j) = select(a, j)
+
+       holds in the current congruence closure, where j are the indices of select.
+       Indices are pruned by the equalities of the current model, so the axiom 
+       is only needed when the indices are in different classes and the two 
+       selects are not known to be equal.
+    */
+    bool theory_array::is_axiom2_satisfied(enode * select, enode * store) {
+        unsigned num_args = select->get_num_args();
+        unsigned i = 1;
+        for (; i < num_args; ++i)
+            if (store->get_arg(i)->get_root() != select->get_arg(i)->get_root())
+                break;
+        if (i == num_args)
+            return true;
+        ptr_buffer<enode> args;
+        args.push_back(store);
+        for (i = 1; i < num_args; ++i)
+            args.push_back(select->get_arg(i));
+        enode * s1 = ctx.get_enode_eq_to(select->get_decl(), num_args, args.data());
+        if (!s1)
+            return false;
+        args[0] = store->get_arg(0);
+        enode * s2 = ctx.get_enode_eq_to(select->get_decl(), num_args, args.data());
+        return s2 && s1->get_root() == s2->get_root();
+    }
+
+    /**
+       \brief Instantiate the read-over-write and extensionality axioms 
+       that were delayed by m_array_lazy_axioms and that are violated by the current assignment.
+    */
+    final_check_status theory_array::assert_lazy_axioms() {
+        final_check_status r = FC_DONE;
+        for (auto const& [select, store] : m_lazy_axiom2) {
+            if (!ctx.is_relevant(select) || is_axiom2_satisfied(select, store))
+                continue;
+            if (assert_store_axiom2(store, select)) {
+                m_stats.m_num_axiom2a++;
+                r = FC_CONTINUE;
+            }
+        }
+        for (auto const& [a1, a2] : m_lazy_ext) {
+            if (!ctx.is_diseq(a1, a2))
+                continue;
+            if (assert_extensionality(a1, a2)) {
+                m_stats.m_num_extensionality++;
+                r = FC_CONTINUE;
+            }
+        }
+        return r;
+    }
+
 
     bool theory_array::internalize_atom(app * atom, bool) {
         return internalize_term(atom);
@@ -361,6 +428,8 @@ namespace smt {
     
     final_check_status theory_array::final_check_eh() {
         m_final_check_idx++;
+        if (m_params.m_array_lazy_axioms && assert_lazy_axioms() == FC_CONTINUE)
+            return FC_CONTINUE;
         final_check_status r = FC_DONE;
         if (m_params.m_array_lazy_ieq) {
             // Delay the creation of interface equalities...  The
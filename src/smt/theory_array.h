@@ -52,6 +52,8 @@ namespace smt {
         th_union_find                   m_find;
         trail_stack                     m_trail_stack;
         unsigned                        m_final_check_idx;
+        enode_pair_vector               m_lazy_axiom2;     // (select, store) pairs, used when m_array_lazy_axioms is set
+        enode_pair_vector               m_lazy_ext;        // disequal arrays, used when m_array_lazy_axioms is set
 
         theory_var mk_var(enode * n) override;
         bool internalize_atom(app * atom, bool gate_ctx) override;
@@ -87,6 +89,8 @@ namespace smt {
         void instantiate_extensionality(enode * a1, enode * a2);
         void instantiate_congruent(enode * a1, enode * a2);
         bool instantiate_axiom2b_for(theory_var v);
+        bool is_axiom2_satisfied(enode * select, enode * store);
+        final_check_status assert_lazy_axioms();
         
         virtual final_check_status assert_delayed_axioms();
         final_check_status mk_interface_eqs_at_final_check();
@@ -1020,6 +1020,8 @@ namespace smt {
         le_atom * a     = new (get_region()) le_atom(l, def);
         insert_bv2a(l.var(), a);
         m_trail_stack.push(mk_atom_trail(*this, l.var()));
+        // a word-level comparison splits the search space more evenly than any single bit
+        ctx.add_theory_aware_branching_info(l.var(), 0.5, l_undef);
         if (!ctx.relevancy() || !params().m_bv_lazy_le) {
             ctx.mk_th_axiom(get_id(),  l, ~def);
             ctx.mk_th_axiom(get_id(), ~l,  def);
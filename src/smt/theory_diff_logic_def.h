@@ -568,6 +568,16 @@ void theory_diff_logic<Ext>::inc_conflicts() {
 
 template<typename Ext>
 void theory_diff_logic<Ext>::propagate_core() {
+    unsigned batch = m_params.m_arith_dl_batch;
+    if (batch > 0 && m_asserted_atoms.size() >= m_asserted_qhead + batch && !ctx.inconsistent()) {
+        svector<edge_id> edges;
+        for (unsigned i = m_asserted_qhead; i < m_asserted_atoms.size(); ++i)
+            edges.push_back(m_asserted_atoms[i]->get_asserted_edge());
+        if (m_graph.enable_edges(edges.size(), edges.data())) {
+            m_asserted_qhead = m_asserted_atoms.size();
+            return;
+        }
+    }
     bool consistent = true;
     while (consistent && can_propagate()) {
         atom * a = m_asserted_atoms[m_asserted_qhead];
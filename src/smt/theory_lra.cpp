@@ -167,6 +167,7 @@ class theory_lra::imp {
     
     svector<std::pair<theory_var, theory_var> >       m_assume_eq_candidates; 
     unsigned                                          m_assume_eq_head;
+    hashtable<uint64_t, u64_hash, u64_eq>             m_assumed_eqs;   // pairs already proposed in the current scope
     indexed_uint_set                                         m_tmp_var_set;
     
     unsigned                                          m_num_conflicts;
@@ -1520,6 +1521,8 @@ public:
             enode* n2 = get_enode(other);
             if (n1->get_root() == n2->get_root())
                 continue;
+            if (m_assumed_eqs.contains(assumed_eq_key(v, other)))
+                continue;
             m_assume_eq_candidates.push_back({v, other});
             num_candidates++;            
         }
@@ -1543,7 +1546,14 @@ public:
             CTRACE("arith", 
                    is_eq(v1, v2) && n1->get_root() != n2->get_root(),
                    tout << "assuming eq: v" << v1 << " = v" << v2 << "\n";);
-            if (is_eq(v1, v2) &&  n1->get_root() != n2->get_root() && th.assume_eq(n1, n2)) {
+            if (!is_eq(v1, v2) || n1->get_root() == n2->get_root())
+                continue;
+            uint64_t key = assumed_eq_key(v1, v2);
+            if (m_assumed_eqs.contains(key))
+                continue;
+            m_assumed_eqs.insert(key);
+            ctx().push_trail(insert_map<hashtable<uint64_t, u64_hash, u64_eq>, uint64_t>(m_assumed_eqs, key));
+            if (th.assume_eq(n1, n2)) {
                 ++m_stats.m_assume_eqs;
                 return true;
             }
@@ -1551,6 +1561,11 @@ public:
         return false;
     }
 
+    static uint64_t assumed_eq_key(theory_var v1, theory_var v2) {
+        if (v1 > v2) std::swap(v1, v2);
+        return (static_cast<uint64_t>(v1) << 32ull) | static_cast<uint64_t>(v2);
+    }
+
     bool is_eq(theory_var v1, theory_var v2) {
         if (use_nra_model()) 
             return m_nla->am().eq(nl_value(v1, m_nla->tmp1()), nl_value(v2, m_nla->tmp2()));
@@ -1892,9 +1907,11 @@ public:
             IF_VERBOSE(4, verbose_stream() << "branch " << b << "\n";);
             // branch on term >= k + 1
             // branch on term <= k
-            // TBD: ctx().force_phase(ctx().get_literal(b));
             // at this point we have a new unassigned atom that the 
-            // SAT core assigns a value to
+            // SAT core assigns a value to. Prefer splitting on it first,
+            // in the direction chosen by the integer solver.
+            if (ctx().b_internalized(b))
+                ctx().add_theory_aware_branching_info(ctx().get_bool_var(b), 1.0, l_true);
             ++m_stats.m_branch;
             return FC_CONTINUE;
         }
@@ -3984,4 +4001,4 @@ template  class lp::lp_bound_propagator<smt::theory_lra::imp>;
 template void lp::lar_solver::propagate_bounds_for_touched_rows<smt::theory_lra::imp>(lp::lp_bound_propagator<smt::theory_lra::imp>&);
 template void lp::lar_solver::check_missed_propagations<smt::theory_lra::imp>(lp::lp_bound_propagator<smt::theory_lra::imp>&);
 template void lp::lar_solver::explain_implied_bound<smt::theory_lra::imp>(const lp::implied_bound&, lp::lp_bound_propagator<smt::theory_lra::imp>&);
-template unsigned lp::lar_solver::calculate_implied_bounds_for_row<smt::theory_lra::imp>(unsigned int, lp::lp_bound_propagator<smt::theory_lra::imp>&);
+template unsigned lp::lar_solver::calculate_implied_bounds_for_row<lp::lp_bound_propagator<smt::theory_lra::imp>>(unsigned int, lp::lp_bound_propagator<smt::theory_lra::imp>&);
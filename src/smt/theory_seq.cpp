@@ -355,6 +355,11 @@ final_check_status theory_seq::final_check_eh() {
         TRACEFIN("zero_length");
         return FC_CONTINUE;
     }
+    if (get_fparams().m_seq_length_first && fix_length_values()) {
+        ++m_stats.m_fix_length_value;
+        TRACEFIN("fix_length_values");
+        return FC_CONTINUE;
+    }
     if (get_fparams().m_split_w_len && len_based_split()) {
         ++m_stats.m_branch_variable;
         TRACEFIN("split_based_on_length");
@@ -536,6 +541,44 @@ bool theory_seq::fixed_length(expr* len_e, bool is_zero, bool check_long_strings
 }
 
 
+/**
+   Use the arithmetic model as a solution of the length abstraction:
+   decide len(x) = v for every sequence variable x whose length is not
+   fixed yet, where v is the value of len(x) in the current arithmetic
+   assignment. The word equations are then solved over strings of known
+   length by fixed_length. If the lengths are not compatible with the
+   word equations, the resulting conflicts add length lemmas and the
+   arithmetic solver produces a new candidate.
+*/
+bool theory_seq::fix_length_values() {
+    bool found = false;
+    rational lo, hi, val;
+    expr* e = nullptr;
+    for (unsigned i = 0; i < m_length.size(); ++i) {
+        expr* len_e = m_length.get(i);
+        VERIFY(m_util.str.is_length(len_e, e));
+        if (!is_var(e) || 
+            m_sk.is_tail(e) || 
+            m_sk.is_seq_first(e) || 
+            m_sk.is_indexof_left(e) || 
+            m_sk.is_indexof_right(e) ||
+            m_fixed.contains(e))
+            continue;
+        if (lower_bound(len_e, lo) && upper_bound(len_e, hi) && lo == hi)
+            continue;
+        if (!m_arith_value.get_value(len_e, val) || !val.is_unsigned())
+            continue;
+        literal lit = mk_eq(len_e, m_autil.mk_numeral(val, true), false);
+        if (ctx.get_assignment(lit) != l_undef)
+            continue;
+        TRACE("seq", tout << "fix length: " << mk_bounded_pp(len_e, m, 2) << " = " << val << "\n";);
+        ctx.mark_as_relevant(lit);
+        ctx.force_phase(lit);
+        found = true;
+    }
+    return found;
+}
+
 /*
     lit => s != ""
 */
@@ -1902,8 +1945,10 @@ void theory_seq::collect_statistics(::statistics & st) const {
     st.update("seq add axiom", m_stats.m_add_axiom);
     st.update("seq extensionality", m_stats.m_extensionality);
     st.update("seq fixed length", m_stats.m_fixed_length);
+    st.update("seq fix length value", m_stats.m_fix_length_value);
     st.update("seq int.to.str", m_stats.m_int_string);
     st.update("seq str.from_ubv", m_stats.m_ubv_string);
+    m_seq_rewrite.collect_statistics(st);
 }
 
 void theory_seq::init_search_eh() {
@@ -316,6 +316,7 @@ namespace smt {
             unsigned m_add_axiom;
             unsigned m_extensionality;
             unsigned m_fixed_length;
+            unsigned m_fix_length_value;
             unsigned m_propagate_contains;
             unsigned m_int_string;
             unsigned m_ubv_string;
@@ -435,6 +436,7 @@ namespace smt {
         bool check_length_coherence(expr* e);
         bool check_fixed_length(bool is_zero, bool check_long_strings);
         bool fixed_length(expr* e, bool is_zero, bool check_long_strings);
+        bool fix_length_values();
         bool branch_variable_eq(depeq const& e);
         bool branch_binary_variable(depeq const& e);
         bool can_align_from_lhs(expr_ref_vector const& ls, expr_ref_vector const& rs);
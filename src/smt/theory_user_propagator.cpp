@@ -28,7 +28,9 @@ theory_user_propagator::theory_user_propagator(context& ctx):
     theory(ctx, ctx.get_manager().mk_family_id(user_propagator::plugin::name())),
     m_var2expr(ctx.get_manager()),
     m_push_popping(false),
-    m_to_add(ctx.get_manager())
+    m_to_add(ctx.get_manager()),
+    m_fixed_batch_terms(ctx.get_manager()),
+    m_fixed_batch_values(ctx.get_manager())
 {}
 
 theory_user_propagator::~theory_user_propagator() {
@@ -136,6 +138,7 @@ theory * theory_user_propagator::mk_fresh(context * new_ctx) {
     }
     th->add(ctx, m_push_eh, m_pop_eh, m_fresh_eh);
     if ((bool)m_fixed_eh) th->register_fixed(m_fixed_eh);
+    if ((bool)m_fixed_batch_eh) th->register_fixed_batch(m_fixed_batch_eh);
     if ((bool)m_final_eh) th->register_final(m_final_eh);
     if ((bool)m_eq_eh) th->register_eq(m_eq_eh);
     if ((bool)m_diseq_eh) th->register_diseq(m_diseq_eh);
@@ -148,6 +151,7 @@ final_check_status theory_user_propagator::final_check_eh() {
     if (!(bool)m_final_eh)
         return FC_DONE;
     force_push();
+    flush_fixed_batch();
     unsigned sz1 = m_prop.size();
     unsigned sz2 = get_num_vars();
     try {
@@ -165,7 +169,7 @@ final_check_status theory_user_propagator::final_check_eh() {
 }
 
 void theory_user_propagator::new_fixed_eh(theory_var v, expr* value, unsigned num_lits, literal const* jlits) {
-    if (!m_fixed_eh)
+    if (!has_fixed())
         return;
     force_push();
     if (m_fixed.contains(v))
@@ -173,6 +177,12 @@ void theory_user_propagator::new_fixed_eh(theory_var v, expr* value, unsigned nu
     m_fixed.insert(v);
     ctx.push_trail(insert_map<uint_set, unsigned>(m_fixed, v));
     m_id2justification.setx(v, literal_vector(num_lits, jlits), literal_vector());
+    if (m_fixed_batch_eh) {
+        // delivered by flush_fixed_batch at the end of the propagation round
+        m_fixed_batch_terms.push_back(var2expr(v));
+        m_fixed_batch_values.push_back(value);
+        return;
+    }
     try {
         m_fixed_eh(m_user_context, this, var2expr(v), value);
     }
@@ -181,6 +191,20 @@ void theory_user_propagator::new_fixed_eh(theory_var v, expr* value, unsigned nu
     }
 }
 
+void theory_user_propagator::flush_fixed_batch() {
+    if (m_fixed_batch_terms.empty())
+        return;
+    expr_ref_vector terms(m), values(m);
+    terms.swap(m_fixed_batch_terms);
+    values.swap(m_fixed_batch_values);
+    try {
+        m_fixed_batch_eh(m_user_context, this, terms.size(), terms.data(), values.data());
+    }
+    catch (...) {
+        throw default_exception("Exception thrown in \"fixed\"-callback");
+    }
+}
+
 bool_var theory_user_propagator::enode_to_bool(enode* n, unsigned idx) {
     if (n->is_bool()) {
         // expression is a boolean
@@ -289,11 +313,13 @@ void theory_user_propagator::pop_scope_eh(unsigned num_scopes) {
     old_sz = m_to_add_lim.size() - num_scopes;
     m_to_add.shrink(m_to_add_lim[old_sz]);
     m_to_add_lim.shrink(old_sz);
+    m_fixed_batch_terms.reset();
+    m_fixed_batch_values.reset();
     m_pop_eh(m_user_context, this, num_scopes);
 }
 
 bool theory_user_propagator::can_propagate() {
-    return m_qhead < m_prop.size() || m_to_add_qhead < m_to_add.size() || m_replay_qhead < m_clauses_to_replay.size();
+    return m_qhead < m_prop.size() || m_to_add_qhead < m_to_add.size() || m_replay_qhead < m_clauses_to_replay.size() || !m_fixed_batch_terms.empty();
 }
 
 void theory_user_propagator::propagate_consequence(prop_info const& prop) {
@@ -362,7 +388,7 @@ void theory_user_propagator::propagate_new_fixed(prop_info const& prop) {
 
 
 void theory_user_propagator::propagate() {
-    if (m_qhead == m_prop.size() && m_to_add_qhead == m_to_add.size() && m_replay_qhead == m_clauses_to_replay.size())
+    if (!can_propagate())
         return;
     TRACE("user_propagate", tout << "propagating queue head: " << m_qhead << " prop queue: " << m_prop.size() << "\n");
     force_push();
@@ -395,6 +421,8 @@ void theory_user_propagator::propagate() {
     }
     ctx.push_trail(value_trail<unsigned>(m_qhead));
     m_qhead = qhead;
+    if (!ctx.inconsistent())
+        flush_fixed_batch();
 }
 
 
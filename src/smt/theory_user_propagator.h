@@ -62,6 +62,7 @@ namespace smt {
         user_propagator::fresh_eh_t     m_fresh_eh;
         user_propagator::final_eh_t     m_final_eh;
         user_propagator::fixed_eh_t     m_fixed_eh;
+        user_propagator::fixed_batch_eh_t m_fixed_batch_eh;
         user_propagator::eq_eh_t        m_eq_eh;
         user_propagator::eq_eh_t        m_diseq_eh;
         user_propagator::created_eh_t   m_created_eh;
@@ -88,6 +89,7 @@ namespace smt {
         lbool                  m_next_split_phase = l_undef;
         vector<expr_ref_vector> m_clauses_to_replay;
         unsigned                m_replay_qhead = 0;
+        expr_ref_vector         m_fixed_batch_terms, m_fixed_batch_values;
 
         expr* var2expr(theory_var v) { return m_var2expr.get(v); }
         theory_var expr2var(expr* e) { check_defined(e); return m_expr2var[e->get_id()]; }
@@ -100,6 +102,7 @@ namespace smt {
 
         void propagate_consequence(prop_info const& prop);
         void propagate_new_fixed(prop_info const& prop);
+        void flush_fixed_batch();
         
         bool_var enode_to_bool(enode* n, unsigned bit);
 
@@ -128,12 +131,13 @@ namespace smt {
 
         void register_final(user_propagator::final_eh_t& final_eh) { m_final_eh = final_eh; }
         void register_fixed(user_propagator::fixed_eh_t& fixed_eh) { m_fixed_eh = fixed_eh; }
+        void register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) { m_fixed_batch_eh = fixed_batch_eh; }
         void register_eq(user_propagator::eq_eh_t& eq_eh) { m_eq_eh = eq_eh; }
         void register_diseq(user_propagator::eq_eh_t& diseq_eh) { m_diseq_eh = diseq_eh; }
         void register_created(user_propagator::created_eh_t& created_eh) { m_created_eh = created_eh; }
         void register_decide(user_propagator::decide_eh_t& decide_eh) { m_decide_eh = decide_eh; }
 
-        bool has_fixed() const { return (bool)m_fixed_eh; }
+        bool has_fixed() const { return (bool)m_fixed_eh || (bool)m_fixed_batch_eh; }
         
         bool propagate_cb(unsigned num_fixed, expr* const* fixed_ids, unsigned num_eqs, expr* const* lhs, expr* const* rhs, expr* conseq) override;
         void register_cb(expr* e) override;
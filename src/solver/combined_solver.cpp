@@ -20,10 +20,13 @@ Notes:
 --*/
 #include "util/scoped_timer.h"
 #include "util/common_msgs.h"
+#include "util/stopwatch.h"
 #include "ast/ast_pp.h"
+#include "ast/static_features.h"
 #include "solver/solver.h"
 #include "solver/combined_solver_params.hpp"
 #include <atomic>
+#include <fstream>
 #define PS_VB_LVL 15
 
 /**
@@ -42,6 +45,12 @@ Notes:
        - push is used
        - assertions are performed after a check_sat
        - parameter ignore_solver1==false
+
+   In adaptive mode the outcomes of solver 2 in incremental mode are recorded
+   for queries with the same static features. Solver 2 is skipped when it
+   failed on all earlier similar queries, and its timeout is lowered to twice
+   its slowest success when it rarely fails. The outcomes can be saved to a
+   file and loaded by other processes.
 */
 class combined_solver : public solver {
 public:
@@ -53,6 +62,37 @@ public:
     };
 
 private:
+    /**
+       \brief Outcomes of solver 2 on queries with the same features.
+    */
+    struct query_stats {
+        unsigned m_num_solved = 0;     // solver 2 returned sat or unsat
+        unsigned m_num_failed = 0;     // solver 2 returned unknown or timed out
+        unsigned m_num_skipped = 0;    // solver 2 was not used
+        double   m_max_time = 0;       // seconds of the slowest success of solver 2
+
+        // solver 2 is retried on every 8th query to detect changes.
+        bool skip_solver2() const {
+            return m_num_solved == 0 && m_num_failed >= 2 && (m_num_skipped + 1) % 8 != 0;
+        }
+
+        unsigned timeout(unsigned t) const {
+            if (m_num_solved < 3 * (m_num_failed + 1))
+                return t;
+            double ms = 2000 * m_max_time + 100;
+            return ms < t ? static_cast<unsigned>(ms) : t;
+        }
+
+        void update(bool solved, double secs) {
+            if (solved) {
+                ++m_num_solved;
+                m_max_time = std::max(m_max_time, secs);
+            }
+            else 
+                ++m_num_failed;
+        }
+    };
+
     bool                 m_inc_mode;
     bool                 m_check_sat_executed;
     bool                 m_use_solver1_results;
@@ -65,6 +105,9 @@ private:
     bool                 m_ignore_solver1;
     inc_unknown_behavior m_inc_unknown_behavior;
     unsigned             m_inc_timeout;
+    bool                 m_adaptive;
+    std::string          m_history_file;
+    u_map<query_stats>   m_history;        // query features |-> outcomes of solver 2
     
     void switch_inc_mode() {
         m_inc_mode = true;
@@ -90,6 +133,50 @@ private:
         m_inc_timeout    = p.solver2_timeout();
         m_ignore_solver1 = p.ignore_solver1();
         m_inc_unknown_behavior = static_cast<inc_unknown_behavior>(p.solver2_unknown());
+        m_adaptive       = p.adaptive();
+        m_history_file   = p.history();
+    }
+
+    unsigned query_key() {
+        static_features sf(get_manager());
+        ptr_vector<expr> fmls;
+        for (unsigned i = 0; i < get_num_assertions(); ++i)
+            fmls.push_back(get_assertion(i));
+        sf.collect(fmls.size(), fmls.data());
+        unsigned key = 0;
+        key |= sf.m_has_int;
+        key |= sf.m_has_real << 1;
+        key |= sf.m_has_bv << 2;
+        key |= sf.m_has_arrays << 3;
+        key |= sf.m_has_fpa << 4;
+        key |= (sf.m_has_str || sf.m_has_seq_non_str) << 5;
+        key |= (sf.m_num_quantifiers > 0) << 6;
+        key |= (sf.m_num_non_linear > 0) << 7;
+        key |= (sf.m_num_uninterpreted_functions > 0) << 8;
+        key |= log2(sf.m_num_exprs + 1) << 9;
+        return key;
+    }
+
+    void load_history() {
+        if (m_history_file.empty())
+            return;
+        std::ifstream in(m_history_file);
+        unsigned key;
+        query_stats qs;
+        while (in >> key >> qs.m_num_solved >> qs.m_num_failed >> qs.m_num_skipped >> qs.m_max_time)
+            m_history.insert(key, qs);
+    }
+
+    void save_history() {
+        if (m_history_file.empty() || m_history.empty())
+            return;
+        std::ofstream out(m_history_file);
+        if (!out) {
+            IF_VERBOSE(1, verbose_stream() << "(combined-solver \"could not write " << m_history_file << "\")\n";);
+            return;
+        }
+        for (auto const& [key, qs] : m_history)
+            out << key << " " << qs.m_num_solved << " " << qs.m_num_failed << " " << qs.m_num_skipped << " " << qs.m_max_time << "\n";
     }
 
     ast_manager& get_manager() const override { return m_solver1->get_manager(); }
@@ -123,6 +210,13 @@ public:
         m_inc_mode            = false;
         m_check_sat_executed  = false;
         m_use_solver1_results = true;
+        if (m_adaptive)
+            load_history();
+    }
+
+    ~combined_solver() override {
+        if (m_adaptive)
+            save_history();
     }
 
     solver* translate(ast_manager& m, params_ref const& p) override {
@@ -221,27 +315,41 @@ public:
         }
         
         if (m_inc_mode) {
-            if (m_inc_timeout == UINT_MAX) {
-                IF_VERBOSE(PS_VB_LVL, verbose_stream() << "(combined-solver \"using solver 2 (without a timeout)\")\n";);            
-                lbool r = m_solver2->check_sat_core(num_assumptions, assumptions);
-                if (r != l_undef || !use_solver1_when_undef() || !get_manager().inc()) {
-                    return r;
-                }
+            query_stats* qs = nullptr;
+            if (m_adaptive && use_solver1_when_undef())
+                qs = &m_history.insert_if_not_there(query_key(), query_stats());
+            if (qs && qs->skip_solver2()) {
+                IF_VERBOSE(PS_VB_LVL, verbose_stream() << "(combined-solver \"skipping solver 2\")\n";);
+                ++qs->m_num_skipped;
             }
             else {
-                IF_VERBOSE(PS_VB_LVL, verbose_stream() << "(combined-solver \"using solver 2 (with timeout)\")\n";);            
-                aux_timeout_eh eh(m_solver2.get());
+                unsigned timeout = qs ? qs->timeout(m_inc_timeout) : m_inc_timeout;
+                stopwatch sw;
+                sw.start();
                 lbool r = l_undef;
-                try {
-                    scoped_timer timer(m_inc_timeout, &eh);
+                bool canceled = false;
+                if (timeout == UINT_MAX) {
+                    IF_VERBOSE(PS_VB_LVL, verbose_stream() << "(combined-solver \"using solver 2 (without a timeout)\")\n";);            
                     r = m_solver2->check_sat_core(num_assumptions, assumptions);
                 }
-                catch (z3_exception&) {
-                    if (!eh.m_canceled) {
-                        throw;
+                else {
+                    IF_VERBOSE(PS_VB_LVL, verbose_stream() << "(combined-solver \"using solver 2 (with timeout)\")\n";);            
+                    aux_timeout_eh eh(m_solver2.get());
+                    try {
+                        scoped_timer timer(timeout, &eh);
+                        r = m_solver2->check_sat_core(num_assumptions, assumptions);
+                    }
+                    catch (z3_exception&) {
+                        if (!eh.m_canceled) {
+                            throw;
+                        }
                     }
+                    canceled = eh.m_canceled;
                 }
-                if ((r != l_undef || !use_solver1_when_undef()) && !eh.m_canceled) {
+                sw.stop();
+                if (qs)
+                    qs->update(r != l_undef && !canceled, sw.get_seconds());
+                if (!canceled && (r != l_undef || !use_solver1_when_undef() || !get_manager().inc())) {
                     return r;
                 }
             }
@@ -367,6 +475,10 @@ public:
         m_solver2->user_propagate_register_fixed(fixed_eh);
     }
     
+    void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) override {
+        m_solver2->user_propagate_register_fixed_batch(fixed_batch_eh);
+    }
+    
     void user_propagate_register_final(user_propagator::final_eh_t& final_eh) override {
         m_solver2->user_propagate_register_final(final_eh);
     }
@@ -0,0 +1,141 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    mus_enum.cpp
+
+Abstract:
+
+    MUS and MCS enumeration.
+
+--*/
+
+#include "solver/mus_enum.h"
+#include "solver/mus.h"
+#include "ast/ast_pp.h"
+#include "ast/ast_util.h"
+
+mus_enumerator::mus_enumerator(solver& s, solver* map, expr_ref_vector const& soft):
+    m_solver(s),
+    m_map(map),
+    m(s.get_manager()),
+    m_soft(soft),
+    m_indicators(m) {
+    for (unsigned i = 0; i < m_soft.size(); ++i)
+        m_indicators.push_back(m.mk_fresh_const("mus", m.mk_bool_sort()));
+}
+
+/**
+   \brief the seed contains the soft constraints whose indicators are not false.
+   Indicators that the map solver leaves unassigned are included to favor large seeds.
+*/
+void mus_enumerator::get_seed(model& mdl, bool_vector& seed) {
+    seed.reset();
+    for (expr* b : m_indicators)
+        seed.push_back(!mdl.is_false(b));
+}
+
+void mus_enumerator::to_exprs(bool_vector const& seed, bool value, expr_ref_vector& result) const {
+    result.reset();
+    for (unsigned i = 0; i < seed.size(); ++i)
+        if (seed[i] == value)
+            result.push_back(m_soft.get(i));
+}
+
+/**
+   \brief extend a satisfiable seed to a maximal satisfiable subset.
+   Soft constraints that hold in the model of a satisfiable check are added
+   without further checks.
+*/
+void mus_enumerator::grow(bool_vector& seed) {
+    expr_ref_vector asms(m);
+    auto add_true = [&]() {
+        model_ref mdl;
+        m_solver.get_model(mdl);
+        if (!mdl)
+            return;
+        for (unsigned i = 0; i < seed.size(); ++i)
+            if (!seed[i] && mdl->is_true(m_soft.get(i)))
+                seed[i] = true;
+    };
+    add_true();
+    for (unsigned i = 0; i < seed.size(); ++i) {
+        if (seed[i])
+            continue;
+        to_exprs(seed, true, asms);
+        asms.push_back(m_soft.get(i));
+        lbool r = m_solver.check_sat(asms);
+        if (r == l_undef)
+            return;
+        if (r == l_true) {
+            seed[i] = true;
+            add_true();
+        }
+    }
+}
+
+lbool mus_enumerator::next(expr_ref_vector& result) {
+    result.reset();
+    bool_vector seed;
+    expr_ref_vector asms(m), block(m);
+    while (true) {
+        lbool r = m_map->check_sat(0, nullptr);
+        if (r != l_true)
+            return l_undef;
+        model_ref mdl;
+        m_map->get_model(mdl);
+        get_seed(*mdl, seed);
+        to_exprs(seed, true, asms);
+        r = m_solver.check_sat(asms);
+        if (r == l_undef)
+            return l_undef;
+        if (r == l_true) {
+            grow(seed);
+            if (!m.inc())
+                return l_undef;
+            block.reset();
+            for (unsigned i = 0; i < seed.size(); ++i)
+                if (!seed[i])
+                    block.push_back(m_indicators.get(i));
+            m_map->assert_expr(mk_or(block));
+            to_exprs(seed, false, result);
+            TRACE("mus", tout << "mcs: " << result << "\n";);
+            return l_true;
+        }
+        expr_ref_vector core(m);
+        m_solver.get_unsat_core(core);
+        obj_hashtable<expr> in_core;
+        for (expr* c : core)
+            in_core.insert(c);
+        mus ms(m_solver);
+        unsigned num_soft = 0;
+        for (unsigned i = 0; i < seed.size(); ++i) {
+            if (seed[i] && in_core.contains(m_soft.get(i))) {
+                ms.add_soft(m_soft.get(i));
+                ++num_soft;
+            }
+        }
+        expr_ref_vector mus_lits(m);
+        if (num_soft > 0 && ms.get_mus(mus_lits) == l_undef)
+            return l_undef;
+        obj_hashtable<expr> in_mus;
+        for (expr* c : mus_lits)
+            in_mus.insert(c);
+        block.reset();
+        for (unsigned i = 0; i < m_soft.size(); ++i) {
+            if (in_mus.contains(m_soft.get(i))) {
+                block.push_back(m.mk_not(m_indicators.get(i)));
+                result.push_back(m_soft.get(i));
+            }
+        }
+        if (block.empty()) {
+            // the hard constraints are unsatisfiable: the empty set is the only MUS.
+            m_map->assert_expr(m.mk_false());
+            return l_false;
+        }
+        m_map->assert_expr(mk_or(block));
+        TRACE("mus", tout << "mus: " << result << "\n";);
+        return l_false;
+    }
+}
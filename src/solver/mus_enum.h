@@ -0,0 +1,53 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    mus_enum.h
+
+Abstract:
+
+    Enumeration of minimal unsatisfiable subsets (MUS) and minimal
+    correction sets (MCS) of soft literals, following MARCO.
+
+    A map solver over one Boolean indicator per soft literal records the
+    subsets that are already explored. Each seed taken from the map solver
+    is either satisfiable and grown to a maximal satisfiable subset, whose
+    complement is an MCS, or unsatisfiable and shrunk to an MUS with the
+    mus class. Every result is blocked in the map solver, so each MUS and
+    MCS is produced once. Enumeration ends when the map solver becomes
+    unsatisfiable.
+
+--*/
+#pragma once
+
+#include "solver/solver.h"
+
+class mus_enumerator {
+    solver&         m_solver;
+    ref<solver>     m_map;
+    ast_manager&    m;
+    expr_ref_vector m_soft;
+    expr_ref_vector m_indicators;
+
+    void get_seed(model& mdl, bool_vector& seed);
+    void grow(bool_vector& seed);
+    void to_exprs(bool_vector const& seed, bool value, expr_ref_vector& result) const;
+
+public:
+    /**
+       \brief enumerate subsets of soft. The hard constraints are the assertions of s.
+       map is an empty solver for the Boolean map problem.
+       \pre the soft constraints are literals.
+    */
+    mus_enumerator(solver& s, solver* map, expr_ref_vector const& soft);
+
+    expr_ref_vector const& soft() const { return m_soft; }
+
+    /**
+       \brief produce the next subset.
+       Return l_false if result is an MUS, l_true if result is an MCS, and
+       l_undef if the enumeration is complete or was interrupted.
+    */
+    lbool next(expr_ref_vector& result);
+};
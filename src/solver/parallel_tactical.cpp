@@ -25,11 +25,18 @@ Notes:
   3. Cube using the parameter settings prescribed in m_params.
   4. Optionally pass the cubes as assumptions and solve each sub-cube with a prescribed resource bound.
   5. Assemble cubes that could not be solved and create a cube state.
+
+ When parallel.cubes_file is set and the search ends without a result, the cubes that
+ are still open are saved to the file as SMT2 scopes, one (push) (assert cube) (check-sat) (pop)
+ per cube. The disjunction of the saved cubes covers the part of the search space that
+ was not closed, so the cubes can be solved separately and later.
  
 --*/
 
 #include "util/scoped_ptr_vector.h"
+#include "util/worker_pool.h"
 #include "ast/ast_pp.h"
+#include "ast/ast_pp_util.h"
 #include "ast/ast_util.h"
 #include "ast/ast_translation.h"
 #include "solver/solver.h"
@@ -68,6 +75,7 @@ tactic * mk_parallel_tactic(solver* s, params_ref const& p) {
 #include <mutex>
 #include <cmath>
 #include <condition_variable>
+#include <fstream>
 
 class parallel_tactic : public tactic {
 
@@ -132,6 +140,8 @@ class parallel_tactic : public tactic {
             }            
         } 
 
+        ptr_vector<solver_state> const& tasks() const { return m_tasks; }
+
         bool is_idle() {
             std::lock_guard<std::mutex> lock(m_mutex);
             return m_tasks.empty() && m_num_waiters > 0;
@@ -266,6 +276,21 @@ class parallel_tactic : public tactic {
 
         vector<cube_var> const& cubes() const { return m_cubes; }
 
+        // cubes that remain to be solved, each conjoined with the asserted cubes.
+        // the cubes of an active task are already handed to a clone, so only the
+        // asserted cubes remain open.
+        void get_open_cubes(bool active, expr_ref_vector& result) {
+            if (active || m_cubes.empty()) {
+                result.push_back(mk_and(m_asserted_cubes));
+                return;
+            }
+            for (auto const& c : m_cubes) {
+                expr_ref_vector lits(m_asserted_cubes);
+                lits.append(c.cube());
+                result.push_back(mk_and(lits));
+            }
+        }
+
         // remove up to n cubes from list of cubes.
         vector<cube_var> split_cubes(unsigned n) {
             vector<cube_var> result;
@@ -381,6 +406,7 @@ private:
     params_ref    m_params;
     sref_vector<model> m_models;
     scoped_ptr<expr_ref_vector> m_core;
+    scoped_ptr<expr_ref_vector> m_open_cubes;     // cubes of canceled tasks, in m_serialize_manager
     unsigned      m_num_threads;    
     statistics    m_stats;
     task_queue    m_queue;
@@ -449,6 +475,46 @@ private:
         }
     }
 
+    bool save_cubes() const {
+        parallel_params pp(m_params);
+        return *pp.cubes_file() != 0;
+    }
+
+    void collect_open_cubes(solver_state& s, bool active) {
+        expr_ref_vector cubes(s.m());
+        s.get_open_cubes(active, cubes);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_serialize_manager) 
+            m_serialize_manager = alloc(ast_manager, s.m(), true);
+        if (!m_open_cubes)
+            m_open_cubes = alloc(expr_ref_vector, *m_serialize_manager);
+        ast_translation tr(s.m(), *m_serialize_manager);
+        m_open_cubes->append(tr(cubes));
+    }
+
+    void write_open_cubes() {
+        parallel_params pp(m_params);
+        std::string file = pp.cubes_file();
+        for (solver_state* st : m_queue.tasks())
+            collect_open_cubes(*st, false);
+        std::ofstream out(file);
+        if (!out) 
+            throw default_exception("could not open file " + file);
+        unsigned num_cubes = 0;
+        if (m_open_cubes) {
+            ast_pp_util visitor(*m_serialize_manager);
+            visitor.collect(*m_open_cubes);
+            visitor.display_decls(out);
+            for (expr* c : *m_open_cubes) {
+                out << "(push)\n";
+                visitor.display_assert(out, c, false);
+                out << "(check-sat)\n(pop)\n";
+            }
+            num_cubes = m_open_cubes->size();
+        }
+        IF_VERBOSE(1, verbose_stream() << "(tactic.parallel :open-cubes " << num_cubes << " :file " << file << ")\n");
+    }
+
     void close_branch(solver_state& s, lbool status) {
         double f = 100.0 / s.get_width();
         {
@@ -705,6 +771,7 @@ private:
                 collect_statistics(*st);
                 m_queue.task_done(st);
                 if (!st->m().inc()) m_queue.shutdown();
+                if (!st->m().inc() && save_cubes()) collect_open_cubes(*st, true);
                 IF_VERBOSE(2, display(verbose_stream()););
                 dealloc(st);
             }
@@ -735,11 +802,7 @@ private:
 
     lbool solve(model_ref& mdl) {        
         add_branches(1);
-        vector<std::thread> threads;
-        for (unsigned i = 0; i < m_num_threads; ++i) 
-            threads.push_back(std::thread([this]() { run_solver(); }));
-        for (std::thread& t : threads) 
-            t.join();
+        worker_pool::run(m_num_threads, [this]() { run_solver(); });
         m_queue.stats(m_stats);
         m_manager.limit().reset_cancel();
         if (m_exn_code == -1) 
@@ -755,8 +818,11 @@ private:
             mdl = mdl->translate(tr);            
             return l_true;
         }
-        if (m_has_undef) 
+        if (m_has_undef) {
+            if (save_cubes())
+                write_open_cubes();
             return l_undef;
+        }
         return l_false;
     }
 
@@ -845,6 +911,7 @@ public:
     void cleanup() override {
         m_queue.reset();
         m_models.reset();
+        m_open_cubes = nullptr;
     }
 
     tactic* translate(ast_manager& m) override {
@@ -22,11 +22,16 @@ Notes:
 #include "ast/ast_pp.h"
 #include "ast/ast_pp_util.h"
 #include "ast/display_dimacs.h"
+#include "ast/ast_binary.h"
 #include "ast/converters/model_converter.h"
 #include "solver/solver.h"
 #include "params/solver_params.hpp"
 #include "model/model_evaluator.h"
 #include "model/model_params.hpp"
+#include "util/mutex.h"
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
 
 
 unsigned solver::get_num_assertions() const {
@@ -229,12 +234,16 @@ void solver::reset_params(params_ref const & p) {
     m_params.append(p);
     solver_params sp(m_params);
     m_cancel_backup_file = sp.cancel_backup_file();
+    m_cache = sp.cache();
+    m_cache_dir = sp.cache_dir();
 }
 
 void solver::updt_params(params_ref const & p) {
     m_params.copy(p);
     solver_params sp(m_params);
     m_cancel_backup_file = sp.cancel_backup_file();
+    m_cache = sp.cache();
+    m_cache_dir = sp.cache_dir();
 }
 
 
@@ -311,9 +320,76 @@ expr_ref_vector solver::get_non_units() {
 }
 
 
+static mutex                           g_cache_mux;
+static std::unordered_set<std::string> g_unsat_cache;
+static const unsigned                  g_max_cache_size = 4096;
+
+/**
+   \brief the key of the current assertions is their serialization in the 
+   binary AST format. It is empty if the assertions cannot be serialized.
+*/
+std::string solver::mk_cache_key() {
+    ast_manager& m = get_manager();
+    expr_ref_vector fmls(m);
+    get_assertions(fmls);
+    std::ostringstream out;
+    try {
+        ast_to_binary(m, fmls.size(), reinterpret_cast<ast* const*>(fmls.data()), out);
+    }
+    catch (default_exception&) {
+        return std::string();
+    }
+    return std::move(out).str();
+}
+
+static std::string cache_file_name(symbol const& dir, std::string const& key) {
+    std::ostringstream name;
+    name << dir << "/" << std::hex << string_hash(key.c_str(), static_cast<unsigned>(key.size()), 17) 
+         << "-" << key.size() << ".z3ab";
+    return std::move(name).str();
+}
+
+bool solver::is_cached_unsat(std::string const& key) {
+    {
+        lock_guard lock(g_cache_mux);
+        if (g_unsat_cache.count(key) > 0)
+            return true;
+    }
+    if (m_cache_dir.is_null() || m_cache_dir.str().empty())
+        return false;
+    std::ifstream in(cache_file_name(m_cache_dir, key), std::ios::in | std::ios::binary);
+    if (!in)
+        return false;
+    std::ostringstream content;
+    content << in.rdbuf();
+    return content.str() == key;
+}
+
+void solver::cache_unsat(std::string const& key) {
+    {
+        lock_guard lock(g_cache_mux);
+        if (g_unsat_cache.size() >= g_max_cache_size)
+            g_unsat_cache.clear();
+        g_unsat_cache.insert(key);
+    }
+    if (m_cache_dir.is_null() || m_cache_dir.str().empty())
+        return;
+    std::ofstream out(cache_file_name(m_cache_dir, key), std::ios::out | std::ios::binary);
+    out << key;
+}
+
 lbool solver::check_sat(unsigned num_assumptions, expr * const * assumptions) {
     lbool r = l_undef;
     scoped_solver_time _st(*this);
+    // unsat cores and proofs are not cached, so only checks that do not need them use the cache.
+    std::string key;
+    if (m_cache && num_assumptions == 0 && !get_manager().proofs_enabled()) {
+        key = mk_cache_key();
+        if (!key.empty() && is_cached_unsat(key)) {
+            IF_VERBOSE(2, verbose_stream() << "(solver.cache :hit)\n");
+            return l_false;
+        }
+    }
     try {
         r = check_sat_core(num_assumptions, assumptions);
     }
@@ -326,6 +402,8 @@ lbool solver::check_sat(unsigned num_assumptions, expr * const * assumptions) {
     if (r == l_undef && !get_manager().inc()) {
         dump_state(num_assumptions, assumptions);        
     }
+    if (r == l_false && !key.empty())
+        cache_unsat(key);
     return r;
 }
 
@@ -51,6 +51,12 @@ solver* mk_smt2_solver(ast_manager& m, params_ref const& p, symbol const& logic
 class solver : public check_sat_result, public user_propagator::core {
     params_ref  m_params;
     symbol      m_cancel_backup_file;
+    bool        m_cache = false;
+    symbol      m_cache_dir;
+
+    std::string mk_cache_key();
+    bool is_cached_unsat(std::string const& key);
+    void cache_unsat(std::string const& key);
 public:
     solver(ast_manager& m): check_sat_result(m) {}
 
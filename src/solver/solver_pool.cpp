@@ -277,7 +277,19 @@ public:
         SASSERT(!m_pushed);
         m_head = 0;
         m_assertions.reset();
-        m_pool.refresh(m_base.get());
+        if (is_virtual() && m_pool.retire(m_base.get())) {
+            m_base->assert_expr(m.mk_not(m_pred));
+            m_pred = m_pool.mk_pred();
+            // the activation literal is the first assumption
+            m_assumptions[0] = m_pred;
+        }
+        else {
+            m_pool.refresh(m_base.get());
+        }
+    }
+
+    void copy_assertions(pool_solver const& src) {
+        m_assertions.append(src.m_assertions);
     }
 
 private:
@@ -336,7 +348,9 @@ private:
 solver_pool::solver_pool(solver* base_solver, unsigned num_pools):
     m_base_solver(base_solver),
     m_num_pools(num_pools),
-    m_current_pool(0)
+    m_current_pool(0),
+    m_num_preds(0),
+    m_max_retired(64)
 {
     SASSERT(num_pools > 0);
 }
@@ -400,14 +414,50 @@ solver* solver_pool::mk_solver() {
         solver* s = m_solvers[(m_current_pool++) % m_num_pools];
         base_solver = dynamic_cast<pool_solver*>(s)->base_solver();
     }
-    std::stringstream name;
-    name << "vsolver#" << m_solvers.size();
-    app_ref pred(m.mk_const(symbol(name.str()), m.mk_bool_sort()), m);
-    pool_solver* solver = alloc(pool_solver, base_solver.get(), *this, pred);
+    return mk_solver(base_solver.get());
+}
+
+solver* solver_pool::mk_solver(solver* base_solver) {
+    app_ref pred = mk_pred();
+    pool_solver* solver = alloc(pool_solver, base_solver, *this, pred);
     m_solvers.push_back(solver);
     return solver;
 }
 
+/**
+   \brief Create a solver that shares the base solver of s and starts
+   with the assertions of s that are not in a scope.
+   The assertions are internalized lazily under the activation literal of
+   the new solver, so the base solver is neither copied nor rebuilt.
+*/
+solver* solver_pool::clone_solver(solver* s) {
+    pool_solver* ps = dynamic_cast<pool_solver*>(s);
+    SASSERT(ps);
+    pool_solver* result = dynamic_cast<pool_solver*>(mk_solver(ps->base_solver()));
+    result->copy_assertions(*ps);
+    return result;
+}
+
+app_ref solver_pool::mk_pred() {
+    ast_manager& m = m_base_solver->get_manager();
+    std::stringstream name;
+    name << "vsolver#" << (m_num_preds++);
+    return app_ref(m.mk_const(symbol(name.str()), m.mk_bool_sort()), m);
+}
+
+/**
+   \brief Record that an activation literal of base_solver is retired.
+   Return false if base_solver has accumulated too many retired literals
+   and should be rebuilt instead.
+*/
+bool solver_pool::retire(solver* base_solver) {
+    unsigned& n = m_num_retired.insert_if_not_there(base_solver, 0);
+    if (n >= m_max_retired) 
+        return false;
+    ++n;
+    return true;
+}
+
 void solver_pool::reset_solver(solver* s) {
     pool_solver* ps = dynamic_cast<pool_solver*>(s);
     SASSERT(ps);
@@ -417,6 +467,7 @@ void solver_pool::reset_solver(solver* s) {
 void solver_pool::refresh(solver* base_solver) {
     ast_manager& m = m_base_solver->get_manager();
     ref<solver> new_base = m_base_solver->translate(m, m_base_solver->get_params());
+    m_num_retired.erase(base_solver);
     for (solver* s0 : m_solvers) {
         pool_solver* s = dynamic_cast<pool_solver*>(s0);
         if (base_solver == s->base_solver()) {
@@ -21,6 +21,12 @@ Notes:
     by Arie Gurfinkel
     Use this module as a replacement for spacer_smt_context_manager.
 
+    Resetting a pool solver retires its activation literal: the negation
+    of the literal is asserted on the base solver and a fresh literal is
+    used for subsequent assertions. The base solver is only rebuilt from
+    the live assertions of its pool solvers once the number of retired
+    literals on it exceeds max_retired.
+
 --*/
 #pragma once
 
@@ -44,7 +50,10 @@ class solver_pool {
     ref<solver>         m_base_solver;
     unsigned            m_num_pools;
     unsigned            m_current_pool;
+    unsigned            m_num_preds;
+    unsigned            m_max_retired;
     sref_vector<solver> m_solvers;
+    ptr_addr_map<solver, unsigned> m_num_retired;   // base solver |-> number of retired activation literals
     stats               m_stats;
 
     stopwatch m_check_watch;
@@ -54,6 +63,12 @@ class solver_pool {
 
     void refresh(solver* s);
 
+    bool retire(solver* base);
+
+    app_ref mk_pred();
+
+    solver* mk_solver(solver* base);
+
     ptr_vector<solver> get_base_solvers() const;
   
 public:
@@ -64,9 +79,14 @@ public:
 
     solver* mk_solver();
 
+    // create a solver on the same base solver as s with the assertions of s outside of scopes.
+    solver* clone_solver(solver* s);
+
     void reset_solver(solver* s);
     void updt_params(const params_ref &p);
 
+    void set_max_retired(unsigned n) { m_max_retired = n; }
+
 };
 
 
@@ -17,6 +17,12 @@ Notes:
 
  - port various pre-processing to simplifiers
    - qe-lite, fm-elimination, ite-lifting, other from asserted_formulas
+ - pre-processing runs to completion before the solver sees the assertions.
+   Overlapping heavier simplifiers with solving requires running them on a
+   translation of the assertions into a separate ast_manager, because
+   ast_manager is not thread safe, and injecting only equivalence preserving
+   results back, because eliminations that extend the model reconstruction
+   trail cannot be applied to assertions the solver already received.
 --*/
 
 
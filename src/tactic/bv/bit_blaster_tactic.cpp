@@ -15,6 +15,12 @@ Author:
 
 Notes:
 
+    Assertions are blasted in sequence by one rewriter, so blasted sub-terms
+    shared between assertions are blasted once. Blasting assertions in parallel
+    would need a rewriter and ast_manager per thread and an ast_translation of
+    the blasted bits back, which loses this sharing and duplicates the fresh
+    bit constants of shared bit-vector constants.
+
 --*/
 #include "tactic/tactical.h"
 #include "tactic/bv/bit_blaster_model_converter.h"
@@ -133,6 +139,7 @@ public:
         r.insert("blast_add", CPK_BOOL, "bit-blast adders.", "true");
         r.insert("blast_quant", CPK_BOOL, "bit-blast quantified variables.", "false");
         r.insert("blast_full", CPK_BOOL, "bit-blast any term with bit-vector sort, this option will make E-matching ineffective in any pattern containing bit-vector terms.", "false");
+        r.insert("blast_cache", CPK_BOOL, "keep the circuits of multipliers, dividers and shifters across calls and inner scopes.", "true");
     }
      
     void operator()(goal_ref const & g, 
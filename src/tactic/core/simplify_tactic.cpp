@@ -44,6 +44,7 @@ struct simplify_tactic::imp {
 
     void collect_statistics(statistics& st) {
         st.update("rewriter.steps", m_num_steps);
+        m_r.collect_statistics(st);
     }
 
     void operator()(goal & g) {
@@ -60,6 +61,8 @@ struct simplify_tactic::imp {
             expr * curr = g.form(idx);
             m_r(curr, new_curr, new_pr);
             m_num_steps += m_r.get_num_steps();
+            if (new_curr == curr)
+                continue;
             if (g.proofs_enabled()) {
                 proof * pr = g.pr(idx);
                 new_pr     = m().mk_modus_ponens(pr, new_pr);
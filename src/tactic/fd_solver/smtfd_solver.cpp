@@ -387,12 +387,15 @@ namespace smtfd {
         th_rewriter     m_rewriter;
         ptr_vector<theory_plugin> m_plugins;
         model_ref       m_model;
+        obj_map<expr, expr*> m_eval_cache;     // abstraction |-> value in m_model
+        expr_ref_vector m_eval_trail;
     public:
         plugin_context(smtfd_abs& a, ast_manager& m):
             m(m),
             m_abs(a),
             m_lemmas(m), 
-            m_rewriter(m)
+            m_rewriter(m),
+            m_eval_trail(m)
         {
         }
 
@@ -412,6 +415,23 @@ namespace smtfd {
 
         model& get_model() { return *m_model; }
 
+        /**
+         * \brief evaluate the abstraction of t in the current model.
+         * Values are cached until the model changes, so a term that is shared
+         * by many applications and refinement rounds is evaluated once per model.
+         */
+        expr_ref eval_abs(expr* t) {
+            expr* a = m_abs.abs(t);
+            expr* v = nullptr;
+            if (m_eval_cache.find(a, v))
+                return expr_ref(v, m);
+            expr_ref r = (*m_model)(a);
+            m_eval_trail.push_back(a);
+            m_eval_trail.push_back(r);
+            m_eval_cache.insert(a, r);
+            return r;
+        }
+
         expr_ref_vector::iterator begin() { return m_lemmas.begin(); }
         expr_ref_vector::iterator end() { return m_lemmas.end(); }
         unsigned size() const { return m_lemmas.size(); }
@@ -526,8 +546,8 @@ namespace smtfd {
 
         ast_manager& get_manager() { return m; }
 
-        expr_ref eval_abs(expr* t) { return m_context.get_model()(m_abs.abs(t)); }
-        bool is_true_abs(expr* t) { return m_context.get_model().is_true(m_abs.abs(t)); }
+        expr_ref eval_abs(expr* t) { return m_context.eval_abs(t); }
+        bool is_true_abs(expr* t) { return m.is_true(m_context.eval_abs(t)); }
         
         expr* value_of(f_app const& f) const { return m_values[f.m_val_offset + f.m_t->get_num_args()]; }
 
@@ -654,6 +674,8 @@ namespace smtfd {
     void plugin_context::reset(model_ref& mdl) {
         m_lemmas.reset();
         m_model = mdl;
+        m_eval_cache.reset();
+        m_eval_trail.reset();
         for (theory_plugin* p : m_plugins) {
             p->reset();
         }
@@ -681,9 +703,14 @@ namespace smtfd {
     }
 
     void plugin_context::populate_model(model_ref& mdl, expr_ref_vector const& terms) {
+        // populating the model adds interpretations that can change values.
         for (theory_plugin* p : m_plugins) {
+            m_eval_cache.reset();
+            m_eval_trail.reset();
             p->populate_model(mdl, terms);
         }
+        m_eval_cache.reset();
+        m_eval_trail.reset();
     }
 
     bool f_app_eq::operator()(f_app const& a, f_app const& b) const {
@@ -23,6 +23,12 @@ Revision History:
 #include "ast/well_sorted.h"
 #include "ast/display_dimacs.h"
 #include "tactic/goal.h"
+#include <atomic>
+
+unsigned goal::mk_stamp() {
+    static std::atomic<unsigned> g_stamp(0);
+    return ++g_stamp;
+}
 
 goal::precision goal::mk_union(precision p1, precision p2) {
     if (p1 == PRECISE) return p2;
@@ -44,6 +50,7 @@ std::ostream & operator<<(std::ostream & out, goal::precision p) {
 goal::goal(ast_manager & m, bool models_enabled, bool core_enabled):
     m_manager(m),
     m_ref_count(0),
+    m_stamp(mk_stamp()),
     m_depth(0),
     m_models_enabled(models_enabled),
     m_proofs_enabled(m.proofs_enabled()),
@@ -55,6 +62,7 @@ goal::goal(ast_manager & m, bool models_enabled, bool core_enabled):
 goal::goal(ast_manager & m, bool proofs_enabled, bool models_enabled, bool core_enabled):
     m_manager(m),
     m_ref_count(0),
+    m_stamp(mk_stamp()),
     m_depth(0),
     m_models_enabled(models_enabled),
     m_proofs_enabled(proofs_enabled),
@@ -67,6 +75,7 @@ goal::goal(ast_manager & m, bool proofs_enabled, bool models_enabled, bool core_
 goal::goal(goal const & src):
     m_manager(src.m()),
     m_ref_count(0),
+    m_stamp(mk_stamp()),
     m_depth(0),
     m_models_enabled(src.models_enabled()),
     m_proofs_enabled(src.proofs_enabled()),
@@ -81,6 +90,7 @@ goal::goal(goal const & src):
 goal::goal(goal const & src, bool):
     m_manager(src.m()),
     m_ref_count(0),
+    m_stamp(mk_stamp()),
     m_depth(src.m_depth),
     m_models_enabled(src.models_enabled()),
     m_proofs_enabled(src.proofs_enabled()),
@@ -101,6 +111,7 @@ void goal::copy_to(goal & target) const {
     if (this == &target)
         return;
 
+    // the arrays are persistent, copying shares them until either goal is updated.
     m().copy(m_forms, target.m_forms);
     m().copy(m_proofs, target.m_proofs);
     m().copy(m_dependencies, target.m_dependencies);
@@ -109,6 +120,7 @@ void goal::copy_to(goal & target) const {
     SASSERT(target.m_proofs_enabled == m_proofs_enabled);
     SASSERT(target.m_core_enabled   == m_core_enabled);
     target.m_inconsistent         = m_inconsistent;
+    target.m_stamp                = m_stamp;
     target.m_precision            = mk_union(prec(), target.prec());
     target.m_mc                   = m_mc.get(); 
     target.m_pc                   = m_pc.get(); 
@@ -119,6 +131,7 @@ void goal::push_back(expr * f, proof * pr, expr_dependency * d) {
     SASSERT(!proofs_enabled() || pr);
     if (m().is_true(f))
         return;
+    touch();
     if (m().is_false(f)) {
         // Make sure pr and d are not deleted by the m().del(...) statements.
         proof_ref saved_pr(m());
@@ -285,6 +298,7 @@ void goal::get_formulas(expr_ref_vector & result) const {
 void goal::update(unsigned i, expr * f, proof * pr, expr_dependency * d) {
     if (m_inconsistent)
         return;
+    touch();
     if (proofs_enabled()) {
         SASSERT(pr);
         if (!pr)
@@ -322,6 +336,7 @@ void goal::update(unsigned i, expr * f, proof * pr, expr_dependency * d) {
 }
 
 void goal::reset_core() {
+    touch();
     m().del(m_forms);
     m().del(m_proofs);
     m().del(m_dependencies);
@@ -473,6 +488,7 @@ unsigned goal::num_exprs() const {
 
 void goal::shrink(unsigned j) {
     SASSERT(j <= size());
+    touch();
     unsigned sz = size();
     for (unsigned i = j; i < sz; i++)
         m().pop_back(m_forms);
@@ -487,6 +503,7 @@ void goal::shrink(unsigned j) {
    \brief Eliminate true formulas.
 */
 void goal::elim_true() {
+    touch();
     unsigned sz = size();
     unsigned j = 0;
     for (unsigned i = 0; i < sz; i++) {
@@ -536,6 +553,7 @@ unsigned goal::get_not_idx(expr * f) const {
 void goal::elim_redundancies() {
     if (inconsistent())
         return;
+    touch();
     expr_ref_fast_mark1 neg_lits(m());
     expr_ref_fast_mark2 pos_lits(m());
     unsigned sz = size();
@@ -17,6 +17,12 @@ Abstract:
        - Goals track dependencies (aka light proofs) for unsat core extraction, and building multi-tier solvers.
          This kind of dependency tracking is more powerful than the one used in the current Z3, since
          it does not prevent the use of preprocessing steps such as "Gaussian Elimination".
+
+    Formulas, proofs and dependencies are stored in persistent arrays (expr_array).
+    Copying a goal is constant time: the copy shares the arrays with the source, and
+    an update creates a new version of the array instead of copying it.
+    A copy also shares the stamp of the source until either of them is updated,
+    so cached properties of the source apply to the copy.
     
 Author:
 
@@ -59,6 +65,7 @@ protected:
     expr_array            m_forms;
     expr_array            m_proofs;
     expr_dependency_array m_dependencies;
+    unsigned              m_stamp;             // unique among goals, changes whenever the assertions change.
     // attributes
     unsigned              m_depth:26;          // depth of the goal in the goal tree.
     unsigned              m_models_enabled:1;  // model generation is enabled.
@@ -78,6 +85,8 @@ protected:
     void shrink(unsigned j);
     void reset_core();
     bool is_literal(expr* f) const;
+    static unsigned mk_stamp();
+    void touch() { m_stamp = mk_stamp(); }
     
 public:
     goal(ast_manager & m, bool models_enabled = true, bool core_enabled = false);
@@ -94,6 +103,8 @@ public:
     ast_manager & m() const { return m_manager; }
 
     unsigned depth() const { return m_depth; }
+    // two goals with the same stamp have the same assertions, for caching properties of goals.
+    unsigned stamp() const { return m_stamp; }
     bool models_enabled() const { return m_models_enabled; }
     bool proofs_enabled() const { return m_proofs_enabled; }
     bool unsat_core_enabled() const { return m_core_enabled; }
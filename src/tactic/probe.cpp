@@ -402,71 +402,93 @@ probe * mk_is_qfufbv_probe() {
 
 
 
+/**
+   \brief The constants of a goal are counted in a single traversal for all
+   num-consts probes. The counts of the last goal are cached by its stamp, so
+   evaluating several of these probes on the same goal traverses it once.
+*/
+struct const_counts {
+    unsigned m_stamp = 0;
+    unsigned m_bool = 0;
+    unsigned m_non_bool = 0;
+    unsigned m_arith = 0;
+    unsigned m_bv = 0;
+};
+
 class num_consts_probe : public probe {
-    bool         m_bool;   // If true, track only boolean constants. Otherwise, track only non boolean constants.
-    char const * m_family; // (Ignored if m_bool == true), if != 0 and m_bool == true, then track only constants of the given family.
+public:
+    enum kind { BOOL_CONSTS, NON_BOOL_CONSTS, ARITH_CONSTS, BV_CONSTS };
+private:
+    kind m_kind;
     struct proc {
-        ast_manager & m;
-        bool          m_bool;
-        family_id     m_fid;
-        unsigned      m_counter;
-        proc(ast_manager & _m, bool b, char const * family):m(_m), m_bool(b), m_counter(0) {
-            if (family != nullptr)
-                m_fid = m.mk_family_id(family);
-            else
-                m_fid = null_family_id;
-        }
+        ast_manager &  m;
+        family_id      m_bv_fid;
+        const_counts & m_counts;
+        proc(ast_manager & _m, const_counts & c):m(_m), m_bv_fid(m.mk_family_id("bv")), m_counts(c) {}
         void operator()(quantifier *) {}
         void operator()(var *) {}
         void operator()(app * n) {
-            if (n->get_num_args() == 0 && !m.is_value(n)) {
-                if (m_bool) {
-                    if (m.is_bool(n))
-                        m_counter++;
-                }
-                else {
-                    if (m_fid == null_family_id) {
-                        if (!m.is_bool(n))
-                            m_counter++;
-                    }
-                    else {
-                        if (n->get_sort()->get_family_id() == m_fid)
-                            m_counter++;
-                    }
-                }
+            if (n->get_num_args() != 0 || m.is_value(n))
+                return;
+            if (m.is_bool(n)) {
+                m_counts.m_bool++;
+                return;
             }
+            m_counts.m_non_bool++;
+            family_id fid = n->get_sort()->get_family_id();
+            if (fid == arith_family_id)
+                m_counts.m_arith++;
+            else if (fid == m_bv_fid)
+                m_counts.m_bv++;
         }
     };
 
-public:
-    num_consts_probe(bool b, char const * f):
-        m_bool(b), m_family(f) {
-    }
-    result operator()(goal const & g) override {
-        proc p(g.m(), m_bool, m_family);
+    static const_counts const& get_counts(goal const & g) {
+        static thread_local const_counts g_counts;
+        if (g_counts.m_stamp == g.stamp())
+            return g_counts;
+        g_counts = const_counts();
+        proc p(g.m(), g_counts);
         unsigned sz = g.size();
         expr_fast_mark1 visited;
         for (unsigned i = 0; i < sz; i++) {
             for_each_expr_core<proc, expr_fast_mark1, true, true>(p, visited, g.form(i));
         }
-        return result(p.m_counter);
+        g_counts.m_stamp = g.stamp();
+        return g_counts;
+    }
+
+public:
+    num_consts_probe(kind k):
+        m_kind(k) {
+    }
+    result operator()(goal const & g) override {
+        const_counts const& c = get_counts(g);
+        switch (m_kind) {
+        case BOOL_CONSTS:     return result(c.m_bool);
+        case NON_BOOL_CONSTS: return result(c.m_non_bool);
+        case ARITH_CONSTS:    return result(c.m_arith);
+        case BV_CONSTS:       return result(c.m_bv);
+        }
+        UNREACHABLE();
+        return result(0u);
     }
 };
 
 probe * mk_num_consts_probe() {
-    return alloc(num_consts_probe, false, nullptr);
+    return alloc(num_consts_probe, num_consts_probe::NON_BOOL_CONSTS);
 }
 
 probe * mk_num_bool_consts_probe() {
-    return alloc(num_consts_probe, true, nullptr);
+    return alloc(num_consts_probe, num_consts_probe::BOOL_CONSTS);
 }
 
 probe * mk_num_arith_consts_probe() {
-    return alloc(num_consts_probe, false, "arith");
+    return alloc(num_consts_probe, num_consts_probe::ARITH_CONSTS);
 }
 
 probe * mk_num_bv_consts_probe() {
-    return alloc(num_consts_probe, false, "bv");
+    return alloc(num_consts_probe, num_consts_probe::BV_CONSTS);
 }
 
 class produce_proofs_probe : public probe {
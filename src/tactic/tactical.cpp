@@ -18,6 +18,7 @@ Notes:
 --*/
 #include "util/scoped_timer.h"
 #include "util/cancel_eh.h"
+#include "util/common_msgs.h"
 #include "util/scoped_ptr_vector.h"
 #include "tactic/tactical.h"
 #include "tactic/goal_proof_converter.h"
@@ -183,6 +184,10 @@ public:
         m_t2->user_propagate_register_fixed(fixed_eh);
     }
 
+    void user_propagate_register_fixed_batch(user_propagator::fixed_batch_eh_t& fixed_batch_eh) override {
+        m_t2->user_propagate_register_fixed_batch(fixed_batch_eh);
+    }
+
     void user_propagate_register_final(user_propagator::final_eh_t& final_eh) override {
         m_t2->user_propagate_register_final(final_eh);
     }
@@ -457,6 +462,7 @@ class par_tactical : public or_else_tactical {
 
 	std::string        ex_msg;
 	unsigned           error_code;
+    unsigned           m_max_memory = 0; // megabytes each branch may allocate, 0 for no limit
 
 public:
     par_tactical(unsigned num, tactic * const * ts):or_else_tactical(num, ts) {
@@ -465,6 +471,16 @@ public:
 
     char const* name() const override { return "par"; }
 
+    void updt_params(params_ref const & p) override {
+        or_else_tactical::updt_params(p);
+        m_max_memory = p.get_uint("par_max_memory", 0);
+    }
+
+    void collect_param_descrs(param_descrs & r) override {
+        or_else_tactical::collect_param_descrs(r);
+        r.insert("par_max_memory", CPK_UINT, "maximum amount of memory in megabytes allocated by each branch of par-or (0 means no limit).", "0");
+    }
+
     void operator()(goal_ref const & in, goal_ref_buffer& result) override {
         bool use_seq;
         use_seq = false;
@@ -502,6 +518,8 @@ public:
             goal_ref_buffer     _result;                        
             goal_ref in_copy = in_copies[i];
             tactic & t = *(ts.get(i));
+            // a branch that exceeds its budget fails without failing the other branches.
+            memory::set_thread_max_size(megabytes_to_bytes(m_max_memory));
             
             try {
                 t(in_copy, _result);
@@ -1068,6 +1086,51 @@ tactic * try_for(tactic * t, unsigned msecs) {
     return alloc(try_for_tactical, t, msecs);
 }
 
+class try_for_rlimit_tactical : public unary_tactical {
+    unsigned m_rlimit;
+
+    // reslimit::pop clears cancellation requests, keep one that arrived while m_t was running.
+    static void pop_rlimit(reslimit& lim) {
+        bool canceled = lim.cancel_requested();
+        lim.pop();
+        if (canceled)
+            lim.inc_cancel();
+    }
+
+public:
+    try_for_rlimit_tactical(tactic * t, unsigned rlimit):unary_tactical(t), m_rlimit(rlimit) {}
+
+    char const* name() const override { return "try_for_rlimit"; }
+    
+    void operator()(goal_ref const & in, goal_ref_buffer& result) override {
+        reslimit& lim = in->m().limit();
+        bool exhausted = false;
+        lim.push(m_rlimit);
+        try {
+            m_t->operator()(in, result);
+            exhausted = lim.is_canceled() && !lim.cancel_requested();
+        }
+        catch (...) {
+            pop_rlimit(lim);
+            throw;
+        }
+        pop_rlimit(lim);
+        if (exhausted) {
+            result.reset();
+            throw tactic_exception(Z3_MAX_RESOURCE_MSG);
+        }
+    }
+
+    tactic * translate(ast_manager & m) override { 
+        tactic * new_t = m_t->translate(m);
+        return alloc(try_for_rlimit_tactical, new_t, m_rlimit);
+    }
+};
+
+tactic * try_for_rlimit(tactic * t, unsigned rlimit) {
+    return alloc(try_for_rlimit_tactical, t, rlimit);
+}
+
 class using_params_tactical : public unary_tactical {
     params_ref m_params;
 public:
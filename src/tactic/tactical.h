@@ -60,6 +60,8 @@ tactic * par_and_then(unsigned num, tactic * const * ts);
 tactic * par_and_then(tactic * t1, tactic * t2);
 
 tactic * try_for(tactic * t, unsigned msecs);
+// Execute t with a budget of rlimit resource units, fail if the budget is exhausted.
+tactic * try_for_rlimit(tactic * t, unsigned rlimit);
 tactic * clean(tactic * t);
 tactic * using_params(tactic * t, params_ref const & p);
 tactic * annotate_tactic(char const* name, tactic * t);
@@ -21,6 +21,7 @@ namespace user_propagator {
     
     typedef std::function<void(void*, callback*)>                            final_eh_t;
     typedef std::function<void(void*, callback*, expr*, expr*)>              fixed_eh_t;
+    typedef std::function<void(void*, callback*, unsigned, expr* const*, expr* const*)> fixed_batch_eh_t;
     typedef std::function<void(void*, callback*, expr*, expr*)>              eq_eh_t;
     typedef std::function<void*(void*, ast_manager&, context_obj*&)>         fresh_eh_t;
     typedef std::function<void(void*, callback*)>                            push_eh_t;
@@ -68,6 +69,10 @@ namespace user_propagator {
             throw default_exception("user-propagators are only supported on the SMT solver");
         }
         
+        virtual void user_propagate_register_fixed_batch(fixed_batch_eh_t& fixed_batch_eh) {
+            throw default_exception("user-propagators are only supported on the SMT solver");
+        }
+
         virtual void user_propagate_register_final(final_eh_t& final_eh) {
             throw default_exception("user-propagators are only supported on the SMT solver");
         }
@@ -131,6 +131,27 @@ static void tst5() {
     m.del(arr3);
 }
 
+static void tst6() {
+    ast_manager m;
+    m.set_delete_budget(2);
+    family_id fid = m.get_basic_family_id();
+    sort_ref b(m.mk_bool_sort(), m);
+    expr_ref a(m.mk_const(symbol("a"), b.get()), m);
+    unsigned num_asts = m.get_num_asts();
+    expr_ref e(a, m);
+    for (unsigned i = 0; i < 100; ++i)
+        e = m.mk_app(fid, OP_NOT, e.get());
+    e = nullptr;
+    // the chain is unreachable, but only its top has been freed
+    ENSURE(m.has_pending_deletes());
+    ENSURE(m.get_num_asts() > num_asts + 1);
+    // not(a) is still referenced by the pending part of the chain
+    expr_ref c(m.mk_app(fid, OP_NOT, a.get()), m);
+    m.delete_pending_nodes();
+    ENSURE(!m.has_pending_deletes());
+    ENSURE(m.get_num_asts() == num_asts + 1);
+    ENSURE(c->get_ref_count() == 1);
+}
 
 struct foo {
     unsigned       m_id; 
@@ -153,5 +174,6 @@ void tst_ast() {
     tst3();
     tst4();
     tst5();
+    tst6();
 }
 
@@ -0,0 +1,73 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+--*/
+
+#include "ast/ast_binary.h"
+#include "ast/ast_translation.h"
+#include "ast/arith_decl_plugin.h"
+#include "ast/array_decl_plugin.h"
+#include "ast/bv_decl_plugin.h"
+#include "ast/seq_decl_plugin.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/ast_pp.h"
+#include <sstream>
+
+void tst_ast_binary() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    bv_util bv(m);
+    array_util ar(m);
+    seq_util seq(m);
+
+    sort* S = m.mk_uninterpreted_sort(symbol("S"));
+    sort* I = a.mk_int();
+    sort* B = bv.mk_sort(8);
+    sort* dom[2] = { S, I };
+    func_decl* f = m.mk_func_decl(symbol("f"), 2, dom, B);
+    app_ref s(m.mk_const(symbol("s"), S), m);
+    app_ref x(m.mk_const(symbol("x"), I), m);
+    app_ref arr(m.mk_const(symbol("arr"), ar.mk_array_sort(I, B)), m);
+    expr_ref fx(m.mk_app(f, s.get(), a.mk_add(x, a.mk_int(rational("123456789012345678901234567890")))), m);
+
+    expr_ref_vector fmls(m);
+    fmls.push_back(m.mk_eq(fx, bv.mk_numeral(rational(17), 8)));
+    fmls.push_back(m.mk_or(a.mk_le(a.mk_to_real(x), a.mk_numeral(rational(-3, 4), false)), m.mk_eq(ar.mk_select(arr, x), fx)));
+    fmls.push_back(m.mk_not(m.mk_eq(seq.str.mk_string(zstring("a\\u{10}b")), seq.str.mk_empty(seq.str.mk_string_sort()))));
+    fmls.push_back(m.mk_distinct(3, fmls.data()));
+
+    // forall y : Int . f(s, y) != #x00
+    sort* srt[1] = { I };
+    symbol names[1] = { symbol("y") };
+    expr_ref body(m.mk_not(m.mk_eq(m.mk_app(f, s.get(), m.mk_var(0, I)), bv.mk_numeral(rational(0), 8))), m);
+    fmls.push_back(m.mk_forall(1, srt, names, body, 0, symbol("q")));
+
+    std::stringstream buffer;
+    ast_to_binary(m, fmls.size(), reinterpret_cast<ast* const*>(fmls.data()), buffer);
+
+    // the formulas are recreated in a fresh manager
+    ast_manager m2;
+    reg_decl_plugins(m2);
+    ast_ref_vector result(m2);
+    ast_from_binary(m2, buffer, result);
+    ENSURE(result.size() == fmls.size());
+    ast_translation tr(m, m2);
+    for (unsigned i = 0; i < fmls.size(); ++i) {
+        TRACE("ast_binary", tout << mk_pp(fmls.get(i), m) << "\n" << mk_pp(result.get(i), m2) << "\n";);
+        ENSURE(tr(fmls.get(i)) == result.get(i));
+    }
+
+    // truncated input is rejected
+    std::string data = buffer.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    ast_ref_vector result2(m2);
+    bool failed = false;
+    try {
+        ast_from_binary(m2, truncated, result2);
+    }
+    catch (default_exception&) {
+        failed = true;
+    }
+    ENSURE(failed);
+}
@@ -356,6 +356,32 @@ public:
         VERIFY(equation == expected);
     }
 
+    // reordering and cache flushes in the middle of building a function preserve it.
+    static void test_dynamic_reorder() {
+        std::cout << "test_dynamic_reorder\n";
+        unsigned const n = 8;
+        bdd_manager m(2 * n);
+        m.set_reorder_threshold(64);
+        m.set_max_op_cache_size(16);
+        bdd f = m.mk_false();
+        for (unsigned i = 0; i < n; ++i)
+            f = f || (m.mk_var(i) && m.mk_var(i + n));
+        VERIFY(m.m_stats.m_num_reorder > 0);
+        VERIFY(m.m_stats.m_cache_flushes > 0);
+        bdd g = m.mk_false();
+        for (unsigned i = n; i-- > 0; )
+            g = g || (m.mk_var(i + n) && m.mk_var(i));
+        VERIFY(f == g);
+        for (unsigned i = 0; i < n; ++i) {
+            VERIFY((m.mk_var(i) && m.mk_var(i + n) && !f).is_false());
+            VERIFY((!m.mk_var(i) && f) != m.mk_false());
+        }
+        bdd none = m.mk_true();
+        for (unsigned i = 0; i < n; ++i)
+            none = none && !m.mk_var(i);
+        VERIFY((none && f).is_false());
+    }
+
     static void test_fdd_reorder() {
         std::cout << "test_fdd_reorder\n";
         bdd_manager m(4);
@@ -527,6 +553,7 @@ void tst_bdd() {
     dd::test_bdd::test_fdd3();
     dd::test_bdd::test_fdd4();
     dd::test_bdd::test_fdd_reorder();
+    dd::test_bdd::test_dynamic_reorder();
     dd::test_bdd::test_fdd_twovars();
     dd::test_bdd::test_fdd_find_hint();
     dd::test_bdd::test_cofactor();
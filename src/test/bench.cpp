@@ -0,0 +1,186 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    bench.cpp
+
+Abstract:
+
+    Timing harness for micro and macro benchmarks.
+
+    test-z3 bench [file ...]
+
+    runs the micro benchmarks and then every .smt2 or .cnf file given
+    on the command line. Each benchmark is run for a fixed number of warmup
+    rounds followed by timed repetitions. The results are printed as a JSON
+    array with one object per benchmark, timings in milliseconds.
+
+--*/
+
+#include "util/hashtable.h"
+#include "util/mpz.h"
+#include "util/small_object_allocator.h"
+#include "util/util.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/arith_decl_plugin.h"
+#include "ast/rewriter/th_rewriter.h"
+#include "sat/sat_solver.h"
+#include "sat/dimacs.h"
+#include "cmd_context/cmd_context.h"
+#include "parsers/smt2/smt2parser.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+static const unsigned s_warmup = 2;
+static const unsigned s_reps = 10;
+
+static bool s_first_result = true;
+
+static void run_bench(char const* name, std::function<void(void)> const& f) {
+    for (unsigned i = 0; i < s_warmup; ++i)
+        f();
+    svector<double> times;
+    for (unsigned i = 0; i < s_reps; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double, std::milli> d = std::chrono::steady_clock::now() - start;
+        times.push_back(d.count());
+    }
+    std::sort(times.begin(), times.end());
+    double sum = 0;
+    for (double t : times)
+        sum += t;
+    std::cout << (s_first_result ? "[\n" : ",\n")
+              << "  {\"name\": \"" << name << "\", \"warmup\": " << s_warmup << ", \"reps\": " << s_reps
+              << ", \"min\": " << times[0] << ", \"median\": " << times[times.size() / 2]
+              << ", \"mean\": " << sum / times.size() << ", \"max\": " << times.back() << "}";
+    s_first_result = false;
+}
+
+static void bench_hashtable() {
+    int_hashtable<int_hash, default_eq<int> > ht;
+    unsigned found = 0;
+    for (int i = 0; i < 1000000; ++i)
+        ht.insert(static_cast<int>((i * 7919ll) % 2000003));
+    for (int i = 0; i < 2000003; ++i)
+        found += ht.contains(i);
+    for (int i = 0; i < 1000000; i += 2)
+        ht.erase(static_cast<int>((i * 7919ll) % 2000003));
+    VERIFY(found == 1000000);
+}
+
+static void bench_mpz() {
+    unsynch_mpz_manager m;
+    scoped_mpz a(m), b(m), c(m), g(m);
+    m.set(a, 1);
+    m.set(b, 1);
+    for (unsigned i = 1; i < 2000; ++i) {
+        m.set(c, i);
+        m.mul(a, c, a);
+        m.add(b, a, b);
+    }
+    for (unsigned i = 0; i < 200; ++i)
+        m.gcd(a, b, g);
+    m.power(b, 3, a);
+    m.div(a, b, g);
+}
+
+static void bench_small_object_allocator() {
+    small_object_allocator alloc;
+    ptr_vector<void> ptrs;
+    for (unsigned round = 0; round < 10; ++round) {
+        for (unsigned i = 0; i < 100000; ++i)
+            ptrs.push_back(alloc.allocate(8 + (i % 16) * 8));
+        for (unsigned i = 0; i < ptrs.size(); ++i)
+            alloc.deallocate(8 + (i % 16) * 8, ptrs[i]);
+        ptrs.reset();
+    }
+}
+
+static void bench_rewriter() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    expr_ref_vector xs(m);
+    for (unsigned i = 0; i < 50; ++i)
+        xs.push_back(m.mk_const(symbol(i), a.mk_int()));
+    // a DAG with many shared sub-terms exercises the rewriter cache.
+    expr_ref t(a.mk_int(0), m);
+    for (unsigned i = 0; i < 2000; ++i) {
+        expr* x = xs.get(i % xs.size());
+        t = m.mk_ite(a.mk_le(x, a.mk_int(i % 7)), a.mk_add(t, x), a.mk_sub(t, a.mk_mul(a.mk_int(2), x)));
+    }
+    th_rewriter rw(m);
+    expr_ref r(m);
+    rw(t, r);
+}
+
+static void bench_sat_propagate() {
+    params_ref p;
+    reslimit rlim;
+    sat::solver s(p, rlim);
+    random_gen rand(0);
+    unsigned num_vars = 400;
+    for (unsigned i = 0; i < num_vars; ++i)
+        s.mk_var();
+    sat::literal_vector cls;
+    // random 3-SAT below the phase transition: satisfiable, propagation dominated.
+    for (unsigned i = 0; i < 3 * num_vars; ++i) {
+        cls.reset();
+        for (unsigned j = 0; j < 3; ++j)
+            cls.push_back(sat::literal(rand(num_vars), rand(2) == 0));
+        s.mk_clause(cls.size(), cls.data());
+    }
+    s.check();
+}
+
+static void bench_file(char const* file_name) {
+    std::string name(file_name);
+    std::ifstream in(file_name);
+    if (in.bad() || in.fail()) {
+        std::cerr << "failed to open " << file_name << "\n";
+        return;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string content = buffer.str();
+    if (name.size() > 4 && name.compare(name.size() - 4, 4, ".cnf") == 0) {
+        run_bench(file_name, [&]() {
+            params_ref p;
+            reslimit rlim;
+            sat::solver s(p, rlim);
+            std::istringstream is(content);
+            VERIFY(parse_dimacs(is, std::cerr, s));
+            s.check();
+        });
+    }
+    else {
+        run_bench(file_name, [&]() {
+            std::ostringstream out;
+            cmd_context ctx;
+            ctx.set_regular_stream(out);
+            std::istringstream is(content);
+            parse_smt2_commands(ctx, is);
+        });
+    }
+}
+
+void tst_bench(char ** argv, int argc, int& i) {
+    run_bench("hashtable", bench_hashtable);
+    run_bench("mpz", bench_mpz);
+    run_bench("small_object_allocator", bench_small_object_allocator);
+    run_bench("rewriter", bench_rewriter);
+    run_bench("sat_propagate", bench_sat_propagate);
+    while (i + 1 < argc && argv[i + 1][0] != '/' && argv[i + 1][0] != '-' && !strchr(argv[i + 1], '=')) {
+        ++i;
+        bench_file(argv[i]);
+    }
+    std::cout << "\n]" << std::endl;
+}
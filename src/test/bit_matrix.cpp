@@ -0,0 +1,89 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    bit_matrix.cpp
+
+Abstract:
+
+    Test Gauss-Jordan elimination on bit matrices.
+
+--*/
+
+#include "math/simplex/bit_matrix.h"
+#include "util/util.h"
+#include "util/debug.h"
+#include <iostream>
+
+// check that the rows of m are in reduced row echelon form and span the rows in orig.
+static void check_solved(bit_matrix& m, vector<bool_vector> const& orig) {
+    unsigned_vector pivots;
+    bool seen_zero = false;
+    for (auto const& r : m) {
+        auto it = r.begin();
+        if (it == r.end()) {
+            seen_zero = true;
+            continue;
+        }
+        ENSURE(!seen_zero);
+        ENSURE(pivots.empty() || pivots.back() < *it);
+        pivots.push_back(*it);
+    }
+    for (unsigned c : pivots) {
+        unsigned count = 0;
+        for (auto const& r : m)
+            if (r[c])
+                ++count;
+        ENSURE(count == 1);
+    }
+    for (bool_vector row : orig) {
+        unsigned i = 0;
+        for (auto const& r : m) {
+            if (i == pivots.size())
+                break;
+            if (row[pivots[i]])
+                for (unsigned c = 0; c < row.size(); ++c)
+                    row[c] = row[c] != r[c];
+            ++i;
+        }
+        for (bool b : row)
+            ENSURE(!b);
+    }
+}
+
+static void tst_random(unsigned num_rows, unsigned num_cols, unsigned density) {
+    random_gen rand(num_rows + num_cols);
+    bit_matrix m;
+    m.reset(num_cols);
+    vector<bool_vector> orig;
+    for (unsigned i = 0; i < num_rows; ++i) {
+        auto r = m.add_row();
+        bool_vector row(num_cols, false);
+        // every fourth row is the sum of two earlier rows
+        if (i > 4 && i % 4 == 0) {
+            bool_vector const& a = orig[rand(i)];
+            bool_vector const& b = orig[rand(i)];
+            for (unsigned c = 0; c < num_cols; ++c)
+                row[c] = a[c] != b[c];
+        }
+        else {
+            for (unsigned c = 0; c < num_cols; ++c)
+                row[c] = rand(density) == 0;
+        }
+        for (unsigned c = 0; c < num_cols; ++c)
+            r.set(c, row[c]);
+        orig.push_back(row);
+    }
+    m.solve();
+    check_solved(m, orig);
+}
+
+void tst_bit_matrix() {
+    tst_random(10, 20, 3);
+    tst_random(50, 40, 2);
+    tst_random(100, 70, 3);
+    tst_random(200, 130, 10);
+    tst_random(300, 200, 50);
+    std::cout << "bit_matrix ok\n";
+}
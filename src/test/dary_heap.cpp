@@ -0,0 +1,80 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    tst_dary_heap.cpp
+
+Abstract:
+
+    Test d-ary heap template against random updates.
+
+--*/
+#include<iostream>
+#include "util/util.h"
+#include "util/dary_heap.h"
+#include "util/uint_set.h"
+
+#define N 5000
+
+static random_gen dheap_rand(1);
+static int g_dvalue[N];
+
+struct dheap_lt { bool operator()(int v1, int v2) const { return g_dvalue[v1] < g_dvalue[v2]; } };
+
+template<unsigned D>
+static void tst_random() {
+    dary_heap<dheap_lt, D> h(N);
+    uint_set t;
+    for (unsigned i = 0; i < N; i++)
+        g_dvalue[i] = dheap_rand() % 1000;
+    for (int i = 0; i < N * 10; i++) {
+        int cmd = dheap_rand() % 10;
+        int val = dheap_rand() % N;
+        if (cmd <= 3) {
+            if (!h.contains(val)) {
+                h.insert(val);
+                t.insert(val);
+            }
+        }
+        else if (cmd <= 5) {
+            if (h.contains(val)) {
+                h.erase(val);
+                t.remove(val);
+            }
+        }
+        else if (cmd <= 8) {
+            int old_v = g_dvalue[val];
+            int new_v = dheap_rand() % 1000;
+            if (h.contains(val)) {
+                g_dvalue[val] = new_v;
+                if (old_v < new_v)
+                    h.increased(val);
+                else
+                    h.decreased(val);
+            }
+        }
+        else {
+            ENSURE(h.check_invariant());
+        }
+        ENSURE(h.contains(val) == t.contains(val));
+    }
+    ENSURE(h.size() == t.num_elems());
+    int prev = -1;
+    while (!h.empty()) {
+        int m1 = h.min_value();
+        int m2 = h.erase_min();
+        ENSURE(m1 == m2);
+        ENSURE(prev <= g_dvalue[m2]);
+        prev = g_dvalue[m2];
+    }
+}
+
+void tst_dary_heap() {
+    for (unsigned i = 0; i < 3; ++i) {
+        dheap_rand.set_seed(i);
+        tst_random<2>();
+        tst_random<4>();
+        tst_random<8>();
+    }
+}
@@ -152,10 +152,13 @@ int main(int argc, char ** argv) {
     TST(region);
     TST(symbol);
     TST(heap);
+    TST(vmtf_queue);
+    TST(dary_heap);
     TST(hashtable);
     TST(rational);
     TST(inf_rational);
     TST(ast);
+    TST(ast_binary);
     TST(optional);
     TST(bit_vector);
     TST(fixed_bit_vector);
@@ -196,6 +199,7 @@ int main(int argc, char ** argv) {
     TST(escaped);
     TST(buffer);
     TST(chashtable);
+    TST(swiss_hashtable);
     TST(egraph);
     TST(ex);
     TST(nlarith_util);
@@ -247,18 +251,22 @@ int main(int argc, char ** argv) {
     TST(sorting_network);
     TST(theory_pb);
     TST(simplex);
+    TST(sparse_lu);
     TST(sat_user_scope);
     TST_ARGV(ddnf);
     TST(ddnf1);
     TST(model_evaluator);
+    TST(model_compiled_eval);
     TST(get_consequences);
     TST(pb2bv);
     TST_ARGV(sat_lookahead);
     TST_ARGV(sat_local_search);
     TST_ARGV(cnf_backbones);
+    TST_ARGV(bench);
     TST(bdd);
     TST(pdd);
     TST(pdd_solver);
+    TST(bit_matrix);
     TST(scoped_timer);
     TST(solver_pool);
     //TST_ARGV(hs);
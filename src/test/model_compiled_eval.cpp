@@ -0,0 +1,64 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+--*/
+
+#include "model/model.h"
+#include "model/model_compiled_eval.h"
+#include "ast/bv_decl_plugin.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/ast_pp.h"
+#include "util/util.h"
+
+void tst_model_compiled_eval() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    random_gen rand(0);
+
+    app_ref x(m.mk_const(symbol("x"), bv.mk_sort(8)), m);
+    app_ref y(m.mk_const(symbol("y"), bv.mk_sort(8)), m);
+    app_ref z(m.mk_const(symbol("z"), bv.mk_sort(64)), m);
+    app_ref p(m.mk_const(symbol("p"), m.mk_bool_sort()), m);
+
+    expr_ref_vector terms(m);
+    terms.push_back(bv.mk_bv_add(x, bv.mk_bv_mul(y, bv.mk_numeral(rational(3), 8))));
+    terms.push_back(bv.mk_bv_sub(x, y));
+    terms.push_back(bv.mk_bv_neg(bv.mk_bv_xor(x, bv.mk_bv_not(y))));
+    terms.push_back(bv.mk_bv_shl(x, y));
+    terms.push_back(bv.mk_bv_lshr(x, bv.mk_bv_and(y, bv.mk_numeral(rational(7), 8))));
+    terms.push_back(bv.mk_bv_ashr(x, bv.mk_bv_and(y, bv.mk_numeral(rational(7), 8))));
+    terms.push_back(bv.mk_sle(x, y));
+    terms.push_back(bv.mk_ule(x, y));
+    terms.push_back(bv.mk_slt(x, y));
+    terms.push_back(bv.mk_concat(x, y));
+    terms.push_back(bv.mk_extract(6, 2, bv.mk_bv_or(x, y)));
+    terms.push_back(bv.mk_sign_extend(8, x));
+    terms.push_back(bv.mk_zero_extend(56, y));
+    terms.push_back(bv.mk_bv_add(z, bv.mk_bv_mul(z, bv.mk_sign_extend(56, x))));
+    terms.push_back(m.mk_ite(p, x, bv.mk_bv_udiv(x, y)));
+    terms.push_back(m.mk_and(p, m.mk_not(m.mk_eq(x, y)), m.mk_implies(p, bv.mk_ule(y, x))));
+    terms.push_back(m.mk_xor(p, bv.mk_slt(z, bv.mk_bv_add(z, z))));
+    terms.push_back(m.mk_distinct(3, terms.data()));
+
+    compiled_evaluator ev(m);
+    unsigned_vector slots;
+    for (expr* t : terms)
+        slots.push_back(ev.add(t));
+
+    for (unsigned round = 0; round < 200; ++round) {
+        model mdl(m);
+        uint64_t zv = (static_cast<uint64_t>(rand()) << 33) ^ (static_cast<uint64_t>(rand()) << 11) ^ rand();
+        mdl.register_decl(x->get_decl(), bv.mk_numeral(rational(rand(256)), 8));
+        mdl.register_decl(y->get_decl(), bv.mk_numeral(rational(rand(256)), 8));
+        mdl.register_decl(z->get_decl(), bv.mk_numeral(zv, 64));
+        mdl.register_decl(p->get_decl(), m.mk_bool_val(rand(2) == 0));
+        VERIFY(ev(mdl));
+        for (unsigned i = 0; i < terms.size(); ++i) {
+            expr_ref expected = mdl(terms.get(i));
+            expr_ref actual = ev.get_value(slots[i]);
+            TRACE("compiled_eval", tout << mk_pp(terms.get(i), m) << " " << expected << " " << actual << "\n";);
+            ENSURE(expected == actual);
+        }
+    }
+}
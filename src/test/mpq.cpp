@@ -160,7 +160,49 @@ static void tst_prev_power_2() {
     tst_prev_power_2((1ll << 60), 3, 58);
 }
 
+// compare the small operand fast paths against the same operations on big operands
+static void tst_small_ops() {
+    unsynch_mpq_manager m;
+    random_gen rand(0);
+    int vals[] = { 0, 1, -1, 2, 3, 7, 12, INT_MAX, INT_MAX - 1, INT_MIN + 1, INT_MIN + 2, 1 << 16 };
+    auto pick = [&]() {
+        unsigned i = rand() % (sizeof(vals) / sizeof(int) + 1);
+        return i < sizeof(vals) / sizeof(int) ? vals[i] : static_cast<int>(rand()) - 5000;
+    };
+    scoped_mpq a(m), b(m), c(m), big(m), ab(m), bb(m), r(m);
+    m.set(big, 1 << 20);
+    m.mul(big, big, big);
+    m.mul(big, big, big);
+    for (unsigned i = 0; i < 10000; ++i) {
+        int d1 = pick(), d2 = pick();
+        if (d1 == 0) d1 = 3;
+        if (d2 == 0) d2 = 5;
+        m.set(a, pick(), d1);
+        m.set(b, pick(), d2);
+        m.mul(a, big, ab);
+        m.mul(b, big, bb);
+        m.add(a, b, c);
+        m.add(ab, bb, r);
+        m.div(r, big, r);
+        ENSURE(m.eq(c, r));
+        m.sub(a, b, c);
+        m.sub(ab, bb, r);
+        m.div(r, big, r);
+        ENSURE(m.eq(c, r));
+        m.mul(a, b, c);
+        m.mul(ab, bb, r);
+        m.div(r, big, r);
+        m.div(r, big, r);
+        ENSURE(m.eq(c, r));
+        m.add(a, b, a);
+        m.sub(a, b, a);
+        m.div(ab, big, r);
+        ENSURE(m.eq(a, r));
+    }
+}
+
 void tst_mpq() {
+    tst_small_ops();
     tst_prev_power_2();
     set_str_bug();
     bug2();
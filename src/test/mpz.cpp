@@ -21,6 +21,7 @@ Revision History:
 #include "util/rational.h"
 #include "util/timeit.h"
 #include "util/scoped_numeral.h"
+#include "util/mpn.h"
 #include <iostream>
 
 static void tst1() {
@@ -504,7 +505,28 @@ static void tst_pw2() {
     }
 }
 
+static void tst_karatsuba() {
+    // compare Karatsuba against schoolbook multiplication
+    mpn_manager schoolbook, karatsuba;
+    schoolbook.set_karatsuba_threshold(UINT_MAX);
+    karatsuba.set_karatsuba_threshold(4);
+    for (unsigned it = 0; it < 500; it++) {
+        unsigned la = 1 + rand() % 150, lb = 1 + rand() % 150;
+        svector<mpn_digit> a, b, c1, c2;
+        for (unsigned i = 0; i < la; i++)
+            a.push_back(rand() % 3 == 0 ? UINT_MAX : (mpn_digit)rand());
+        for (unsigned i = 0; i < lb; i++)
+            b.push_back(rand() % 3 == 0 ? UINT_MAX : (mpn_digit)rand());
+        c1.resize(la + lb, 0);
+        c2.resize(la + lb, 0);
+        schoolbook.mul(a.data(), la, b.data(), lb, c1.data());
+        karatsuba.mul(a.data(), la, b.data(), lb, c2.data());
+        ENSURE(c1 == c2);
+    }
+}
+
 void tst_mpz() {
+    tst_karatsuba();
     disable_trace("mpz");
     enable_trace("mpz_2k");
     tst_pw2();
@@ -719,6 +719,27 @@ public:
         }
     }
 
+    // temporary polynomials are collected and the node pool does not keep growing.
+    static void gc_bounded() {
+        std::cout << "gc_bounded\n";
+        pdd_manager m(6);
+        pdd x = m.mk_var(0), y = m.mk_var(1), z = m.mk_var(2);
+        pdd u = m.mk_var(3), v = m.mk_var(4), w = m.mk_var(5);
+        pdd keep = x*y + z;
+        unsigned max_pool = 0;
+        for (unsigned i = 0; i < 200; ++i) {
+            pdd p = (x + y + z + u + v + w + m.mk_val(i));
+            pdd q = p * p * p;
+            VERIFY(q.degree() == 3);
+            if (i == 100)
+                max_pool = 2 * m.m_nodes.size();
+        }
+        VERIFY(m.m_nodes.size() <= max_pool);
+        m.gc();
+        VERIFY(m.m_nodes.size() < max_pool);
+        VERIFY(keep == x*y + z);
+    }
+
 };
 
 }
@@ -744,4 +765,5 @@ void tst_pdd() {
     dd::test::subst_get();
     dd::test::univariate();
     dd::test::factors();
+    dd::test::gc_bounded();
 }
@@ -227,6 +227,10 @@ namespace dd {
             g.set(cfg);
             g.simplify();
             g.display(std::cout << "after exlin\n");
+            cfg.m_enable_f4 = true;
+            g.set(cfg);
+            g.simplify();
+            g.display(std::cout << "after f4\n");
         }
         g.saturate();
         g.display(std::cout);
@@ -190,6 +190,34 @@ static void test7() {
   M.display(std::cout);
 }
 
+static void test8() {
+    // minimize v = -x0 - x1 subject to 0 <= x0, x1 <= 10, x0 + x1 <= 15
+    reslimit rl; Simplex S(rl);
+    unsynch_mpz_manager m;
+    unsynch_mpq_inf_manager em;
+    for (unsigned i = 0; i < 4; ++i)
+        S.ensure_var(i);
+    mpq_inf zero(mpq(0), mpq(0)), ten(mpq(10), mpq(0)), fifteen(mpq(15), mpq(0));
+    S.set_lower(0, zero);
+    S.set_upper(0, ten);
+    S.set_lower(1, zero);
+    S.set_upper(1, ten);
+    S.set_upper(3, fifteen);
+    unsigned vars1[3] = { 2, 0, 1 };
+    unsigned vars2[3] = { 3, 0, 1 };
+    scoped_mpz_vector c1(m), c2(m);
+    c1.push_back(mpz(1)); c1.push_back(mpz(1)); c1.push_back(mpz(1));
+    c2.push_back(mpz(-1)); c2.push_back(mpz(1)); c2.push_back(mpz(1));
+    S.add_row(2, 3, vars1, c1.data());
+    S.add_row(3, 3, vars2, c2.data());
+    ENSURE(S.make_feasible() == l_true);
+    ENSURE(S.minimize(2) == l_true);
+    ENSURE(em.eq(S.get_value(2), mpq_inf(mpq(-15), mpq(0))));
+    statistics st;
+    S.collect_statistics(st);
+    st.display(std::cout);
+}
+
 void tst_simplex() {
     reslimit rl; Simplex S(rl);
 
@@ -228,4 +256,5 @@ void tst_simplex() {
     test5();
     test6();
     test7();
+    test8();
 }
@@ -39,4 +39,12 @@ void tst_solver_pool() {
     std::cout << *s1;
     std::cout << *s2;
     std::cout << *base;
+
+    // a clone starts with the assertions of s1, resetting s1 does not affect it.
+    ref<solver> s5 = pool.clone_solver(s1.get());
+    pool.reset_solver(s1.get());
+    asms.reset();
+    asms.push_back(m.mk_not(c));
+    VERIFY(s5->check_sat(asms) == l_false);
+    VERIFY(s1->check_sat(asms) == l_true);
 }
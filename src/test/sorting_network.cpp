@@ -666,6 +666,7 @@ void tst_sorting_network() {
     tst_sorting_network(sorting_network_encoding::ordered_at_most);
     tst_sorting_network(sorting_network_encoding::grouped_at_most);
     tst_sorting_network(sorting_network_encoding::bimander_at_most);
+    tst_sorting_network(sorting_network_encoding::adaptive_at_most);
     test_sorting1();
     test_sorting2();
     test_sorting3();
@@ -0,0 +1,117 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    tst_sparse_lu.cpp
+
+Abstract:
+
+    Test the sparse LU factorization of a basis against random
+    right sides and column replacements.
+
+--*/
+#include <iostream>
+#include "util/util.h"
+#include "math/lp/sparse_lu.h"
+
+typedef lp::sparse_lu<lp::mpq> lu_t;
+typedef lu_t::sparse_column column;
+
+static random_gen lu_rand(0);
+
+static column random_column(unsigned m, unsigned diag) {
+    column c;
+    c.push_back({diag, lp::mpq(1 + lu_rand() % 5)});
+    for (unsigned k = 0; k < 2; ++k) {
+        unsigned r = lu_rand() % m;
+        bool found = false;
+        for (auto const& e : c)
+            found |= e.first == r;
+        if (!found)
+            c.push_back({r, lp::mpq(static_cast<int>(lu_rand() % 7) - 3)});
+    }
+    return c;
+}
+
+static lp::indexed_vector<lp::mpq> random_vector(unsigned m) {
+    lp::indexed_vector<lp::mpq> v(m);
+    for (unsigned k = 0; k < 3; ++k) {
+        unsigned i = lu_rand() % m;
+        if (lp::is_zero(v[i]))
+            v.set_value(lp::mpq(1 + lu_rand() % 9), i);
+    }
+    return v;
+}
+
+// B x == a, where x is indexed by positions
+static void check_Bx(vector<column> const& B, lp::indexed_vector<lp::mpq> const& a, lu_t const& lu) {
+    unsigned m = B.size();
+    lp::indexed_vector<lp::mpq> x(m);
+    x = a;
+    lu.solve_Bx(x);
+    vector<lp::mpq> r(m, lp::mpq(0));
+    for (unsigned p = 0; p < m; ++p)
+        for (auto const& e : B[p])
+            r[e.first] += e.second * x[p];
+    for (unsigned i = 0; i < m; ++i)
+        ENSURE(r[i] == a[i]);
+}
+
+// y^T B == d^T, where y is indexed by rows
+static void check_yB(vector<column> const& B, lp::indexed_vector<lp::mpq> const& d, lu_t const& lu) {
+    unsigned m = B.size();
+    lp::indexed_vector<lp::mpq> y(m);
+    y = d;
+    lu.solve_yB(y);
+    for (unsigned p = 0; p < m; ++p) {
+        lp::mpq s(0);
+        for (auto const& e : B[p])
+            s += y[e.first] * e.second;
+        ENSURE(s == d[p]);
+    }
+}
+
+static void tst_random(unsigned m) {
+    vector<column> B;
+    for (unsigned p = 0; p < m; ++p)
+        B.push_back(random_column(m, (p * 7) % m));
+    lu_t lu(10);
+    if (!lu.factor(B))
+        return;
+    for (unsigned round = 0; round < 30; ++round) {
+        check_Bx(B, random_vector(m), lu);
+        check_yB(B, random_vector(m), lu);
+        unsigned p = lu_rand() % m;
+        column c = random_column(m, lu_rand() % m);
+        lp::indexed_vector<lp::mpq> alpha(m);
+        for (auto const& e : c)
+            if (!lp::is_zero(e.second))
+                alpha.add_value_at_index(e.first, e.second);
+        lu.solve_Bx(alpha);
+        if (!lu.replace_column(p, alpha))
+            continue;
+        B[p] = c;
+        if (lu.needs_refactorization())
+            ENSURE(lu.factor(B));
+    }
+}
+
+static void tst_singular() {
+    vector<column> B;
+    B.push_back(column());
+    B.back().push_back({0, lp::mpq(1)});
+    B.back().push_back({1, lp::mpq(2)});
+    B.push_back(column());
+    B.back().push_back({0, lp::mpq(2)});
+    B.back().push_back({1, lp::mpq(4)});
+    lu_t lu;
+    ENSURE(!lu.factor(B));
+}
+
+void tst_sparse_lu() {
+    tst_singular();
+    for (unsigned m : { 1u, 2u, 5u, 20u, 60u })
+        for (unsigned i = 0; i < 10; ++i)
+            tst_random(m);
+}
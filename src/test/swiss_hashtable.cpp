@@ -0,0 +1,104 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    swiss_hashtable.cpp
+
+Abstract:
+
+    Test the hashtable with control tags against core_hashtable.
+
+--*/
+#include "util/swiss_hashtable.h"
+#include "util/obj_hashtable.h"
+#include "util/map.h"
+#include "util/util.h"
+#include <iostream>
+
+typedef map<unsigned, unsigned, u_hash, u_eq, swiss_hashtable> swiss_u_map;
+
+static void check_same(swiss_u_map const & s, u_map<unsigned> const & c) {
+    ENSURE(s.size() == c.size());
+    unsigned n = 0;
+    for (auto const & kv : s) {
+        unsigned v = 0;
+        ENSURE(c.find(kv.m_key, v));
+        ENSURE(v == kv.m_value);
+        ++n;
+    }
+    ENSURE(n == c.size());
+}
+
+// random inserts and removals, with a small key range to exercise deleted slots
+static void tst1(unsigned range) {
+    random_gen r(range);
+    swiss_u_map s;
+    u_map<unsigned> c;
+    for (unsigned i = 0; i < 100000; ++i) {
+        unsigned k = r(range);
+        switch (r(4)) {
+        case 0:
+            s.erase(k);
+            c.erase(k);
+            break;
+        case 1:
+            ENSURE(s.contains(k) == c.contains(k));
+            break;
+        default:
+            s.insert(k, i);
+            c.insert(k, i);
+            break;
+        }
+        ENSURE(s.size() == c.size());
+    }
+    check_same(s, c);
+    DEBUG_CODE(ENSURE(s.check_invariant()););
+    swiss_u_map s2;
+    s2.swap(s);
+    check_same(s2, c);
+    ENSURE(s.empty());
+    s2.reset();
+    ENSURE(s2.empty());
+    ENSURE(!s2.contains(0));
+}
+
+struct swiss_obj {
+    unsigned m_hash;
+    unsigned hash() const { return m_hash; }
+};
+
+// many keys with the same hash code
+static void tst2() {
+    swiss_obj objs[100];
+    for (unsigned i = 0; i < 100; ++i)
+        objs[i].m_hash = i % 3;
+    obj_map<swiss_obj, unsigned, swiss_hashtable> m;
+    obj_hashtable<swiss_obj, swiss_hashtable> h;
+    for (unsigned i = 0; i < 100; ++i) {
+        m.insert(objs + i, i);
+        h.insert(objs + i);
+    }
+    for (unsigned i = 0; i < 100; i += 2) {
+        m.remove(objs + i);
+        h.remove(objs + i);
+    }
+    ENSURE(m.size() == 50 && h.size() == 50);
+    for (unsigned i = 0; i < 100; ++i) {
+        ENSURE(m.contains(objs + i) == (i % 2 == 1));
+        ENSURE(h.contains(objs + i) == (i % 2 == 1));
+        if (i % 2 == 1)
+            ENSURE(m[objs + i] == i);
+    }
+    ENSURE(m.insert_if_not_there(objs + 1, 0) == 1);
+    ENSURE(m.insert_if_not_there(objs + 2, 7) == 7);
+    ENSURE(m.size() == 51);
+}
+
+void tst_swiss_hashtable() {
+    tst1(16);
+    tst1(1000);
+    tst1(100000);
+    tst2();
+    std::cout << "ok\n";
+}
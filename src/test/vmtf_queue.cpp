@@ -0,0 +1,66 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    vmtf_queue.cpp
+
+Abstract:
+
+    Test variable move-to-front queue.
+
+--*/
+
+#include "util/vmtf_queue.h"
+#include "util/vector.h"
+#include "util/debug.h"
+#include <iostream>
+
+static void tst1() {
+    vmtf_queue q;
+    bool_vector assigned(10, false);
+    auto is_free = [&](unsigned v) { return !assigned[v]; };
+    for (unsigned v = 0; v < 10; ++v)
+        q.mk_var_eh(v);
+    // most recently created variable comes first
+    ENSURE(q.next_var(is_free) == 9);
+    assigned[9] = true;
+    ENSURE(q.next_var(is_free) == 8);
+    q.bump(3, true);
+    ENSURE(q.next_var(is_free) == 3);
+    assigned[3] = true;
+    assigned[8] = true;
+    ENSURE(q.next_var(is_free) == 7);
+    // unassigning a more recently bumped variable moves the search pointer forward
+    assigned[3] = false;
+    q.unassign_var_eh(3);
+    ENSURE(q.next_var(is_free) == 3);
+    ENSURE(q.more_active(3, 9));
+    q.del_var_eh(3);
+    ENSURE(!q.contains(3));
+    ENSURE(q.next_var(is_free) == 7);
+}
+
+static void tst2() {
+    vmtf_queue q;
+    bool_vector assigned(5, true);
+    auto is_free = [&](unsigned v) { return !assigned[v]; };
+    for (unsigned v = 0; v < 5; ++v)
+        q.mk_var_eh(v);
+    ENSURE(q.next_var(is_free) == UINT_MAX);
+    // relative order of bumped variables is preserved
+    unsigned_vector vars;
+    vars.push_back(4);
+    vars.push_back(1);
+    vars.push_back(2);
+    q.bump(vars, is_free);
+    ENSURE(q.more_active(4, 2) && q.more_active(2, 1) && q.more_active(1, 3));
+    assigned[1] = false;
+    q.unassign_var_eh(1);
+    ENSURE(q.next_var(is_free) == 1);
+}
+
+void tst_vmtf_queue() {
+    tst1();
+    tst2();
+}
@@ -0,0 +1,111 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    async_file_buffer.cpp
+
+Abstract:
+
+    Stream buffer that writes to a file from a background thread.
+
+--*/
+
+#include "util/async_file_buffer.h"
+
+async_file_buffer::async_file_buffer(char const* file_name, std::ios_base::openmode mode, unsigned buffer_size):
+    m_file(file_name, mode) {
+    m_active.resize(buffer_size);
+    m_pending.resize(buffer_size);
+    reset_put_area();
+#ifndef SINGLE_THREAD
+    m_writer = std::thread([this]() { write_loop(); });
+#endif
+}
+
+async_file_buffer::~async_file_buffer() {
+    sync();
+#ifndef SINGLE_THREAD
+    {
+        std::lock_guard<std::mutex> lock(m_mux);
+        m_done = true;
+    }
+    m_cv.notify_all();
+    m_writer.join();
+#endif
+    m_file.flush();
+}
+
+void async_file_buffer::reset_put_area() {
+    setp(m_active.data(), m_active.data() + m_active.size());
+}
+
+#ifndef SINGLE_THREAD
+
+void async_file_buffer::write_loop() {
+    std::unique_lock<std::mutex> lock(m_mux);
+    while (true) {
+        m_cv.wait(lock, [&]() { return m_has_pending || m_done; });
+        if (m_has_pending) {
+            // the producer does not touch m_pending while m_has_pending is set.
+            lock.unlock();
+            m_file.write(m_pending.data(), m_pending.size());
+            lock.lock();
+            m_has_pending = false;
+            m_cv.notify_all();
+        }
+        else if (m_done)
+            return;
+    }
+}
+
+void async_file_buffer::hand_off() {
+    unsigned sz = static_cast<unsigned>(pptr() - pbase());
+    if (sz == 0)
+        return;
+    unsigned capacity = m_active.size();
+    {
+        std::unique_lock<std::mutex> lock(m_mux);
+        m_cv.wait(lock, [&]() { return !m_has_pending; });
+        m_active.shrink(sz);
+        m_active.swap(m_pending);
+        m_active.resize(capacity);
+        m_has_pending = true;
+    }
+    m_cv.notify_all();
+    reset_put_area();
+}
+
+int async_file_buffer::sync() {
+    hand_off();
+    std::unique_lock<std::mutex> lock(m_mux);
+    m_cv.wait(lock, [&]() { return !m_has_pending; });
+    m_file.flush();
+    return m_file.good() ? 0 : -1;
+}
+
+#else
+
+void async_file_buffer::hand_off() {
+    unsigned sz = static_cast<unsigned>(pptr() - pbase());
+    if (sz > 0)
+        m_file.write(pbase(), sz);
+    reset_put_area();
+}
+
+int async_file_buffer::sync() {
+    hand_off();
+    m_file.flush();
+    return m_file.good() ? 0 : -1;
+}
+
+#endif
+
+async_file_buffer::int_type async_file_buffer::overflow(int_type ch) {
+    hand_off();
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+        return traits_type::not_eof(ch);
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
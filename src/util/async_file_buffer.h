@@ -0,0 +1,51 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    async_file_buffer.h
+
+Abstract:
+
+    Stream buffer that writes to a file from a background thread.
+
+    Output is collected in a large buffer. When the buffer is full
+    it is handed to a writer thread and the producer continues with
+    a second buffer, such that the producer only blocks when both
+    buffers are full. In single threaded builds the buffer is written
+    synchronously.
+
+--*/
+#pragma once
+
+#include <fstream>
+#include <streambuf>
+#include "util/vector.h"
+#ifndef SINGLE_THREAD
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+class async_file_buffer : public std::streambuf {
+    std::ofstream           m_file;
+    svector<char>           m_active;
+    svector<char>           m_pending;
+#ifndef SINGLE_THREAD
+    std::mutex              m_mux;
+    std::condition_variable m_cv;
+    std::thread             m_writer;
+    bool                    m_has_pending = false;
+    bool                    m_done = false;
+    void write_loop();
+#endif
+    void hand_off();
+    void reset_put_area();
+protected:
+    int_type overflow(int_type ch) override;
+    int sync() override;
+public:
+    async_file_buffer(char const* file_name, std::ios_base::openmode mode, unsigned buffer_size = (1 << 20));
+    ~async_file_buffer() override;
+    bool is_open() const { return m_file.is_open(); }
+};
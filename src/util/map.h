@@ -39,7 +39,7 @@ struct _key_data {
     }
 };
 
-template<typename Entry, typename HashProc, typename EqProc>
+template<typename Entry, typename HashProc, typename EqProc, template<typename, typename, typename> class Table = core_hashtable>
 class table2map {
 public:
     typedef Entry    entry;
@@ -68,7 +68,7 @@ public:
         }
     };
 
-    typedef core_hashtable<entry, entry_hash_proc, entry_eq_proc> table;
+    typedef Table<entry, entry_hash_proc, entry_eq_proc> table;
     
     table m_table;
     
@@ -216,11 +216,11 @@ public:
 };
 
 
-template<typename Key, typename Value, typename HashProc, typename EqProc>
-class map : public table2map<default_map_entry<Key, Value>, HashProc, EqProc> {
+template<typename Key, typename Value, typename HashProc, typename EqProc, template<typename, typename, typename> class Table = core_hashtable>
+class map : public table2map<default_map_entry<Key, Value>, HashProc, EqProc, Table> {
 public:
     map(HashProc const & h = HashProc(), EqProc const & e = EqProc()):
-        table2map<default_map_entry<Key, Value>, HashProc, EqProc>(h, e) {
+        table2map<default_map_entry<Key, Value>, HashProc, EqProc, Table>(h, e) {
     }
 };
 
@@ -52,14 +52,16 @@ out_of_memory_error::out_of_memory_error():z3_error(ERR_MEMOUT) {
 }
 
 
-static DECLARE_INIT_MUTEX(g_memory_mux);
+// The global counters are only updated when a thread flushes its local
+// counters (see synchronize_counters), so they are kept as atomics
+// instead of being guarded by a mutex.
 static atomic<bool> g_memory_out_of_memory(false);
 static bool       g_memory_initialized       = false;
-static long long  g_memory_alloc_size        = 0;
+static atomic<long long> g_memory_alloc_size(0);
 static long long  g_memory_max_size          = 0;
-static long long  g_memory_max_used_size     = 0;
+static atomic<long long> g_memory_max_used_size(0);
 static long long  g_memory_watermark         = 0;
-static long long  g_memory_alloc_count       = 0;
+static atomic<long long> g_memory_alloc_count(0);
 static long long  g_memory_max_alloc_count   = 0;
 static bool       g_exit_when_out_of_memory  = false;
 static char const * g_out_of_memory_msg      = "ERROR: out of memory";
@@ -130,7 +132,6 @@ void memory::set_high_watermark(size_t watermark) {
 bool memory::above_high_watermark() {
     if (g_memory_watermark == 0)
         return false;
-    lock_guard lock(*g_memory_mux);
     return g_memory_watermark < g_memory_alloc_size;
 }
 
@@ -151,9 +152,6 @@ void memory::finalize(bool shutdown) {
     if (g_memory_initialized) {
         g_finalizing = true;
         mem_finalize();
-        // we leak the mutex since we need it to be always live since memory may
-        // be reinitialized again
-        //delete g_memory_mux;
         g_memory_initialized = false;
         g_finalizing = false;
 
@@ -164,23 +162,14 @@ void memory::finalize(bool shutdown) {
 }
 
 unsigned long long memory::get_allocation_size() {
-    long long r;
-    {
-        lock_guard lock(*g_memory_mux);
-        r = g_memory_alloc_size;
-    }
+    long long r = g_memory_alloc_size;
     if (r < 0)
         r = 0;
     return r;
 }
 
 unsigned long long memory::get_max_used_memory() {
-    unsigned long long r;
-    {
-        lock_guard lock(*g_memory_mux);
-        r = g_memory_max_used_size;
-    }
-    return r;
+    return g_memory_max_used_size;
 }
 
 #if defined(_WINDOWS)
@@ -199,6 +188,12 @@ unsigned long long memory::get_max_memory_size() {
 #endif
 }
 
+void memory::trim() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
 unsigned long long memory::get_allocation_count() {
     return g_memory_alloc_count;
 }
@@ -245,29 +240,37 @@ void * memory::allocate(char const* file, int line, char const* obj, size_t s) {
 
 thread_local long long g_memory_thread_alloc_size    = 0;
 thread_local long long g_memory_thread_alloc_count   = 0;
+thread_local long long g_memory_thread_usage         = 0; // net bytes synchronized by this thread
+thread_local long long g_memory_thread_max_size      = 0;
+
+void memory::set_thread_max_size(size_t max_size) {
+    g_memory_thread_max_size = max_size > static_cast<size_t>(LLONG_MAX) ? 0 : static_cast<long long>(max_size);
+    g_memory_thread_usage = 0;
+}
 
 static void synchronize_counters(bool allocating) {
 #ifdef PROFILE_MEMORY
     g_synch_counter++;
 #endif
 
-    bool out_of_mem = false;
-    bool counts_exceeded = false;
-    {
-        lock_guard lock(*g_memory_mux);
-        g_memory_alloc_size += g_memory_thread_alloc_size;
-        g_memory_alloc_count += g_memory_thread_alloc_count;
-        if (g_memory_alloc_size > g_memory_max_used_size)
-            g_memory_max_used_size = g_memory_alloc_size;
-        if (g_memory_max_size != 0 && g_memory_alloc_size > g_memory_max_size)
-            out_of_mem = true;
-        if (g_memory_max_alloc_count != 0 && g_memory_alloc_count > g_memory_max_alloc_count)
-            counts_exceeded = true;
-    }
+    long long size = g_memory_alloc_size.fetch_add(g_memory_thread_alloc_size) + g_memory_thread_alloc_size;
+    long long count = g_memory_alloc_count.fetch_add(g_memory_thread_alloc_count) + g_memory_thread_alloc_count;
+    long long max_used = g_memory_max_used_size;
+    while (size > max_used && !g_memory_max_used_size.compare_exchange_weak(max_used, size))
+        ;
+    bool out_of_mem = g_memory_max_size != 0 && size > g_memory_max_size;
+    bool counts_exceeded = g_memory_max_alloc_count != 0 && count > g_memory_max_alloc_count;
+    g_memory_thread_usage += g_memory_thread_alloc_size;
+    bool thread_out_of_mem = g_memory_thread_max_size != 0 && g_memory_thread_usage > g_memory_thread_max_size;
     g_memory_thread_alloc_size = 0;
+    g_memory_thread_alloc_count = 0;
     if (out_of_mem && allocating) {
         throw_out_of_memory();
     }
+    if (thread_out_of_mem && allocating) {
+        // only the current thread is out of its budget. 
+        throw out_of_memory_error();
+    }
     if (counts_exceeded && allocating) {
         throw_alloc_counts_exceeded();
     }
@@ -353,6 +356,9 @@ void* memory::reallocate(void *p, size_t s) {
 // ==================================
 // allocate & deallocate without locking
 
+void memory::set_thread_max_size(size_t max_size) {
+}
+
 void memory::deallocate(void * p) {
 #ifdef HAS_MALLOC_USABLE_SIZE
     size_t sz      = malloc_usable_size(p);
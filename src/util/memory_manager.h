@@ -55,6 +55,13 @@ public:
     static bool above_high_watermark();
     static void set_max_size(size_t max_size);
     static void set_max_alloc_count(size_t max_count);
+    /**
+       \brief limit the memory allocated by the current thread from now on.
+       Exceeding the limit throws out_of_memory_error in this thread only.
+       The limit is checked when thread counters are synchronized and memory released
+       by other threads is not credited. 0 means no limit.
+    */
+    static void set_thread_max_size(size_t max_size);
     static void finalize(bool shutdown = true);
     static void display_max_usage(std::ostream& os);
     static void display_i_max_usage(std::ostream& os);
@@ -69,6 +76,8 @@ public:
     static unsigned long long get_max_used_memory();
     static unsigned long long get_allocation_count();
     static unsigned long long get_max_memory_size();
+    // return freed heap memory to the operating system where the C library supports it.
+    static void trim();
     // temporary hack to avoid out-of-memory crash in z3.exe
     static void exit_when_out_of_memory(bool flag, char const * msg);
 };
@@ -92,18 +92,127 @@ bool mpn_manager::sub(mpn_digit const * a, unsigned lnga,
     return true; // return k != 0?
 }
 
+#define DIGIT_BITS (sizeof(mpn_digit)*8)
+#define HALF_BITS (sizeof(mpn_digit)*4)
+
 bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
                       mpn_digit const * b, unsigned lngb,
                       mpn_digit * c) const {
     trace(a, lnga, b, lngb, "*");
+    if (lnga < lngb) {
+        std::swap(a, b);
+        std::swap(lnga, lngb);
+    }
+    if (lngb >= m_karatsuba_threshold)
+        mul_karatsuba(a, lnga, b, lngb, c);
+    else
+        mul_schoolbook(a, lnga, b, lngb, c);
+    trace_nl(c, lnga+lngb);
+    return true;
+}
+
+/**
+   \brief c[0..lc) += x[0..lx), where lx <= lc and the sum fits in lc digits.
+*/
+static void add_at(mpn_digit * c, unsigned lc, mpn_digit const * x, unsigned lx) {
+    SASSERT(lx <= lc);
+    mpn_double_digit k = 0;
+    unsigned i = 0;
+    for (; i < lx; i++) {
+        k += (mpn_double_digit)c[i] + (mpn_double_digit)x[i];
+        c[i] = (mpn_digit)k;
+        k >>= DIGIT_BITS;
+    }
+    for (; k != 0 && i < lc; i++) {
+        k += (mpn_double_digit)c[i];
+        c[i] = (mpn_digit)k;
+        k >>= DIGIT_BITS;
+    }
+    SASSERT(k == 0);
+}
+
+/**
+   \brief c[0..lc) -= x[0..lx), where lx <= lc and c >= x.
+*/
+static void sub_at(mpn_digit * c, unsigned lc, mpn_digit const * x, unsigned lx) {
+    SASSERT(lx <= lc);
+    mpn_digit borrow = 0;
+    unsigned i = 0;
+    for (; i < lx; i++) {
+        mpn_digit r = c[i] - x[i];
+        bool b1 = r > c[i];
+        c[i] = r - borrow;
+        bool b2 = c[i] > r;
+        borrow = b1 | b2;
+    }
+    for (; borrow != 0 && i < lc; i++) {
+        borrow = c[i] == 0;
+        c[i]--;
+    }
+    SASSERT(borrow == 0);
+}
+
+/**
+   \brief Karatsuba multiplication, see Knuth, Section 4.3.3.
+   Let a = a1*B^h + a0 and b = b1*B^h + b0, then
+   a*b = a1*b1*B^2h + ((a0 + a1)*(b0 + b1) - a0*b0 - a1*b1)*B^h + a0*b0.
+   Operands of unbalanced sizes are multiplied by slices of a.
+   
+   \pre lnga >= lngb >= 4, c does not overlap with a and b.
+*/
+void mpn_manager::mul_karatsuba(mpn_digit const * a, unsigned lnga,
+                                mpn_digit const * b, unsigned lngb,
+                                mpn_digit * c) const {
+    SASSERT(lnga >= lngb && lngb >= 4);
+    unsigned lngc = lnga + lngb;
+    if (lnga >= 2 * lngb) {
+        for (unsigned i = 0; i < lngc; i++)
+            c[i] = 0;
+        mpn_sbuffer t;
+        for (unsigned off = 0; off < lnga; off += lngb) {
+            unsigned n = std::min(lngb, lnga - off);
+            t.resize(n + lngb);
+            mul(a + off, n, b, lngb, t.data());
+            add_at(c + off, lngc - off, t.data(), n + lngb);
+        }
+        return;
+    }
+    // lngb > h, so that a1 and b1 are non-empty.
+    unsigned h = lnga / 2;
+    unsigned lnga1 = lnga - h, lngb1 = lngb - h;
+    mul(a, h, b, h, c);                      // z0 = a0*b0
+    mul(a + h, lnga1, b + h, lngb1, c + 2*h); // z2 = a1*b1
+
+    unsigned lsa = lnga1 + 1, lsb = std::max(h, lngb1) + 1;
+    mpn_sbuffer sa(lsa, 0), sb(lsb, 0);
+    for (unsigned i = 0; i < lnga1; i++)
+        sa[i] = a[h + i];
+    add_at(sa.data(), lsa, a, h);
+    for (unsigned i = 0; i < h; i++)
+        sb[i] = b[i];
+    add_at(sb.data(), lsb, b + h, lngb1);
+
+    unsigned lz1 = lsa + lsb;
+    mpn_sbuffer z1(lz1, 0);
+    while (lsa > 1 && sa[lsa - 1] == 0)
+        lsa--;
+    while (lsb > 1 && sb[lsb - 1] == 0)
+        lsb--;
+    mul(sa.data(), lsa, sb.data(), lsb, z1.data());
+    sub_at(z1.data(), lz1, c, 2*h);
+    sub_at(z1.data(), lz1, c + 2*h, lngc - 2*h);
+    while (lz1 > 0 && z1[lz1 - 1] == 0)
+        lz1--;
+    add_at(c + h, lngc - h, z1.data(), lz1);
+}
+
+void mpn_manager::mul_schoolbook(mpn_digit const * a, unsigned lnga,
+                                 mpn_digit const * b, unsigned lngb,
+                                 mpn_digit * c) const {
     // Essentially Knuth's Algorithm M. 
-    // Perhaps implement a more efficient version, see e.g., Knuth, Section 4.3.3.    
     unsigned i;
     mpn_digit k;
 
-#define DIGIT_BITS (sizeof(mpn_digit)*8)
-#define HALF_BITS (sizeof(mpn_digit)*4)
-
     for (unsigned i = 0; i < lnga; i++)
         c[i] = 0;
 
@@ -127,9 +236,6 @@ bool mpn_manager::mul(mpn_digit const * a, unsigned lnga,
             c[j+lnga] = k;
         }        
     }
-    
-    trace_nl(c, lnga+lngb);
-    return true;
 }
 
 #define MASK_FIRST (~((mpn_digit)(-1) >> 1))
@@ -25,8 +25,12 @@ Revision History:
 typedef unsigned int mpn_digit;
 
 class mpn_manager {
+    // operands with at least this many digits are multiplied using Karatsuba's method
+    unsigned m_karatsuba_threshold = 32;
 
 public:
+    void set_karatsuba_threshold(unsigned n) { m_karatsuba_threshold = std::max(n, 4u); }
+
     int compare(mpn_digit const * a, unsigned lnga,
                 mpn_digit const * b, unsigned lngb) const;
 
@@ -55,6 +59,14 @@ private:
 
     void display_raw(std::ostream & out, mpn_digit const * a, unsigned lng) const;
 
+    void mul_schoolbook(mpn_digit const * a, unsigned lnga,
+                        mpn_digit const * b, unsigned lngb,
+                        mpn_digit * c) const;
+
+    void mul_karatsuba(mpn_digit const * a, unsigned lnga,
+                       mpn_digit const * b, unsigned lngb,
+                       mpn_digit * c) const;
+
     unsigned div_normalize(mpn_digit const * numer, unsigned lnum,
                          mpn_digit const * denom, unsigned lden,
                          mpn_sbuffer & n_numer,
@@ -225,6 +225,37 @@ public:
 
     void display_decimal(std::ostream & out, mpq const & a, unsigned prec, bool truncate = false);
 
+    // Fast paths for operands whose numerators and denominators are small.
+    // Small values fit in an int and denominators are positive, so the
+    // products and sums below cannot overflow int64_t.
+    void set_small_rat(mpq & c, int64_t n, int64_t d) {
+        SASSERT(d > 0);
+        if (n == 0)
+            d = 1;
+        else if (d != 1) {
+            int64_t g = static_cast<int64_t>(u64_gcd(static_cast<uint64_t>(n < 0 ? -n : n), static_cast<uint64_t>(d)));
+            n /= g;
+            d /= g;
+        }
+        mpz_manager<SYNCH>::set(c.m_num, n);
+        mpz_manager<SYNCH>::set(c.m_den, d);
+    }
+
+    template<bool SUB>
+    void small_add(mpq const & a, mpq const & b, mpq & c) {
+        int64_t an = a.m_num.value(), ad = a.m_den.value();
+        int64_t bn = b.m_num.value(), bd = b.m_den.value();
+        if (ad == bd)
+            set_small_rat(c, SUB ? an - bn : an + bn, ad);
+        else
+            set_small_rat(c, SUB ? an * bd - bn * ad : an * bd + bn * ad, ad * bd);
+    }
+
+    void small_mul(mpq const & a, mpq const & b, mpq & c) {
+        set_small_rat(c, static_cast<int64_t>(a.m_num.value()) * b.m_num.value(),
+                      static_cast<int64_t>(a.m_den.value()) * b.m_den.value());
+    }
+
     void add(mpz const & a, mpz const & b, mpz & c) { mpz_manager<SYNCH>::add(a, b, c); }
     
     void add(mpq const & a, mpq const & b, mpq & c) {
@@ -239,6 +270,9 @@ public:
             mpz_manager<SYNCH>::add(a.m_num, b.m_num, c.m_num);
             reset_denominator(c);
         }
+        else if (is_small(a) && is_small(b)) {
+            small_add<false>(a, b, c);
+        }
         else {
             rat_add(a, b, c);
         }
@@ -271,6 +305,8 @@ public:
             mpz_manager<SYNCH>::sub(a.m_num, b.m_num, c.m_num);
             reset_denominator(c);
         }
+        else if (is_small(a) && is_small(b))
+            small_add<true>(a, b, c);
         else
             rat_sub(a, b, c);
         STRACE("mpq", tout << to_string(c) << "\n";);
@@ -297,6 +333,8 @@ public:
             mpz_manager<SYNCH>::mul(a.m_num, b.m_num, c.m_num);
             reset_denominator(c);
         }
+        else if (is_small(a) && is_small(b))
+            small_mul(a, b, c);
         else
             rat_mul(a, b, c);
         STRACE("mpq", tout << to_string(c) << "\n";);
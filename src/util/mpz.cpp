@@ -185,6 +185,68 @@ mpz_manager<SYNCH>::~mpz_manager() {
 }
 
 #ifndef _MP_GMP
+#ifndef SINGLE_THREAD
+namespace {
+    /**
+       \brief Per-thread free lists of the cells used by synchronized managers.
+
+       Numerals of a synchronized manager (e.g., rational) are created and
+       deleted by many threads, so their cells cannot live in the manager's
+       small_object_allocator. Instead of going to the global heap for every
+       cell, each thread keeps a bounded number of released small cells and
+       reuses them. A cell allocated by one thread and released by another
+       simply moves to the free list of the releasing thread.
+    */
+    class mpz_cell_cache {
+        static const unsigned max_capacity = 16;
+        static const unsigned max_cells    = 256;
+        struct node { node * m_next; };
+        node *   m_free[max_capacity + 1];
+        unsigned m_size[max_capacity + 1];
+    public:
+        mpz_cell_cache() {
+            for (unsigned i = 0; i <= max_capacity; ++i) {
+                m_free[i] = nullptr;
+                m_size[i] = 0;
+            }
+        }
+
+        ~mpz_cell_cache() {
+            for (unsigned i = 0; i <= max_capacity; ++i) {
+                while (m_free[i]) {
+                    node * n = m_free[i];
+                    m_free[i] = n->m_next;
+                    memory::deallocate(n);
+                }
+            }
+        }
+
+        void * allocate(unsigned capacity, size_t sz) {
+            if (capacity <= max_capacity && m_free[capacity]) {
+                node * n = m_free[capacity];
+                m_free[capacity] = n->m_next;
+                m_size[capacity]--;
+                return n;
+            }
+            return memory::allocate(sz);
+        }
+
+        void deallocate(unsigned capacity, void * p) {
+            if (capacity <= max_capacity && m_size[capacity] < max_cells) {
+                node * n = static_cast<node*>(p);
+                n->m_next = m_free[capacity];
+                m_free[capacity] = n;
+                m_size[capacity]++;
+                return;
+            }
+            memory::deallocate(p);
+        }
+    };
+
+    thread_local mpz_cell_cache g_mpz_cell_cache;
+}
+#endif
+
 template<bool SYNCH>
 mpz_cell * mpz_manager<SYNCH>::allocate(unsigned capacity) {
     SASSERT(capacity >= m_init_cell_capacity);
@@ -193,7 +255,7 @@ mpz_cell * mpz_manager<SYNCH>::allocate(unsigned capacity) {
     cell = reinterpret_cast<mpz_cell*>(m_allocator.allocate(cell_size(capacity)));
 #else
     if (SYNCH) {
-        cell = reinterpret_cast<mpz_cell*>(memory::allocate(cell_size(capacity)));
+        cell = reinterpret_cast<mpz_cell*>(g_mpz_cell_cache.allocate(capacity, cell_size(capacity)));
     }
     else {
         cell = reinterpret_cast<mpz_cell*>(m_allocator.allocate(cell_size(capacity)));
@@ -212,7 +274,7 @@ void mpz_manager<SYNCH>::deallocate(bool is_heap, mpz_cell * ptr) {
         m_allocator.deallocate(cell_size(ptr->m_capacity), ptr); 
 #else
         if (SYNCH) {
-            memory::deallocate(ptr);
+            g_mpz_cell_cache.deallocate(ptr->m_capacity, ptr);
         }
         else {
             m_allocator.deallocate(cell_size(ptr->m_capacity), ptr);        
@@ -246,9 +308,13 @@ void mpz_manager<SYNCH>::del(mpz_manager<SYNCH>* m, mpz & a) {
 template<bool SYNCH>
 void mpz_manager<SYNCH>::add(mpz const & a, mpz const & b, mpz & c) {
     STRACE("mpz", tout << "[mpz] " << to_string(a) << " + " << to_string(b) << " == ";); 
+    int64_t x, y, z;
     if (is_small(a) && is_small(b)) {
         set_i64(c, i64(a) + i64(b));
     }
+    else if (get_i64(a, x) && get_i64(b, y) && !add_overflow(x, y, z)) {
+        set_i64(c, z);
+    }
     else {
         big_add(a, b, c);
     }
@@ -258,9 +324,13 @@ void mpz_manager<SYNCH>::add(mpz const & a, mpz const & b, mpz & c) {
 template<bool SYNCH>
 void mpz_manager<SYNCH>::sub(mpz const & a, mpz const & b, mpz & c) {
     STRACE("mpz", tout << "[mpz] " << to_string(a) << " - " << to_string(b) << " == ";); 
+    int64_t x, y, z;
     if (is_small(a) && is_small(b)) {
         set_i64(c, i64(a) - i64(b));
     }
+    else if (get_i64(a, x) && get_i64(b, y) && !sub_overflow(x, y, z)) {
+        set_i64(c, z);
+    }
     else {
         big_sub(a, b, c);
     }
@@ -502,9 +572,13 @@ void mpz_manager<SYNCH>::set_digits(mpz & target, unsigned sz, digit_t const * d
 template<bool SYNCH>
 void mpz_manager<SYNCH>::mul(mpz const & a, mpz const & b, mpz & c) {
     STRACE("mpz", tout << "[mpz] " << to_string(a) << " * " << to_string(b) << " == ";); 
+    int64_t x, y, z;
     if (is_small(a) && is_small(b)) {
         set_i64(c, i64(a) * i64(b));
     }
+    else if (get_i64(a, x) && get_i64(b, y) && !mul_overflow(x, y, z)) {
+        set_i64(c, z);
+    }
     else {
         big_mul(a, b, c);
     }
@@ -550,9 +624,8 @@ void mpz_manager<SYNCH>::submul(mpz const & a, mpz const & b, mpz const & c, mpz
 template<bool SYNCH>
 void mpz_manager<SYNCH>::machine_div_rem(mpz const & a, mpz const & b, mpz & q, mpz & r) {
     STRACE("mpz", tout << "[mpz-ext] divrem(" << to_string(a) << ",  " << to_string(b) << ") == ";); 
-    if (is_small(a) && is_small(b)) {
-        int64_t _a = i64(a);
-        int64_t _b = i64(b);
+    int64_t _a, _b;
+    if (get_i64(a, _a) && get_i64(b, _b) && _b != 0 && !(_a == INT64_MIN && _b == -1)) {
         set_i64(q, _a / _b);
         set_i64(r, _a % _b);
     }
@@ -568,8 +641,9 @@ void mpz_manager<SYNCH>::machine_div(mpz const & a, mpz const & b, mpz & c) {
     if (is_small(b) && i64(b) == 0)
         throw default_exception("division by 0"); 
 
-    if (is_small(a) && is_small(b)) 
-        set_i64(c, i64(a) / i64(b));
+    int64_t x, y;
+    if (get_i64(a, x) && get_i64(b, y) && y != 0 && !(x == INT64_MIN && y == -1))
+        set_i64(c, x / y);
     else 
         big_div(a, b, c);
     STRACE("mpz", tout << to_string(c) << "\n";);
@@ -584,8 +658,9 @@ void mpz_manager<SYNCH>::reset(mpz & a) {
 template<bool SYNCH>
 void mpz_manager<SYNCH>::rem(mpz const & a, mpz const & b, mpz & c) {
     STRACE("mpz", tout << "[mpz-ext] rem(" << to_string(a) << ",  " << to_string(b) << ") == ";); 
-    if (is_small(a) && is_small(b)) {
-        set_i64(c, i64(a) % i64(b));
+    int64_t x, y;
+    if (get_i64(a, x) && get_i64(b, y) && y != 0 && !(x == INT64_MIN && y == -1)) {
+        set_i64(c, x % y);
     }
     else {
         big_rem(a, b, c);
@@ -269,6 +269,80 @@ class mpz_manager {
 
     void set_big_ui64(mpz & c, uint64_t v);
 
+    /**
+       \brief Overflow-checked operations on 64-bit integers.
+       Return true if the result does not fit in an int64_t.
+    */
+    static bool add_overflow(int64_t a, int64_t b, int64_t & r) {
+#ifdef __GNUC__
+        return __builtin_add_overflow(a, b, &r);
+#else
+        if ((b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b))
+            return true;
+        r = a + b;
+        return false;
+#endif
+    }
+
+    static bool sub_overflow(int64_t a, int64_t b, int64_t & r) {
+#ifdef __GNUC__
+        return __builtin_sub_overflow(a, b, &r);
+#else
+        if ((b < 0 && a > INT64_MAX + b) || (b > 0 && a < INT64_MIN + b))
+            return true;
+        r = a - b;
+        return false;
+#endif
+    }
+
+    static bool mul_overflow(int64_t a, int64_t b, int64_t & r) {
+#ifdef __GNUC__
+        return __builtin_mul_overflow(a, b, &r);
+#else
+        if (a == 0 || b == 0) {
+            r = 0;
+            return false;
+        }
+        if ((a == -1 && b == INT64_MIN) || (b == -1 && a == INT64_MIN))
+            return true;
+        int64_t p = static_cast<int64_t>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+        if (p / b != a)
+            return true;
+        r = p;
+        return false;
+#endif
+    }
+
+    /**
+       \brief Store the value of a in v if it fits in an int64_t.
+       Large numbers are only considered by the internal backend, where
+       reading their digits is cheap.
+    */
+    bool get_i64(mpz const & a, int64_t & v) const {
+        if (is_small(a)) {
+            v = a.value();
+            return true;
+        }
+#ifndef _MP_GMP
+        if (!is_abs_uint64(a))
+            return false;
+        uint64_t n = big_abs_to_uint64(a);
+        if (a.m_val >= 0) {
+            if (n > static_cast<uint64_t>(INT64_MAX))
+                return false;
+            v = static_cast<int64_t>(n);
+        }
+        else {
+            if (n > static_cast<uint64_t>(INT64_MAX) + 1)
+                return false;
+            v = static_cast<int64_t>(0 - n);
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
 
 #ifndef _MP_GMP
 
@@ -44,15 +44,19 @@ public:
     void mark_as_free() { m_ptr = nullptr; }
 };
 
-template<typename T>
-class obj_hashtable : public core_hashtable<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> > {
+/**
+   \brief Hashtable of obj pointers. The underlying table can be replaced by
+   any class with the interface of core_hashtable, e.g., swiss_hashtable.
+*/
+template<typename T, template<typename, typename, typename> class Table = core_hashtable>
+class obj_hashtable : public Table<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> > {
 public:
     obj_hashtable(unsigned initial_capacity = DEFAULT_HASHTABLE_INITIAL_CAPACITY):
-        core_hashtable<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> >(initial_capacity) {}
+        Table<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> >(initial_capacity) {}
 
 };
 
-template<typename Key, typename Value>
+template<typename Key, typename Value, template<typename, typename, typename> class Table = core_hashtable>
 class obj_map {
 public:
     struct key_data {
@@ -93,7 +97,7 @@ public:
         void mark_as_free() { m_data.m_key = nullptr; }
     };
 
-    typedef core_hashtable<obj_map_entry, obj_hash<key_data>, default_eq<key_data> > table;
+    typedef Table<obj_map_entry, obj_hash<key_data>, default_eq<key_data> > table;
 
     table m_table;
   
@@ -217,8 +221,8 @@ public:
 /**
    \brief Reset and deallocate the values stored in a mapping of the form obj_map<Key, Value*>
 */
-template<typename Key, typename Value>
-void reset_dealloc_values(obj_map<Key, Value*> & m) {
+template<typename Key, typename Value, template<typename, typename, typename> class Table>
+void reset_dealloc_values(obj_map<Key, Value*, Table> & m) {
     for (auto & kv : m) {
         dealloc(kv.m_value);
     }
@@ -228,8 +232,8 @@ void reset_dealloc_values(obj_map<Key, Value*> & m) {
 /**
    \brief Remove the key k from the mapping m, and delete the value associated with k.
 */
-template<typename Key, typename Value>
-void erase_dealloc_value(obj_map<Key, Value*> & m, Key * k) {
+template<typename Key, typename Value, template<typename, typename, typename> class Table>
+void erase_dealloc_value(obj_map<Key, Value*, Table> & m, Key * k) {
     Value * v = 0;
     bool contains = m.find(k, v);
     m.erase(k);
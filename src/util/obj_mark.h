@@ -18,8 +18,35 @@ Revision History:
 --*/
 #pragma once
 
+#include <climits>
 #include "util/bit_vector.h"
 
+/**
+   \brief Bit vector with a constant time reset.
+
+   A bit is set if its stamp is the current one, so reset only advances the
+   current stamp. It uses a word per bit, so it is meant for marks that are
+   reset many times between uses, see obj_mark.
+*/
+class stamp_vector {
+    svector<unsigned> m_stamps;
+    unsigned          m_stamp = 1;
+public:
+    unsigned size() const { return m_stamps.size(); }
+    bool get(unsigned i) const { return m_stamps[i] == m_stamp; }
+    void set(unsigned i, bool val) { m_stamps[i] = val ? m_stamp : 0; }
+    void resize(unsigned new_size, bool val) {
+        SASSERT(!val);
+        m_stamps.resize(new_size, 0);
+    }
+    void reset() {
+        if (++m_stamp == UINT_MAX) {
+            m_stamps.fill(0);
+            m_stamp = 1;
+        }
+    }
+};
+
 template<typename T>
 struct default_t2uint {
     unsigned operator()(T const & obj) const { return obj.get_id(); }
@@ -17,6 +17,8 @@ Revision History:
 
 --*/
 #include "util/region.h"
+#include <algorithm>
+#include "util/statistics.h"
 
 #ifdef Z3DEBUG
 
@@ -27,6 +29,7 @@ void region::display_mem_stats(std::ostream & out) const {
 void * region::allocate(size_t size) {
     char * r = alloc_svect(char, size);
     m_chunks.push_back(r);
+    m_max_chunks = std::max(m_max_chunks, m_chunks.size());
     return r;
 }
 
@@ -47,6 +50,11 @@ void region::pop_scope() {
     m_chunks.shrink(old_size);
 }
 
+void region::collect_statistics(statistics & st) const {
+    st.update("region objects", m_chunks.size());
+    st.update("region max objects", m_max_chunks);
+}
+
 
 #else
 
@@ -56,6 +64,12 @@ void region::pop_scope() {
 #include "util/page.h"
 
 inline void region::allocate_page() {
+    if (m_free_pages)
+        m_num_reused_pages++;
+    else
+        m_num_new_pages++;
+    if (++m_num_pages > m_max_num_pages)
+        m_max_num_pages = m_num_pages;
     m_curr_page     = allocate_default_page(m_curr_page, m_free_pages);
     m_curr_ptr      = m_curr_page;
     m_curr_end_ptr  = end_of_default_page(m_curr_page);
@@ -100,6 +114,8 @@ void * region::allocate(size_t size) {
 
 inline void region::recycle_curr_page() {
     char * prev = prev_page(m_curr_page);
+    if (is_default_page(m_curr_page))
+        m_num_pages--;
     recycle_page(m_curr_page, m_free_pages);
     m_curr_page = prev;
 }
@@ -109,6 +125,7 @@ void region::reset() {
         recycle_curr_page();
     }
     SASSERT(m_curr_page == 0);
+    SASSERT(m_num_pages == 0);
     m_curr_ptr     = nullptr;
     m_curr_end_ptr = nullptr;
     m_mark         = nullptr;
@@ -118,7 +135,8 @@ void region::reset() {
 void region::push_scope() {
     char * curr_page = m_curr_page;
     char * curr_ptr  = m_curr_ptr;
-    m_mark = new (*this) mark(curr_page, curr_ptr, m_mark);
+    unsigned num_pages = m_num_pages;
+    m_mark = new (*this) mark(curr_page, curr_ptr, m_mark, num_pages);
 }
 
 void region::pop_scope() {
@@ -126,6 +144,7 @@ void region::pop_scope() {
     char * old_curr_page = m_mark->m_curr_page;
     SASSERT(is_default_page(old_curr_page));
     m_curr_ptr           = m_mark->m_curr_ptr;
+    m_max_scope_pages    = std::max(m_max_scope_pages, m_num_pages - m_mark->m_num_pages);
     m_mark               = m_mark->m_prev_mark;
     while (m_curr_page != old_curr_page) {
         recycle_curr_page();
@@ -144,5 +163,12 @@ void region::display_mem_stats(std::ostream & out) const {
     out << "num. pages:      " << n << "\n";
 }
 
+void region::collect_statistics(statistics & st) const {
+    st.update("region max pages", m_max_num_pages);
+    st.update("region max scope pages", m_max_scope_pages);
+    st.update("region new pages", m_num_new_pages);
+    st.update("region reused pages", m_num_reused_pages);
+}
+
 #endif
 
@@ -20,6 +20,8 @@ Revision History:
 #include<cstdlib>
 #include<ostream>
 
+class statistics;
+
 #ifdef Z3DEBUG
 
 #include "util/vector.h"
@@ -27,6 +29,7 @@ Revision History:
 class region {
     ptr_vector<char> m_chunks;
     unsigned_vector  m_scopes;
+    unsigned         m_max_chunks = 0;
 public:
     ~region() {
         reset();
@@ -50,6 +53,8 @@ public:
     }
 
     void display_mem_stats(std::ostream & out) const;
+
+    void collect_statistics(statistics & st) const;
 };
 
 #else
@@ -59,16 +64,22 @@ public:
 */
 class region {
     struct mark {
-        char * m_curr_page;
-        char * m_curr_ptr;
-        mark * m_prev_mark;
-        mark(char * page, char * ptr, mark * m):m_curr_page(page), m_curr_ptr(ptr), m_prev_mark(m) {}
+        char *   m_curr_page;
+        char *   m_curr_ptr;
+        mark *   m_prev_mark;
+        unsigned m_num_pages;
+        mark(char * page, char * ptr, mark * m, unsigned num_pages):m_curr_page(page), m_curr_ptr(ptr), m_prev_mark(m), m_num_pages(num_pages) {}
     };
     char *   m_curr_page;
     char *   m_curr_ptr;     //!< Next free space in the current page.
     char *   m_curr_end_ptr; //!< Point to the end of the current page.
-    char *   m_free_pages;
+    char *   m_free_pages;   //!< Pages released by pop_scope and reset, reused before new pages are allocated.
     mark *   m_mark;
+    unsigned m_num_pages = 0;        //!< Default pages in use.
+    unsigned m_max_num_pages = 0;
+    unsigned m_max_scope_pages = 0;  //!< Maximal number of pages allocated by a scope that was popped.
+    unsigned m_num_new_pages = 0;
+    unsigned m_num_reused_pages = 0;
     void allocate_page();
     void recycle_curr_page();
 public:
@@ -84,6 +95,7 @@ public:
         }
     }
     void display_mem_stats(std::ostream & out) const;
+    void collect_statistics(statistics & st) const;
 };
 
 #endif
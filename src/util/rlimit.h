@@ -53,6 +53,7 @@ public:
     bool suspended() const { return m_suspend;  }
     inline bool not_canceled() const { return (m_cancel == 0 && m_count <= m_limit) || m_suspend; }
     inline bool is_canceled() const { return !not_canceled(); }
+    bool cancel_requested() const { return m_cancel > 0; }
     char const* get_cancel_msg() const;
     void cancel();
     void reset_cancel();
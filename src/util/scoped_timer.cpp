@@ -22,55 +22,60 @@ Revision History:
 #include "util/scoped_timer.h"
 #include "util/mutex.h"
 #include "util/util.h"
-#include <atomic>
 #include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <thread>
-#include <vector>
 #ifndef _WINDOWS
 #include <pthread.h>
 #endif
 
-enum scoped_timer_work_state { IDLE = 0, WORKING = 1, EXITING = 2 };
+// All timers are served by a single thread that waits for the earliest deadline.
+// Timers are kept ordered by deadline; a timer that is destroyed before it expires
+// is removed through the position recorded when it was armed.
+
+typedef std::chrono::steady_clock timer_clock;
 
 struct scoped_timer_state {
-    std::thread m_thread;
-    std::timed_mutex m_mutex;
     event_handler * eh;
-    unsigned ms;
-    std::atomic<scoped_timer_work_state> work;
-    std::condition_variable_any cv;
+    std::multimap<timer_clock::time_point, scoped_timer_state*>::iterator m_pos;
+    bool m_armed;
 };
 
-static std::vector<scoped_timer_state*> available_workers;
-static std::mutex workers;
-static atomic<unsigned> num_workers(0);
-
-static void thread_func(scoped_timer_state *s) {
-    workers.lock();
+static std::mutex                  g_mutex;
+static std::condition_variable     g_wakeup;   // the set of timers changed
+static std::condition_variable     g_fired;    // a timeout handler returned
+static std::multimap<timer_clock::time_point, scoped_timer_state*> g_timers;
+static scoped_timer_state *        g_firing = nullptr;
+static std::thread                 g_thread;
+static bool                        g_running = false;
+static bool                        g_exiting = false;
+
+static void thread_func() {
+    std::unique_lock<std::mutex> lock(g_mutex);
     while (true) {
-        s->cv.wait(workers, [=]{ return s->work != IDLE; });
-        workers.unlock();
-
-        if (s->work == EXITING)
-            return;
-
-        auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(s->ms);
-
-        while (!s->m_mutex.try_lock_until(end)) {
-            if (std::chrono::steady_clock::now() >= end) {
-                s->eh->operator()(TIMEOUT_EH_CALLER);
-                goto next;
-            }
+        if (g_timers.empty()) {
+            if (g_exiting)
+                return;
+            g_wakeup.wait(lock);
+            continue;
         }
-
-        s->m_mutex.unlock();
-
-    next:
-        s->work = IDLE;
-        workers.lock();
+        auto it = g_timers.begin();
+        if (timer_clock::now() < it->first) {
+            g_wakeup.wait_until(lock, it->first);
+            continue;
+        }
+        scoped_timer_state * s = it->second;
+        g_timers.erase(it);
+        s->m_armed = false;
+        g_firing = s;
+        lock.unlock();
+        s->eh->operator()(TIMEOUT_EH_CALLER);
+        lock.lock();
+        g_firing = nullptr;
+        g_fired.notify_all();
     }
 }
 
@@ -79,35 +84,36 @@ scoped_timer::scoped_timer(unsigned ms, event_handler * eh) {
     if (ms == 0 || ms == UINT_MAX)
         return;
 
-    workers.lock();
-    if (available_workers.empty()) {
-        // start new thead
-        workers.unlock();
-        s = new scoped_timer_state;
-        ++num_workers;
-        init_state(ms, eh);
-        s->m_thread = std::thread(thread_func, s);
-    }
-    else {
-        // re-use existing thread
-        s = available_workers.back();
-        available_workers.pop_back();
-        init_state(ms, eh);
-        workers.unlock();
-        s->cv.notify_one();
+    s = new scoped_timer_state;
+    s->eh = eh;
+    auto deadline = timer_clock::now() + std::chrono::milliseconds(ms);
+    std::lock_guard<std::mutex> lock(g_mutex);
+    bool earliest = g_timers.empty() || deadline < g_timers.begin()->first;
+    s->m_pos = g_timers.emplace(deadline, s);
+    s->m_armed = true;
+    if (!g_running) {
+        g_running = true;
+        g_thread = std::thread(thread_func);
     }
+    else if (earliest)
+        g_wakeup.notify_one();
 }
     
 scoped_timer::~scoped_timer() {
     if (!s)
         return;
 
-    s->m_mutex.unlock();
-    while (s->work == WORKING)
-        std::this_thread::yield();
-    workers.lock();
-    available_workers.push_back(s);
-    workers.unlock();
+    {
+        std::unique_lock<std::mutex> lock(g_mutex);
+        if (s->m_armed) {
+            g_timers.erase(s->m_pos);
+            if (g_exiting)
+                g_wakeup.notify_one();
+        }
+        else
+            g_fired.wait(lock, [&]{ return g_firing != s; });
+    }
+    delete s;
 }
 
 void scoped_timer::initialize() {
@@ -121,30 +127,15 @@ void scoped_timer::initialize() {
 }
 
 void scoped_timer::finalize() {
-    unsigned deleted = 0;
-    while (deleted < num_workers) {
-        workers.lock();
-        for (auto w : available_workers) {
-            w->work = EXITING;
-            w->cv.notify_one();
-        }
-        decltype(available_workers) cleanup_workers;
-        std::swap(available_workers, cleanup_workers);
-        workers.unlock();
-
-        for (auto w : cleanup_workers) {
-            ++deleted;
-            w->m_thread.join();
-            delete w;
-        }
-    }
-    num_workers = 0;
-    available_workers.clear();
-}
-
-void scoped_timer::init_state(unsigned ms, event_handler * eh) {
-    s->ms = ms;
-    s->eh = eh;
-    s->m_mutex.lock();
-    s->work = WORKING;
+    // wait for the live timers to expire or be destroyed, then stop the timer thread.
+    std::unique_lock<std::mutex> lock(g_mutex);
+    if (!g_running)
+        return;
+    g_exiting = true;
+    g_wakeup.notify_one();
+    lock.unlock();
+    g_thread.join();
+    lock.lock();
+    g_running = false;
+    g_exiting = false;
 }
@@ -29,8 +29,6 @@ public:
     ~scoped_timer();
     static void initialize();
     static void finalize();
-private:
-    void init_state(unsigned ms, event_handler * eh);
 };
 
 /*
@@ -23,23 +23,41 @@ Revision History:
 #include "util/debug.h"
 #include "util/util.h"
 #include "util/vector.h"
+#include "util/mutex.h"
 #include<iomanip>
+#include<map>
+#include<string>
 #ifdef Z3DEBUG
 # include <iostream>
 #endif
 
+static mutex                    g_live_mux;
+static small_object_allocator * g_live = nullptr;
+
 small_object_allocator::small_object_allocator(char const * id) {
     for (unsigned i = 0; i < NUM_SLOTS; i++) {
         m_chunks[i] = nullptr;
         m_free_list[i] = nullptr;
     }
-    DEBUG_CODE({
-        m_id = id;
-    });
+    m_id = id;
     m_alloc_size = 0;
+    lock_guard lock(g_live_mux);
+    m_next_live = g_live;
+    if (g_live)
+        g_live->m_prev_live = this;
+    g_live = this;
 }
 
 small_object_allocator::~small_object_allocator() {
+    {
+        lock_guard lock(g_live_mux);
+        if (m_prev_live)
+            m_prev_live->m_next_live = m_next_live;
+        else
+            g_live = m_next_live;
+        if (m_next_live)
+            m_next_live->m_prev_live = m_prev_live;
+    }
     for (unsigned i = 0; i < NUM_SLOTS; i++) {
         chunk * c = m_chunks[i];
         while (c) {
@@ -196,9 +214,6 @@ void small_object_allocator::consolidate() {
             ptr = *(reinterpret_cast<char**>(ptr));
         }
         unsigned obj_size = slot_id << PTR_ALIGNMENT;
-        unsigned num_objs_per_chunk = CHUNK_SIZE / obj_size;
-        if (free_objs.size() < num_objs_per_chunk)
-            continue;
         SASSERT(!chunks.empty());
         std::sort(chunks.begin(), chunks.end(), ptr_lt<chunk>());
         std::sort(free_objs.begin(), free_objs.end(), ptr_lt<char>());
@@ -212,16 +227,18 @@ void small_object_allocator::consolidate() {
             chunk * curr_chunk = chunks[chunk_idx];
             char *  curr_begin = curr_chunk->m_data;
             char *  curr_end   = curr_begin + CHUNK_SIZE;
+            // only the prefix up to m_curr has been handed out
+            unsigned num_objs_in_chunk = static_cast<unsigned>((curr_chunk->m_curr - curr_begin) / obj_size);
             unsigned num_free_in_chunk = 0;
             unsigned saved_obj_idx = obj_idx;
             while (obj_idx < num_objs) {
                 char * free_obj = free_objs[obj_idx];
-                if (free_obj > curr_end)
+                if (free_obj >= curr_end)
                     break;
                 obj_idx++;
                 num_free_in_chunk++;
             }
-            if (num_free_in_chunk == num_objs_per_chunk) {
+            if (num_free_in_chunk == num_objs_in_chunk) {
                 dealloc(curr_chunk);
             }
             else {
@@ -244,3 +261,16 @@ void small_object_allocator::consolidate() {
                << " :memory " << std::fixed << std::setprecision(2) 
                << static_cast<double>(memory::get_allocation_size())/static_cast<double>(1024*1024) << ")" << std::endl;);
 }
+
+std::ostream& small_object_allocator::display_usage(std::ostream& out) {
+    std::map<std::string, size_t> usage;
+    {
+        lock_guard lock(g_live_mux);
+        for (small_object_allocator * a = g_live; a; a = a->m_next_live)
+            usage[a->m_id] += a->m_alloc_size;
+    }
+    for (auto const& [id, size] : usage) 
+        if (size > 0)
+            out << " :" << id << " " << size;
+    return out;
+}
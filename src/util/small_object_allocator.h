@@ -22,6 +22,7 @@ Revision History:
 #include "util/machine.h"
 #include "util/debug.h"
 #include "util/trace.h"
+#include <ostream>
 
 class small_object_allocator {
     static const unsigned CHUNK_SIZE     = (8192 - sizeof(void*)*2);
@@ -36,11 +37,13 @@ class small_object_allocator {
     chunk *     m_chunks[NUM_SLOTS];
     void  *     m_free_list[NUM_SLOTS];
     size_t      m_alloc_size;
-#ifdef Z3DEBUG
     char const * m_id;
-#endif
+    // live allocators are linked so that their usage can be reported by id.
+    small_object_allocator * m_prev_live = nullptr;
+    small_object_allocator * m_next_live = nullptr;
 public:
     small_object_allocator(char const * id = "unknown");
+    small_object_allocator(small_object_allocator const&) = delete;
     ~small_object_allocator();
     void reset();
     void * allocate(size_t size);
@@ -49,6 +52,13 @@ public:
     size_t get_wasted_size() const;
     size_t get_num_free_objs() const;
     void consolidate();
+
+    /**
+       \brief Display the bytes in use by all live allocators, summed by allocator id.
+       Allocators used by other threads are read without synchronization, so the
+       numbers are approximate while those threads run.
+    */
+    static std::ostream& display_usage(std::ostream& out);
 };
 
 inline void * operator new(size_t s, small_object_allocator & r) { return r.allocate(s); }
@@ -20,6 +20,9 @@ Notes:
 --*/
 
 #include "util/vector.h"
+#include <map>
+#include <tuple>
+#include <vector>
 
 #pragma once
 
@@ -29,7 +32,8 @@ Notes:
         bimander_at_most,
         ordered_at_most,
         unate_at_most,
-        circuit_at_most
+        circuit_at_most,
+        adaptive_at_most
     };
 
     inline std::ostream& operator<<(std::ostream& out, sorting_network_encoding enc) {
@@ -40,14 +44,17 @@ Notes:
         case sorting_network_encoding::sorted_at_most: return out << "sorted";
         case sorting_network_encoding::unate_at_most: return out << "unate";
         case sorting_network_encoding::circuit_at_most: return out << "circuit";
+        case sorting_network_encoding::adaptive_at_most: return out << "adaptive";
         }
         return out << "???";
     }
 
     struct sorting_network_config {
         sorting_network_encoding m_encoding;
+        bool                     m_cache; // share cardinality networks over the same inputs
         sorting_network_config() {
             m_encoding = sorting_network_encoding::sorted_at_most;
+            m_cache = false;
         }
     };
 
@@ -187,6 +194,10 @@ Notes:
         psort_expr&  ctx;
         cmp_t        m_t;
 
+        // cardinality networks indexed by polarity, bound and inputs.
+        typedef std::tuple<unsigned, unsigned, std::vector<literal>> card_key;
+        std::map<card_key, literal_vector> m_card_cache;
+
         // for testing
         static const bool m_disable_dcard    = false; 
         static const bool m_disable_dsorting = false; 
@@ -204,6 +215,7 @@ Notes:
             unsigned m_num_compiled_vars;
             unsigned m_num_compiled_clauses;
             unsigned m_num_clause_vars;
+            unsigned m_num_cache_hits;
             void reset() { memset(this, 0, sizeof(*this)); }
             stats() { reset(); }
         };
@@ -228,6 +240,42 @@ Notes:
 
         sorting_network_config& cfg() { return m_cfg; }
 
+        /**
+           \brief forget shared networks.
+           Must be called when clauses created so far are retracted.
+        */
+        void reset_cache() { m_card_cache.clear(); }
+
+        /**
+           \brief select the encoding of a cardinality constraint over n literals with bound k.
+           The adaptive encoding compares the estimated size of a sorting
+           network, a unary counter and a binary adder. Adders propagate
+           less and are only chosen when they are much smaller.
+        */
+        sorting_network_encoding encoding(cmp_t t, unsigned k, unsigned n) {
+            if (m_cfg.m_encoding != sorting_network_encoding::adaptive_at_most)
+                return m_cfg.m_encoding;
+            unsigned last = (t == GE || t == GE_FULL) ? k : k + 1;
+            unsigned num_bits = 0;
+            for (unsigned k0 = last; k0 > 0; k0 >>= 1)
+                ++num_bits;
+            cmp_t save = m_t;
+            m_t = t;
+            vc card = vc_card(last, n);
+            m_t = save;
+            vc unate(2 * n * last, 6 * n * last);
+            vc circuit(9 * n * num_bits, 36 * n * num_bits);
+            sorting_network_encoding enc = sorting_network_encoding::sorted_at_most;
+            if (unate < card) {
+                card = unate;
+                enc = sorting_network_encoding::unate_at_most;
+            }
+            if (circuit * 2 < card)
+                enc = sorting_network_encoding::circuit_at_most;
+            TRACE("pb_verbose", tout << "k: " << k << " n: " << n << " encoding: " << enc << "\n";);
+            return enc;
+        }
+
         literal ge(bool full, unsigned k, unsigned n, literal const* xs) {
             if (k > n) {
                 return ctx.mk_false();
@@ -244,7 +292,7 @@ Notes:
                 return le(full, k, in.size(), in.data());
             }
             else {
-                switch (m_cfg.m_encoding) {
+                switch (encoding(full ? GE_FULL : GE, k, n)) {
                 case sorting_network_encoding::sorted_at_most:
                 case sorting_network_encoding::bimander_at_most:
                 case sorting_network_encoding::ordered_at_most:
@@ -282,6 +330,7 @@ Notes:
                 case sorting_network_encoding::sorted_at_most:
                 case sorting_network_encoding::unate_at_most:
                 case sorting_network_encoding::circuit_at_most:
+                case sorting_network_encoding::adaptive_at_most:
                     return mk_at_most_1(full, n, xs, ors, false);
                 case sorting_network_encoding::bimander_at_most:
                     return mk_at_most_1_bimander(full, n, xs, ors);
@@ -294,7 +343,7 @@ Notes:
                 }
             }
             else {
-                switch (m_cfg.m_encoding) {
+                switch (encoding(full ? LE_FULL : LE, k, n)) {
                 case sorting_network_encoding::sorted_at_most:
                 case sorting_network_encoding::bimander_at_most:
                 case sorting_network_encoding::ordered_at_most:
@@ -329,7 +378,7 @@ Notes:
                 return mk_exactly_1(full, n, xs);
             }
             else {
-                switch (m_cfg.m_encoding) {
+                switch (encoding(EQ, k, n)) {
                 case sorting_network_encoding::sorted_at_most:
                 case sorting_network_encoding::bimander_at_most:
                 case sorting_network_encoding::grouped_at_most:
@@ -702,6 +751,7 @@ Notes:
             case sorting_network_encoding::sorted_at_most:
             case sorting_network_encoding::unate_at_most:
             case sorting_network_encoding::circuit_at_most:
+            case sorting_network_encoding::adaptive_at_most:
                 r1 = mk_at_most_1(full, n, xs, ors, true);
                 break;
             case sorting_network_encoding::bimander_at_most:
@@ -1035,6 +1085,23 @@ Notes:
 
         void card(unsigned k, unsigned n, literal const* xs, literal_vector& out) {
             TRACE("pb_verbose", tout << "card k: " << k << " n: " << n << "\n";);
+            if (m_cfg.m_cache && n > 1) {
+                card_key key(m_t, k, std::vector<literal>(xs, xs + n));
+                auto it = m_card_cache.find(key);
+                if (it != m_card_cache.end()) {
+                    m_stats.m_num_cache_hits++;
+                    out.append(it->second);
+                    return;
+                }
+                unsigned sz = out.size();
+                card_nocache(k, n, xs, out);
+                m_card_cache.emplace(std::move(key), literal_vector(out.size() - sz, out.data() + sz));
+                return;
+            }
+            card_nocache(k, n, xs, out);
+        }
+
+        void card_nocache(unsigned k, unsigned n, literal const* xs, literal_vector& out) {
             if (n <= k) {
                 psort_nw<psort_expr>::sorting(n, xs, out);
             }
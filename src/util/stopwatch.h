@@ -91,6 +91,16 @@ struct scoped_watch {
     }
 };
 
+struct scoped_watch_if {
+    stopwatch *m_sw;
+    scoped_watch_if(stopwatch &sw, bool enable): m_sw(enable ? &sw : nullptr) {
+        if (m_sw) m_sw->start();
+    }
+    ~scoped_watch_if() {
+        if (m_sw) m_sw->stop();
+    }
+};
+
 inline std::ostream& operator<<(std::ostream& out, stopwatch const& sw) {
     return out << " :time " << std::fixed << std::setprecision(2) << sw.get_seconds();
 }
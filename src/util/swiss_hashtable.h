@@ -0,0 +1,597 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    swiss_hashtable.h
+
+Abstract:
+
+    Open addressing hashtable with a separate array of one byte control
+    tags (a "Swiss table").
+
+    The table has the same interface as core_hashtable and uses the same
+    entry classes, so it can be selected per instantiation of obj_map,
+    obj_hashtable and map, e.g.,
+
+        obj_map<expr, unsigned, swiss_hashtable> m;
+
+    Each slot has a control byte that is either EMPTY, DELETED, or holds
+    7 bits of the hash code of the element stored in the slot. Lookups
+    compare the tag against a group of control bytes at once (16 with
+    SSE2, 8 otherwise) and only touch the entries whose tag matches, so
+    misses and collisions rarely load an entry.
+
+    The iteration order differs from core_hashtable.
+
+--*/
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include "util/hashtable.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SWISS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#define SWISS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace swiss {
+
+    const uint8_t EMPTY   = 0x80;
+    const uint8_t DELETED = 0xFE;
+
+#ifdef SWISS_SSE2
+    const unsigned GROUP_WIDTH = 16;
+    const unsigned MASK_SHIFT  = 0;   // bit i of a mask corresponds to slot i
+#else
+    const unsigned GROUP_WIDTH = 8;
+    const unsigned MASK_SHIFT  = 3;   // bit 8*i+7 of a mask corresponds to slot i
+#endif
+
+    inline unsigned ctz(uint64_t v) {
+        SASSERT(v != 0);
+#ifdef __GNUC__
+        return __builtin_ctzll(v);
+#else
+        unsigned r = 0;
+        for (; (v & 1) == 0; v >>= 1)
+            ++r;
+        return r;
+#endif
+    }
+
+    inline unsigned clz(uint64_t v) {
+        SASSERT(v != 0);
+#ifdef __GNUC__
+        return __builtin_clzll(v);
+#else
+        unsigned r = 0;
+        for (; (v & (1ull << 63)) == 0; v <<= 1)
+            ++r;
+        return r;
+#endif
+    }
+
+    /**
+       \brief Set of slots of a group that satisfy some condition.
+    */
+    class mask {
+        uint64_t m_bits;
+    public:
+        explicit mask(uint64_t bits): m_bits(bits) {}
+        explicit operator bool() const { return m_bits != 0; }
+        unsigned lowest() const { return ctz(m_bits) >> MASK_SHIFT; }
+        void clear_lowest() { m_bits &= m_bits - 1; }
+        unsigned trailing_zeros() const { return lowest(); }
+        unsigned leading_zeros() const { return (clz(m_bits) - (64 - (GROUP_WIDTH << MASK_SHIFT))) >> MASK_SHIFT; }
+    };
+
+    /**
+       \brief GROUP_WIDTH consecutive control bytes.
+    */
+    class group {
+#ifdef SWISS_SSE2
+        __m128i m_ctrl;
+    public:
+        explicit group(uint8_t const * ctrl): m_ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ctrl))) {}
+        mask match(uint8_t tag) const {
+            return mask(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), m_ctrl))));
+        }
+        mask match_empty() const { return match(EMPTY); }
+        mask match_empty_or_deleted() const { return mask(static_cast<unsigned>(_mm_movemask_epi8(m_ctrl))); }
+#else
+        static const uint64_t LSBS = 0x0101010101010101ull;
+        static const uint64_t MSBS = 0x8080808080808080ull;
+        uint64_t m_ctrl;
+#ifdef SWISS_NEON
+        uint8x8_t m_vctrl;
+#endif
+    public:
+        explicit group(uint8_t const * ctrl): m_ctrl(0) {
+            // little endian view of the control bytes: slot i is byte i
+            for (unsigned i = 0; i < GROUP_WIDTH; ++i)
+                m_ctrl |= static_cast<uint64_t>(ctrl[i]) << (8 * i);
+#ifdef SWISS_NEON
+            m_vctrl = vcreate_u8(m_ctrl);
+#endif
+        }
+        mask match(uint8_t tag) const {
+#ifdef SWISS_NEON
+            return mask(vget_lane_u64(vreinterpret_u64_u8(vceq_u8(m_vctrl, vdup_n_u8(tag))), 0) & MSBS);
+#else
+            // may report a full slot with a different tag, but never an empty or deleted slot
+            uint64_t x = m_ctrl ^ (LSBS * tag);
+            return mask((x - LSBS) & ~x & MSBS);
+#endif
+        }
+        mask match_empty() const { return mask(m_ctrl & ~(m_ctrl << 6) & MSBS); }
+        mask match_empty_or_deleted() const { return mask(m_ctrl & MSBS); }
+#endif
+    };
+
+    inline uint8_t tag(unsigned hash) {
+        // the slot is selected by the low bits of the hash code, so the tag is
+        // taken from the high bits of a multiplicative mix.
+        return static_cast<uint8_t>((hash * 0x9E3779B1u) >> 25);
+    }
+
+    inline bool is_full(uint8_t c) { return (c & 0x80) == 0; }
+}
+
+template<typename Entry, typename HashProc, typename EqProc>
+class swiss_hashtable : private HashProc, private EqProc {
+public:
+    typedef typename Entry::data data;
+    typedef Entry                entry;
+protected:
+    uint8_t * m_ctrl;       // m_capacity + GROUP_WIDTH tags, the last GROUP_WIDTH mirror the first ones
+    Entry *   m_table;
+    unsigned  m_capacity;
+    unsigned  m_size;
+    unsigned  m_num_deleted;
+#ifdef HASHTABLE_STATISTICS
+    unsigned long long m_st_collision;
+#endif
+
+    unsigned get_hash(data const & e) const { return HashProc::operator()(e); }
+    bool equals(data const & e1, data const & e2) const { return EqProc::operator()(e1, e2); }
+
+    static unsigned normalize_capacity(unsigned c) {
+        SASSERT(is_power_of_two(c));
+        return c < swiss::GROUP_WIDTH ? swiss::GROUP_WIDTH : c;
+    }
+
+    void alloc_table(unsigned capacity) {
+        m_capacity = capacity;
+        m_table    = alloc_vect<Entry>(capacity);
+        m_ctrl     = static_cast<uint8_t*>(memory::allocate(capacity + swiss::GROUP_WIDTH));
+        memset(m_ctrl, swiss::EMPTY, capacity + swiss::GROUP_WIDTH);
+    }
+
+    void delete_table() {
+        if (m_table) {
+            dealloc_vect(m_table, m_capacity);
+            memory::deallocate(m_ctrl);
+        }
+        m_table = nullptr;
+        m_ctrl  = nullptr;
+    }
+
+    void set_ctrl(unsigned i, uint8_t c) {
+        m_ctrl[i] = c;
+        if (i < swiss::GROUP_WIDTH)
+            m_ctrl[m_capacity + i] = c;
+    }
+
+    /**
+       \brief Return the first empty or deleted slot on the probe sequence of hash.
+    */
+    unsigned find_free_slot(unsigned hash) const {
+        unsigned mask = m_capacity - 1;
+        unsigned pos  = hash & mask;
+        for (unsigned step = swiss::GROUP_WIDTH; ; step += swiss::GROUP_WIDTH) {
+            swiss::mask m = swiss::group(m_ctrl + pos).match_empty_or_deleted();
+            if (m)
+                return (pos + m.lowest()) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    void rehash(unsigned new_capacity) {
+        Entry *   old_table    = m_table;
+        uint8_t * old_ctrl     = m_ctrl;
+        unsigned  old_capacity = m_capacity;
+        alloc_table(new_capacity);
+        for (unsigned i = 0; i < old_capacity; ++i) {
+            if (!swiss::is_full(old_ctrl[i]))
+                continue;
+            unsigned hash = old_table[i].get_hash();
+            unsigned j    = find_free_slot(hash);
+            m_table[j] = std::move(old_table[i]);
+            set_ctrl(j, swiss::tag(hash));
+        }
+        dealloc_vect(old_table, old_capacity);
+        memory::deallocate(old_ctrl);
+        m_num_deleted = 0;
+    }
+
+    void reserve_slot() {
+        if ((m_size + m_num_deleted + 1) * 8 <= m_capacity * 7)
+            return;
+        // reclaim the deleted slots if that frees a large part of the table
+        if (m_size * 2 <= m_capacity && !memory::is_out_of_memory())
+            rehash(m_capacity);
+        else
+            rehash(m_capacity << 1);
+    }
+
+    /**
+       \brief Return true if e is stored in slot idx. Otherwise, store in idx the
+       slot where e should be inserted.
+    */
+    bool find_or_prepare(data const & e, unsigned hash, unsigned & idx) {
+        unsigned mask  = m_capacity - 1;
+        unsigned pos   = hash & mask;
+        uint8_t  t     = swiss::tag(hash);
+        unsigned avail = UINT_MAX;
+        for (unsigned step = swiss::GROUP_WIDTH; ; step += swiss::GROUP_WIDTH) {
+            swiss::group g(m_ctrl + pos);
+            for (swiss::mask m = g.match(t); m; m.clear_lowest()) {
+                unsigned i = (pos + m.lowest()) & mask;
+                if (equals(m_table[i].get_data(), e)) {
+                    idx = i;
+                    return true;
+                }
+                HS_CODE(m_st_collision++;);
+            }
+            if (avail == UINT_MAX) {
+                swiss::mask m = g.match_empty_or_deleted();
+                if (m)
+                    avail = (pos + m.lowest()) & mask;
+            }
+            if (g.match_empty()) {
+                idx = avail;
+                return false;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    void fill_slot(unsigned idx, unsigned hash, data && e) {
+        if (m_ctrl[idx] == swiss::DELETED)
+            m_num_deleted--;
+        m_table[idx].set_data(std::move(e));
+        m_table[idx].set_hash(hash);
+        set_ctrl(idx, swiss::tag(hash));
+        m_size++;
+    }
+
+    void copy_from(swiss_hashtable const & source) {
+        alloc_table(source.m_capacity);
+        memcpy(m_ctrl, source.m_ctrl, m_capacity + swiss::GROUP_WIDTH);
+        for (unsigned i = 0; i < m_capacity; ++i)
+            if (swiss::is_full(m_ctrl[i]))
+                m_table[i] = source.m_table[i];
+        m_size        = source.m_size;
+        m_num_deleted = source.m_num_deleted;
+    }
+
+public:
+    swiss_hashtable(unsigned initial_capacity = DEFAULT_HASHTABLE_INITIAL_CAPACITY,
+                    HashProc const & h = HashProc(),
+                    EqProc const & e = EqProc()):
+        HashProc(h),
+        EqProc(e) {
+        alloc_table(normalize_capacity(initial_capacity));
+        m_size        = 0;
+        m_num_deleted = 0;
+        HS_CODE({
+            m_st_collision = 0;
+        });
+    }
+
+    swiss_hashtable(swiss_hashtable const & source):
+        HashProc(source),
+        EqProc(source) {
+        copy_from(source);
+        HS_CODE({
+            m_st_collision = 0;
+        });
+    }
+
+    swiss_hashtable(swiss_hashtable && source) noexcept :
+        HashProc(source),
+        EqProc(source),
+        m_ctrl(nullptr),
+        m_table(nullptr),
+        m_capacity(source.m_capacity),
+        m_size(source.m_size),
+        m_num_deleted(source.m_num_deleted) {
+        std::swap(m_ctrl, source.m_ctrl);
+        std::swap(m_table, source.m_table);
+        HS_CODE({
+            m_st_collision = source.m_st_collision;
+        });
+    }
+
+    ~swiss_hashtable() {
+        delete_table();
+    }
+
+    void swap(swiss_hashtable & source) noexcept {
+        std::swap(m_ctrl,        source.m_ctrl);
+        std::swap(m_table,       source.m_table);
+        std::swap(m_capacity,    source.m_capacity);
+        std::swap(m_size,        source.m_size);
+        std::swap(m_num_deleted, source.m_num_deleted);
+        HS_CODE({
+            std::swap(m_st_collision, source.m_st_collision);
+        });
+    }
+
+    void reset() {
+        if (m_size == 0 && m_num_deleted == 0)
+            return;
+        for (unsigned i = 0; i < m_capacity; ++i)
+            if (swiss::is_full(m_ctrl[i]))
+                m_table[i].mark_as_free();
+        // shrink tables that are mostly empty, as core_hashtable does
+        if (m_capacity > 16 && ((m_capacity - m_size - m_num_deleted) << 2) > m_capacity * 3) {
+            unsigned capacity = m_capacity >> 1;
+            delete_table();
+            alloc_table(capacity);
+        }
+        else {
+            memset(m_ctrl, swiss::EMPTY, m_capacity + swiss::GROUP_WIDTH);
+        }
+        m_size        = 0;
+        m_num_deleted = 0;
+    }
+
+    void finalize() {
+        if (m_capacity > SMALL_TABLE_CAPACITY) {
+            delete_table();
+            alloc_table(SMALL_TABLE_CAPACITY);
+            m_size        = 0;
+            m_num_deleted = 0;
+        }
+        else {
+            reset();
+        }
+    }
+
+    class iterator {
+        uint8_t const * m_ctrl;
+        entry *         m_curr;
+        entry *         m_end;
+        void move_to_used() {
+            while (m_curr != m_end && !swiss::is_full(*m_ctrl)) {
+                ++m_curr;
+                ++m_ctrl;
+            }
+        }
+    public:
+        iterator(uint8_t const * ctrl, entry * start, entry * end): m_ctrl(ctrl), m_curr(start), m_end(end) { move_to_used(); }
+        data & operator*() { return m_curr->get_data(); }
+        data const & operator*() const { return m_curr->get_data(); }
+        data const * operator->() const { return &(operator*()); }
+        data * operator->() { return &(operator*()); }
+        iterator & operator++() { ++m_curr; ++m_ctrl; move_to_used(); return *this; }
+        iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+        bool operator==(iterator const & it) const { return m_curr == it.m_curr; }
+        bool operator!=(iterator const & it) const { return m_curr != it.m_curr; }
+    };
+
+    bool empty() const { return m_size == 0; }
+
+    unsigned size() const { return m_size; }
+
+    unsigned capacity() const { return m_capacity; }
+
+    iterator begin() const { return iterator(m_ctrl, m_table, m_table + m_capacity); }
+
+    iterator end() const { return iterator(m_ctrl + m_capacity, m_table + m_capacity, m_table + m_capacity); }
+
+    void insert(data && e) {
+        reserve_slot();
+        unsigned hash = get_hash(e);
+        unsigned idx;
+        if (find_or_prepare(e, hash, idx))
+            m_table[idx].set_data(std::move(e));
+        else
+            fill_slot(idx, hash, std::move(e));
+    }
+
+    void insert(const data & e) {
+        data tmp(e);
+        insert(std::move(tmp));
+    }
+
+    /**
+       \brief Insert the element e if it is not in the table.
+       Return true if it is a new element, and false otherwise.
+       Store the entry/slot of the table in et.
+    */
+    bool insert_if_not_there_core(data && e, entry * & et) {
+        reserve_slot();
+        unsigned hash = get_hash(e);
+        unsigned idx;
+        bool found = find_or_prepare(e, hash, idx);
+        if (!found)
+            fill_slot(idx, hash, std::move(e));
+        et = m_table + idx;
+        return !found;
+    }
+
+    bool insert_if_not_there_core(const data & e, entry * & et) {
+        data temp(e);
+        return insert_if_not_there_core(std::move(temp), et);
+    }
+
+    data const & insert_if_not_there(data const & e) {
+        entry * et;
+        insert_if_not_there_core(e, et);
+        return et->get_data();
+    }
+
+    entry * insert_if_not_there2(data const & e) {
+        entry * et;
+        insert_if_not_there_core(e, et);
+        return et;
+    }
+
+    entry * find_core(data const & e) const {
+        unsigned hash = get_hash(e);
+        unsigned mask = m_capacity - 1;
+        unsigned pos  = hash & mask;
+        uint8_t  t    = swiss::tag(hash);
+        for (unsigned step = swiss::GROUP_WIDTH; ; step += swiss::GROUP_WIDTH) {
+            swiss::group g(m_ctrl + pos);
+            for (swiss::mask m = g.match(t); m; m.clear_lowest()) {
+                unsigned i = (pos + m.lowest()) & mask;
+                if (equals(m_table[i].get_data(), e))
+                    return m_table + i;
+                HS_CODE(const_cast<swiss_hashtable*>(this)->m_st_collision++;);
+            }
+            if (g.match_empty())
+                return nullptr;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    bool find(data const & k, data & r) const {
+        entry * e = find_core(k);
+        if (e != nullptr) {
+            r = e->get_data();
+            return true;
+        }
+        return false;
+    }
+
+    bool contains(data const & e) const {
+        return find_core(e) != nullptr;
+    }
+
+    iterator find(data const & e) const {
+        entry * r = find_core(e);
+        if (r)
+            return iterator(m_ctrl + (r - m_table), r, m_table + m_capacity);
+        else
+            return end();
+    }
+
+    void remove(data const & e) {
+        entry * r = find_core(e);
+        if (!r)
+            return;
+        unsigned mask = m_capacity - 1;
+        unsigned idx  = static_cast<unsigned>(r - m_table);
+        r->mark_as_free();
+        m_size--;
+        // The slot can become empty again if no probe window that contains it
+        // was ever full, because then no lookup has skipped over it.
+        swiss::mask empty_after  = swiss::group(m_ctrl + idx).match_empty();
+        swiss::mask empty_before = swiss::group(m_ctrl + ((idx - swiss::GROUP_WIDTH) & mask)).match_empty();
+        if (empty_after && empty_before &&
+            empty_after.trailing_zeros() + empty_before.leading_zeros() < swiss::GROUP_WIDTH) {
+            set_ctrl(idx, swiss::EMPTY);
+        }
+        else {
+            set_ctrl(idx, swiss::DELETED);
+            m_num_deleted++;
+        }
+    }
+
+    void erase(data const & e) { remove(e); }
+
+    void dump(std::ostream & out) {
+        out << "[";
+        bool first = true;
+        for (data const & d : *this) {
+            if (first)
+                first = false;
+            else
+                out << " ";
+            out << d;
+        }
+        out << "]";
+    }
+
+    swiss_hashtable& operator|=(swiss_hashtable const& other) {
+        if (this == &other) return *this;
+        for (const data& d : other) {
+            insert(d);
+        }
+        return *this;
+    }
+
+    swiss_hashtable& operator&=(swiss_hashtable const& other) {
+        if (this == &other) return *this;
+        swiss_hashtable copy(*this);
+        for (const data& d : copy) {
+            if (!other.contains(d)) {
+                remove(d);
+            }
+        }
+        return *this;
+    }
+
+    swiss_hashtable& operator=(swiss_hashtable const& other) {
+        if (this == &other) return *this;
+        reset();
+        for (const data& d : other) {
+            insert(d);
+        }
+        return *this;
+    }
+
+#ifdef Z3DEBUG
+    bool check_invariant() {
+        unsigned num_deleted = 0;
+        unsigned num_used    = 0;
+        for (unsigned i = 0; i < m_capacity; ++i) {
+            if (m_ctrl[i] == swiss::DELETED)
+                num_deleted++;
+            if (swiss::is_full(m_ctrl[i])) {
+                num_used++;
+                SASSERT(m_ctrl[i] == swiss::tag(m_table[i].get_hash()));
+            }
+        }
+        for (unsigned i = 0; i < swiss::GROUP_WIDTH; ++i)
+            SASSERT(m_ctrl[m_capacity + i] == m_ctrl[i]);
+        SASSERT(num_deleted == m_num_deleted);
+        SASSERT(num_used == m_size);
+        return true;
+    }
+#endif
+
+#ifdef HASHTABLE_STATISTICS
+    unsigned long long get_num_collision() const { return m_st_collision; }
+#else
+    unsigned long long get_num_collision() const { return 0; }
+#endif
+
+    void get_collisions(data const& e, vector<data>& collisions) {
+        unsigned hash = get_hash(e);
+        unsigned mask = m_capacity - 1;
+        unsigned pos  = hash & mask;
+        for (unsigned step = swiss::GROUP_WIDTH; step <= m_capacity; step += swiss::GROUP_WIDTH) {
+            swiss::group g(m_ctrl + pos);
+            for (unsigned i = 0; i < swiss::GROUP_WIDTH; ++i) {
+                unsigned j = (pos + i) & mask;
+                if (!swiss::is_full(m_ctrl[j]))
+                    continue;
+                if (equals(m_table[j].get_data(), e))
+                    return;
+                collisions.push_back(m_table[j].get_data());
+            }
+            if (g.match_empty())
+                return;
+            pos = (pos + step) & mask;
+        }
+    }
+};
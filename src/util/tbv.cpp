@@ -203,8 +203,28 @@ tbv& tbv_manager::set_or(tbv& dst,  tbv const& src) const {
     return dst;
 }
 bool tbv_manager::set_and(tbv& dst,  tbv const& src) const {
-    m.set_and(dst, src); 
-    return is_well_formed(dst);
+    return set_and(dst, dst, src);
+}
+
+/**
+   \brief dst := a & b, return true if dst is well formed.
+   Combines the conjunction with the well-formedness check in one pass over the words.
+*/
+bool tbv_manager::set_and(tbv& dst, tbv const& a, tbv const& b) const {
+    unsigned nw = m.num_words();
+    if (nw == 0)
+        return true;
+    unsigned ok = 0xFFFFFFFF;
+    for (unsigned i = 0; i + 1 < nw; ++i) {
+        unsigned w = a.m_data[i] & b.m_data[i];
+        dst.m_data[i] = w;
+        ok &= w | (w << 1) | 0x55555555;
+    }
+    unsigned w = a.m_data[nw - 1] & b.m_data[nw - 1];
+    dst.m_data[nw - 1] = w;
+    w &= m.get_mask();
+    ok &= w | (w << 1) | 0x55555555 | ~m.get_mask();
+    return ok == 0xFFFFFFFF;
 }
 
 bool tbv_manager::is_well_formed(tbv const& dst) const {
@@ -265,8 +285,7 @@ bool tbv_manager::contains(tbv const& a, unsigned_vector const& colsa,
 }
 
 bool tbv_manager::intersect(tbv const& a, tbv const& b, tbv& result) {
-    copy(result, a);
-    return set_and(result, b);
+    return set_and(result, a, b);
 }
 
 std::ostream& tbv_manager::display(std::ostream& out, tbv const& b, unsigned hi, unsigned lo) const {
@@ -41,6 +41,7 @@ class tbv_manager {
     friend class tbv;
     fixed_bit_vector_manager m;
     ptr_vector<tbv> allocated_tbvs;
+    bool set_and(tbv& dst, tbv const& a, tbv const& b) const;
 public:
     tbv_manager(unsigned n): m(2*n) {}
     tbv_manager(tbv_manager const& m) = delete;
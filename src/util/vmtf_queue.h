@@ -0,0 +1,155 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    vmtf_queue.h
+
+Abstract:
+
+    Variable move-to-front decision queue.
+
+    Variables are kept in a doubly linked list ordered by the time
+    they were last bumped. Bumping moves a variable to the front
+    of the list and stamps it with a new time, which takes
+    constant time. The search pointer marks the most recently
+    bumped variable that may be unassigned: all variables bumped
+    after it are assigned. Unassigning a variable moves the search
+    pointer forward if the variable has a more recent stamp.
+
+--*/
+#pragma once
+
+#include <algorithm>
+#include "util/vector.h"
+
+class vmtf_queue {
+    typedef unsigned var;
+    static const var null_var = UINT_MAX;
+
+    struct link {
+        var      m_prev     = null_var;
+        var      m_next     = null_var;
+        uint64_t m_stamp    = 0;
+        bool     m_in_queue = false;
+    };
+
+    svector<link> m_links;
+    var           m_first  = null_var;  // least recently bumped
+    var           m_last   = null_var;  // most recently bumped
+    var           m_search = null_var;
+    uint64_t      m_stamp  = 0;
+
+    void unlink(var v) {
+        link& l = m_links[v];
+        if (l.m_prev == null_var)
+            m_first = l.m_next;
+        else
+            m_links[l.m_prev].m_next = l.m_next;
+        if (l.m_next == null_var)
+            m_last = l.m_prev;
+        else
+            m_links[l.m_next].m_prev = l.m_prev;
+        l.m_prev = l.m_next = null_var;
+    }
+
+    void enqueue(var v) {
+        link& l = m_links[v];
+        l.m_prev = m_last;
+        l.m_next = null_var;
+        l.m_stamp = ++m_stamp;
+        if (m_last == null_var)
+            m_first = v;
+        else
+            m_links[m_last].m_next = v;
+        m_last = v;
+    }
+
+public:
+
+    void mk_var_eh(var v) {
+        if (v >= m_links.size())
+            m_links.resize(v + 1);
+        if (m_links[v].m_in_queue)
+            return;
+        m_links[v].m_in_queue = true;
+        enqueue(v);
+        m_search = v;
+    }
+
+    void del_var_eh(var v) {
+        if (!contains(v))
+            return;
+        if (m_search == v)
+            m_search = m_links[v].m_prev;
+        unlink(v);
+        m_links[v].m_in_queue = false;
+    }
+
+    void unassign_var_eh(var v) {
+        if (contains(v) && (m_search == null_var || m_links[v].m_stamp > m_links[m_search].m_stamp))
+            m_search = v;
+    }
+
+    /**
+       \brief Move v to the front of the queue. is_free indicates whether v is currently unassigned.
+    */
+    void bump(var v, bool is_free) {
+        if (!contains(v))
+            return;
+        if (v != m_last) {
+            unlink(v);
+            enqueue(v);
+        }
+        if (is_free)
+            m_search = v;
+    }
+
+    /**
+       \brief Bump the variables in vars preserving their relative order in the queue.
+    */
+    template<typename IsFree>
+    void bump(svector<var>& vars, IsFree const& is_free) {
+        std::sort(vars.begin(), vars.end(), [&](var a, var b) { return m_links[a].m_stamp < m_links[b].m_stamp; });
+        for (var v : vars)
+            bump(v, is_free(v));
+    }
+
+    /**
+       \brief Return the most recently bumped free variable, or UINT_MAX if there is none.
+       The variable is not removed from the queue.
+    */
+    template<typename IsFree>
+    var next_var(IsFree const& is_free) {
+        var v = m_search;
+        while (v != null_var && !is_free(v))
+            v = m_links[v].m_prev;
+        m_search = v;
+        return v;
+    }
+
+    bool contains(var v) const { return v < m_links.size() && m_links[v].m_in_queue; }
+
+    bool more_active(var v1, var v2) const { return m_links[v1].m_stamp > m_links[v2].m_stamp; }
+
+    void reset() {
+        m_links.reset();
+        m_first = m_last = m_search = null_var;
+        m_stamp = 0;
+    }
+
+    std::ostream& display(std::ostream& out) const {
+        for (var v = m_last; v != null_var; v = m_links[v].m_prev) {
+            out << v;
+            if (v == m_search)
+                out << "*";
+            if (m_links[v].m_prev != null_var)
+                out << " ";
+        }
+        return out;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& out, vmtf_queue const& queue) {
+    return queue.display(out);
+}
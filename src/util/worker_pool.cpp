@@ -0,0 +1,116 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    worker_pool.cpp
+
+Abstract:
+
+    Process wide pool of long lived worker threads.
+
+--*/
+
+#include "util/worker_pool.h"
+
+#ifdef SINGLE_THREAD
+
+void worker_pool::run(unsigned n, std::function<void(void)> const& f) {
+    for (unsigned i = 0; i < n; ++i)
+        f();
+}
+
+void worker_pool::submit(std::function<void(void)> f) {
+    f();
+}
+
+void worker_pool::finalize() {
+}
+
+#else
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static std::mutex                          g_mutex;
+static std::condition_variable             g_cond;
+static std::deque<std::function<void(void)>> g_tasks;
+static std::vector<std::thread>            g_threads;
+static unsigned                            g_num_idle = 0;
+static bool                                g_exiting = false;
+
+static void worker_func() {
+    std::unique_lock<std::mutex> lock(g_mutex);
+    while (true) {
+        g_cond.wait(lock, [] { return g_exiting || !g_tasks.empty(); });
+        if (g_tasks.empty())
+            return;
+        std::function<void(void)> task = std::move(g_tasks.front());
+        g_tasks.pop_front();
+        --g_num_idle;
+        lock.unlock();
+        task();
+        lock.lock();
+        ++g_num_idle;
+    }
+}
+
+void worker_pool::run(unsigned n, std::function<void(void)> const& f) {
+    if (n == 0)
+        return;
+    std::mutex              done_mutex;
+    std::condition_variable done_cond;
+    unsigned                pending = n;
+    auto task = [&]() {
+        f();
+        // notify while holding the lock: run returns and destroys the state once pending is 0.
+        std::lock_guard<std::mutex> lock(done_mutex);
+        --pending;
+        done_cond.notify_all();
+    };
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        for (unsigned i = 0; i < n; ++i)
+            g_tasks.push_back(task);
+        // workers count as idle until they pick up a task.
+        while (g_num_idle < g_tasks.size()) {
+            ++g_num_idle;
+            g_threads.push_back(std::thread(worker_func));
+        }
+    }
+    g_cond.notify_all();
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cond.wait(lock, [&] { return pending == 0; });
+}
+
+void worker_pool::submit(std::function<void(void)> f) {
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_tasks.push_back(std::move(f));
+        while (g_num_idle < g_tasks.size()) {
+            ++g_num_idle;
+            g_threads.push_back(std::thread(worker_func));
+        }
+    }
+    g_cond.notify_one();
+}
+
+void worker_pool::finalize() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_exiting = true;
+        std::swap(threads, g_threads);
+    }
+    g_cond.notify_all();
+    for (std::thread& t : threads)
+        t.join();
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_num_idle = 0;
+    g_exiting = false;
+}
+
+#endif
@@ -0,0 +1,32 @@
+/*++
+Copyright (c) 2026 Microsoft Corporation
+
+Module Name:
+
+    worker_pool.h
+
+Abstract:
+
+    Process wide pool of long lived worker threads.
+
+    run(n, f) executes f on n workers and waits until all of them return.
+    submit(f) executes f on one worker and returns immediately.
+    Idle workers are reused across calls, and the pool grows when more
+    workers are requested than are idle. Calls from different threads can
+    run concurrently. f must not throw.
+
+--*/
+#pragma once
+
+#include <functional>
+
+class worker_pool {
+public:
+    static void run(unsigned n, std::function<void(void)> const& f);
+    static void submit(std::function<void(void)> f);
+    static void finalize();
+};
+
+/*
+    ADD_FINALIZER('worker_pool::finalize();')
+*/